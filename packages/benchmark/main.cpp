@@ -0,0 +1,27 @@
+#include <tomurcuk/ArrayListBenchmark.hpp>
+#include <tomurcuk/BTreeMapBenchmark.hpp>
+#include <tomurcuk/BytesBenchmark.hpp>
+#include <tomurcuk/CodecBenchmark.hpp>
+#include <tomurcuk/HeapBenchmark.hpp>
+#include <tomurcuk/IndexBenchmark.hpp>
+#include <tomurcuk/PackedIntArrayBenchmark.hpp>
+#include <tomurcuk/RoaringBitmapBenchmark.hpp>
+#include <tomurcuk/RopeBenchmark.hpp>
+#include <tomurcuk/SortBenchmark.hpp>
+#include <tomurcuk/StringInternerBenchmark.hpp>
+#include <tomurcuk/TextBenchmark.hpp>
+
+auto main() -> int {
+    tomurcuk::BytesBenchmark::suite();
+    tomurcuk::ArrayListBenchmark::suite();
+    tomurcuk::SortBenchmark::suite();
+    tomurcuk::HeapBenchmark::suite();
+    tomurcuk::BTreeMapBenchmark::suite();
+    tomurcuk::IndexBenchmark::suite();
+    tomurcuk::PackedIntArrayBenchmark::suite();
+    tomurcuk::CodecBenchmark::suite();
+    tomurcuk::RoaringBitmapBenchmark::suite();
+    tomurcuk::StringInternerBenchmark::suite();
+    tomurcuk::RopeBenchmark::suite();
+    tomurcuk::TextBenchmark::suite();
+}
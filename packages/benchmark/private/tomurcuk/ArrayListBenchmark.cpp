@@ -0,0 +1,109 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListBenchmark.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/InlineArrayList.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::ArrayListBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    benchmarkArrayLists(memoryAllocator);
+    linearMemoryAllocator.deallocateAll();
+    benchmarkInlineArrayLists(memoryAllocator);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::ArrayListBenchmark::getListCount(int64_t index) -> int64_t {
+    // Mostly below the inline count, with every 16th list going over it.
+    auto hash = (uint64_t)index * UINT64_C(0x9E37'79B9'7F4A'7C15);
+    if ((hash >> 60U) == 0) {
+        return kInlineCount * 4;
+    }
+    return (int64_t)((hash >> 32U) % (uint64_t)kInlineCount);
+}
+
+auto tomurcuk::ArrayListBenchmark::benchmarkArrayLists(MemoryAllocator memoryAllocator) -> void {
+    auto listsResult = memoryAllocator.allocate(kListCount * (int64_t)sizeof(ArrayList<int64_t>), alignof(ArrayList<int64_t>));
+    if (listsResult.isFailure()) {
+        Crashes::crash("Could not allocate the lists for the benchmarks!");
+    }
+    auto lists = (ArrayList<int64_t> *)*listsResult.value();
+
+    auto elementCount = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kListCount; i++) {
+        lists[i].initialize();
+        auto count = getListCount(i);
+        for (auto j = INT64_C(0); j != count; j++) {
+            if (!lists[i].add(memoryAllocator, j)) {
+                Crashes::crash("Could not add to the lists for the benchmarks!");
+            }
+        }
+        elementCount += count;
+    }
+    Benchmarks::reportRate("ArrayList::add", elementCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    auto sum = INT64_C(0);
+    for (auto i = INT64_C(0); i != kListCount; i++) {
+        auto view = lists[i].getView();
+        for (auto j = INT64_C(0); j != view.getCount(); j++) {
+            sum += *view.get(j);
+        }
+    }
+    Benchmarks::reportRate("ArrayList::getView", elementCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+
+    for (auto i = INT64_C(0); i != kListCount; i++) {
+        lists[i].destroy(memoryAllocator);
+    }
+}
+
+auto tomurcuk::ArrayListBenchmark::benchmarkInlineArrayLists(MemoryAllocator memoryAllocator) -> void {
+    auto listsResult = memoryAllocator.allocate(kListCount * (int64_t)sizeof(InlineArrayList<int64_t, kInlineCount>), alignof(InlineArrayList<int64_t, kInlineCount>));
+    if (listsResult.isFailure()) {
+        Crashes::crash("Could not allocate the lists for the benchmarks!");
+    }
+    auto lists = (InlineArrayList<int64_t, kInlineCount> *)*listsResult.value();
+
+    auto elementCount = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kListCount; i++) {
+        lists[i].initialize();
+        auto count = getListCount(i);
+        for (auto j = INT64_C(0); j != count; j++) {
+            if (lists[i].add(memoryAllocator, j) == Status::eFailure) {
+                Crashes::crash("Could not add to the lists for the benchmarks!");
+            }
+        }
+        elementCount += count;
+    }
+    Benchmarks::reportRate("InlineArrayList::add", elementCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    auto sum = INT64_C(0);
+    for (auto i = INT64_C(0); i != kListCount; i++) {
+        auto view = lists[i].getView();
+        for (auto j = INT64_C(0); j != view.getCount(); j++) {
+            sum += *view.get(j);
+        }
+    }
+    Benchmarks::reportRate("InlineArrayList::getView", elementCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+
+    for (auto i = INT64_C(0); i != kListCount; i++) {
+        lists[i].destroy(memoryAllocator);
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class ArrayListBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of lists in the workload.
+         */
+        static constexpr auto kListCount = INT64_C(1) << 20U;
+
+        /**
+         * The amount of elements an inline list holds without allocating,
+         * which most lists in the workload fit into.
+         */
+        static constexpr auto kInlineCount = INT64_C(8);
+
+        /**
+         * Provides the amount of elements a list in the workload holds.
+         *
+         * @param[in] index The index of the list.
+         * @return The amount of elements the list holds.
+         */
+        static auto getListCount(int64_t index) -> int64_t;
+
+        static auto benchmarkArrayLists(MemoryAllocator memoryAllocator) -> void;
+        static auto benchmarkInlineArrayLists(MemoryAllocator memoryAllocator) -> void;
+    };
+}
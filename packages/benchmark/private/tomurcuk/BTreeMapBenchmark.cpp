@@ -0,0 +1,97 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BTreeMap.hpp>
+#include <tomurcuk/BTreeMapBenchmark.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::BTreeMapBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    benchmarkPutting(memoryAllocator);
+    linearMemoryAllocator.deallocateAll();
+    benchmarkLookingUp(memoryAllocator);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::BTreeMapBenchmark::getKey(int64_t index) -> uint64_t {
+    return (uint64_t)index * UINT64_C(0x9E37'79B9'7F4A'7C15);
+}
+
+auto tomurcuk::BTreeMapBenchmark::benchmarkPutting(MemoryAllocator memoryAllocator) -> void {
+    BTreeMap<uint64_t, uint64_t> map;
+    map.initialize();
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        if (map.put(memoryAllocator, getKey(i), (uint64_t)i) == Status::eFailure) {
+            Crashes::crash("Could not put into the map for the benchmarks!");
+        }
+    }
+    Benchmarks::reportRate((char *)"BTreeMap::put", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    map.destroy(memoryAllocator);
+}
+
+auto tomurcuk::BTreeMapBenchmark::benchmarkLookingUp(MemoryAllocator memoryAllocator) -> void {
+    // Every other key is loaded, so that half of the lookups miss.
+    auto keysResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    auto valuesResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    if (keysResult.isFailure() || valuesResult.isFailure()) {
+        Crashes::crash("Could not allocate the entries for the benchmarks!");
+    }
+    auto keyArray = (uint64_t *)*keysResult.value();
+    auto valueArray = (uint64_t *)*valuesResult.value();
+    auto step = UINT64_MAX / (uint64_t)kCount;
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        keyArray[i] = (uint64_t)i * step;
+        valueArray[i] = (uint64_t)i;
+    }
+    ArrayListView<uint64_t> keys;
+    keys.initialize(keyArray, kCount);
+    ArrayListView<uint64_t> values;
+    values.initialize(valueArray, kCount);
+
+    BTreeMap<uint64_t, uint64_t> map;
+    map.initialize();
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    if (map.bulkLoad(memoryAllocator, keys, values) == Status::eFailure) {
+        Crashes::crash("Could not load the map for the benchmarks!");
+    }
+    Benchmarks::reportRate((char *)"BTreeMap::bulkLoad", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    auto sum = UINT64_C(0);
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kLookupCount; i++) {
+        auto key = getKey(i) / step * step + (i % 2 == 0 ? 0 : 1);
+        auto value = map.get(key);
+        if (value != nullptr) {
+            sum += *value;
+        }
+    }
+    Benchmarks::reportRate((char *)"BTreeMap::get", kLookupCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kLookupCount; i++) {
+        auto cursor = map.findCeiling(getKey(i));
+        for (auto j = INT64_C(0); j != kScannedCount && cursor.isValid(); j++) {
+            sum += *cursor.getValue();
+            cursor.moveNext();
+        }
+    }
+    Benchmarks::reportRate((char *)"BTreeMap::findCeiling+scan", kLookupCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+
+    map.destroy(memoryAllocator);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class BTreeMapBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of entries in the maps.
+         */
+        static constexpr auto kCount = INT64_C(1) << 22U;
+
+        /**
+         * The amount of lookups in each workload.
+         */
+        static constexpr auto kLookupCount = INT64_C(1) << 22U;
+
+        /**
+         * The amount of entries every range scan visits.
+         */
+        static constexpr auto kScannedCount = INT64_C(16);
+
+        /**
+         * Provides a key that is spread over the whole range of keys.
+         *
+         * @param[in] index The index of the key.
+         * @return The key at the index.
+         */
+        static auto getKey(int64_t index) -> uint64_t;
+
+        static auto benchmarkPutting(MemoryAllocator memoryAllocator) -> void;
+        static auto benchmarkLookingUp(MemoryAllocator memoryAllocator) -> void;
+    };
+}
@@ -0,0 +1,30 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <tomurcuk/Benchmarks.hpp>
+
+auto tomurcuk::Benchmarks::getCurrentNanoseconds() -> int64_t {
+    auto time = timespec{};
+    (void)timespec_get(&time, TIME_UTC);
+    return ((int64_t)time.tv_sec * INT64_C(1'000'000'000)) + (int64_t)time.tv_nsec;
+}
+
+auto tomurcuk::Benchmarks::reportThroughput(char *name, int64_t size, int64_t nanoseconds) -> void {
+    if (nanoseconds == 0) {
+        nanoseconds = 1;
+    }
+    (void)printf("%-48s %10.3f GB/s\n", name, (double)size / (double)nanoseconds);
+}
+
+auto tomurcuk::Benchmarks::reportRate(char *name, int64_t count, int64_t nanoseconds) -> void {
+    if (nanoseconds == 0) {
+        nanoseconds = 1;
+    }
+    (void)printf("%-48s %10.3f M/s\n", name, (double)count * 1000.0 / (double)nanoseconds);
+}
+
+auto tomurcuk::Benchmarks::consume(int64_t value) -> void {
+    sSink = sSink + value;
+}
+
+thread_local int64_t volatile tomurcuk::Benchmarks::sSink;
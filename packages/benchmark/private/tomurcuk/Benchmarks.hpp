@@ -0,0 +1,54 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Utilities for timing and reporting the measured operations.
+     */
+    class Benchmarks {
+    public:
+        /**
+         * Reads a monotonic clock.
+         *
+         * @return The current time in nanoseconds, relative to an unspecified
+         * point.
+         */
+        static auto getCurrentNanoseconds() -> int64_t;
+
+        /**
+         * Prints the throughput of an operation.
+         *
+         * @param[in] name The name of the measured operation.
+         * @param[in] size The amount of bytes the operation processed.
+         * @param[in] nanoseconds The time the operation took.
+         */
+        static auto reportThroughput(char *name, int64_t size, int64_t nanoseconds) -> void;
+
+        /**
+         * Prints the rate of an operation.
+         *
+         * @param[in] name The name of the measured operation.
+         * @param[in] count The amount of items the operation processed.
+         * @param[in] nanoseconds The time the operation took.
+         */
+        static auto reportRate(char *name, int64_t count, int64_t nanoseconds) -> void;
+
+        /**
+         * Keeps a result alive, so that the computation of it is not optimized
+         * away.
+         *
+         * Might be called from any thread.
+         *
+         * @param[in] value The result of the measured operation.
+         */
+        static auto consume(int64_t value) -> void;
+
+    private:
+        /**
+         * Sum of the values consumed by the current thread, which keeps the
+         * benchmarks that run on several threads from racing on it.
+         */
+        static thread_local int64_t volatile sSink;
+    };
+}
@@ -0,0 +1,255 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <threads.h>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/BytesBenchmark.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+
+auto tomurcuk::BytesBenchmark::suite() -> void {
+    static constexpr auto kSize = INT64_C(64) << 20U;
+    static constexpr auto kNeighborSize = INT64_C(1) << 20U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kSize * 2 + kNeighborSize + 4096);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto block0Result = memoryAllocator.allocate(kSize, 64);
+    auto block1Result = memoryAllocator.allocate(kSize, 64);
+    auto neighborBlockResult = memoryAllocator.allocate(kNeighborSize, 64);
+    if (block0Result.isFailure() || block1Result.isFailure() || neighborBlockResult.isFailure()) {
+        Crashes::crash("Could not allocate the blocks for the benchmarks!");
+    }
+    auto block0 = (uint8_t *)*block0Result.value();
+    auto block1 = (uint8_t *)*block1Result.value();
+    auto neighborBlock = (uint8_t *)*neighborBlockResult.value();
+
+    // Lowercase letters, so that the searched punctuation is only found where
+    // it is placed.
+    auto state = UINT32_C(1);
+    for (auto i = INT64_C(0); i != kSize; i++) {
+        state = state * UINT32_C(1'664'525) + UINT32_C(1'013'904'223);
+        block0[i] = (uint8_t)('a' + ((state >> 24U) % 26U));
+    }
+    Bytes::copyBlock(block1, block0, kSize);
+
+    benchmarkFindingBytes(block0, kSize);
+    benchmarkFindingAnyBytes(block0, kSize);
+    benchmarkCountingBytes(block0, kSize);
+    benchmarkFindingMismatches(block0, block1, kSize);
+    benchmarkCopyingBlocks(block0, block1, kSize);
+    benchmarkCachePollution(block0, block1, kSize, neighborBlock, kNeighborSize);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::BytesBenchmark::benchmarkFindingBytes(uint8_t *block, int64_t size) -> void {
+    static constexpr auto kRepetitions = 16;
+
+    auto first = block[0];
+    auto last = block[size - 1];
+    block[size - 1] = ';';
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume(Bytes::findByte(block, size, ';'));
+    }
+    Benchmarks::reportThroughput("Bytes::findByte", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume((int64_t)memchr(block, ';', (size_t)size));
+    }
+    Benchmarks::reportThroughput("memchr", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    block[size - 1] = last;
+    block[0] = ';';
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume(Bytes::findLastByte(block, size, ';'));
+    }
+    Benchmarks::reportThroughput("Bytes::findLastByte", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    block[0] = first;
+}
+
+auto tomurcuk::BytesBenchmark::benchmarkFindingAnyBytes(uint8_t *block, int64_t size) -> void {
+    static constexpr auto kRepetitions = 16;
+
+    uint8_t needles[] = {' ', '\t', '\r', '\n', ',', ';', '(', ')', '{', '}', '[', ']', '"', '\'', '\\', 0};
+    auto secondToLast = block[size - 2];
+    auto last = block[size - 1];
+    block[size - 2] = ';';
+    block[size - 1] = 0;
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume(Bytes::findAnyByte(block, size, needles, sizeof(needles)));
+    }
+    Benchmarks::reportThroughput("Bytes::findAnyByte (16 needles)", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    // The terminating null byte is the 16th needle of the other search.
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume((int64_t)strcspn((char *)block, (char *)needles));
+    }
+    Benchmarks::reportThroughput("strcspn (16 needles)", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    block[size - 2] = secondToLast;
+    block[size - 1] = last;
+}
+
+auto tomurcuk::BytesBenchmark::benchmarkCountingBytes(uint8_t *block, int64_t size) -> void {
+    static constexpr auto kRepetitions = 16;
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume(Bytes::countByte(block, size, 'e'));
+    }
+    Benchmarks::reportThroughput("Bytes::countByte", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        auto count = INT64_C(0);
+        auto cursor = block;
+        auto end = block + size;
+        for (;;) {
+            cursor = (uint8_t *)memchr(cursor, 'e', (size_t)(end - cursor));
+            if (cursor == nullptr) {
+                break;
+            }
+            count++;
+            cursor++;
+        }
+        Benchmarks::consume(count);
+    }
+    Benchmarks::reportThroughput("memchr loop", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+}
+
+auto tomurcuk::BytesBenchmark::benchmarkFindingMismatches(uint8_t *block0, uint8_t *block1, int64_t size) -> void {
+    static constexpr auto kRepetitions = 16;
+
+    block1[size - 1] = ';';
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume(Bytes::findMismatch(block0, block1, size));
+    }
+    Benchmarks::reportThroughput("Bytes::findMismatch", size * 2 * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Benchmarks::consume(memcmp(block0, block1, (size_t)size));
+    }
+    Benchmarks::reportThroughput("memcmp", size * 2 * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    block1[size - 1] = block0[size - 1];
+}
+
+auto tomurcuk::BytesBenchmark::benchmarkCopyingBlocks(uint8_t *block0, uint8_t *block1, int64_t size) -> void {
+    static constexpr auto kRepetitions = 8;
+    static constexpr auto kSmallSize = INT64_C(4096);
+    static constexpr auto kSmallRepetitions = 100'000;
+
+    auto streamingThreshold = Bytes::getStreamingThreshold();
+
+    Bytes::setStreamingThreshold(INT64_MAX);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Bytes::copyBlock(block1, block0, size);
+    }
+    Benchmarks::reportThroughput("Bytes::copyBlock (cached)", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+    Bytes::setStreamingThreshold(streamingThreshold);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Bytes::copyBlock(block1, block0, size);
+    }
+    Benchmarks::reportThroughput("Bytes::copyBlock (streaming)", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        memcpy(block1, block0, (size_t)size);
+    }
+    Benchmarks::reportThroughput("memcpy", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kRepetitions; i++) {
+        Bytes::resetBlock(block1, size);
+    }
+    Benchmarks::reportThroughput("Bytes::resetBlock (streaming)", size * kRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = 0; i != kSmallRepetitions; i++) {
+        Bytes::copyBlock(block1 + ((i % 64) * kSmallSize), block0, kSmallSize);
+    }
+    Benchmarks::reportThroughput("Bytes::copyBlock (4 KiB)", kSmallSize * kSmallRepetitions, Benchmarks::getCurrentNanoseconds() - begin);
+
+    Bytes::copyBlock(block1, block0, size);
+}
+
+auto tomurcuk::BytesBenchmark::benchmarkCachePollution(uint8_t *block0, uint8_t *block1, int64_t size, uint8_t *neighborBlock, int64_t neighborSize) -> void {
+    auto streamingThreshold = Bytes::getStreamingThreshold();
+
+    (void)printf("Neighbor thread reading a cached block while:\n");
+    (void)printf("  idle: ");
+    measureNeighbor(block0, block1, size, neighborBlock, neighborSize, false);
+
+    Bytes::setStreamingThreshold(INT64_MAX);
+    (void)printf("  copying with cached stores: ");
+    measureNeighbor(block0, block1, size, neighborBlock, neighborSize, true);
+    Bytes::setStreamingThreshold(streamingThreshold);
+
+    (void)printf("  copying with streaming stores: ");
+    measureNeighbor(block0, block1, size, neighborBlock, neighborSize, true);
+}
+
+auto tomurcuk::BytesBenchmark::measureNeighbor(uint8_t *block0, uint8_t *block1, int64_t size, uint8_t *neighborBlock, int64_t neighborSize, bool isCopying) -> void {
+    static constexpr auto kRepetitions = 8;
+    static constexpr auto kIdleNanoseconds = INT64_C(500'000'000);
+
+    Neighbor neighbor;
+    neighbor.block = neighborBlock;
+    neighbor.size = neighborSize;
+    neighbor.passes = 0;
+    neighbor.isStopped = false;
+
+    thrd_t thread;
+    if (thrd_create(&thread, &runNeighbor, &neighbor) != thrd_success) {
+        Crashes::crash("Could not create the neighbor thread!");
+    }
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    if (isCopying) {
+        for (auto i = 0; i != kRepetitions; i++) {
+            Bytes::copyBlock(block1, block0, size);
+        }
+    } else {
+        auto duration = timespec{};
+        duration.tv_nsec = kIdleNanoseconds;
+        (void)thrd_sleep(&duration, nullptr);
+    }
+    __atomic_store_n(&neighbor.isStopped, true, __ATOMIC_RELAXED);
+    (void)thrd_join(thread, nullptr);
+    auto nanoseconds = Benchmarks::getCurrentNanoseconds() - begin;
+
+    (void)printf("%.3f GB/s\n", (double)(neighbor.passes * neighborSize) / (double)nanoseconds);
+}
+
+auto tomurcuk::BytesBenchmark::runNeighbor(void *neighbor) -> int {
+    auto state = (Neighbor *)neighbor;
+    while (!__atomic_load_n(&state->isStopped, __ATOMIC_RELAXED)) {
+        auto sum = UINT64_C(0);
+        for (auto i = INT64_C(0); i < state->size; i += 64) {
+            sum += state->block[i];
+        }
+        Benchmarks::consume((int64_t)sum);
+        state->passes++;
+    }
+    return 0;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    class BytesBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * State of a thread that repeatedly reads a block that fits into the
+         * cache, which is slowed down when its block is evicted.
+         */
+        struct Neighbor {
+            uint8_t *block;
+            int64_t size;
+            int64_t passes;
+            bool isStopped;
+        };
+
+        static auto benchmarkFindingBytes(uint8_t *block, int64_t size) -> void;
+        static auto benchmarkFindingAnyBytes(uint8_t *block, int64_t size) -> void;
+        static auto benchmarkCountingBytes(uint8_t *block, int64_t size) -> void;
+        static auto benchmarkFindingMismatches(uint8_t *block0, uint8_t *block1, int64_t size) -> void;
+        static auto benchmarkCopyingBlocks(uint8_t *block0, uint8_t *block1, int64_t size) -> void;
+        static auto benchmarkCachePollution(uint8_t *block0, uint8_t *block1, int64_t size, uint8_t *neighborBlock, int64_t neighborSize) -> void;
+        static auto measureNeighbor(uint8_t *block0, uint8_t *block1, int64_t size, uint8_t *neighborBlock, int64_t neighborSize, bool isCopying) -> void;
+        static auto runNeighbor(void *neighbor) -> int;
+    };
+}
@@ -0,0 +1,141 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/BlockPackingCodec.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/CodecBenchmark.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/DeltaCodec.hpp>
+#include <tomurcuk/FrameOfReferenceCodec.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/VarintCodec.hpp>
+
+auto tomurcuk::CodecBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    auto arraysResult = memoryAllocator.allocate(3 * kCount * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+    if (arraysResult.isFailure()) {
+        Crashes::crash("Could not allocate the integers for the benchmarks!");
+    }
+
+    // The IDs are sorted, with gaps of up to 1024 between them, which take
+    // one or two bytes as varints.
+    auto ids = (uint32_t *)*arraysResult.value();
+    auto gaps = ids + kCount;
+    auto decoded = gaps + kCount;
+    auto id = UINT32_C(0);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        gaps[i] = (uint32_t)(hash >> 54U) + 1;
+        id += gaps[i];
+        ids[i] = id;
+    }
+
+    // The decoded integers are written once first, so that no workload pays
+    // for the page faults.
+    Bytes::resetArray(decoded, kCount);
+
+    benchmarkVarints(memoryAllocator, gaps, decoded);
+    benchmarkDeltas(ids, decoded);
+    benchmarkFramesOfReference(memoryAllocator, ids, decoded);
+    benchmarkBlockPackings(memoryAllocator, gaps, decoded);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::CodecBenchmark::sample(uint32_t *values) -> int64_t {
+    return (int64_t)values[0] + values[kCount / 2] + values[kCount - 1];
+}
+
+auto tomurcuk::CodecBenchmark::benchmarkVarints(MemoryAllocator memoryAllocator, uint32_t *gaps, uint32_t *decoded) -> void {
+    ArrayListView<uint32_t> gapsView;
+    gapsView.initialize(gaps, kCount);
+    ArrayList<uint8_t> bytes;
+    bytes.initialize();
+    if (VarintCodec::encode(memoryAllocator, &bytes, gapsView) == Status::eFailure) {
+        Crashes::crash("Could not encode the integers for the benchmarks!");
+    }
+
+    ArrayListView<uint32_t> decodedView;
+    decodedView.initialize(decoded, kCount);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    auto size = VarintCodec::decode(bytes.getView(), decodedView);
+    Benchmarks::reportRate((char *)"varint decode", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(size + sample(decoded));
+
+    bytes.destroy(memoryAllocator);
+}
+
+auto tomurcuk::CodecBenchmark::benchmarkDeltas(uint32_t *ids, uint32_t *decoded) -> void {
+    Bytes::copyArray(decoded, ids, kCount);
+    ArrayListView<uint32_t> decodedView;
+    decodedView.initialize(decoded, kCount);
+    DeltaCodec::encode(decodedView);
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    DeltaCodec::decode(decodedView);
+    Benchmarks::reportRate((char *)"delta decode", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sample(decoded));
+}
+
+auto tomurcuk::CodecBenchmark::benchmarkFramesOfReference(MemoryAllocator memoryAllocator, uint32_t *ids, uint32_t *decoded) -> void {
+    ArrayList<uint64_t> words;
+    words.initialize();
+    for (auto i = INT64_C(0); i != kCount; i += kFrameCount) {
+        ArrayListView<uint32_t> frameView;
+        frameView.initialize(ids + i, kFrameCount);
+        if (FrameOfReferenceCodec::encode(memoryAllocator, &words, frameView) == Status::eFailure) {
+            Crashes::crash("Could not encode the integers for the benchmarks!");
+        }
+    }
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    auto offset = INT64_C(0);
+    for (auto i = INT64_C(0); i != kCount; i += kFrameCount) {
+        ArrayListView<uint64_t> wordsView;
+        wordsView.initialize(words.getArray() + offset, words.getCount() - offset);
+        ArrayListView<uint32_t> frameView;
+        frameView.initialize(decoded + i, kFrameCount);
+        offset += FrameOfReferenceCodec::decode(wordsView, frameView);
+    }
+    Benchmarks::reportRate((char *)"frame-of-reference decode", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(offset + sample(decoded));
+
+    words.destroy(memoryAllocator);
+}
+
+auto tomurcuk::CodecBenchmark::benchmarkBlockPackings(MemoryAllocator memoryAllocator, uint32_t *gaps, uint32_t *decoded) -> void {
+    ArrayListView<uint32_t> gapsView;
+    gapsView.initialize(gaps, kCount);
+    ArrayList<uint32_t> words;
+    words.initialize();
+    if (BlockPackingCodec::encode(memoryAllocator, &words, gapsView) == Status::eFailure) {
+        Crashes::crash("Could not encode the integers for the benchmarks!");
+    }
+
+    ArrayListView<uint32_t> decodedView;
+    decodedView.initialize(decoded, kCount);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    auto wordCount = BlockPackingCodec::decode(words.getView(), decodedView);
+    Benchmarks::reportRate((char *)"block packing decode", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(wordCount + sample(decoded));
+
+    // Restoring the IDs from the gaps is the usual way the blocks are read.
+    begin = Benchmarks::getCurrentNanoseconds();
+    wordCount = BlockPackingCodec::decode(words.getView(), decodedView);
+    DeltaCodec::decode(decodedView);
+    Benchmarks::reportRate((char *)"block packing and delta decode", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(wordCount + sample(decoded));
+
+    words.destroy(memoryAllocator);
+}
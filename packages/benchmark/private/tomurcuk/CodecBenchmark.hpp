@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class CodecBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of decoded integers, which take more memory than the
+         * caches hold.
+         */
+        static constexpr auto kCount = INT64_C(1) << 24U;
+
+        /**
+         * The amount of integers in a frame of reference, which matches the
+         * blocks of the block packing.
+         */
+        static constexpr auto kFrameCount = INT64_C(128);
+
+        /**
+         * Sums decoded integers, so that they are not optimized away.
+         *
+         * @param[in] values The pointer to the decoded integers.
+         * @return The sum of a few of the integers.
+         */
+        static auto sample(uint32_t *values) -> int64_t;
+
+        static auto benchmarkVarints(MemoryAllocator memoryAllocator, uint32_t *gaps, uint32_t *decoded) -> void;
+        static auto benchmarkDeltas(uint32_t *ids, uint32_t *decoded) -> void;
+        static auto benchmarkFramesOfReference(MemoryAllocator memoryAllocator, uint32_t *ids, uint32_t *decoded) -> void;
+        static auto benchmarkBlockPackings(MemoryAllocator memoryAllocator, uint32_t *gaps, uint32_t *decoded) -> void;
+    };
+}
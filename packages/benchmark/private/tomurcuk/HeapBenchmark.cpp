@@ -0,0 +1,89 @@
+#include <stdint.h>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/HeapBenchmark.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/PriorityQueue.hpp>
+#include <tomurcuk/RadixHeap.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::HeapBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    benchmarkPriorityQueues<2>(memoryAllocator, (char *)"PriorityQueue<2>");
+    linearMemoryAllocator.deallocateAll();
+    benchmarkPriorityQueues<4>(memoryAllocator, (char *)"PriorityQueue<4>");
+    linearMemoryAllocator.deallocateAll();
+    benchmarkPriorityQueues<8>(memoryAllocator, (char *)"PriorityQueue<8>");
+    linearMemoryAllocator.deallocateAll();
+    benchmarkRadixHeaps(memoryAllocator);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::HeapBenchmark::getKeyIncrement(int64_t index) -> uint64_t {
+    // Like the edge weights of a shortest path search, mostly small with a
+    // long tail.
+    auto hash = (uint64_t)(index + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+    return (hash >> 48U) >> (hash & 15U);
+}
+
+template<int64_t kArity>
+auto tomurcuk::HeapBenchmark::benchmarkPriorityQueues(MemoryAllocator memoryAllocator, char *name) -> void {
+    PriorityQueue<uint64_t, OrderComparable<uint64_t>, kArity> queue;
+    queue.initialize();
+    for (auto i = INT64_C(0); i != kQueuedCount; i++) {
+        if (queue.add(memoryAllocator, getKeyIncrement(i)) == Status::eFailure) {
+            Crashes::crash("Could not add to the queue for the benchmarks!");
+        }
+    }
+
+    auto sum = UINT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kOperationCount; i++) {
+        auto key = *queue.getFirst();
+        sum += key;
+        queue.replaceFirst(key + getKeyIncrement(i));
+    }
+    Benchmarks::reportRate(name, kOperationCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+
+    queue.destroy(memoryAllocator);
+}
+
+auto tomurcuk::HeapBenchmark::benchmarkRadixHeaps(MemoryAllocator memoryAllocator) -> void {
+    RadixHeap<uint64_t> heap;
+    heap.initialize();
+    for (auto i = INT64_C(0); i != kQueuedCount; i++) {
+        if (heap.add(memoryAllocator, getKeyIncrement(i)) == Status::eFailure) {
+            Crashes::crash("Could not add to the heap for the benchmarks!");
+        }
+    }
+
+    auto sum = UINT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kOperationCount; i++) {
+        auto keyResult = heap.removeFirst(memoryAllocator);
+        if (keyResult.isFailure()) {
+            Crashes::crash("Could not remove from the heap for the benchmarks!");
+        }
+        auto key = *keyResult.value();
+        sum += key;
+        if (heap.add(memoryAllocator, key + getKeyIncrement(i)) == Status::eFailure) {
+            Crashes::crash("Could not add to the heap for the benchmarks!");
+        }
+    }
+    Benchmarks::reportRate("RadixHeap", kOperationCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+
+    heap.destroy(memoryAllocator);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class HeapBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of removals in the workload, each of which is followed
+         * by an addition.
+         */
+        static constexpr auto kOperationCount = INT64_C(1) << 22U;
+
+        /**
+         * The amount of elements the queues hold throughout the workload.
+         */
+        static constexpr auto kQueuedCount = INT64_C(1) << 16U;
+
+        /**
+         * Provides the amount a removed key grows by before it is added back.
+         *
+         * @param[in] index The index of the operation.
+         * @return The amount that is added to the removed key.
+         */
+        static auto getKeyIncrement(int64_t index) -> uint64_t;
+
+        template<int64_t kArity>
+        static auto benchmarkPriorityQueues(MemoryAllocator memoryAllocator, char *name) -> void;
+        static auto benchmarkRadixHeaps(MemoryAllocator memoryAllocator) -> void;
+    };
+}
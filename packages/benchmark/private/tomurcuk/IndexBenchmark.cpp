@@ -0,0 +1,108 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/EytzingerIndex.hpp>
+#include <tomurcuk/IndexBenchmark.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/StaticBTreeIndex.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::IndexBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    auto arrayResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(int32_t), alignof(int32_t));
+    if (arrayResult.isFailure()) {
+        Crashes::crash("Could not allocate the elements for the benchmarks!");
+    }
+    auto array = (int32_t *)*arrayResult.value();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        array[i] = (int32_t)(2 * i);
+    }
+
+    benchmarkBinarySearches(array);
+    benchmarkEytzingerIndices(memoryAllocator, array);
+    benchmarkStaticBTreeIndices(memoryAllocator, array);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::IndexBenchmark::getSearchedElement(int64_t index) -> int32_t {
+    auto hash = (uint64_t)(index + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+    return (int32_t)((hash >> 32U) % (uint64_t)(2 * kCount));
+}
+
+auto tomurcuk::IndexBenchmark::benchmarkBinarySearches(int32_t *array) -> void {
+    auto sum = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kLookupCount; i++) {
+        auto element = getSearchedElement(i);
+        auto low = INT64_C(0);
+        auto high = kCount;
+        while (low < high) {
+            auto middle = low + (high - low) / 2;
+            if (array[middle] < element) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        sum += low;
+    }
+    Benchmarks::reportRate((char *)"binary search", kLookupCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+}
+
+auto tomurcuk::IndexBenchmark::benchmarkEytzingerIndices(MemoryAllocator memoryAllocator, int32_t *array) -> void {
+    ArrayListView<int32_t> view;
+    view.initialize(array, kCount);
+    EytzingerIndex<int32_t> index;
+    index.initialize();
+    if (index.build(memoryAllocator, view) == Status::eFailure) {
+        Crashes::crash("Could not build the index for the benchmarks!");
+    }
+
+    auto sum = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kLookupCount; i++) {
+        auto found = index.findLowerBound(getSearchedElement(i));
+        if (found != nullptr) {
+            sum += *found;
+        }
+    }
+    Benchmarks::reportRate((char *)"EytzingerIndex::findLowerBound", kLookupCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+
+    index.destroy(memoryAllocator);
+}
+
+auto tomurcuk::IndexBenchmark::benchmarkStaticBTreeIndices(MemoryAllocator memoryAllocator, int32_t *array) -> void {
+    ArrayListView<int32_t> view;
+    view.initialize(array, kCount);
+    StaticBTreeIndex<int32_t> index;
+    index.initialize();
+    if (index.build(memoryAllocator, view) == Status::eFailure) {
+        Crashes::crash("Could not build the index for the benchmarks!");
+    }
+
+    auto sum = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kLookupCount; i++) {
+        auto found = index.findLowerBound(getSearchedElement(i));
+        if (found != nullptr) {
+            sum += *found;
+        }
+    }
+    Benchmarks::reportRate((char *)"StaticBTreeIndex::findLowerBound", kLookupCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+
+    index.destroy(memoryAllocator);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class IndexBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of indexed elements, which take more memory than the
+         * caches hold.
+         */
+        static constexpr auto kCount = INT64_C(1) << 22U;
+
+        /**
+         * The amount of lookups in each workload.
+         */
+        static constexpr auto kLookupCount = INT64_C(1) << 22U;
+
+        /**
+         * Provides a searched element that is spread over the whole range of
+         * the elements.
+         *
+         * @param[in] index The index of the lookup.
+         * @return The searched element.
+         */
+        static auto getSearchedElement(int64_t index) -> int32_t;
+
+        static auto benchmarkBinarySearches(int32_t *array) -> void;
+        static auto benchmarkEytzingerIndices(MemoryAllocator memoryAllocator, int32_t *array) -> void;
+        static auto benchmarkStaticBTreeIndices(MemoryAllocator memoryAllocator, int32_t *array) -> void;
+    };
+}
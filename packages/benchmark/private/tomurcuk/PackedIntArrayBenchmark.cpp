@@ -0,0 +1,79 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/PackedIntArray.hpp>
+#include <tomurcuk/PackedIntArrayBenchmark.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::PackedIntArrayBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    auto arrayResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+    if (arrayResult.isFailure()) {
+        Crashes::crash("Could not allocate the integers for the benchmarks!");
+    }
+    auto array = (uint32_t *)*arrayResult.value();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        array[i] = (uint32_t)(hash >> (uint64_t)(64 - kBitWidth));
+    }
+
+    benchmarkUnpackedScans(array);
+    benchmarkPackedScans(memoryAllocator, array);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::PackedIntArrayBenchmark::benchmarkUnpackedScans(uint32_t *array) -> void {
+    auto sum = UINT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        sum += array[i];
+    }
+    Benchmarks::reportRate((char *)"unpacked scan", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+}
+
+auto tomurcuk::PackedIntArrayBenchmark::benchmarkPackedScans(MemoryAllocator memoryAllocator, uint32_t *array) -> void {
+    ArrayListView<uint32_t> view;
+    view.initialize(array, kCount);
+    PackedIntArray packedArray;
+    packedArray.initialize(kBitWidth);
+    if (packedArray.addAll(memoryAllocator, view) == Status::eFailure) {
+        Crashes::crash("Could not pack the integers for the benchmarks!");
+    }
+
+    auto sum = UINT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        sum += packedArray.get(i);
+    }
+    Benchmarks::reportRate((char *)"packed scan by get", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+
+    uint32_t chunk[kChunkCount];
+    ArrayListView<uint32_t> chunkView;
+    chunkView.initialize(chunk, kChunkCount);
+    sum = 0;
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kCount; i += kChunkCount) {
+        packedArray.unpack(i, chunkView);
+        for (auto value : chunk) {
+            sum += value;
+        }
+    }
+    Benchmarks::reportRate((char *)"packed scan by unpack", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+
+    packedArray.destroy(memoryAllocator);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class PackedIntArrayBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of scanned integers, which take more memory than the
+         * caches hold even when they are packed.
+         */
+        static constexpr auto kCount = INT64_C(1) << 24U;
+
+        /**
+         * The amount of bits of every packed integer.
+         */
+        static constexpr auto kBitWidth = INT64_C(20);
+
+        /**
+         * The amount of integers that are unpacked at a time, which fit in
+         * the first-level cache.
+         */
+        static constexpr auto kChunkCount = INT64_C(1024);
+
+        static auto benchmarkUnpackedScans(uint32_t *array) -> void;
+        static auto benchmarkPackedScans(MemoryAllocator memoryAllocator, uint32_t *array) -> void;
+    };
+}
@@ -0,0 +1,95 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/RoaringBitmap.hpp>
+#include <tomurcuk/RoaringBitmapBenchmark.hpp>
+#include <tomurcuk/RoaringBitmapView.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RoaringBitmapBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // One integer in 32 keeps the containers arrays, and one in 2 makes them
+    // bitmaps.
+    benchmarkOperations(memoryAllocator, (char *)"sparse", 5);
+    benchmarkOperations(memoryAllocator, (char *)"dense", 1);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::RoaringBitmapBenchmark::benchmarkOperations(MemoryAllocator memoryAllocator, char *name, uint64_t densityShift) -> void {
+    char *operationNames[] = {(char *)"intersection", (char *)"union", (char *)"difference", (char *)"intersection with view"};
+
+    RoaringBitmap bitmap;
+    createBitmap(memoryAllocator, &bitmap, 1, densityShift);
+    RoaringBitmap other;
+    createBitmap(memoryAllocator, &other, 2, densityShift);
+    ArrayList<uint64_t> words;
+    words.initialize();
+    RoaringBitmapView view;
+    if (other.serialize(memoryAllocator, &words) == Status::eFailure || view.initialize(words.getView()) == Status::eFailure) {
+        Crashes::crash("Could not serialize the bitmap for the benchmarks!");
+    }
+    auto count = bitmap.getCount() + other.getCount();
+
+    for (auto operation = 0; operation != 4; operation++) {
+        auto nanoseconds = INT64_C(0);
+        auto resultCount = INT64_C(0);
+        for (auto round = INT64_C(0); round != kRoundCount; round++) {
+            RoaringBitmap result;
+            result.initialize();
+            if (result.uniteWith(memoryAllocator, &bitmap) == Status::eFailure) {
+                Crashes::crash("Could not copy the bitmap for the benchmarks!");
+            }
+
+            auto status = Status::eSuccess;
+            auto begin = Benchmarks::getCurrentNanoseconds();
+            if (operation == 0) {
+                status = result.intersectWith(memoryAllocator, &other);
+            } else if (operation == 1) {
+                status = result.uniteWith(memoryAllocator, &other);
+            } else if (operation == 2) {
+                status = result.subtract(memoryAllocator, &other);
+            } else {
+                status = result.intersectWith(memoryAllocator, &view);
+            }
+            nanoseconds += Benchmarks::getCurrentNanoseconds() - begin;
+            if (status == Status::eFailure) {
+                Crashes::crash("Could not operate on the bitmaps for the benchmarks!");
+            }
+
+            resultCount += result.getCount();
+            result.destroy(memoryAllocator);
+        }
+
+        char reportName[64];
+        snprintf(reportName, sizeof(reportName), "RoaringBitmap (%s %s)", name, operationNames[operation]);
+        Benchmarks::reportRate(reportName, kRoundCount * count, nanoseconds);
+        Benchmarks::consume(resultCount);
+    }
+
+    words.destroy(memoryAllocator);
+    other.destroy(memoryAllocator);
+    bitmap.destroy(memoryAllocator);
+}
+
+auto tomurcuk::RoaringBitmapBenchmark::createBitmap(MemoryAllocator memoryAllocator, RoaringBitmap *bitmap, uint64_t seed, uint64_t densityShift) -> void {
+    bitmap->initialize();
+    for (auto i = INT64_C(0); i != kRange; i++) {
+        auto hash = ((uint64_t)i + seed * kRange + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        if (hash >> (64 - densityShift) == 0 && bitmap->add(memoryAllocator, (uint32_t)i) == Status::eFailure) {
+            Crashes::crash("Could not create the bitmap for the benchmarks!");
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/RoaringBitmap.hpp>
+
+namespace tomurcuk {
+    class RoaringBitmapBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The range of the integers, which spans 1024 containers.
+         */
+        static constexpr auto kRange = INT64_C(1) << 26U;
+
+        /**
+         * The amount of times each operation is repeated on fresh copies.
+         */
+        static constexpr auto kRoundCount = INT64_C(10);
+
+        static auto benchmarkOperations(MemoryAllocator memoryAllocator, char *name, uint64_t densityShift) -> void;
+        static auto createBitmap(MemoryAllocator memoryAllocator, RoaringBitmap *bitmap, uint64_t seed, uint64_t densityShift) -> void;
+    };
+}
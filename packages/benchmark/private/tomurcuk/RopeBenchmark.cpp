@@ -0,0 +1,134 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Rope.hpp>
+#include <tomurcuk/RopeBenchmark.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RopeBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Lines of varying lengths, as in source code.
+    auto textResult = memoryAllocator.allocate(kCount, 1);
+    if (textResult.isFailure()) {
+        Crashes::crash("Could not allocate the text for the benchmarks!");
+    }
+    auto text = (char *)*textResult.value();
+    auto state = UINT64_C(1);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        state = state * UINT64_C(6'364'136'223'846'793'005) + UINT64_C(1'442'695'040'888'963'407);
+        text[i] = (state >> 58U) == 0 ? '\n' : (char)('a' + (state >> 59U));
+    }
+    auto cursor = linearMemoryAllocator.cursor();
+
+    benchmarkEditing(memoryAllocator, text);
+    linearMemoryAllocator.deallocateDownTo(cursor);
+    benchmarkEditingArrayList(memoryAllocator, text);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::RopeBenchmark::getIndex(int64_t index, int64_t count) -> int64_t {
+    return (int64_t)(((uint64_t)index * UINT64_C(0x9E37'79B9'7F4A'7C15)) % (uint64_t)count);
+}
+
+auto tomurcuk::RopeBenchmark::benchmarkEditing(MemoryAllocator memoryAllocator, char *text) -> void {
+    Rope<char> rope;
+    rope.initialize();
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i < kCount; i += kPieceCount) {
+        ArrayListView<char> piece;
+        piece.initialize(text + i, kCount - i < kPieceCount ? kCount - i : kPieceCount);
+        if (rope.insertAll(memoryAllocator, i, piece) == Status::eFailure) {
+            Crashes::crash("Could not load the rope for the benchmarks!");
+        }
+    }
+    Benchmarks::reportThroughput((char *)"Rope::insertAll (loading)", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    auto character = 'x';
+    ArrayListView<char> edit;
+    edit.initialize(&character, 1);
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kEditCount; i++) {
+        if (rope.insertAll(memoryAllocator, getIndex(i, rope.getCount()), edit) == Status::eFailure) {
+            Crashes::crash("Could not insert into the rope for the benchmarks!");
+        }
+    }
+    Benchmarks::reportRate((char *)"Rope::insertAll (1 byte)", kEditCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    // Typing inserts after the previous edit, and moves elsewhere now and
+    // then.
+    begin = Benchmarks::getCurrentNanoseconds();
+    auto index = INT64_C(0);
+    for (auto i = INT64_C(0); i != kEditCount; i++) {
+        index = i % kTypedCount == 0 ? getIndex(i, rope.getCount()) : index + 1;
+        if (rope.insertAll(memoryAllocator, index, edit) == Status::eFailure) {
+            Crashes::crash("Could not insert into the rope for the benchmarks!");
+        }
+    }
+    Benchmarks::reportRate((char *)"Rope::insertAll (1 byte, typing)", kEditCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    // The edited text is scanned chunk by chunk.
+    auto lineCount = INT64_C(0);
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto chunkCursor = rope.getFirst(); chunkCursor.isValid(); chunkCursor.moveNext()) {
+        auto chunk = chunkCursor.getChunk();
+        lineCount += Bytes::countByte(chunk.getArray(), chunk.getCount(), '\n');
+    }
+    Benchmarks::reportThroughput((char *)"Rope chunks with Bytes::countByte", rope.getCount(), Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    lineCount += Bytes::countByte(text, kCount, '\n');
+    Benchmarks::reportThroughput((char *)"Array with Bytes::countByte", kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(lineCount);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kEditCount; i++) {
+        index = getIndex(i, rope.getCount());
+        rope.removePortion(memoryAllocator, index, index + 1);
+    }
+    Benchmarks::reportRate((char *)"Rope::removePortion (1 byte)", kEditCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    rope.destroy(memoryAllocator);
+}
+
+auto tomurcuk::RopeBenchmark::benchmarkEditingArrayList(MemoryAllocator memoryAllocator, char *text) -> void {
+    ArrayList<char> list;
+    list.initialize();
+    ArrayListView<char> view;
+    view.initialize(text, kCount);
+    if (!list.addAll(memoryAllocator, view)) {
+        Crashes::crash("Could not load the list for the benchmarks!");
+    }
+
+    auto character = 'x';
+    ArrayListView<char> edit;
+    edit.initialize(&character, 1);
+    // Every edit moves the rest of the text; so, the rate is reported as the
+    // throughput of the moved bytes.
+    auto movedCount = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kArrayListEditCount; i++) {
+        auto index = getIndex(i, list.getCount());
+        if (!list.insertAll(memoryAllocator, index, edit)) {
+            Crashes::crash("Could not insert into the list for the benchmarks!");
+        }
+        movedCount += list.getCount() - 1 - index;
+    }
+    Benchmarks::reportThroughput((char *)"ArrayList::insertAll (1 byte, moved bytes)", movedCount, Benchmarks::getCurrentNanoseconds() - begin);
+
+    list.destroy(memoryAllocator);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class RopeBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of bytes in the edited text, which is the size of a
+         * large file.
+         */
+        static constexpr auto kCount = INT64_C(100'000'000);
+
+        /**
+         * The amount of bytes every append loads at once.
+         */
+        static constexpr auto kPieceCount = INT64_C(1) << 16U;
+
+        /**
+         * The amount of single-byte edits on the rope.
+         */
+        static constexpr auto kEditCount = INT64_C(1'000'000);
+
+        /**
+         * The amount of bytes that are typed at a place before moving to
+         * another one.
+         */
+        static constexpr auto kTypedCount = INT64_C(64);
+
+        /**
+         * The amount of single-byte edits on the array list, which moves the
+         * whole text after the edit every time.
+         */
+        static constexpr auto kArrayListEditCount = INT64_C(100);
+
+        /**
+         * Provides an index that is spread over the whole text.
+         *
+         * @param[in] index The index of the edit.
+         * @param[in] count The amount of bytes in the text.
+         * @return The index of the edited byte.
+         */
+        static auto getIndex(int64_t index, int64_t count) -> int64_t;
+
+        static auto benchmarkEditing(MemoryAllocator memoryAllocator, char *text) -> void;
+        static auto benchmarkEditingArrayList(MemoryAllocator memoryAllocator, char *text) -> void;
+    };
+}
@@ -0,0 +1,130 @@
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ParallelSorts.hpp>
+#include <tomurcuk/SortBenchmark.hpp>
+#include <tomurcuk/Sorts.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::SortBenchmark::suite() -> void {
+    // The input and the scratch memory of the radix sort.
+    static constexpr auto kCapacity = 2 * kCount * (int64_t)sizeof(int64_t) + 4096;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto arrayResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(int64_t), 64);
+    if (arrayResult.isFailure()) {
+        Crashes::crash("Could not allocate the input for the benchmarks!");
+    }
+    auto array = (int64_t *)*arrayResult.value();
+
+    for (auto i = INT64_C(0); i != kDistributionCount; i++) {
+        benchmarkSorting(array, fill(array, i));
+        benchmarkSortingByRadix(memoryAllocator, array, fill(array, i));
+        benchmarkSortingByRadixInPlace(array, fill(array, i));
+    }
+    benchmarkSortingInParallel(array);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::SortBenchmark::fill(int64_t *array, int64_t distribution) -> char * {
+    auto state = UINT64_C(1);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        state = state * UINT64_C(6'364'136'223'846'793'005) + UINT64_C(1'442'695'040'888'963'407);
+        auto random = (int64_t)(state >> 1U);
+        switch (distribution) {
+        case 0:
+            array[i] = random;
+            break;
+        case 1:
+            array[i] = random & 0xFF'FFFF;
+            break;
+        case 2:
+            array[i] = random & 0xF;
+            break;
+        case 3:
+            array[i] = i;
+            break;
+        case 4:
+            array[i] = kCount - i;
+            break;
+        default:
+            array[i] = i % 64 == 0 ? random : i;
+            break;
+        }
+    }
+
+    char *names[kDistributionCount] = {(char *)"random", (char *)"random 24-bit", (char *)"random 4-bit", (char *)"sorted", (char *)"reversed", (char *)"mostly sorted"};
+    return names[distribution];
+}
+
+auto tomurcuk::SortBenchmark::benchmarkSorting(int64_t *array, char *distributionName) -> void {
+    ArrayListView<int64_t> view;
+    view.initialize(array, kCount);
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    Sorts::sort(view);
+    auto nanoseconds = Benchmarks::getCurrentNanoseconds() - begin;
+
+    char name[64];
+    snprintf(name, sizeof(name), "Sorts::sort (%s)", distributionName);
+    Benchmarks::reportRate(name, kCount, nanoseconds);
+}
+
+auto tomurcuk::SortBenchmark::benchmarkSortingByRadix(MemoryAllocator memoryAllocator, int64_t *array, char *distributionName) -> void {
+    ArrayListView<int64_t> view;
+    view.initialize(array, kCount);
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    if (Sorts::sortByRadix(memoryAllocator, view) == Status::eFailure) {
+        Crashes::crash("Could not allocate the scratch memory for the benchmarks!");
+    }
+    auto nanoseconds = Benchmarks::getCurrentNanoseconds() - begin;
+
+    char name[64];
+    snprintf(name, sizeof(name), "Sorts::sortByRadix (%s)", distributionName);
+    Benchmarks::reportRate(name, kCount, nanoseconds);
+}
+
+auto tomurcuk::SortBenchmark::benchmarkSortingByRadixInPlace(int64_t *array, char *distributionName) -> void {
+    ArrayListView<int64_t> view;
+    view.initialize(array, kCount);
+
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    Sorts::sortByRadixInPlace(view);
+    auto nanoseconds = Benchmarks::getCurrentNanoseconds() - begin;
+
+    char name[64];
+    snprintf(name, sizeof(name), "Sorts::sortByRadixInPlace (%s)", distributionName);
+    Benchmarks::reportRate(name, kCount, nanoseconds);
+}
+
+auto tomurcuk::SortBenchmark::benchmarkSortingInParallel(int64_t *array) -> void {
+    ArrayListView<int64_t> view;
+    view.initialize(array, kCount);
+
+    // The same input on more and more threads shows the strong scaling.
+    for (auto threadCount = INT64_C(1); threadCount <= 64; threadCount *= 2) {
+        (void)fill(array, 0);
+
+        auto begin = Benchmarks::getCurrentNanoseconds();
+        if (ParallelSorts::sort(view, threadCount) == Status::eFailure) {
+            Crashes::crash("Could not allocate the scratch memory for the benchmarks!");
+        }
+        auto nanoseconds = Benchmarks::getCurrentNanoseconds() - begin;
+
+        char name[64];
+        snprintf(name, sizeof(name), "ParallelSorts::sort (%" PRId64 " threads)", threadCount);
+        Benchmarks::reportRate(name, kCount, nanoseconds);
+    }
+}
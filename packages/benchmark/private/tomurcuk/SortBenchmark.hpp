@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class SortBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of elements in the workload.
+         */
+        static constexpr auto kCount = INT64_C(1) << 24U;
+
+        /**
+         * The amount of input distributions in the workload.
+         */
+        static constexpr auto kDistributionCount = INT64_C(6);
+
+        /**
+         * Fills the input with a distribution.
+         *
+         * @param[out] array The pointer to the input.
+         * @param[in] distribution The index of the distribution.
+         * @return The name of the distribution.
+         */
+        static auto fill(int64_t *array, int64_t distribution) -> char *;
+
+        static auto benchmarkSorting(int64_t *array, char *distributionName) -> void;
+        static auto benchmarkSortingByRadix(MemoryAllocator memoryAllocator, int64_t *array, char *distributionName) -> void;
+        static auto benchmarkSortingByRadixInPlace(int64_t *array, char *distributionName) -> void;
+        static auto benchmarkSortingInParallel(int64_t *array) -> void;
+    };
+}
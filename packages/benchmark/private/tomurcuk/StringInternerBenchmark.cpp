@@ -0,0 +1,94 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringInterner.hpp>
+#include <tomurcuk/StringInternerBenchmark.hpp>
+
+auto tomurcuk::StringInternerBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    auto charactersResult = memoryAllocator.allocate(kDistinctCount * kLength, alignof(char));
+    auto stringsResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(ArrayListView<char>), alignof(ArrayListView<char>));
+    auto symbolsResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+    if (charactersResult.isFailure() || stringsResult.isFailure() || symbolsResult.isFailure()) {
+        Crashes::crash("Could not allocate the strings for the benchmarks!");
+    }
+    auto characters = (char *)*charactersResult.value();
+    auto strings = (ArrayListView<char> *)*stringsResult.value();
+    auto symbols = (uint32_t *)*symbolsResult.value();
+
+    // Every string is one of the distinct ones, which are picked by a hash so
+    // that the lookups do not follow the order of the table.
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        auto index = (int64_t)(hash % (uint64_t)kDistinctCount);
+        auto string = characters + index * kLength;
+        strings[i].initialize(string, snprintf(string, kLength, "identifier_%lld", (long long)index));
+    }
+    ArrayListView<ArrayListView<char>> stringsView;
+    stringsView.initialize(strings, kCount);
+
+    benchmarkInterning(memoryAllocator, stringsView, 1);
+    benchmarkInterning(memoryAllocator, stringsView, 8);
+    benchmarkInterningInBatches(memoryAllocator, stringsView, symbols, 1);
+    benchmarkInterningInBatches(memoryAllocator, stringsView, symbols, 8);
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::StringInternerBenchmark::benchmarkInterning(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char>> strings, int64_t shardCount) -> void {
+    auto internerResult = StringInterner::create(memoryAllocator, kDistinctCount * kLength, shardCount);
+    if (internerResult.isFailure()) {
+        Crashes::crash("Could not create the interner for the benchmarks!");
+    }
+    auto interner = *internerResult.value();
+
+    auto sum = UINT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto symbolResult = interner.intern(memoryAllocator, *strings.get(i));
+        if (symbolResult.isFailure()) {
+            Crashes::crash("Could not intern the strings for the benchmarks!");
+        }
+        sum += *symbolResult.value();
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "intern (%lld shards)", (long long)shardCount);
+    Benchmarks::reportRate(name, kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume((int64_t)sum);
+
+    interner.destroy(memoryAllocator);
+}
+
+auto tomurcuk::StringInternerBenchmark::benchmarkInterningInBatches(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char>> strings, uint32_t *symbols, int64_t shardCount) -> void {
+    auto internerResult = StringInterner::create(memoryAllocator, kDistinctCount * kLength, shardCount);
+    if (internerResult.isFailure()) {
+        Crashes::crash("Could not create the interner for the benchmarks!");
+    }
+    auto interner = *internerResult.value();
+
+    ArrayListView<uint32_t> symbolsView;
+    symbolsView.initialize(symbols, kCount);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    if (interner.internAll(memoryAllocator, strings, symbolsView) == Status::eFailure) {
+        Crashes::crash("Could not intern the strings for the benchmarks!");
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "intern all (%lld shards)", (long long)shardCount);
+    Benchmarks::reportRate(name, kCount, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(symbols[kCount - 1]);
+
+    interner.destroy(memoryAllocator);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class StringInternerBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of interned strings, like the identifiers of a large
+         * source file.
+         */
+        static constexpr auto kCount = INT64_C(1) << 22U;
+
+        /**
+         * The amount of distinct strings, whose tables take more memory than
+         * the first-level cache holds.
+         */
+        static constexpr auto kDistinctCount = INT64_C(1) << 16U;
+
+        /**
+         * The most bytes of every string.
+         */
+        static constexpr auto kLength = INT64_C(24);
+
+        static auto benchmarkInterning(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char>> strings, int64_t shardCount) -> void;
+        static auto benchmarkInterningInBatches(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char>> strings, uint32_t *symbols, int64_t shardCount) -> void;
+    };
+}
@@ -0,0 +1,248 @@
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Benchmarks.hpp>
+#include <tomurcuk/Crashes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/SubstringFinder.hpp>
+#include <tomurcuk/SubstringSetFinder.hpp>
+#include <tomurcuk/TextBenchmark.hpp>
+#include <tomurcuk/Transcoder.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+
+auto tomurcuk::TextBenchmark::suite() -> void {
+    static constexpr auto kCapacity = INT64_C(1) << 30U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+    if (linearMemoryAllocatorResult.isFailure()) {
+        Crashes::crash("Could not create the allocator for the benchmarks!");
+    }
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    auto bytesResult = memoryAllocator.allocate(kSize, alignof(char8_t));
+    if (bytesResult.isFailure()) {
+        Crashes::crash("Could not allocate the corpora for the benchmarks!");
+    }
+    auto bytes = (char8_t *)*bytesResult.value();
+
+    // English-like text, European text with some accented letters, and
+    // Chinese-like text with a few ASCII characters.
+    char *corpusNames[] = {(char *)"ASCII", (char *)"Latin", (char *)"CJK"};
+    char32_t firstCodePoints[] = {U'a', U'À', U'一'};
+    int64_t codePointCounts[] = {26, 0x180 - 0xC0, 0xA000 - 0x4E00};
+    int64_t nonAsciiEighths[] = {0, 1, 7};
+    for (auto i = 0; i != 3; i++) {
+        fillCorpus(bytes, firstCodePoints[i], codePointCounts[i], nonAsciiEighths[i]);
+        benchmarkValidation(corpusNames[i], bytes);
+        benchmarkCounting(corpusNames[i], bytes);
+        benchmarkTranscoding(memoryAllocator, corpusNames[i], bytes);
+        benchmarkSearching(memoryAllocator, corpusNames[i], bytes);
+        benchmarkSearchingSets(memoryAllocator, corpusNames[i], bytes);
+    }
+
+    linearMemoryAllocator.destroy();
+}
+
+auto tomurcuk::TextBenchmark::benchmarkValidation(char *corpusName, char8_t *bytes) -> void {
+    ArrayListView<char8_t> view;
+    view.initialize(bytes, kSize);
+
+    auto sum = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+        sum += Utf8Codec::findInvalidIndex(view);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "UTF-8 validation (%s)", corpusName);
+    Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+}
+
+auto tomurcuk::TextBenchmark::benchmarkCounting(char *corpusName, char8_t *bytes) -> void {
+    ArrayListView<char8_t> view;
+    view.initialize(bytes, kSize);
+
+    auto sum = INT64_C(0);
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+        sum += Utf8Codec::countCodePoints(view);
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "UTF-8 code point counting (%s)", corpusName);
+    Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(sum);
+}
+
+auto tomurcuk::TextBenchmark::benchmarkTranscoding(MemoryAllocator memoryAllocator, char *corpusName, char8_t *bytes) -> void {
+    ArrayListView<char8_t> view;
+    view.initialize(bytes, kSize);
+
+    // The throughputs are in the bytes of the UTF-8 encoding in every
+    // direction, and the outputs are reused.
+    ArrayList<char16_t> units;
+    units.initialize();
+    ArrayList<char32_t> codePoints;
+    codePoints.initialize();
+    ArrayList<char8_t> encodedBytes;
+    encodedBytes.initialize();
+    auto invalidIndex = INT64_C(-1);
+
+    char name[64];
+    auto begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+        units.removeAll();
+        if (Transcoder::transcode(memoryAllocator, view, &units, &invalidIndex) == Status::eFailure) {
+            Crashes::crash("Could not transcode the corpus to UTF-16!");
+        }
+    }
+    snprintf(name, sizeof(name), "UTF-8 to UTF-16 transcoding (%s)", corpusName);
+    Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+        codePoints.removeAll();
+        if (Transcoder::transcode(memoryAllocator, view, &codePoints, &invalidIndex) == Status::eFailure) {
+            Crashes::crash("Could not transcode the corpus to UTF-32!");
+        }
+    }
+    snprintf(name, sizeof(name), "UTF-8 to UTF-32 transcoding (%s)", corpusName);
+    Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+        encodedBytes.removeAll();
+        if (Transcoder::transcode(memoryAllocator, units.getView(), &encodedBytes, &invalidIndex) == Status::eFailure) {
+            Crashes::crash("Could not transcode the corpus from UTF-16!");
+        }
+    }
+    snprintf(name, sizeof(name), "UTF-16 to UTF-8 transcoding (%s)", corpusName);
+    Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+
+    begin = Benchmarks::getCurrentNanoseconds();
+    for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+        encodedBytes.removeAll();
+        if (Transcoder::transcode(memoryAllocator, codePoints.getView(), &encodedBytes, &invalidIndex) == Status::eFailure) {
+            Crashes::crash("Could not transcode the corpus from UTF-32!");
+        }
+    }
+    snprintf(name, sizeof(name), "UTF-32 to UTF-8 transcoding (%s)", corpusName);
+    Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+    Benchmarks::consume(encodedBytes.getCount());
+
+    units.destroy(memoryAllocator);
+    codePoints.destroy(memoryAllocator);
+    encodedBytes.destroy(memoryAllocator);
+}
+
+auto tomurcuk::TextBenchmark::benchmarkSearching(MemoryAllocator memoryAllocator, char *corpusName, char8_t *bytes) -> void {
+    ArrayListView<char8_t> view;
+    view.initialize(bytes, kSize);
+
+    // The needles are taken from the middle of the corpus, and every
+    // occurrence is found, so that the whole corpus is searched.
+    ArrayList<int64_t> indices;
+    indices.initialize();
+    int64_t needleSizes[] = {8, 64};
+    for (auto needleSize : needleSizes) {
+        ArrayListView<char8_t> needle;
+        needle.initialize(bytes + kSize / 2, needleSize);
+        SubstringFinder finder;
+        finder.initialize(needle);
+
+        char name[64];
+        auto begin = Benchmarks::getCurrentNanoseconds();
+        for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+            indices.removeAll();
+            if (finder.findAll(memoryAllocator, view, &indices) == Status::eFailure) {
+                Crashes::crash("Could not find the needle in the corpus!");
+            }
+        }
+        snprintf(name, sizeof(name), "%" PRId64 "-byte substring search (%s)", needleSize, corpusName);
+        Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+        Benchmarks::consume(indices.getCount());
+
+        auto count = INT64_C(0);
+        begin = Benchmarks::getCurrentNanoseconds();
+        for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+            auto cursor = bytes;
+            auto end = bytes + kSize;
+            while ((cursor = (char8_t *)memmem(cursor, (size_t)(end - cursor), needle.getArray(), (size_t)needleSize)) != nullptr) {
+                count++;
+                cursor++;
+            }
+        }
+        snprintf(name, sizeof(name), "%" PRId64 "-byte substring search with memmem (%s)", needleSize, corpusName);
+        Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+        Benchmarks::consume(count);
+    }
+
+    indices.destroy(memoryAllocator);
+}
+
+auto tomurcuk::TextBenchmark::benchmarkSearchingSets(MemoryAllocator memoryAllocator, char *corpusName, char8_t *bytes) -> void {
+    static constexpr auto kMaxNeedleCount = INT64_C(100);
+
+    ArrayListView<char8_t> view;
+    view.initialize(bytes, kSize);
+
+    // A set that is searched with the Teddy algorithm, and one that is
+    // searched with the automaton.
+    ArrayListView<char8_t> needles[kMaxNeedleCount];
+    for (auto i = INT64_C(0); i != kMaxNeedleCount; i++) {
+        needles[i].initialize(bytes + kSize / kMaxNeedleCount * i, 6 + i % 11);
+    }
+    ArrayList<int64_t> indices;
+    indices.initialize();
+    int64_t needleCounts[] = {8, kMaxNeedleCount};
+    for (auto needleCount : needleCounts) {
+        ArrayListView<ArrayListView<char8_t>> needlesView;
+        needlesView.initialize(needles, needleCount);
+        auto finderResult = SubstringSetFinder::create(memoryAllocator, needlesView);
+        if (finderResult.isFailure()) {
+            Crashes::crash("Could not create the finder for the benchmarks!");
+        }
+        auto finder = *finderResult.value();
+
+        auto begin = Benchmarks::getCurrentNanoseconds();
+        for (auto i = INT64_C(0); i != kRepeatCount; i++) {
+            indices.removeAll();
+            if (finder.findAll(memoryAllocator, view, &indices) == Status::eFailure) {
+                Crashes::crash("Could not find the needles in the corpus!");
+            }
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "%" PRId64 "-needle substring search (%s)", needleCount, corpusName);
+        Benchmarks::reportThroughput(name, kRepeatCount * kSize, Benchmarks::getCurrentNanoseconds() - begin);
+        Benchmarks::consume(indices.getCount());
+
+        finder.destroy(memoryAllocator);
+    }
+
+    indices.destroy(memoryAllocator);
+}
+
+auto tomurcuk::TextBenchmark::fillCorpus(char8_t *bytes, char32_t firstCodePoint, int64_t codePointCount, int64_t nonAsciiEighths) -> int64_t {
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    for (auto i = INT64_C(0); kSize - offset >= Utf8Codec::kMaxSize; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        auto codePoint = (char32_t)(U'a' + (hash >> 32U) % 26);
+        if ((int64_t)((hash >> 61U) & 7U) < nonAsciiEighths) {
+            codePoint = (char32_t)(firstCodePoint + (hash >> 32U) % (uint64_t)codePointCount);
+        } else if ((hash >> 40U) % 6 == 0) {
+            codePoint = U' ';
+        }
+        offset += Utf8Codec::encode(bytes + offset, codePoint);
+        count++;
+    }
+    for (; offset != kSize; offset++) {
+        bytes[offset] = u8' ';
+        count++;
+    }
+    return count;
+}
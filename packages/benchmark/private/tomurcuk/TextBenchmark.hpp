@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class TextBenchmark {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of bytes of every corpus, which fit in the last level
+         * cache.
+         */
+        static constexpr auto kSize = INT64_C(1) << 20U;
+
+        /**
+         * The amount of times every corpus is processed.
+         */
+        static constexpr auto kRepeatCount = INT64_C(64);
+
+        static auto benchmarkValidation(char *corpusName, char8_t *bytes) -> void;
+        static auto benchmarkCounting(char *corpusName, char8_t *bytes) -> void;
+        static auto benchmarkTranscoding(MemoryAllocator memoryAllocator, char *corpusName, char8_t *bytes) -> void;
+        static auto benchmarkSearching(MemoryAllocator memoryAllocator, char *corpusName, char8_t *bytes) -> void;
+        static auto benchmarkSearchingSets(MemoryAllocator memoryAllocator, char *corpusName, char8_t *bytes) -> void;
+
+        /**
+         * Writes text whose code points are ASCII letters and ones from a
+         * range, in a given proportion.
+         *
+         * @return The amount of written code points.
+         */
+        static auto fillCorpus(char8_t *bytes, char32_t firstCodePoint, int64_t codePointCount, int64_t nonAsciiEighths) -> int64_t;
+    };
+}
@@ -0,0 +1,184 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/BitPacking.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::BitPacking::getMask(int64_t bitWidth) -> uint64_t {
+    assert(bitWidth > 0);
+    assert(bitWidth <= 64);
+
+    return bitWidth == 64 ? UINT64_MAX : (UINT64_C(1) << (uint64_t)bitWidth) - 1;
+}
+
+auto tomurcuk::BitPacking::get(uint64_t *words, int64_t bitWidth, int64_t index) -> uint64_t {
+    auto bitIndex = index * bitWidth;
+    auto word = words + bitIndex / 64;
+    auto shift = (uint64_t)(bitIndex % 64);
+
+    // The bits from the next word are shifted in two steps, so that none of
+    // them are when the integer starts at the beginning of its word.
+    auto low = word[0] >> shift;
+    auto high = (word[1] << 1U) << (63U - shift);
+    return (low | high) & getMask(bitWidth);
+}
+
+auto tomurcuk::BitPacking::set(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t value) -> void {
+    auto mask = getMask(bitWidth);
+
+    assert((value & ~mask) == 0);
+
+    auto bitIndex = index * bitWidth;
+    auto word = words + bitIndex / 64;
+    auto shift = (uint64_t)(bitIndex % 64);
+    word[0] = (word[0] & ~(mask << shift)) | (value << shift);
+    if (shift + (uint64_t)bitWidth > 64) {
+        word[1] = (word[1] & ~(mask >> (64 - shift))) | (value >> (64 - shift));
+    }
+}
+
+auto tomurcuk::BitPacking::unpack(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void {
+    assert(bitWidth <= 32);
+    assert(count >= 0);
+
+    getKernels().unpack32(words, bitWidth, index, values, count);
+}
+
+auto tomurcuk::BitPacking::unpack(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void {
+    assert(count >= 0);
+
+    getKernels().unpack64(words, bitWidth, index, values, count);
+}
+
+auto tomurcuk::BitPacking::pack(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void {
+    assert(bitWidth <= 32);
+    assert(count >= 0);
+
+    packAll(words, bitWidth, index, values, count);
+}
+
+auto tomurcuk::BitPacking::pack(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void {
+    assert(count >= 0);
+
+    packAll(words, bitWidth, index, values, count);
+}
+
+auto tomurcuk::BitPacking::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::BitPacking::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.unpack32 = &unpack32Portably;
+    kernels.unpack64 = &unpack64Portably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.unpack32 = &unpack32WithAvx2;
+        kernels.unpack64 = &unpack64WithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::BitPacking::unpack32Portably(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        values[i] = (uint32_t)get(words, bitWidth, index + i);
+    }
+}
+
+auto tomurcuk::BitPacking::unpack64Portably(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        values[i] = get(words, bitWidth, index + i);
+    }
+}
+
+template<typename Value>
+auto tomurcuk::BitPacking::packAll(uint64_t *words, int64_t bitWidth, int64_t index, Value *values, int64_t count) -> void {
+    if (count == 0) {
+        return;
+    }
+
+    // Whole words are assembled in a register, and only the bits before the
+    // first integer and after the last one are kept from memory.
+    auto width = (uint64_t)bitWidth;
+    auto bitIndex = index * bitWidth;
+    auto word = words + bitIndex / 64;
+    auto shift = (uint64_t)(bitIndex % 64);
+    auto accumulator = word[0] & ((UINT64_C(1) << shift) - 1);
+    for (auto i = INT64_C(0); i != count; i++) {
+        auto value = (uint64_t)values[i];
+
+        assert((value & ~getMask(bitWidth)) == 0);
+
+        accumulator |= value << shift;
+        shift += width;
+        if (shift >= 64) {
+            *word = accumulator;
+            word++;
+            shift -= 64;
+            accumulator = shift == 0 ? 0 : value >> (width - shift);
+        }
+    }
+    if (shift != 0) {
+        auto keptMask = (UINT64_C(1) << shift) - 1;
+        *word = accumulator | (*word & ~keptMask);
+    }
+}
+
+#if defined(__x86_64__)
+
+// Every integer is read with a gather of the 8 bytes from the one its first
+// bit is in, which holds the whole integer when it has at most 57 bits.
+
+[[gnu::target("avx2")]]
+auto tomurcuk::BitPacking::unpack32WithAvx2(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void {
+    auto bitIndex = index * bitWidth;
+    auto bitIndices0 = _mm256_setr_epi64x(bitIndex, bitIndex + bitWidth, bitIndex + 2 * bitWidth, bitIndex + 3 * bitWidth);
+    auto bitIndices1 = _mm256_add_epi64(bitIndices0, _mm256_set1_epi64x(4 * bitWidth));
+    auto step = _mm256_set1_epi64x(8 * bitWidth);
+    auto mask = _mm256_set1_epi64x((int64_t)getMask(bitWidth));
+    auto shiftMask = _mm256_set1_epi64x(7);
+    auto lowHalves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    auto i = INT64_C(0);
+    for (; i + 8 <= count; i += 8) {
+        auto vector0 = _mm256_i64gather_epi64((long long *)words, _mm256_srli_epi64(bitIndices0, 3), 1);
+        auto vector1 = _mm256_i64gather_epi64((long long *)words, _mm256_srli_epi64(bitIndices1, 3), 1);
+        vector0 = _mm256_and_si256(_mm256_srlv_epi64(vector0, _mm256_and_si256(bitIndices0, shiftMask)), mask);
+        vector1 = _mm256_and_si256(_mm256_srlv_epi64(vector1, _mm256_and_si256(bitIndices1, shiftMask)), mask);
+        auto packed0 = _mm256_permutevar8x32_epi32(vector0, lowHalves);
+        auto packed1 = _mm256_permutevar8x32_epi32(vector1, lowHalves);
+        _mm256_storeu_si256((__m256i *)(values + i), _mm256_permute2x128_si256(packed0, packed1, 0x20));
+        bitIndices0 = _mm256_add_epi64(bitIndices0, step);
+        bitIndices1 = _mm256_add_epi64(bitIndices1, step);
+    }
+    unpack32Portably(words, bitWidth, index + i, values + i, count - i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::BitPacking::unpack64WithAvx2(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void {
+    if (bitWidth > 57) {
+        unpack64Portably(words, bitWidth, index, values, count);
+        return;
+    }
+
+    auto bitIndex = index * bitWidth;
+    auto bitIndices = _mm256_setr_epi64x(bitIndex, bitIndex + bitWidth, bitIndex + 2 * bitWidth, bitIndex + 3 * bitWidth);
+    auto step = _mm256_set1_epi64x(4 * bitWidth);
+    auto mask = _mm256_set1_epi64x((int64_t)getMask(bitWidth));
+    auto shiftMask = _mm256_set1_epi64x(7);
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector = _mm256_i64gather_epi64((long long *)words, _mm256_srli_epi64(bitIndices, 3), 1);
+        vector = _mm256_and_si256(_mm256_srlv_epi64(vector, _mm256_and_si256(bitIndices, shiftMask)), mask);
+        _mm256_storeu_si256((__m256i *)(values + i), vector);
+        bitIndices = _mm256_add_epi64(bitIndices, step);
+    }
+    unpack64Portably(words, bitWidth, index + i, values + i, count - i);
+}
+
+#endif
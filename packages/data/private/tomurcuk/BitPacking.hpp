@@ -0,0 +1,119 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that move integers between plain arrays and arrays of 64-bit
+     * words that hold them in a fixed amount of bits each.
+     *
+     * Integer `i` is in bits `i * bitWidth` to `(i + 1) * bitWidth - 1` of the
+     * words, where bit `j` is bit `j % 64` of word `j / 64`. The words must
+     * have one more word after the last bit, which is read but not modified.
+     *
+     * Unpacking has a portable implementation and an AVX2 one; the fastest one
+     * the processor supports is selected on the first use.
+     */
+    class BitPacking {
+    public:
+        /**
+         * Provides the mask of the bits of an integer.
+         *
+         * @param[in] bitWidth The amount of bits of every integer.
+         * @return The value whose lowest `bitWidth` bits are set.
+         */
+        static auto getMask(int64_t bitWidth) -> uint64_t;
+
+        /**
+         * Reads an integer.
+         *
+         * @param[in] words The pointer to the words.
+         * @param[in] bitWidth The amount of bits of every integer.
+         * @param[in] index The index of the integer.
+         * @return The integer.
+         */
+        static auto get(uint64_t *words, int64_t bitWidth, int64_t index) -> uint64_t;
+
+        /**
+         * Writes an integer.
+         *
+         * @param[in,out] words The pointer to the words.
+         * @param[in] bitWidth The amount of bits of every integer.
+         * @param[in] index The index of the integer.
+         * @param[in] value The integer, which fits in the bits.
+         */
+        static auto set(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t value) -> void;
+
+        /**
+         * Reads consecutive integers into 32-bit ones.
+         *
+         * @param[in] words The pointer to the words.
+         * @param[in] bitWidth The amount of bits of every integer, which is at
+         * most 32.
+         * @param[in] index The index of the first integer.
+         * @param[out] values The pointer to the read integers.
+         * @param[in] count The amount of integers.
+         */
+        static auto unpack(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void;
+
+        /**
+         * Reads consecutive integers into 64-bit ones.
+         *
+         * @param[in] words The pointer to the words.
+         * @param[in] bitWidth The amount of bits of every integer.
+         * @param[in] index The index of the first integer.
+         * @param[out] values The pointer to the read integers.
+         * @param[in] count The amount of integers.
+         */
+        static auto unpack(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void;
+
+        /**
+         * Writes consecutive integers from 32-bit ones.
+         *
+         * @param[in,out] words The pointer to the words.
+         * @param[in] bitWidth The amount of bits of every integer, which is at
+         * most 32.
+         * @param[in] index The index of the first integer.
+         * @param[in] values The pointer to the written integers, which fit in
+         * the bits.
+         * @param[in] count The amount of integers.
+         */
+        static auto pack(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void;
+
+        /**
+         * Writes consecutive integers from 64-bit ones.
+         *
+         * @param[in,out] words The pointer to the words.
+         * @param[in] bitWidth The amount of bits of every integer.
+         * @param[in] index The index of the first integer.
+         * @param[in] values The pointer to the written integers, which fit in
+         * the bits.
+         * @param[in] count The amount of integers.
+         */
+        static auto pack(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*unpack32)(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void;
+            auto (*unpack64)(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto unpack32Portably(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void;
+        static auto unpack64Portably(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void;
+
+        static auto unpack32WithAvx2(uint64_t *words, int64_t bitWidth, int64_t index, uint32_t *values, int64_t count) -> void;
+        static auto unpack64WithAvx2(uint64_t *words, int64_t bitWidth, int64_t index, uint64_t *values, int64_t count) -> void;
+
+        /**
+         * Writes consecutive integers by filling whole words at a time.
+         */
+        template<typename Value>
+        static auto packAll(uint64_t *words, int64_t bitWidth, int64_t index, Value *values, int64_t count) -> void;
+    };
+}
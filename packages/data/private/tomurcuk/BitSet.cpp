@@ -0,0 +1,134 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/BitSet.hpp>
+#include <tomurcuk/BitWords.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::BitSet::initialize() -> void {
+    mWords = nullptr;
+    mWordCount = 0;
+    mBitCount = 0;
+}
+
+auto tomurcuk::BitSet::destroy(MemoryAllocator memoryAllocator) -> void {
+    memoryAllocator.deallocate(mWords, mWordCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+}
+
+auto tomurcuk::BitSet::resize(MemoryAllocator memoryAllocator, int64_t bitCount) -> Status {
+    assert(bitCount >= 0);
+
+    auto wordCount = (bitCount + 63) / 64;
+    if (wordCount != mWordCount) {
+        if (mWordCount == 0) {
+            // A fresh block might come zeroed for free; so, it is not reset
+            // here.
+            auto newBlockResult = memoryAllocator.allocateZeroed(wordCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mWords = (uint64_t *)*newBlockResult.value();
+        } else {
+            auto newBlockResult = memoryAllocator.reallocate(mWords, mWordCount * (int64_t)sizeof(uint64_t), wordCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mWords = (uint64_t *)*newBlockResult.value();
+            if (wordCount > mWordCount) {
+                Bytes::resetArray(mWords + mWordCount, wordCount - mWordCount);
+            }
+        }
+        mWordCount = wordCount;
+    }
+
+    // Clear the removed bits that share the last word with the kept ones.
+    if (bitCount % 64 != 0) {
+        mWords[wordCount - 1] &= (UINT64_C(1) << (uint64_t)(bitCount % 64)) - 1;
+    }
+    mBitCount = bitCount;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::BitSet::getBitCount() -> int64_t {
+    return mBitCount;
+}
+
+auto tomurcuk::BitSet::getWordCount() -> int64_t {
+    return mWordCount;
+}
+
+auto tomurcuk::BitSet::getWords() -> uint64_t * {
+    return mWords;
+}
+
+auto tomurcuk::BitSet::test(int64_t index) -> bool {
+    assert(index >= 0);
+    assert(index < mBitCount);
+
+    return ((mWords[index / 64] >> (uint64_t)(index % 64)) & 1U) != 0;
+}
+
+auto tomurcuk::BitSet::set(int64_t index) -> void {
+    assert(index >= 0);
+    assert(index < mBitCount);
+
+    mWords[index / 64] |= UINT64_C(1) << (uint64_t)(index % 64);
+}
+
+auto tomurcuk::BitSet::reset(int64_t index) -> void {
+    assert(index >= 0);
+    assert(index < mBitCount);
+
+    mWords[index / 64] &= ~(UINT64_C(1) << (uint64_t)(index % 64));
+}
+
+auto tomurcuk::BitSet::resetAll() -> void {
+    if (mWordCount != 0) {
+        Bytes::resetArray(mWords, mWordCount);
+    }
+}
+
+auto tomurcuk::BitSet::intersectWith(BitSet *other) -> void {
+    assert(other->mBitCount == mBitCount);
+
+    BitWords::intersect(mWords, other->mWords, mWordCount);
+}
+
+auto tomurcuk::BitSet::uniteWith(BitSet *other) -> void {
+    assert(other->mBitCount == mBitCount);
+
+    BitWords::unite(mWords, other->mWords, mWordCount);
+}
+
+auto tomurcuk::BitSet::subtract(BitSet *other) -> void {
+    assert(other->mBitCount == mBitCount);
+
+    BitWords::subtract(mWords, other->mWords, mWordCount);
+}
+
+auto tomurcuk::BitSet::countSetBits() -> int64_t {
+    return BitWords::countSetBits(mWords, mWordCount);
+}
+
+auto tomurcuk::BitSet::findNextSetBit(int64_t index) -> int64_t {
+    assert(index >= 0);
+    assert(index <= mBitCount);
+
+    auto wordIndex = index / 64;
+    if (wordIndex == mWordCount) {
+        return -1;
+    }
+    auto word = mWords[wordIndex] & (UINT64_MAX << (uint64_t)(index % 64));
+    if (word != 0) {
+        return wordIndex * 64 + __builtin_ctzll(word);
+    }
+
+    wordIndex++;
+    auto foundIndex = BitWords::findNonZeroWord(mWords + wordIndex, mWordCount - wordIndex);
+    if (foundIndex == -1) {
+        return -1;
+    }
+    wordIndex += foundIndex;
+    return wordIndex * 64 + __builtin_ctzll(mWords[wordIndex]);
+}
@@ -0,0 +1,197 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/BitWords.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::BitWords::intersect(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    assert(count >= 0);
+
+    getKernels().intersect(destination, source, count);
+}
+
+auto tomurcuk::BitWords::unite(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    assert(count >= 0);
+
+    getKernels().unite(destination, source, count);
+}
+
+auto tomurcuk::BitWords::subtract(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    assert(count >= 0);
+
+    getKernels().subtract(destination, source, count);
+}
+
+auto tomurcuk::BitWords::countSetBits(uint64_t *words, int64_t count) -> int64_t {
+    assert(count >= 0);
+
+    return getKernels().countSetBits(words, count);
+}
+
+auto tomurcuk::BitWords::findNonZeroWord(uint64_t *words, int64_t count) -> int64_t {
+    assert(count >= 0);
+
+    return getKernels().findNonZeroWord(words, count);
+}
+
+auto tomurcuk::BitWords::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::BitWords::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.intersect = &intersectPortably;
+    kernels.unite = &unitePortably;
+    kernels.subtract = &subtractPortably;
+    kernels.countSetBits = &countSetBitsPortably;
+    kernels.findNonZeroWord = &findNonZeroWordPortably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasPopcnt()) {
+        kernels.countSetBits = &countSetBitsWithPopcnt;
+    }
+
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.intersect = &intersectWithAvx2;
+        kernels.unite = &uniteWithAvx2;
+        kernels.subtract = &subtractWithAvx2;
+        kernels.countSetBits = &countSetBitsWithAvx2;
+        kernels.findNonZeroWord = &findNonZeroWordWithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::BitWords::intersectPortably(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        destination[i] &= source[i];
+    }
+}
+
+auto tomurcuk::BitWords::unitePortably(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        destination[i] |= source[i];
+    }
+}
+
+auto tomurcuk::BitWords::subtractPortably(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        destination[i] &= ~source[i];
+    }
+}
+
+auto tomurcuk::BitWords::countSetBitsPortably(uint64_t *words, int64_t count) -> int64_t {
+    auto setBitCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        setBitCount += __builtin_popcountll(words[i]);
+    }
+    return setBitCount;
+}
+
+auto tomurcuk::BitWords::findNonZeroWordPortably(uint64_t *words, int64_t count) -> int64_t {
+    for (auto i = INT64_C(0); i != count; i++) {
+        if (words[i] != 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("popcnt")]]
+auto tomurcuk::BitWords::countSetBitsWithPopcnt(uint64_t *words, int64_t count) -> int64_t {
+    // Separate sums keep the `popcnt` instructions independent.
+    auto setBitCount0 = INT64_C(0);
+    auto setBitCount1 = INT64_C(0);
+    auto i = INT64_C(0);
+    for (; i + 2 <= count; i += 2) {
+        setBitCount0 += _mm_popcnt_u64(words[i]);
+        setBitCount1 += _mm_popcnt_u64(words[i + 1]);
+    }
+    if (i != count) {
+        setBitCount0 += _mm_popcnt_u64(words[i]);
+    }
+    return setBitCount0 + setBitCount1;
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::BitWords::intersectWithAvx2(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector0 = _mm256_loadu_si256((__m256i *)(destination + i));
+        auto vector1 = _mm256_loadu_si256((__m256i *)(source + i));
+        _mm256_storeu_si256((__m256i *)(destination + i), _mm256_and_si256(vector0, vector1));
+    }
+    intersectPortably(destination + i, source + i, count - i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::BitWords::uniteWithAvx2(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector0 = _mm256_loadu_si256((__m256i *)(destination + i));
+        auto vector1 = _mm256_loadu_si256((__m256i *)(source + i));
+        _mm256_storeu_si256((__m256i *)(destination + i), _mm256_or_si256(vector0, vector1));
+    }
+    unitePortably(destination + i, source + i, count - i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::BitWords::subtractWithAvx2(uint64_t *destination, uint64_t *source, int64_t count) -> void {
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector0 = _mm256_loadu_si256((__m256i *)(destination + i));
+        auto vector1 = _mm256_loadu_si256((__m256i *)(source + i));
+        _mm256_storeu_si256((__m256i *)(destination + i), _mm256_andnot_si256(vector1, vector0));
+    }
+    subtractPortably(destination + i, source + i, count - i);
+}
+
+[[gnu::target("avx2,popcnt")]]
+auto tomurcuk::BitWords::countSetBitsWithAvx2(uint64_t *words, int64_t count) -> int64_t {
+    // Look up the counts of both nibbles of every byte, and add the bytes of
+    // each lane together with `vpsadbw`.
+    auto const lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    auto const lowMask = _mm256_set1_epi8(0x0F);
+    auto sums = _mm256_setzero_si256();
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector = _mm256_loadu_si256((__m256i *)(words + i));
+        auto low = _mm256_and_si256(vector, lowMask);
+        auto high = _mm256_and_si256(_mm256_srli_epi16(vector, 4), lowMask);
+        auto counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+    }
+    auto setBitCount = _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) + _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3);
+    for (; i != count; i++) {
+        setBitCount += (int64_t)_mm_popcnt_u64(words[i]);
+    }
+    return setBitCount;
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::BitWords::findNonZeroWordWithAvx2(uint64_t *words, int64_t count) -> int64_t {
+    auto i = INT64_C(0);
+    for (; i + 8 <= count; i += 8) {
+        auto vector0 = _mm256_loadu_si256((__m256i *)(words + i));
+        auto vector1 = _mm256_loadu_si256((__m256i *)(words + i + 4));
+        auto vector = _mm256_or_si256(vector0, vector1);
+        if (_mm256_testz_si256(vector, vector) == 0) {
+            break;
+        }
+    }
+    for (; i != count; i++) {
+        if (words[i] != 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif
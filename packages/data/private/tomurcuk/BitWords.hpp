@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that work on arrays of 64-bit words that hold bits.
+     *
+     * Each operation has a portable implementation and an AVX2 one; the
+     * fastest one the processor supports is selected on the first use.
+     */
+    class BitWords {
+    public:
+        /**
+         * Keeps the bits that are set in both arrays.
+         *
+         * @param[in,out] destination The pointer to the modified words.
+         * @param[in] source The pointer to the other words.
+         * @param[in] count The amount of words.
+         */
+        static auto intersect(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+
+        /**
+         * Sets the bits that are set in either array.
+         *
+         * @param[in,out] destination The pointer to the modified words.
+         * @param[in] source The pointer to the other words.
+         * @param[in] count The amount of words.
+         */
+        static auto unite(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+
+        /**
+         * Resets the bits that are set in another array.
+         *
+         * @param[in,out] destination The pointer to the modified words.
+         * @param[in] source The pointer to the words that have the reset bits.
+         * @param[in] count The amount of words.
+         */
+        static auto subtract(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+
+        /**
+         * Counts the set bits.
+         *
+         * @param[in] words The pointer to the counted words.
+         * @param[in] count The amount of words.
+         * @return The amount of set bits.
+         */
+        static auto countSetBits(uint64_t *words, int64_t count) -> int64_t;
+
+        /**
+         * Finds the first word that has a set bit.
+         *
+         * @param[in] words The pointer to the searched words.
+         * @param[in] count The amount of words.
+         * @return The index of the first non-zero word if there is one.
+         * Otherwise, `-1`.
+         */
+        static auto findNonZeroWord(uint64_t *words, int64_t count) -> int64_t;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*intersect)(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+            auto (*unite)(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+            auto (*subtract)(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+            auto (*countSetBits)(uint64_t *words, int64_t count) -> int64_t;
+            auto (*findNonZeroWord)(uint64_t *words, int64_t count) -> int64_t;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto intersectPortably(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+        static auto unitePortably(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+        static auto subtractPortably(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+        static auto countSetBitsPortably(uint64_t *words, int64_t count) -> int64_t;
+        static auto findNonZeroWordPortably(uint64_t *words, int64_t count) -> int64_t;
+
+        static auto countSetBitsWithPopcnt(uint64_t *words, int64_t count) -> int64_t;
+
+        static auto intersectWithAvx2(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+        static auto uniteWithAvx2(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+        static auto subtractWithAvx2(uint64_t *destination, uint64_t *source, int64_t count) -> void;
+        static auto countSetBitsWithAvx2(uint64_t *words, int64_t count) -> int64_t;
+        static auto findNonZeroWordWithAvx2(uint64_t *words, int64_t count) -> int64_t;
+    };
+}
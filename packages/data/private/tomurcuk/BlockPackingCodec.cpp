@@ -0,0 +1,182 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BlockPackingCodec.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::BlockPackingCodec::encode(MemoryAllocator memoryAllocator, ArrayList<uint32_t> *words, ArrayListView<uint32_t> values) -> Status {
+    if (values.isEmpty()) {
+        return Status::eSuccess;
+    }
+
+    auto blockCount = (values.getCount() + kBlockCount - 1) / kBlockCount;
+    if (!words->reserve(memoryAllocator, blockCount * (1 + kBlockCount))) {
+        return Status::eFailure;
+    }
+
+    auto array = values.getArray();
+    auto wordCount = INT64_C(0);
+    uint32_t lastBlock[kBlockCount];
+    for (auto i = INT64_C(0); i < values.getCount(); i += kBlockCount) {
+        // The last block is copied, so that the padding is read from there.
+        auto block = array + i;
+        if (values.getCount() - i < kBlockCount) {
+            Bytes::copyArray(lastBlock, block, values.getCount() - i);
+            Bytes::resetArray(lastBlock + values.getCount() - i, kBlockCount - (values.getCount() - i));
+            block = lastBlock;
+        }
+
+        auto bits = UINT32_C(0);
+        for (auto j = INT64_C(0); j != kBlockCount; j++) {
+            bits |= block[j];
+        }
+        auto bitWidth = bits == 0 ? INT64_C(0) : 32 - (int64_t)__builtin_clz(bits);
+        auto blockWords = words->getEnd() + wordCount;
+        blockWords[0] = (uint32_t)bitWidth;
+        packBlock(bitWidth, block, blockWords + 1);
+        wordCount += 1 + kLaneCount * bitWidth;
+    }
+    words->acknowledge(wordCount);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::BlockPackingCodec::decode(ArrayListView<uint32_t> words, ArrayListView<uint32_t> values) -> int64_t {
+    auto array = words.getArray();
+    auto offset = INT64_C(0);
+    uint32_t lastBlock[kBlockCount];
+    for (auto i = INT64_C(0); i < values.getCount(); i += kBlockCount) {
+        if (offset == words.getCount()) {
+            return -1;
+        }
+        auto bitWidth = (int64_t)array[offset];
+        if (bitWidth > 32 || words.getCount() - offset - 1 < kLaneCount * bitWidth) {
+            return -1;
+        }
+
+        // The last block is unpacked aside, so that its padding is dropped.
+        if (values.getCount() - i < kBlockCount) {
+            unpackBlock(bitWidth, array + offset + 1, lastBlock);
+            Bytes::copyArray(values.getArray() + i, lastBlock, values.getCount() - i);
+        } else {
+            unpackBlock(bitWidth, array + offset + 1, values.getArray() + i);
+        }
+        offset += 1 + kLaneCount * bitWidth;
+    }
+    return offset;
+}
+
+auto tomurcuk::BlockPackingCodec::packBlock(int64_t bitWidth, uint32_t *values, uint32_t *words) -> void {
+    static constexpr decltype(&packBlock<0>) kKernels[] = {
+        &packBlock<0>, &packBlock<1>, &packBlock<2>, &packBlock<3>, &packBlock<4>, &packBlock<5>, &packBlock<6>, &packBlock<7>, &packBlock<8>,
+        &packBlock<9>, &packBlock<10>, &packBlock<11>, &packBlock<12>, &packBlock<13>, &packBlock<14>, &packBlock<15>, &packBlock<16>,
+        &packBlock<17>, &packBlock<18>, &packBlock<19>, &packBlock<20>, &packBlock<21>, &packBlock<22>, &packBlock<23>, &packBlock<24>,
+        &packBlock<25>, &packBlock<26>, &packBlock<27>, &packBlock<28>, &packBlock<29>, &packBlock<30>, &packBlock<31>, &packBlock<32>,
+    };
+
+    kKernels[bitWidth](values, words);
+}
+
+auto tomurcuk::BlockPackingCodec::unpackBlock(int64_t bitWidth, uint32_t *words, uint32_t *values) -> void {
+    static constexpr decltype(&unpackBlock<0>) kKernels[] = {
+        &unpackBlock<0>, &unpackBlock<1>, &unpackBlock<2>, &unpackBlock<3>, &unpackBlock<4>, &unpackBlock<5>, &unpackBlock<6>, &unpackBlock<7>, &unpackBlock<8>,
+        &unpackBlock<9>, &unpackBlock<10>, &unpackBlock<11>, &unpackBlock<12>, &unpackBlock<13>, &unpackBlock<14>, &unpackBlock<15>, &unpackBlock<16>,
+        &unpackBlock<17>, &unpackBlock<18>, &unpackBlock<19>, &unpackBlock<20>, &unpackBlock<21>, &unpackBlock<22>, &unpackBlock<23>, &unpackBlock<24>,
+        &unpackBlock<25>, &unpackBlock<26>, &unpackBlock<27>, &unpackBlock<28>, &unpackBlock<29>, &unpackBlock<30>, &unpackBlock<31>, &unpackBlock<32>,
+    };
+
+    kKernels[bitWidth](words, values);
+}
+
+// Integer `i` of a lane starts at bit `i * kBitWidth` of the lane; so, after
+// the loops are unrolled, every shift and every word boundary is known at
+// compile-time.
+
+template<int64_t kBitWidth>
+auto tomurcuk::BlockPackingCodec::packBlock(uint32_t *values, uint32_t *words) -> void {
+    if constexpr (kBitWidth != 0) {
+#if defined(__x86_64__)
+        auto accumulator = _mm_setzero_si128();
+        auto wordIndex = INT64_C(0);
+        for (auto i = INT64_C(0); i != kLaneValueCount; i++) {
+            auto value = _mm_loadu_si128((__m128i *)(values + i * kLaneCount));
+            auto shift = (int)(i * kBitWidth % 32);
+            accumulator = _mm_or_si128(accumulator, _mm_slli_epi32(value, shift));
+            if (shift + kBitWidth >= 32) {
+                _mm_storeu_si128((__m128i *)(words + wordIndex * kLaneCount), accumulator);
+                wordIndex++;
+                accumulator = shift + kBitWidth > 32 ? _mm_srli_epi32(value, 32 - shift) : _mm_setzero_si128();
+            }
+        }
+#else
+        for (auto lane = INT64_C(0); lane != kLaneCount; lane++) {
+            auto accumulator = UINT32_C(0);
+            auto wordIndex = INT64_C(0);
+            for (auto i = INT64_C(0); i != kLaneValueCount; i++) {
+                auto value = values[i * kLaneCount + lane];
+                auto shift = (uint32_t)(i * kBitWidth % 32);
+                accumulator |= value << shift;
+                if (shift + kBitWidth >= 32) {
+                    words[wordIndex * kLaneCount + lane] = accumulator;
+                    wordIndex++;
+                    accumulator = shift + kBitWidth > 32 ? value >> (32 - shift) : 0;
+                }
+            }
+        }
+#endif
+    }
+}
+
+template<int64_t kBitWidth>
+auto tomurcuk::BlockPackingCodec::unpackBlock(uint32_t *words, uint32_t *values) -> void {
+    static constexpr auto kMask = kBitWidth == 32 ? UINT32_MAX : (UINT32_C(1) << (uint32_t)kBitWidth) - 1;
+
+    if constexpr (kBitWidth == 0) {
+        Bytes::resetArray(values, kBlockCount);
+    } else {
+#if defined(__x86_64__)
+        auto mask = _mm_set1_epi32((int32_t)kMask);
+        auto word = _mm_loadu_si128((__m128i *)words);
+        auto wordIndex = INT64_C(0);
+        for (auto i = INT64_C(0); i != kLaneValueCount; i++) {
+            auto shift = (int)(i * kBitWidth % 32);
+            auto value = _mm_srli_epi32(word, shift);
+            if (shift + kBitWidth >= 32) {
+                // The last integer ends with the last word.
+                wordIndex++;
+                if (wordIndex != kBitWidth) {
+                    word = _mm_loadu_si128((__m128i *)(words + wordIndex * kLaneCount));
+                }
+                if (shift + kBitWidth > 32) {
+                    value = _mm_or_si128(value, _mm_slli_epi32(word, 32 - shift));
+                }
+            }
+            _mm_storeu_si128((__m128i *)(values + i * kLaneCount), _mm_and_si128(value, mask));
+        }
+#else
+        for (auto lane = INT64_C(0); lane != kLaneCount; lane++) {
+            auto word = words[lane];
+            auto wordIndex = INT64_C(0);
+            for (auto i = INT64_C(0); i != kLaneValueCount; i++) {
+                auto shift = (uint32_t)(i * kBitWidth % 32);
+                auto value = word >> shift;
+                if (shift + kBitWidth >= 32) {
+                    wordIndex++;
+                    if (wordIndex != kBitWidth) {
+                        word = words[wordIndex * kLaneCount + lane];
+                    }
+                    if (shift + kBitWidth > 32) {
+                        value |= word << (32 - shift);
+                    }
+                }
+                values[i * kLaneCount + lane] = value & kMask;
+            }
+        }
+#endif
+    }
+}
@@ -0,0 +1,168 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/DeltaCodec.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::DeltaCodec::encode(ArrayListView<uint32_t> values) -> void {
+    encodeAll(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::encode(ArrayListView<uint64_t> values) -> void {
+    encodeAll(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::decode(ArrayListView<uint32_t> values) -> void {
+    getKernels().sumPrefixes32(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::decode(ArrayListView<uint64_t> values) -> void {
+    getKernels().sumPrefixes64(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::encodeSecondOrder(ArrayListView<uint32_t> values) -> void {
+    encodeAllSecondOrder(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::encodeSecondOrder(ArrayListView<uint64_t> values) -> void {
+    encodeAllSecondOrder(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::decodeSecondOrder(ArrayListView<uint32_t> values) -> void {
+    if (values.getCount() < 2) {
+        return;
+    }
+
+    // The first-order differences are restored first, and then the integers
+    // from them.
+    auto kernels = getKernels();
+    decodeZigzags(values.getArray() + 1, values.getCount() - 1);
+    kernels.sumPrefixes32(values.getArray() + 1, values.getCount() - 1);
+    kernels.sumPrefixes32(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::decodeSecondOrder(ArrayListView<uint64_t> values) -> void {
+    if (values.getCount() < 2) {
+        return;
+    }
+
+    auto kernels = getKernels();
+    decodeZigzags(values.getArray() + 1, values.getCount() - 1);
+    kernels.sumPrefixes64(values.getArray() + 1, values.getCount() - 1);
+    kernels.sumPrefixes64(values.getArray(), values.getCount());
+}
+
+auto tomurcuk::DeltaCodec::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::DeltaCodec::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.sumPrefixes32 = &sumPrefixes32Portably;
+    kernels.sumPrefixes64 = &sumPrefixes64Portably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.sumPrefixes32 = &sumPrefixes32WithAvx2;
+        kernels.sumPrefixes64 = &sumPrefixes64WithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::DeltaCodec::sumPrefixes32Portably(uint32_t *values, int64_t count) -> void {
+    for (auto i = INT64_C(1); i < count; i++) {
+        values[i] += values[i - 1];
+    }
+}
+
+auto tomurcuk::DeltaCodec::sumPrefixes64Portably(uint64_t *values, int64_t count) -> void {
+    for (auto i = INT64_C(1); i < count; i++) {
+        values[i] += values[i - 1];
+    }
+}
+
+template<typename Value>
+auto tomurcuk::DeltaCodec::encodeAll(Value *values, int64_t count) -> void {
+    for (auto i = count - 1; i > 0; i--) {
+        values[i] -= values[i - 1];
+    }
+}
+
+template<typename Value>
+auto tomurcuk::DeltaCodec::encodeAllSecondOrder(Value *values, int64_t count) -> void {
+    static constexpr auto kSignShift = (uint64_t)sizeof(Value) * 8 - 1;
+
+    // The integers are visited from the end, so that the ones the differences
+    // are computed from are not encoded yet.
+    for (auto i = count - 1; i > 0; i--) {
+        Value difference = values[i] - values[i - 1];
+        if (i > 1) {
+            difference -= values[i - 1] - values[i - 2];
+        }
+        values[i] = (Value)(difference << 1U) ^ (Value)(0 - (difference >> kSignShift));
+    }
+}
+
+template<typename Value>
+auto tomurcuk::DeltaCodec::decodeZigzags(Value *values, int64_t count) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        values[i] = (Value)(values[i] >> 1U) ^ (Value)(0 - (values[i] & 1U));
+    }
+}
+
+#if defined(__x86_64__)
+
+// Every vector is summed within its 128-bit halves by adding it shifted by one
+// element, and then by two for 32-bit elements. Then, the total of the lower
+// half is added to the upper one, and the total of the previous vectors to the
+// whole vector.
+
+[[gnu::target("avx2")]]
+auto tomurcuk::DeltaCodec::sumPrefixes32WithAvx2(uint32_t *values, int64_t count) -> void {
+    auto zero = _mm256_setzero_si256();
+    auto carry = zero;
+    auto lowTotalIndices = _mm256_set1_epi32(3);
+    auto totalIndices = _mm256_set1_epi32(7);
+    auto i = INT64_C(0);
+    for (; i + 8 <= count; i += 8) {
+        auto vector = _mm256_loadu_si256((__m256i *)(values + i));
+        vector = _mm256_add_epi32(vector, _mm256_slli_si256(vector, 4));
+        vector = _mm256_add_epi32(vector, _mm256_slli_si256(vector, 8));
+        auto lowTotals = _mm256_permutevar8x32_epi32(vector, lowTotalIndices);
+        vector = _mm256_add_epi32(vector, _mm256_blend_epi32(zero, lowTotals, 0xF0));
+        vector = _mm256_add_epi32(vector, carry);
+        _mm256_storeu_si256((__m256i *)(values + i), vector);
+        carry = _mm256_permutevar8x32_epi32(vector, totalIndices);
+    }
+    if (i != 0 && i != count) {
+        values[i] += values[i - 1];
+    }
+    sumPrefixes32Portably(values + i, count - i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::DeltaCodec::sumPrefixes64WithAvx2(uint64_t *values, int64_t count) -> void {
+    auto zero = _mm256_setzero_si256();
+    auto carry = zero;
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector = _mm256_loadu_si256((__m256i *)(values + i));
+        vector = _mm256_add_epi64(vector, _mm256_slli_si256(vector, 8));
+        auto lowTotals = _mm256_permute4x64_epi64(vector, 0x55);
+        vector = _mm256_add_epi64(vector, _mm256_blend_epi32(zero, lowTotals, 0xF0));
+        vector = _mm256_add_epi64(vector, carry);
+        _mm256_storeu_si256((__m256i *)(values + i), vector);
+        carry = _mm256_permute4x64_epi64(vector, 0xFF);
+    }
+    if (i != 0 && i != count) {
+        values[i] += values[i - 1];
+    }
+    sumPrefixes64Portably(values + i, count - i);
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BitPacking.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/FrameOfReferenceCodec.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::FrameOfReferenceCodec::encode(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words, ArrayListView<uint32_t> values) -> Status {
+    return encodeAll(memoryAllocator, words, values.getArray(), values.getCount());
+}
+
+auto tomurcuk::FrameOfReferenceCodec::encode(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words, ArrayListView<uint64_t> values) -> Status {
+    return encodeAll(memoryAllocator, words, values.getArray(), values.getCount());
+}
+
+auto tomurcuk::FrameOfReferenceCodec::decode(ArrayListView<uint64_t> words, ArrayListView<uint32_t> values) -> int64_t {
+    return decodeAll(words.getArray(), words.getCount(), values.getArray(), values.getCount());
+}
+
+auto tomurcuk::FrameOfReferenceCodec::decode(ArrayListView<uint64_t> words, ArrayListView<uint64_t> values) -> int64_t {
+    return decodeAll(words.getArray(), words.getCount(), values.getArray(), values.getCount());
+}
+
+auto tomurcuk::FrameOfReferenceCodec::getPackedWordCount(int64_t bitWidth, int64_t count) -> int64_t {
+    if (bitWidth == 0) {
+        return 0;
+    }
+
+    // The kernels of BitPacking read one more word after the last bit.
+    return (count * bitWidth + 63) / 64 + 1;
+}
+
+template<typename Value>
+auto tomurcuk::FrameOfReferenceCodec::encodeAll(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words, Value *values, int64_t count) -> Status {
+    static constexpr auto kChunkCount = INT64_C(256);
+
+    if (count == 0) {
+        return Status::eSuccess;
+    }
+
+    auto least = values[0];
+    auto greatest = values[0];
+    for (auto i = INT64_C(1); i != count; i++) {
+        least = values[i] < least ? values[i] : least;
+        greatest = values[i] > greatest ? values[i] : greatest;
+    }
+    auto range = (uint64_t)(greatest - least);
+    auto bitWidth = range == 0 ? INT64_C(0) : 64 - (int64_t)__builtin_clzll(range);
+    auto packedWordCount = getPackedWordCount(bitWidth, count);
+    if (!words->reserve(memoryAllocator, kHeaderWordCount + packedWordCount)) {
+        return Status::eFailure;
+    }
+
+    auto frame = words->getEnd();
+    frame[0] = (uint64_t)least;
+    frame[1] = (uint64_t)bitWidth;
+    if (bitWidth != 0) {
+        // Packing keeps the bits around the integers; so, the words are reset
+        // first. The differences are packed a chunk at a time.
+        Bytes::resetArray(frame + kHeaderWordCount, packedWordCount);
+        Value differences[kChunkCount];
+        for (auto i = INT64_C(0); i < count; i += kChunkCount) {
+            auto chunkCount = count - i < kChunkCount ? count - i : kChunkCount;
+            for (auto j = INT64_C(0); j != chunkCount; j++) {
+                differences[j] = values[i + j] - least;
+            }
+            BitPacking::pack(frame + kHeaderWordCount, bitWidth, i, differences, chunkCount);
+        }
+    }
+    words->acknowledge(kHeaderWordCount + packedWordCount);
+    return Status::eSuccess;
+}
+
+template<typename Value>
+auto tomurcuk::FrameOfReferenceCodec::decodeAll(uint64_t *words, int64_t wordCount, Value *values, int64_t count) -> int64_t {
+    if (count == 0) {
+        return 0;
+    }
+    if (wordCount < kHeaderWordCount) {
+        return -1;
+    }
+
+    auto least = words[0];
+    auto bitWidth = words[1];
+    if (bitWidth > sizeof(Value) * 8 || least > (Value)-1) {
+        return -1;
+    }
+    auto packedWordCount = getPackedWordCount((int64_t)bitWidth, count);
+    if (wordCount - kHeaderWordCount < packedWordCount) {
+        return -1;
+    }
+
+    if (bitWidth == 0) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            values[i] = (Value)least;
+        }
+    } else {
+        BitPacking::unpack(words + kHeaderWordCount, (int64_t)bitWidth, 0, values, count);
+        for (auto i = INT64_C(0); i != count; i++) {
+            values[i] += (Value)least;
+        }
+    }
+    return kHeaderWordCount + packedWordCount;
+}
@@ -0,0 +1,150 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/KeySearch.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::KeySearch::countLess(int32_t *keys, int64_t count, int32_t key) -> int64_t {
+    assert(count >= 0);
+
+    return getKernels().countLessInt32(keys, count, key);
+}
+
+auto tomurcuk::KeySearch::countLess(uint32_t *keys, int64_t count, uint32_t key) -> int64_t {
+    assert(count >= 0);
+
+    return getKernels().countLessUint32(keys, count, key);
+}
+
+auto tomurcuk::KeySearch::countLess(int64_t *keys, int64_t count, int64_t key) -> int64_t {
+    assert(count >= 0);
+
+    return getKernels().countLessInt64(keys, count, key);
+}
+
+auto tomurcuk::KeySearch::countLess(uint64_t *keys, int64_t count, uint64_t key) -> int64_t {
+    assert(count >= 0);
+
+    return getKernels().countLessUint64(keys, count, key);
+}
+
+auto tomurcuk::KeySearch::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::KeySearch::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.countLessInt32 = &countLessInt32Portably;
+    kernels.countLessUint32 = &countLessUint32Portably;
+    kernels.countLessInt64 = &countLessInt64Portably;
+    kernels.countLessUint64 = &countLessUint64Portably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.countLessInt32 = &countLessInt32WithAvx2;
+        kernels.countLessUint32 = &countLessUint32WithAvx2;
+        kernels.countLessInt64 = &countLessInt64WithAvx2;
+        kernels.countLessUint64 = &countLessUint64WithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::KeySearch::countLessInt32Portably(int32_t *keys, int64_t count, int32_t key) -> int64_t {
+    auto lessCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        lessCount += keys[i] < key;
+    }
+    return lessCount;
+}
+
+auto tomurcuk::KeySearch::countLessUint32Portably(uint32_t *keys, int64_t count, uint32_t key) -> int64_t {
+    auto lessCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        lessCount += keys[i] < key;
+    }
+    return lessCount;
+}
+
+auto tomurcuk::KeySearch::countLessInt64Portably(int64_t *keys, int64_t count, int64_t key) -> int64_t {
+    auto lessCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        lessCount += keys[i] < key;
+    }
+    return lessCount;
+}
+
+auto tomurcuk::KeySearch::countLessUint64Portably(uint64_t *keys, int64_t count, uint64_t key) -> int64_t {
+    auto lessCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        lessCount += keys[i] < key;
+    }
+    return lessCount;
+}
+
+#if defined(__x86_64__)
+
+// Every vector is compared, instead of stopping at the first one that has a
+// key that is not less, since where that happens is as unpredictable as the
+// searched key.
+
+[[gnu::target("avx2,popcnt")]]
+auto tomurcuk::KeySearch::countLessInt32WithAvx2(int32_t *keys, int64_t count, int32_t key) -> int64_t {
+    auto target = _mm256_set1_epi32(key);
+    auto lessCount = INT64_C(0);
+    auto i = INT64_C(0);
+    for (; i + 8 <= count; i += 8) {
+        auto vector = _mm256_loadu_si256((__m256i *)(keys + i));
+        auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, vector)));
+        lessCount += _mm_popcnt_u32((uint32_t)mask);
+    }
+    return lessCount + countLessInt32Portably(keys + i, count - i, key);
+}
+
+[[gnu::target("avx2,popcnt")]]
+auto tomurcuk::KeySearch::countLessUint32WithAvx2(uint32_t *keys, int64_t count, uint32_t key) -> int64_t {
+    // Flipping the sign bits turns the unsigned order into the signed one.
+    auto signBits = _mm256_set1_epi32(INT32_MIN);
+    auto target = _mm256_xor_si256(_mm256_set1_epi32((int32_t)key), signBits);
+    auto lessCount = INT64_C(0);
+    auto i = INT64_C(0);
+    for (; i + 8 <= count; i += 8) {
+        auto vector = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(keys + i)), signBits);
+        auto mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(target, vector)));
+        lessCount += _mm_popcnt_u32((uint32_t)mask);
+    }
+    return lessCount + countLessUint32Portably(keys + i, count - i, key);
+}
+
+[[gnu::target("avx2,popcnt")]]
+auto tomurcuk::KeySearch::countLessInt64WithAvx2(int64_t *keys, int64_t count, int64_t key) -> int64_t {
+    auto target = _mm256_set1_epi64x(key);
+    auto lessCount = INT64_C(0);
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector = _mm256_loadu_si256((__m256i *)(keys + i));
+        auto mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(target, vector)));
+        lessCount += _mm_popcnt_u32((uint32_t)mask);
+    }
+    return lessCount + countLessInt64Portably(keys + i, count - i, key);
+}
+
+[[gnu::target("avx2,popcnt")]]
+auto tomurcuk::KeySearch::countLessUint64WithAvx2(uint64_t *keys, int64_t count, uint64_t key) -> int64_t {
+    auto signBits = _mm256_set1_epi64x(INT64_MIN);
+    auto target = _mm256_xor_si256(_mm256_set1_epi64x((int64_t)key), signBits);
+    auto lessCount = INT64_C(0);
+    auto i = INT64_C(0);
+    for (; i + 4 <= count; i += 4) {
+        auto vector = _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(keys + i)), signBits);
+        auto mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(target, vector)));
+        lessCount += _mm_popcnt_u32((uint32_t)mask);
+    }
+    return lessCount + countLessUint64Portably(keys + i, count - i, key);
+}
+
+#endif
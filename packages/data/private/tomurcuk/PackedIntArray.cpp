@@ -0,0 +1,188 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BitPacking.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/PackedIntArray.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::PackedIntArray::initialize(int64_t bitWidth) -> void {
+    assert(bitWidth > 0);
+    assert(bitWidth <= 64);
+
+    mWords = nullptr;
+    mCapacity = 0;
+    mCount = 0;
+    mBitWidth = bitWidth;
+}
+
+auto tomurcuk::PackedIntArray::destroy(MemoryAllocator memoryAllocator) -> void {
+    memoryAllocator.deallocate(mWords, getWordCount(mCapacity) * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+}
+
+auto tomurcuk::PackedIntArray::getBitWidth() -> int64_t {
+    return mBitWidth;
+}
+
+auto tomurcuk::PackedIntArray::getCount() -> int64_t {
+    return mCount;
+}
+
+auto tomurcuk::PackedIntArray::getAllocatedCount() -> int64_t {
+    return mCapacity;
+}
+
+auto tomurcuk::PackedIntArray::isEmpty() -> bool {
+    return mCount == 0;
+}
+
+auto tomurcuk::PackedIntArray::get(int64_t index) -> uint64_t {
+    assert(index >= 0);
+    assert(index < mCount);
+
+    return BitPacking::get(mWords, mBitWidth, index);
+}
+
+auto tomurcuk::PackedIntArray::set(int64_t index, uint64_t value) -> void {
+    assert(index >= 0);
+    assert(index < mCount);
+
+    BitPacking::set(mWords, mBitWidth, index, value);
+}
+
+auto tomurcuk::PackedIntArray::add(MemoryAllocator memoryAllocator, uint64_t value) -> Status {
+    if (reserve(memoryAllocator, 1) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    mCount++;
+    BitPacking::set(mWords, mBitWidth, mCount - 1, value);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PackedIntArray::addAll(MemoryAllocator memoryAllocator, ArrayListView<uint32_t> view) -> Status {
+    if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    auto index = mCount;
+    mCount += view.getCount();
+    pack(index, view);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PackedIntArray::addAll(MemoryAllocator memoryAllocator, ArrayListView<uint64_t> view) -> Status {
+    if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    auto index = mCount;
+    mCount += view.getCount();
+    pack(index, view);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PackedIntArray::unpack(int64_t index, ArrayListView<uint32_t> view) -> void {
+    assert(index >= 0);
+    assert(index <= mCount - view.getCount());
+
+    if (view.isEmpty()) {
+        return;
+    }
+    BitPacking::unpack(mWords, mBitWidth, index, view.getArray(), view.getCount());
+}
+
+auto tomurcuk::PackedIntArray::unpack(int64_t index, ArrayListView<uint64_t> view) -> void {
+    assert(index >= 0);
+    assert(index <= mCount - view.getCount());
+
+    if (view.isEmpty()) {
+        return;
+    }
+    BitPacking::unpack(mWords, mBitWidth, index, view.getArray(), view.getCount());
+}
+
+auto tomurcuk::PackedIntArray::pack(int64_t index, ArrayListView<uint32_t> view) -> void {
+    assert(index >= 0);
+    assert(index <= mCount - view.getCount());
+
+    if (view.isEmpty()) {
+        return;
+    }
+    BitPacking::pack(mWords, mBitWidth, index, view.getArray(), view.getCount());
+}
+
+auto tomurcuk::PackedIntArray::pack(int64_t index, ArrayListView<uint64_t> view) -> void {
+    assert(index >= 0);
+    assert(index <= mCount - view.getCount());
+
+    if (view.isEmpty()) {
+        return;
+    }
+    BitPacking::pack(mWords, mBitWidth, index, view.getArray(), view.getCount());
+}
+
+auto tomurcuk::PackedIntArray::resize(MemoryAllocator memoryAllocator, int64_t count) -> Status {
+    assert(count >= 0);
+
+    if (count < mCount) {
+        resetFrom(count);
+    } else if (reserve(memoryAllocator, count - mCount) == Status::eFailure) {
+        return Status::eFailure;
+    }
+
+    // The bits after the last integer are already `0`; so, the added integers
+    // need no writes.
+    mCount = count;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PackedIntArray::removeAll() -> void {
+    resetFrom(0);
+    mCount = 0;
+}
+
+auto tomurcuk::PackedIntArray::reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+    auto newCapacity = Bytes::growCapacity(mCapacity, mCount, amount);
+    if (newCapacity == mCapacity) {
+        return Status::eSuccess;
+    }
+
+    assert(newCapacity <= INT64_MAX / mBitWidth - 128);
+
+    auto wordCount = getWordCount(mCapacity);
+    auto newWordCount = getWordCount(newCapacity);
+    auto newBlockResult = memoryAllocator.reallocate(mWords, wordCount * (int64_t)sizeof(uint64_t), newWordCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    if (newBlockResult.isFailure()) {
+        return Status::eFailure;
+    }
+
+    mWords = (uint64_t *)*newBlockResult.value();
+    mCapacity = newCapacity;
+    if (newWordCount != wordCount) {
+        Bytes::resetArray(mWords + wordCount, newWordCount - wordCount);
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PackedIntArray::getWordCount(int64_t count) -> int64_t {
+    if (count == 0) {
+        return 0;
+    }
+    return (count * mBitWidth + 63) / 64 + 1;
+}
+
+auto tomurcuk::PackedIntArray::resetFrom(int64_t index) -> void {
+    if (index == mCount) {
+        return;
+    }
+
+    auto bitIndex = index * mBitWidth;
+    auto wordIndex = bitIndex / 64;
+    if (bitIndex % 64 != 0) {
+        mWords[wordIndex] &= (UINT64_C(1) << (uint64_t)(bitIndex % 64)) - 1;
+        wordIndex++;
+    }
+    auto endWordIndex = (mCount * mBitWidth + 63) / 64;
+    if (wordIndex < endWordIndex) {
+        Bytes::resetArray(mWords + wordIndex, endWordIndex - wordIndex);
+    }
+}
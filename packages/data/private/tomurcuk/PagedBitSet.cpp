@@ -0,0 +1,214 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/BitWords.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/PagedBitSet.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::PagedBitSet::initialize() -> void {
+    mPages = nullptr;
+    mPageCount = 0;
+    mBitCount = 0;
+}
+
+auto tomurcuk::PagedBitSet::destroy(MemoryAllocator memoryAllocator) -> void {
+    resetAll(memoryAllocator);
+    memoryAllocator.deallocate(mPages, mPageCount * (int64_t)sizeof(uint64_t *), alignof(uint64_t *));
+}
+
+auto tomurcuk::PagedBitSet::resize(MemoryAllocator memoryAllocator, int64_t bitCount) -> Status {
+    assert(bitCount >= 0);
+
+    auto pageCount = (bitCount + kPageBitCount - 1) / kPageBitCount;
+    for (auto i = mPageCount - 1; i >= pageCount; i--) {
+        deallocatePage(memoryAllocator, i);
+    }
+    if (pageCount != mPageCount) {
+        auto newBlockResult = memoryAllocator.reallocate(mPages, mPageCount * (int64_t)sizeof(uint64_t *), pageCount * (int64_t)sizeof(uint64_t *), alignof(uint64_t *));
+        if (newBlockResult.isFailure()) {
+            return Status::eFailure;
+        }
+        mPages = (uint64_t **)*newBlockResult.value();
+        if (pageCount > mPageCount) {
+            Bytes::resetArray(mPages + mPageCount, pageCount - mPageCount);
+        }
+        mPageCount = pageCount;
+    }
+
+    // Clear the removed bits that share the last page with the kept ones.
+    auto keptBitCount = bitCount % kPageBitCount;
+    if (keptBitCount != 0 && mPages[pageCount - 1] != nullptr) {
+        auto page = mPages[pageCount - 1];
+        auto keptWordCount = (keptBitCount + 63) / 64;
+        if (keptBitCount % 64 != 0) {
+            page[keptWordCount - 1] &= (UINT64_C(1) << (uint64_t)(keptBitCount % 64)) - 1;
+        }
+        Bytes::resetArray(page + keptWordCount, kPageWordCount - keptWordCount);
+    }
+    mBitCount = bitCount;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PagedBitSet::getBitCount() -> int64_t {
+    return mBitCount;
+}
+
+auto tomurcuk::PagedBitSet::getPageCount() -> int64_t {
+    return mPageCount;
+}
+
+auto tomurcuk::PagedBitSet::countAllocatedPages() -> int64_t {
+    auto allocatedPageCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != mPageCount; i++) {
+        if (mPages[i] != nullptr) {
+            allocatedPageCount++;
+        }
+    }
+    return allocatedPageCount;
+}
+
+auto tomurcuk::PagedBitSet::test(int64_t index) -> bool {
+    assert(index >= 0);
+    assert(index < mBitCount);
+
+    auto page = mPages[index / kPageBitCount];
+    if (page == nullptr) {
+        return false;
+    }
+    auto bitIndex = index % kPageBitCount;
+    return ((page[bitIndex / 64] >> (uint64_t)(bitIndex % 64)) & 1U) != 0;
+}
+
+auto tomurcuk::PagedBitSet::set(MemoryAllocator memoryAllocator, int64_t index) -> Status {
+    assert(index >= 0);
+    assert(index < mBitCount);
+
+    auto pageIndex = index / kPageBitCount;
+    if (mPages[pageIndex] == nullptr && allocatePage(memoryAllocator, pageIndex) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    auto bitIndex = index % kPageBitCount;
+    mPages[pageIndex][bitIndex / 64] |= UINT64_C(1) << (uint64_t)(bitIndex % 64);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PagedBitSet::reset(int64_t index) -> void {
+    assert(index >= 0);
+    assert(index < mBitCount);
+
+    auto page = mPages[index / kPageBitCount];
+    if (page == nullptr) {
+        return;
+    }
+    auto bitIndex = index % kPageBitCount;
+    page[bitIndex / 64] &= ~(UINT64_C(1) << (uint64_t)(bitIndex % 64));
+}
+
+auto tomurcuk::PagedBitSet::resetAll(MemoryAllocator memoryAllocator) -> void {
+    for (auto i = mPageCount - 1; i >= 0; i--) {
+        deallocatePage(memoryAllocator, i);
+    }
+}
+
+auto tomurcuk::PagedBitSet::intersectWith(MemoryAllocator memoryAllocator, PagedBitSet *other) -> void {
+    assert(other->mBitCount == mBitCount);
+
+    for (auto i = INT64_C(0); i != mPageCount; i++) {
+        if (mPages[i] == nullptr) {
+            continue;
+        }
+        if (other->mPages[i] == nullptr) {
+            deallocatePage(memoryAllocator, i);
+            continue;
+        }
+        BitWords::intersect(mPages[i], other->mPages[i], kPageWordCount);
+    }
+}
+
+auto tomurcuk::PagedBitSet::uniteWith(MemoryAllocator memoryAllocator, PagedBitSet *other) -> Status {
+    assert(other->mBitCount == mBitCount);
+
+    for (auto i = INT64_C(0); i != mPageCount; i++) {
+        if (other->mPages[i] == nullptr) {
+            continue;
+        }
+        if (mPages[i] == nullptr) {
+            auto newBlockResult = memoryAllocator.allocate(kPageSize, kPageSize);
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mPages[i] = (uint64_t *)*newBlockResult.value();
+            Bytes::copyArray(mPages[i], other->mPages[i], kPageWordCount);
+            continue;
+        }
+        BitWords::unite(mPages[i], other->mPages[i], kPageWordCount);
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PagedBitSet::subtract(PagedBitSet *other) -> void {
+    assert(other->mBitCount == mBitCount);
+
+    for (auto i = INT64_C(0); i != mPageCount; i++) {
+        if (mPages[i] != nullptr && other->mPages[i] != nullptr) {
+            BitWords::subtract(mPages[i], other->mPages[i], kPageWordCount);
+        }
+    }
+}
+
+auto tomurcuk::PagedBitSet::countSetBits() -> int64_t {
+    auto setBitCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != mPageCount; i++) {
+        if (mPages[i] != nullptr) {
+            setBitCount += BitWords::countSetBits(mPages[i], kPageWordCount);
+        }
+    }
+    return setBitCount;
+}
+
+auto tomurcuk::PagedBitSet::findNextSetBit(int64_t index) -> int64_t {
+    assert(index >= 0);
+    assert(index <= mBitCount);
+
+    auto pageIndex = index / kPageBitCount;
+    auto wordIndex = (index % kPageBitCount) / 64;
+    auto mask = UINT64_MAX << (uint64_t)(index % 64);
+    for (; pageIndex < mPageCount; pageIndex++) {
+        auto page = mPages[pageIndex];
+        if (page != nullptr) {
+            auto word = page[wordIndex] & mask;
+            if (word != 0) {
+                return pageIndex * kPageBitCount + wordIndex * 64 + __builtin_ctzll(word);
+            }
+            wordIndex++;
+            auto foundIndex = BitWords::findNonZeroWord(page + wordIndex, kPageWordCount - wordIndex);
+            if (foundIndex != -1) {
+                wordIndex += foundIndex;
+                return pageIndex * kPageBitCount + wordIndex * 64 + __builtin_ctzll(page[wordIndex]);
+            }
+        }
+        wordIndex = 0;
+        mask = UINT64_MAX;
+    }
+    return -1;
+}
+
+auto tomurcuk::PagedBitSet::allocatePage(MemoryAllocator memoryAllocator, int64_t pageIndex) -> Status {
+    // Pages are aligned to their size, which lets an allocator that maps
+    // memory hand out untouched pages that are already zeroed.
+    auto newBlockResult = memoryAllocator.allocateZeroed(kPageSize, kPageSize);
+    if (newBlockResult.isFailure()) {
+        return Status::eFailure;
+    }
+    mPages[pageIndex] = (uint64_t *)*newBlockResult.value();
+    return Status::eSuccess;
+}
+
+auto tomurcuk::PagedBitSet::deallocatePage(MemoryAllocator memoryAllocator, int64_t pageIndex) -> void {
+    if (mPages[pageIndex] == nullptr) {
+        return;
+    }
+    memoryAllocator.deallocate(mPages[pageIndex], kPageSize, kPageSize);
+    mPages[pageIndex] = nullptr;
+}
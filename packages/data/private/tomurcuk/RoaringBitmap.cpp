@@ -0,0 +1,343 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/RoaringBitmap.hpp>
+#include <tomurcuk/RoaringBitmapView.hpp>
+#include <tomurcuk/RoaringContainer.hpp>
+#include <tomurcuk/RoaringContainerKind.hpp>
+#include <tomurcuk/RoaringContainers.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RoaringBitmap::initialize() -> void {
+    mContainers = nullptr;
+    mContainerCount = 0;
+    mContainerCapacity = 0;
+}
+
+auto tomurcuk::RoaringBitmap::destroy(MemoryAllocator memoryAllocator) -> void {
+    removeAll(memoryAllocator);
+    memoryAllocator.deallocate(mContainers, mContainerCapacity * (int64_t)sizeof(RoaringContainer), alignof(RoaringContainer));
+}
+
+auto tomurcuk::RoaringBitmap::getCount() -> int64_t {
+    auto count = INT64_C(0);
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        count += mContainers[i].count;
+    }
+    return count;
+}
+
+auto tomurcuk::RoaringBitmap::isEmpty() -> bool {
+    return mContainerCount == 0;
+}
+
+auto tomurcuk::RoaringBitmap::contains(uint32_t value) -> bool {
+    auto key = (uint16_t)(value >> 16U);
+    auto index = findContainer(key);
+    return index != mContainerCount && mContainers[index].key == key && RoaringContainers::contains(mContainers + index, (uint16_t)value);
+}
+
+auto tomurcuk::RoaringBitmap::add(MemoryAllocator memoryAllocator, uint32_t value) -> Status {
+    auto key = (uint16_t)(value >> 16U);
+    auto index = findContainer(key);
+    if (index != mContainerCount && mContainers[index].key == key) {
+        return RoaringContainers::add(memoryAllocator, mContainers + index, (uint16_t)value);
+    }
+
+    RoaringContainer container;
+    if (RoaringContainers::create(memoryAllocator, &container, key, (uint16_t)value) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    if (insertContainer(memoryAllocator, index, &container) == Status::eFailure) {
+        RoaringContainers::destroy(memoryAllocator, &container);
+        return Status::eFailure;
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmap::remove(MemoryAllocator memoryAllocator, uint32_t value) -> Status {
+    auto key = (uint16_t)(value >> 16U);
+    auto index = findContainer(key);
+    if (index == mContainerCount || mContainers[index].key != key) {
+        return Status::eSuccess;
+    }
+
+    if (RoaringContainers::remove(memoryAllocator, mContainers + index, (uint16_t)value) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    if (mContainers[index].count == 0) {
+        removeContainer(memoryAllocator, index);
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmap::removeAll(MemoryAllocator memoryAllocator) -> void {
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        RoaringContainers::destroy(memoryAllocator, mContainers + i);
+    }
+    mContainerCount = 0;
+}
+
+auto tomurcuk::RoaringBitmap::intersectWith(MemoryAllocator memoryAllocator, RoaringBitmap *other) -> Status {
+    if (other == this) {
+        return Status::eSuccess;
+    }
+    return intersectWithAll(memoryAllocator, other);
+}
+
+auto tomurcuk::RoaringBitmap::intersectWith(MemoryAllocator memoryAllocator, RoaringBitmapView *other) -> Status {
+    return intersectWithAll(memoryAllocator, other);
+}
+
+auto tomurcuk::RoaringBitmap::uniteWith(MemoryAllocator memoryAllocator, RoaringBitmap *other) -> Status {
+    if (other == this) {
+        return Status::eSuccess;
+    }
+    return uniteWithAll(memoryAllocator, other);
+}
+
+auto tomurcuk::RoaringBitmap::uniteWith(MemoryAllocator memoryAllocator, RoaringBitmapView *other) -> Status {
+    return uniteWithAll(memoryAllocator, other);
+}
+
+auto tomurcuk::RoaringBitmap::subtract(MemoryAllocator memoryAllocator, RoaringBitmap *other) -> Status {
+    if (other == this) {
+        removeAll(memoryAllocator);
+        return Status::eSuccess;
+    }
+    return subtractAll(memoryAllocator, other);
+}
+
+auto tomurcuk::RoaringBitmap::subtract(MemoryAllocator memoryAllocator, RoaringBitmapView *other) -> Status {
+    return subtractAll(memoryAllocator, other);
+}
+
+auto tomurcuk::RoaringBitmap::optimize(MemoryAllocator memoryAllocator) -> Status {
+    auto status = Status::eSuccess;
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        if (RoaringContainers::compress(memoryAllocator, mContainers + i) == Status::eFailure) {
+            status = Status::eFailure;
+        }
+    }
+    return status;
+}
+
+auto tomurcuk::RoaringBitmap::copyValues(MemoryAllocator memoryAllocator, ArrayList<uint32_t> *values) -> Status {
+    if (!values->reserve(memoryAllocator, getCount())) {
+        return Status::eFailure;
+    }
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        if (RoaringContainers::copyValues(memoryAllocator, mContainers + i, values) == Status::eFailure) {
+            return Status::eFailure;
+        }
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmap::serialize(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words) -> Status {
+    // The header takes a word, and every container takes two words in the
+    // directory and whole words for its integers.
+    auto wordCount = 1 + 2 * mContainerCount;
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        wordCount += (RoaringContainers::getDataSize(mContainers + i) + 7) / 8;
+    }
+    if (!words->reserve(memoryAllocator, wordCount)) {
+        return Status::eFailure;
+    }
+
+    auto output = words->getEnd();
+    output[0] = RoaringBitmapView::kMagic | (uint64_t)mContainerCount << 32U;
+    auto offset = 1 + 2 * mContainerCount;
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        auto container = mContainers + i;
+        auto dataSize = RoaringContainers::getDataSize(container);
+        output[1 + 2 * i] = container->key | (uint64_t)container->kind << 16U | (uint64_t)container->count << 32U;
+        output[2 + 2 * i] = (uint64_t)container->size | (uint64_t)offset << 32U;
+
+        // The padding after the integers is written first, so that the words
+        // are deterministic.
+        output[offset + (dataSize + 7) / 8 - 1] = 0;
+        Bytes::copyBlock(output + offset, container->kind == RoaringContainerKind::eBitmap ? (void *)container->words : (void *)container->values, dataSize);
+        offset += (dataSize + 7) / 8;
+    }
+    words->acknowledge(wordCount);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmap::getContainerCount() -> int64_t {
+    return mContainerCount;
+}
+
+auto tomurcuk::RoaringBitmap::getContainer(int64_t index, RoaringContainer *container) -> void {
+    *container = mContainers[index];
+}
+
+auto tomurcuk::RoaringBitmap::findContainer(uint16_t key) -> int64_t {
+    auto beginIndex = INT64_C(0);
+    auto endIndex = mContainerCount;
+    while (beginIndex != endIndex) {
+        auto middleIndex = beginIndex + (endIndex - beginIndex) / 2;
+        if (mContainers[middleIndex].key < key) {
+            beginIndex = middleIndex + 1;
+        } else {
+            endIndex = middleIndex;
+        }
+    }
+    return beginIndex;
+}
+
+auto tomurcuk::RoaringBitmap::insertContainer(MemoryAllocator memoryAllocator, int64_t index, RoaringContainer *container) -> Status {
+    if (mContainerCount == mContainerCapacity) {
+        auto newCapacity = Bytes::growCapacity(mContainerCapacity, mContainerCount, 1);
+        auto newBlockResult = memoryAllocator.reallocate(mContainers, mContainerCapacity * (int64_t)sizeof(RoaringContainer), newCapacity * (int64_t)sizeof(RoaringContainer), alignof(RoaringContainer));
+        if (newBlockResult.isFailure()) {
+            return Status::eFailure;
+        }
+        mContainers = (RoaringContainer *)*newBlockResult.value();
+        mContainerCapacity = newCapacity;
+    }
+
+    if (index != mContainerCount) {
+        Bytes::copyAliasingArray(mContainers + index + 1, mContainers + index, mContainerCount - index);
+    }
+    mContainers[index] = *container;
+    mContainerCount++;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmap::removeContainer(MemoryAllocator memoryAllocator, int64_t index) -> void {
+    RoaringContainers::destroy(memoryAllocator, mContainers + index);
+    if (index + 1 != mContainerCount) {
+        Bytes::copyAliasingArray(mContainers + index, mContainers + index + 1, mContainerCount - index - 1);
+    }
+    mContainerCount--;
+}
+
+template<typename Other>
+auto tomurcuk::RoaringBitmap::intersectWithAll(MemoryAllocator memoryAllocator, Other *other) -> Status {
+    // The containers are intersected in place, and the ones that become empty
+    // are removed while the others are moved to the front.
+    auto status = Status::eSuccess;
+    auto otherCount = other->getContainerCount();
+    auto count = INT64_C(0);
+    auto j = INT64_C(0);
+    RoaringContainer otherContainer;
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        auto container = mContainers + i;
+        auto isFound = false;
+        for (; j != otherCount; j++) {
+            other->getContainer(j, &otherContainer);
+            if (otherContainer.key >= container->key) {
+                isFound = otherContainer.key == container->key;
+                break;
+            }
+        }
+
+        if (!isFound) {
+            container->count = 0;
+        } else if (RoaringContainers::intersect(memoryAllocator, container, &otherContainer) == Status::eFailure) {
+            status = Status::eFailure;
+        }
+
+        if (container->count == 0) {
+            RoaringContainers::destroy(memoryAllocator, container);
+        } else {
+            mContainers[count] = *container;
+            count++;
+        }
+    }
+    mContainerCount = count;
+    return status;
+}
+
+template<typename Other>
+auto tomurcuk::RoaringBitmap::uniteWithAll(MemoryAllocator memoryAllocator, Other *other) -> Status {
+    auto otherCount = other->getContainerCount();
+    if (otherCount == 0) {
+        return Status::eSuccess;
+    }
+
+    // The containers are merged into a new directory that has room for all
+    // of them.
+    auto newCapacity = mContainerCount + otherCount;
+    auto newBlockResult = memoryAllocator.allocate(newCapacity * (int64_t)sizeof(RoaringContainer), alignof(RoaringContainer));
+    if (newBlockResult.isFailure()) {
+        return Status::eFailure;
+    }
+    auto newContainers = (RoaringContainer *)*newBlockResult.value();
+
+    auto status = Status::eSuccess;
+    auto count = INT64_C(0);
+    auto i = INT64_C(0);
+    auto j = INT64_C(0);
+    RoaringContainer otherContainer;
+    while (i != mContainerCount || j != otherCount) {
+        if (j == otherCount) {
+            newContainers[count] = mContainers[i];
+            count++;
+            i++;
+            continue;
+        }
+        other->getContainer(j, &otherContainer);
+        if (i != mContainerCount && mContainers[i].key < otherContainer.key) {
+            newContainers[count] = mContainers[i];
+            count++;
+            i++;
+        } else if (i == mContainerCount || otherContainer.key < mContainers[i].key) {
+            if (RoaringContainers::copy(memoryAllocator, newContainers + count, &otherContainer) == Status::eFailure) {
+                status = Status::eFailure;
+            } else {
+                count++;
+            }
+            j++;
+        } else {
+            if (RoaringContainers::unite(memoryAllocator, mContainers + i, &otherContainer) == Status::eFailure) {
+                status = Status::eFailure;
+            }
+            newContainers[count] = mContainers[i];
+            count++;
+            i++;
+            j++;
+        }
+    }
+
+    memoryAllocator.deallocate(mContainers, mContainerCapacity * (int64_t)sizeof(RoaringContainer), alignof(RoaringContainer));
+    mContainers = newContainers;
+    mContainerCount = count;
+    mContainerCapacity = newCapacity;
+    return status;
+}
+
+template<typename Other>
+auto tomurcuk::RoaringBitmap::subtractAll(MemoryAllocator memoryAllocator, Other *other) -> Status {
+    auto status = Status::eSuccess;
+    auto otherCount = other->getContainerCount();
+    auto count = INT64_C(0);
+    auto j = INT64_C(0);
+    RoaringContainer otherContainer;
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        auto container = mContainers + i;
+        auto isFound = false;
+        for (; j != otherCount; j++) {
+            other->getContainer(j, &otherContainer);
+            if (otherContainer.key >= container->key) {
+                isFound = otherContainer.key == container->key;
+                break;
+            }
+        }
+
+        if (isFound && RoaringContainers::subtract(memoryAllocator, container, &otherContainer) == Status::eFailure) {
+            status = Status::eFailure;
+        }
+
+        if (container->count == 0) {
+            RoaringContainers::destroy(memoryAllocator, container);
+        } else {
+            mContainers[count] = *container;
+            count++;
+        }
+    }
+    mContainerCount = count;
+    return status;
+}
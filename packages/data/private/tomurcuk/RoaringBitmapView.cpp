@@ -0,0 +1,167 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BitWords.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/RoaringBitmapView.hpp>
+#include <tomurcuk/RoaringContainer.hpp>
+#include <tomurcuk/RoaringContainerKind.hpp>
+#include <tomurcuk/RoaringContainers.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RoaringBitmapView::initialize(ArrayListView<uint64_t> words) -> Status {
+    auto wordCount = words.getCount();
+    if (wordCount == 0 || (words.getArray()[0] & UINT32_MAX) != kMagic) {
+        return Status::eFailure;
+    }
+    mWords = words.getArray();
+    mContainerCount = (int64_t)(mWords[0] >> 32U);
+    if (mContainerCount > 65536 || 1 + 2 * mContainerCount > wordCount) {
+        return Status::eFailure;
+    }
+
+    // The containers must follow each other in the order of their keys
+    // without gaps, and their integers must be what the other operations
+    // expect; so, they never read or write past the ends of the arrays.
+    auto offset = 1 + 2 * mContainerCount;
+    auto previousKey = INT64_C(-1);
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        auto entry = mWords[1 + 2 * i];
+        auto key = (int64_t)(entry & UINT16_MAX);
+        auto kind = (entry >> 16U) & UINT16_MAX;
+        auto count = (int64_t)(entry >> 32U);
+        auto size = (int64_t)(mWords[2 + 2 * i] & UINT32_MAX);
+        if (key <= previousKey || count == 0 || count > 65536 || (int64_t)(mWords[2 + 2 * i] >> 32U) != offset) {
+            return Status::eFailure;
+        }
+        previousKey = key;
+
+        auto dataSize = INT64_C(0);
+        if (kind == (uint64_t)RoaringContainerKind::eArray) {
+            dataSize = size * (int64_t)sizeof(uint16_t);
+        } else if (kind == (uint64_t)RoaringContainerKind::eBitmap) {
+            dataSize = RoaringContainers::kWordCount * (int64_t)sizeof(uint64_t);
+        } else if (kind == (uint64_t)RoaringContainerKind::eRun) {
+            dataSize = size * 2 * (int64_t)sizeof(uint16_t);
+        } else {
+            return Status::eFailure;
+        }
+        if (size > 65536 || (dataSize + 7) / 8 > wordCount - offset) {
+            return Status::eFailure;
+        }
+
+        auto values = (uint16_t *)(mWords + offset);
+        if (kind == (uint64_t)RoaringContainerKind::eArray) {
+            if (size != count || count > RoaringContainers::kArrayCapacity) {
+                return Status::eFailure;
+            }
+            for (auto j = INT64_C(1); j < size; j++) {
+                if (values[j] <= values[j - 1]) {
+                    return Status::eFailure;
+                }
+            }
+        } else if (kind == (uint64_t)RoaringContainerKind::eBitmap) {
+            if (size != 0 || BitWords::countSetBits(mWords + offset, RoaringContainers::kWordCount) != count) {
+                return Status::eFailure;
+            }
+        } else {
+            auto runCount = INT64_C(0);
+            auto nextValue = INT64_C(0);
+            for (auto j = INT64_C(0); j != size; j++) {
+                auto begin = (int64_t)values[2 * j];
+                auto length = (int64_t)values[2 * j + 1] + 1;
+                if (begin < nextValue || begin + length > 65536) {
+                    return Status::eFailure;
+                }
+                runCount += length;
+                nextValue = begin + length;
+            }
+            if (size == 0 || runCount != count) {
+                return Status::eFailure;
+            }
+        }
+        offset += (dataSize + 7) / 8;
+    }
+    mWordCount = offset;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmapView::getWordCount() -> int64_t {
+    return mWordCount;
+}
+
+auto tomurcuk::RoaringBitmapView::getCount() -> int64_t {
+    auto count = INT64_C(0);
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        count += (int64_t)(mWords[1 + 2 * i] >> 32U);
+    }
+    return count;
+}
+
+auto tomurcuk::RoaringBitmapView::isEmpty() -> bool {
+    return mContainerCount == 0;
+}
+
+auto tomurcuk::RoaringBitmapView::contains(uint32_t value) -> bool {
+    auto key = (uint16_t)(value >> 16U);
+    auto index = findContainer(key);
+    if (index == mContainerCount) {
+        return false;
+    }
+    RoaringContainer container;
+    getContainer(index, &container);
+    return container.key == key && RoaringContainers::contains(&container, (uint16_t)value);
+}
+
+auto tomurcuk::RoaringBitmapView::copyValues(MemoryAllocator memoryAllocator, ArrayList<uint32_t> *values) -> Status {
+    if (!values->reserve(memoryAllocator, getCount())) {
+        return Status::eFailure;
+    }
+    RoaringContainer container;
+    for (auto i = INT64_C(0); i != mContainerCount; i++) {
+        getContainer(i, &container);
+        if (RoaringContainers::copyValues(memoryAllocator, &container, values) == Status::eFailure) {
+            return Status::eFailure;
+        }
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringBitmapView::getContainerCount() -> int64_t {
+    return mContainerCount;
+}
+
+auto tomurcuk::RoaringBitmapView::getContainer(int64_t index, RoaringContainer *container) -> void {
+    assert(index >= 0);
+    assert(index < mContainerCount);
+
+    auto entry = mWords[1 + 2 * index];
+    auto data = mWords + (mWords[2 + 2 * index] >> 32U);
+    container->key = (uint16_t)entry;
+    container->kind = (RoaringContainerKind)(entry >> 16U);
+    container->count = (int64_t)(entry >> 32U);
+    container->size = (int64_t)(mWords[2 + 2 * index] & UINT32_MAX);
+    container->capacity = 0;
+    if (container->kind == RoaringContainerKind::eBitmap) {
+        container->values = nullptr;
+        container->words = data;
+    } else {
+        container->values = (uint16_t *)data;
+        container->words = nullptr;
+    }
+}
+
+auto tomurcuk::RoaringBitmapView::findContainer(uint16_t key) -> int64_t {
+    auto beginIndex = INT64_C(0);
+    auto endIndex = mContainerCount;
+    while (beginIndex != endIndex) {
+        auto middleIndex = beginIndex + (endIndex - beginIndex) / 2;
+        if ((uint16_t)mWords[1 + 2 * middleIndex] < key) {
+            beginIndex = middleIndex + 1;
+        } else {
+            endIndex = middleIndex;
+        }
+    }
+    return beginIndex;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/RoaringContainerKind.hpp>
+
+namespace tomurcuk {
+    /**
+     * The integers of a @ref RoaringBitmap that share their upper 16 bits.
+     *
+     * A container either owns its memory, or it refers to the memory of a
+     * serialized bitmap, in which case it has no capacity and it is never
+     * modified.
+     */
+    struct RoaringContainer {
+        /**
+         * The upper 16 bits of the integers.
+         */
+        uint16_t key;
+
+        /**
+         * The representation of the integers.
+         */
+        RoaringContainerKind kind;
+
+        /**
+         * The amount of integers, which is at least `1`.
+         */
+        int64_t count;
+
+        /**
+         * The amount of values of an array, or the amount of runs, each of
+         * which takes 2 values. `0` for a bitmap.
+         */
+        int64_t size;
+
+        /**
+         * The amount of values or runs the memory can hold. `0` for a bitmap
+         * and for a container that does not own its memory.
+         */
+        int64_t capacity;
+
+        /**
+         * Pointer to the values of an array or the runs.
+         *
+         * @warning `nullptr` for a bitmap.
+         */
+        uint16_t *values;
+
+        /**
+         * Pointer to the words of a bitmap.
+         *
+         * @warning `nullptr` for an array and runs.
+         */
+        uint64_t *words;
+    };
+}
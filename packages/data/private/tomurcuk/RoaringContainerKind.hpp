@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Representation of the integers of a container of a @ref RoaringBitmap.
+     *
+     * The values are stored in serialized bitmaps; so, they must not change.
+     */
+    enum class RoaringContainerKind : uint8_t {
+        /**
+         * Sorted array of the lower 16 bits of the integers.
+         */
+        eArray = 0,
+
+        /**
+         * Bits of all the 65536 lower 16 bits, where the ones of the integers
+         * are set.
+         */
+        eBitmap = 1,
+
+        /**
+         * Sorted array of runs of consecutive integers, each of which is the
+         * lower 16 bits of its first integer followed by its length minus
+         * one.
+         */
+        eRun = 2,
+    };
+}
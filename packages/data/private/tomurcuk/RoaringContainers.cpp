@@ -0,0 +1,750 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/BitWords.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/RoaringContainer.hpp>
+#include <tomurcuk/RoaringContainerKind.hpp>
+#include <tomurcuk/RoaringContainers.hpp>
+#include <tomurcuk/Status.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::RoaringContainers::create(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t key, uint16_t value) -> Status {
+    // Most containers of sparse bitmaps stay small; so, they start with room
+    // for a few integers.
+    if (allocateValues(memoryAllocator, container, RoaringContainerKind::eArray, 4) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    container->key = key;
+    container->count = 1;
+    container->size = 1;
+    container->values[0] = value;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::copy(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *source) -> Status {
+    if (source->kind == RoaringContainerKind::eBitmap) {
+        if (allocateWords(memoryAllocator, container) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        Bytes::copyArray(container->words, source->words, kWordCount);
+    } else {
+        if (allocateValues(memoryAllocator, container, source->kind, source->size) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        Bytes::copyArray(container->values, source->values, source->size * getUnitSize(source->kind) / 2);
+        container->size = source->size;
+    }
+    container->key = source->key;
+    container->count = source->count;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::destroy(MemoryAllocator memoryAllocator, RoaringContainer *container) -> void {
+    assert(container->kind == RoaringContainerKind::eBitmap || container->capacity != 0);
+
+    if (container->kind == RoaringContainerKind::eBitmap) {
+        memoryAllocator.deallocate(container->words, kWordCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    } else {
+        memoryAllocator.deallocate(container->values, container->capacity * getUnitSize(container->kind), alignof(uint16_t));
+    }
+}
+
+auto tomurcuk::RoaringContainers::contains(RoaringContainer *container, uint16_t value) -> bool {
+    switch (container->kind) {
+    case RoaringContainerKind::eArray: {
+        auto index = findValue(container->values, container->size, value);
+        return index != container->size && container->values[index] == value;
+    }
+    case RoaringContainerKind::eBitmap:
+        return ((container->words[value / 64U] >> (value % 64U)) & 1U) != 0;
+    case RoaringContainerKind::eRun: {
+        auto index = findRun(container->values, container->size, value);
+        return index != -1 && value - container->values[2 * index] <= container->values[2 * index + 1];
+    }
+    }
+    return false;
+}
+
+auto tomurcuk::RoaringContainers::add(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t value) -> Status {
+    if (container->kind == RoaringContainerKind::eRun) {
+        if (contains(container, value)) {
+            return Status::eSuccess;
+        }
+        if (expand(memoryAllocator, container) == Status::eFailure) {
+            return Status::eFailure;
+        }
+    }
+
+    if (container->kind == RoaringContainerKind::eBitmap) {
+        auto bit = UINT64_C(1) << (value % 64U);
+        container->count += (int64_t)((container->words[value / 64U] & bit) == 0);
+        container->words[value / 64U] |= bit;
+        return Status::eSuccess;
+    }
+
+    auto index = findValue(container->values, container->size, value);
+    if (index != container->size && container->values[index] == value) {
+        return Status::eSuccess;
+    }
+
+    if (container->size == kArrayCapacity) {
+        RoaringContainer replacement;
+        if (allocateWords(memoryAllocator, &replacement) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        fillWords(container, replacement.words);
+        replacement.words[value / 64U] |= UINT64_C(1) << (value % 64U);
+        replacement.key = container->key;
+        replacement.count = container->count + 1;
+        replace(memoryAllocator, container, &replacement);
+        return Status::eSuccess;
+    }
+
+    if (container->size == container->capacity) {
+        auto newCapacity = Bytes::growCapacity(container->capacity, container->size, 1);
+        if (newCapacity > kArrayCapacity) {
+            newCapacity = kArrayCapacity;
+        }
+        auto newBlockResult = memoryAllocator.reallocate(container->values, container->capacity * (int64_t)sizeof(uint16_t), newCapacity * (int64_t)sizeof(uint16_t), alignof(uint16_t));
+        if (newBlockResult.isFailure()) {
+            return Status::eFailure;
+        }
+        container->values = (uint16_t *)*newBlockResult.value();
+        container->capacity = newCapacity;
+    }
+
+    if (index != container->size) {
+        Bytes::copyAliasingArray(container->values + index + 1, container->values + index, container->size - index);
+    }
+    container->values[index] = value;
+    container->size++;
+    container->count++;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::remove(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t value) -> Status {
+    if (!contains(container, value)) {
+        return Status::eSuccess;
+    }
+
+    if (container->kind == RoaringContainerKind::eRun && expand(memoryAllocator, container) == Status::eFailure) {
+        return Status::eFailure;
+    }
+
+    if (container->kind == RoaringContainerKind::eBitmap) {
+        container->words[value / 64U] &= ~(UINT64_C(1) << (value % 64U));
+        container->count--;
+        shrink(memoryAllocator, container);
+        return Status::eSuccess;
+    }
+
+    auto index = findValue(container->values, container->size, value);
+    if (index + 1 != container->size) {
+        Bytes::copyAliasingArray(container->values + index, container->values + index + 1, container->size - index - 1);
+    }
+    container->size--;
+    container->count--;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::intersect(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *other) -> Status {
+    if (container->kind == RoaringContainerKind::eRun && expand(memoryAllocator, container) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    RoaringContainer bitmap;
+    uint64_t words[kWordCount];
+    if (other->kind == RoaringContainerKind::eRun) {
+        materialize(other, &bitmap, words);
+        other = &bitmap;
+    }
+
+    if (container->kind == RoaringContainerKind::eArray) {
+        auto count = INT64_C(0);
+        if (other->kind == RoaringContainerKind::eArray) {
+            // The vectorized kernel writes whole vectors past the last
+            // integer; so, the result gets some room to spare.
+            uint16_t result[kArrayCapacity + 8];
+            count = getKernels().intersectArrays(container->values, container->size, other->values, other->size, result);
+            if (count != 0) {
+                Bytes::copyArray(container->values, result, count);
+            }
+        } else {
+            for (auto i = INT64_C(0); i != container->size; i++) {
+                auto value = container->values[i];
+                container->values[count] = value;
+                count += (int64_t)((other->words[value / 64U] >> (value % 64U)) & 1U);
+            }
+        }
+        container->size = count;
+        container->count = count;
+        return Status::eSuccess;
+    }
+
+    if (other->kind == RoaringContainerKind::eArray) {
+        uint16_t result[kArrayCapacity];
+        auto count = INT64_C(0);
+        for (auto i = INT64_C(0); i != other->size; i++) {
+            auto value = other->values[i];
+            result[count] = value;
+            count += (int64_t)((container->words[value / 64U] >> (value % 64U)) & 1U);
+        }
+        return loadValues(memoryAllocator, container, result, count);
+    }
+
+    BitWords::intersect(container->words, other->words, kWordCount);
+    container->count = BitWords::countSetBits(container->words, kWordCount);
+    shrink(memoryAllocator, container);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::unite(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *other) -> Status {
+    if (container->kind == RoaringContainerKind::eRun && expand(memoryAllocator, container) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    RoaringContainer bitmap;
+    uint64_t words[kWordCount];
+    if (other->kind == RoaringContainerKind::eRun) {
+        materialize(other, &bitmap, words);
+        other = &bitmap;
+    }
+
+    if (container->kind == RoaringContainerKind::eArray) {
+        if (other->kind == RoaringContainerKind::eArray) {
+            uint16_t result[2 * kArrayCapacity];
+            auto count = INT64_C(0);
+            auto i = INT64_C(0);
+            auto j = INT64_C(0);
+            while (i != container->size && j != other->size) {
+                auto value = container->values[i];
+                auto otherValue = other->values[j];
+                result[count] = value < otherValue ? value : otherValue;
+                count++;
+                i += (int64_t)(value <= otherValue);
+                j += (int64_t)(otherValue <= value);
+            }
+            if (i != container->size) {
+                Bytes::copyArray(result + count, container->values + i, container->size - i);
+                count += container->size - i;
+            }
+            if (j != other->size) {
+                Bytes::copyArray(result + count, other->values + j, other->size - j);
+                count += other->size - j;
+            }
+            return loadValues(memoryAllocator, container, result, count);
+        }
+
+        RoaringContainer replacement;
+        if (allocateWords(memoryAllocator, &replacement) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        Bytes::copyArray(replacement.words, other->words, kWordCount);
+        fillWords(container, replacement.words);
+        replacement.key = container->key;
+        replacement.count = BitWords::countSetBits(replacement.words, kWordCount);
+        replace(memoryAllocator, container, &replacement);
+        return Status::eSuccess;
+    }
+
+    if (other->kind == RoaringContainerKind::eArray) {
+        for (auto i = INT64_C(0); i != other->size; i++) {
+            auto value = other->values[i];
+            auto bit = UINT64_C(1) << (value % 64U);
+            container->count += (int64_t)((container->words[value / 64U] & bit) == 0);
+            container->words[value / 64U] |= bit;
+        }
+        return Status::eSuccess;
+    }
+
+    BitWords::unite(container->words, other->words, kWordCount);
+    container->count = BitWords::countSetBits(container->words, kWordCount);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::subtract(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *other) -> Status {
+    if (container->kind == RoaringContainerKind::eRun && expand(memoryAllocator, container) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    RoaringContainer bitmap;
+    uint64_t words[kWordCount];
+    if (other->kind == RoaringContainerKind::eRun) {
+        materialize(other, &bitmap, words);
+        other = &bitmap;
+    }
+
+    if (container->kind == RoaringContainerKind::eArray) {
+        auto count = INT64_C(0);
+        if (other->kind == RoaringContainerKind::eArray) {
+            auto j = INT64_C(0);
+            for (auto i = INT64_C(0); i != container->size; i++) {
+                auto value = container->values[i];
+                while (j != other->size && other->values[j] < value) {
+                    j++;
+                }
+                container->values[count] = value;
+                count += (int64_t)(j == other->size || other->values[j] != value);
+            }
+        } else {
+            for (auto i = INT64_C(0); i != container->size; i++) {
+                auto value = container->values[i];
+                container->values[count] = value;
+                count += (int64_t)(((other->words[value / 64U] >> (value % 64U)) & 1U) == 0);
+            }
+        }
+        container->size = count;
+        container->count = count;
+        return Status::eSuccess;
+    }
+
+    if (other->kind == RoaringContainerKind::eArray) {
+        for (auto i = INT64_C(0); i != other->size; i++) {
+            auto value = other->values[i];
+            auto bit = UINT64_C(1) << (value % 64U);
+            container->count -= (int64_t)((container->words[value / 64U] & bit) != 0);
+            container->words[value / 64U] &= ~bit;
+        }
+    } else {
+        BitWords::subtract(container->words, other->words, kWordCount);
+        container->count = BitWords::countSetBits(container->words, kWordCount);
+    }
+    shrink(memoryAllocator, container);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::compress(MemoryAllocator memoryAllocator, RoaringContainer *container) -> Status {
+    if (container->kind == RoaringContainerKind::eRun) {
+        return Status::eSuccess;
+    }
+
+    auto runCount = countRuns(container);
+    if (runCount * getUnitSize(RoaringContainerKind::eRun) >= getDataSize(container)) {
+        return Status::eSuccess;
+    }
+
+    RoaringContainer replacement;
+    if (allocateValues(memoryAllocator, &replacement, RoaringContainerKind::eRun, runCount) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    fillRuns(container, replacement.values);
+    replacement.key = container->key;
+    replacement.count = container->count;
+    replacement.size = runCount;
+    replace(memoryAllocator, container, &replacement);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::copyValues(MemoryAllocator memoryAllocator, RoaringContainer *container, ArrayList<uint32_t> *values) -> Status {
+    if (!values->reserve(memoryAllocator, container->count)) {
+        return Status::eFailure;
+    }
+
+    auto high = (uint32_t)container->key << 16U;
+    auto output = values->getEnd();
+    switch (container->kind) {
+    case RoaringContainerKind::eArray:
+        for (auto i = INT64_C(0); i != container->size; i++) {
+            output[i] = high | container->values[i];
+        }
+        break;
+    case RoaringContainerKind::eBitmap: {
+        auto count = INT64_C(0);
+        for (auto i = INT64_C(0); i != kWordCount; i++) {
+            auto word = container->words[i];
+            while (word != 0) {
+                output[count] = high | (uint32_t)(i * 64 + __builtin_ctzll(word));
+                count++;
+                word &= word - 1;
+            }
+        }
+        break;
+    }
+    case RoaringContainerKind::eRun: {
+        auto count = INT64_C(0);
+        for (auto i = INT64_C(0); i != container->size; i++) {
+            auto begin = (uint32_t)container->values[2 * i];
+            auto end = begin + container->values[2 * i + 1];
+            for (auto value = begin; value <= end; value++) {
+                output[count] = high | value;
+                count++;
+            }
+        }
+        break;
+    }
+    }
+    values->acknowledge(container->count);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::getDataSize(RoaringContainer *container) -> int64_t {
+    if (container->kind == RoaringContainerKind::eBitmap) {
+        return kWordCount * (int64_t)sizeof(uint64_t);
+    }
+    return container->size * getUnitSize(container->kind);
+}
+
+auto tomurcuk::RoaringContainers::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::RoaringContainers::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.intersectArrays = &intersectArraysPortably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasSsse3()) {
+        kernels.intersectArrays = &intersectArraysWithSsse3;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::RoaringContainers::intersectArraysPortably(uint16_t *values, int64_t count, uint16_t *otherValues, int64_t otherCount, uint16_t *result) -> int64_t {
+    // Every step writes the smaller integer and advances past it without a
+    // branch that depends on the data.
+    auto resultCount = INT64_C(0);
+    auto i = INT64_C(0);
+    auto j = INT64_C(0);
+    while (i != count && j != otherCount) {
+        auto value = values[i];
+        auto otherValue = otherValues[j];
+        result[resultCount] = value;
+        resultCount += (int64_t)(value == otherValue);
+        i += (int64_t)(value <= otherValue);
+        j += (int64_t)(otherValue <= value);
+    }
+    return resultCount;
+}
+
+auto tomurcuk::RoaringContainers::allocateValues(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainerKind kind, int64_t capacity) -> Status {
+    assert(capacity > 0);
+
+    auto newBlockResult = memoryAllocator.allocate(capacity * getUnitSize(kind), alignof(uint16_t));
+    if (newBlockResult.isFailure()) {
+        return Status::eFailure;
+    }
+    container->kind = kind;
+    container->size = 0;
+    container->capacity = capacity;
+    container->values = (uint16_t *)*newBlockResult.value();
+    container->words = nullptr;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::allocateWords(MemoryAllocator memoryAllocator, RoaringContainer *container) -> Status {
+    auto newBlockResult = memoryAllocator.allocateZeroed(kWordCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    if (newBlockResult.isFailure()) {
+        return Status::eFailure;
+    }
+    container->kind = RoaringContainerKind::eBitmap;
+    container->size = 0;
+    container->capacity = 0;
+    container->values = nullptr;
+    container->words = (uint64_t *)*newBlockResult.value();
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::findValue(uint16_t *values, int64_t count, uint16_t value) -> int64_t {
+    auto beginIndex = INT64_C(0);
+    auto endIndex = count;
+    while (beginIndex != endIndex) {
+        auto middleIndex = beginIndex + (endIndex - beginIndex) / 2;
+        if (values[middleIndex] < value) {
+            beginIndex = middleIndex + 1;
+        } else {
+            endIndex = middleIndex;
+        }
+    }
+    return beginIndex;
+}
+
+auto tomurcuk::RoaringContainers::findRun(uint16_t *runs, int64_t count, uint16_t value) -> int64_t {
+    // Finds the last run that begins at or before the integer.
+    auto beginIndex = INT64_C(0);
+    auto endIndex = count;
+    while (beginIndex != endIndex) {
+        auto middleIndex = beginIndex + (endIndex - beginIndex) / 2;
+        if (runs[2 * middleIndex] <= value) {
+            beginIndex = middleIndex + 1;
+        } else {
+            endIndex = middleIndex;
+        }
+    }
+    return beginIndex - 1;
+}
+
+auto tomurcuk::RoaringContainers::fillWords(RoaringContainer *container, uint64_t *words) -> void {
+    switch (container->kind) {
+    case RoaringContainerKind::eArray:
+        for (auto i = INT64_C(0); i != container->size; i++) {
+            auto value = container->values[i];
+            words[value / 64U] |= UINT64_C(1) << (value % 64U);
+        }
+        break;
+    case RoaringContainerKind::eBitmap:
+        BitWords::unite(words, container->words, kWordCount);
+        break;
+    case RoaringContainerKind::eRun:
+        for (auto i = INT64_C(0); i != container->size; i++) {
+            auto begin = (int64_t)container->values[2 * i];
+            auto last = begin + container->values[2 * i + 1];
+            auto beginMask = UINT64_MAX << (uint64_t)(begin % 64);
+            auto lastMask = UINT64_MAX >> (uint64_t)(63 - last % 64);
+            if (begin / 64 == last / 64) {
+                words[begin / 64] |= beginMask & lastMask;
+                continue;
+            }
+            words[begin / 64] |= beginMask;
+            for (auto j = begin / 64 + 1; j != last / 64; j++) {
+                words[j] = UINT64_MAX;
+            }
+            words[last / 64] |= lastMask;
+        }
+        break;
+    }
+}
+
+auto tomurcuk::RoaringContainers::fillValues(uint64_t *words, uint16_t *values) -> void {
+    auto count = INT64_C(0);
+    for (auto i = INT64_C(0); i != kWordCount; i++) {
+        auto word = words[i];
+        while (word != 0) {
+            values[count] = (uint16_t)(i * 64 + __builtin_ctzll(word));
+            count++;
+            word &= word - 1;
+        }
+    }
+}
+
+auto tomurcuk::RoaringContainers::fillRuns(RoaringContainer *container, uint16_t *runs) -> void {
+    assert(container->kind != RoaringContainerKind::eRun);
+
+    // A run is extended when its next integer follows its last one, and a
+    // new run is begun otherwise.
+    auto runCount = INT64_C(0);
+    auto nextValue = INT64_C(-1);
+    if (container->kind == RoaringContainerKind::eArray) {
+        for (auto i = INT64_C(0); i != container->size; i++) {
+            auto value = (int64_t)container->values[i];
+            if (value == nextValue) {
+                runs[2 * runCount - 1]++;
+            } else {
+                runs[2 * runCount] = (uint16_t)value;
+                runs[2 * runCount + 1] = 0;
+                runCount++;
+            }
+            nextValue = value + 1;
+        }
+        return;
+    }
+
+    for (auto i = INT64_C(0); i != kWordCount; i++) {
+        auto word = container->words[i];
+        while (word != 0) {
+            auto shift = (uint64_t)__builtin_ctzll(word);
+            auto shiftedWord = word >> shift;
+            auto length = shiftedWord == UINT64_MAX ? INT64_C(64) : (int64_t)__builtin_ctzll(~shiftedWord);
+            auto value = i * 64 + (int64_t)shift;
+            if (value == nextValue) {
+                runs[2 * runCount - 1] = (uint16_t)(runs[2 * runCount - 1] + length);
+            } else {
+                runs[2 * runCount] = (uint16_t)value;
+                runs[2 * runCount + 1] = (uint16_t)(length - 1);
+                runCount++;
+            }
+            nextValue = value + length;
+            word = shift + (uint64_t)length == 64 ? 0 : word & UINT64_MAX << (shift + (uint64_t)length);
+        }
+    }
+}
+
+auto tomurcuk::RoaringContainers::countRuns(RoaringContainer *container) -> int64_t {
+    switch (container->kind) {
+    case RoaringContainerKind::eArray: {
+        auto runCount = (int64_t)(container->size != 0);
+        for (auto i = INT64_C(1); i < container->size; i++) {
+            runCount += (int64_t)(container->values[i] != container->values[i - 1] + 1);
+        }
+        return runCount;
+    }
+    case RoaringContainerKind::eBitmap: {
+        // A run begins at every set bit whose previous bit is not set.
+        auto runCount = INT64_C(0);
+        auto carry = UINT64_C(0);
+        for (auto i = INT64_C(0); i != kWordCount; i++) {
+            auto word = container->words[i];
+            runCount += __builtin_popcountll(word & ~(word << 1U | carry));
+            carry = word >> 63U;
+        }
+        return runCount;
+    }
+    case RoaringContainerKind::eRun:
+        return container->size;
+    }
+    return 0;
+}
+
+auto tomurcuk::RoaringContainers::getUnitSize(RoaringContainerKind kind) -> int64_t {
+    return kind == RoaringContainerKind::eRun ? 2 * (int64_t)sizeof(uint16_t) : (int64_t)sizeof(uint16_t);
+}
+
+auto tomurcuk::RoaringContainers::expand(MemoryAllocator memoryAllocator, RoaringContainer *container) -> Status {
+    assert(container->kind == RoaringContainerKind::eRun);
+
+    RoaringContainer replacement;
+    if (container->count <= kArrayCapacity) {
+        if (allocateValues(memoryAllocator, &replacement, RoaringContainerKind::eArray, container->count) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        auto count = INT64_C(0);
+        for (auto i = INT64_C(0); i != container->size; i++) {
+            auto begin = (int64_t)container->values[2 * i];
+            auto last = begin + container->values[2 * i + 1];
+            for (auto value = begin; value <= last; value++) {
+                replacement.values[count] = (uint16_t)value;
+                count++;
+            }
+        }
+        replacement.size = count;
+    } else {
+        if (allocateWords(memoryAllocator, &replacement) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        fillWords(container, replacement.words);
+    }
+    replacement.key = container->key;
+    replacement.count = container->count;
+    replace(memoryAllocator, container, &replacement);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::shrink(MemoryAllocator memoryAllocator, RoaringContainer *container) -> void {
+    if (container->kind != RoaringContainerKind::eBitmap || container->count == 0 || container->count > kArrayCapacity) {
+        return;
+    }
+
+    // A bitmap holds the integers just as well; so, a failure is ignored.
+    RoaringContainer replacement;
+    if (allocateValues(memoryAllocator, &replacement, RoaringContainerKind::eArray, container->count) == Status::eFailure) {
+        return;
+    }
+    fillValues(container->words, replacement.values);
+    replacement.key = container->key;
+    replacement.count = container->count;
+    replacement.size = container->count;
+    replace(memoryAllocator, container, &replacement);
+}
+
+auto tomurcuk::RoaringContainers::materialize(RoaringContainer *container, RoaringContainer *bitmap, uint64_t *words) -> void {
+    Bytes::resetArray(words, kWordCount);
+    fillWords(container, words);
+    bitmap->key = container->key;
+    bitmap->kind = RoaringContainerKind::eBitmap;
+    bitmap->count = container->count;
+    bitmap->size = 0;
+    bitmap->capacity = 0;
+    bitmap->values = nullptr;
+    bitmap->words = words;
+}
+
+auto tomurcuk::RoaringContainers::loadValues(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t *values, int64_t count) -> Status {
+    assert(container->kind != RoaringContainerKind::eRun);
+
+    // An empty container is removed by the caller; so, its memory is kept.
+    if (count == 0) {
+        container->count = 0;
+        return Status::eSuccess;
+    }
+
+    if (count <= kArrayCapacity && container->kind == RoaringContainerKind::eArray && count <= container->capacity) {
+        Bytes::copyArray(container->values, values, count);
+        container->size = count;
+        container->count = count;
+        return Status::eSuccess;
+    }
+
+    if (count > kArrayCapacity && container->kind == RoaringContainerKind::eBitmap) {
+        Bytes::resetArray(container->words, kWordCount);
+        for (auto i = INT64_C(0); i != count; i++) {
+            container->words[values[i] / 64U] |= UINT64_C(1) << (values[i] % 64U);
+        }
+        container->count = count;
+        return Status::eSuccess;
+    }
+
+    RoaringContainer replacement;
+    if (count <= kArrayCapacity) {
+        if (allocateValues(memoryAllocator, &replacement, RoaringContainerKind::eArray, count) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        Bytes::copyArray(replacement.values, values, count);
+        replacement.size = count;
+    } else {
+        if (allocateWords(memoryAllocator, &replacement) == Status::eFailure) {
+            return Status::eFailure;
+        }
+        for (auto i = INT64_C(0); i != count; i++) {
+            replacement.words[values[i] / 64U] |= UINT64_C(1) << (values[i] % 64U);
+        }
+    }
+    replacement.key = container->key;
+    replacement.count = count;
+    replace(memoryAllocator, container, &replacement);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::RoaringContainers::replace(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *replacement) -> void {
+    destroy(memoryAllocator, container);
+    *container = *replacement;
+}
+
+#if defined(__x86_64__)
+
+// Every vector of 8 integers is compared with the 8 rotations of a vector of
+// the other array, so that all 64 pairs are compared. The integers that have a
+// match are moved to the beginning of the vector with a shuffle, and the whole
+// vector is written; then, the vector that ends with the smaller integer is
+// replaced with the next one.
+
+[[gnu::target("ssse3")]]
+auto tomurcuk::RoaringContainers::intersectArraysWithSsse3(uint16_t *values, int64_t count, uint16_t *otherValues, int64_t otherCount, uint16_t *result) -> int64_t {
+    static constexpr auto kCompactions = makeCompactions();
+
+    auto resultCount = INT64_C(0);
+    auto i = INT64_C(0);
+    auto j = INT64_C(0);
+    if (count >= 8 && otherCount >= 8) {
+        while (true) {
+            auto vector = _mm_loadu_si128((__m128i *)(values + i));
+            auto otherVector = _mm_loadu_si128((__m128i *)(otherValues + j));
+            auto matches = _mm_cmpeq_epi16(vector, otherVector);
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 2)));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 4)));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 6)));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 8)));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 10)));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 12)));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi16(vector, _mm_alignr_epi8(otherVector, otherVector, 14)));
+            auto mask = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(matches, _mm_setzero_si128())) & 0xFFU;
+            auto shuffle = _mm_loadu_si128((__m128i *)kCompactions.shuffles[mask]);
+            _mm_storeu_si128((__m128i *)(result + resultCount), _mm_shuffle_epi8(vector, shuffle));
+            resultCount += __builtin_popcount(mask);
+
+            auto last = values[i + 7];
+            auto otherLast = otherValues[j + 7];
+            i += last <= otherLast ? 8 : 0;
+            j += otherLast <= last ? 8 : 0;
+            if (i + 8 > count || j + 8 > otherCount) {
+                break;
+            }
+        }
+    }
+    return resultCount + intersectArraysPortably(values + i, count - i, otherValues + j, otherCount - j, result + resultCount);
+}
+
+#endif
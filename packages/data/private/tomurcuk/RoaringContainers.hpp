@@ -0,0 +1,229 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/RoaringContainer.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Operations on the containers of a @ref RoaringBitmap.
+     *
+     * An array holds at most @ref kArrayCapacity integers, and a container
+     * with more integers is a bitmap. A bitmap that drops to that many
+     * integers is turned back into an array when there is memory for it.
+     * Runs are only made by @ref compress; a modified container with runs is
+     * expanded first, and the other operand of a binary operation that has
+     * runs is expanded into a temporary bitmap.
+     *
+     * Intersecting two arrays has a portable implementation and an SSSE3 one,
+     * which compares 8 integers of each array at a time; the fastest one the
+     * processor supports is selected on the first use. The operations on
+     * bitmaps use the kernels of @ref BitWords.
+     */
+    class RoaringContainers {
+    public:
+        /**
+         * The most integers in an array, which take as much memory as a
+         * bitmap.
+         */
+        static constexpr auto kArrayCapacity = INT64_C(4096);
+
+        /**
+         * The amount of words in a bitmap.
+         */
+        static constexpr auto kWordCount = INT64_C(1024);
+
+        /**
+         * Creates an array that holds a single integer.
+         *
+         * @param[in,out] memoryAllocator The allocator that will provide the
+         * memory.
+         * @param[out] container The created container.
+         * @param[in] key The upper 16 bits of the integer.
+         * @param[in] value The lower 16 bits of the integer.
+         * @return Whether the operation succeeded.
+         */
+        static auto create(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t key, uint16_t value) -> Status;
+
+        /**
+         * Creates a copy of a container that owns its memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that will provide the
+         * memory.
+         * @param[out] container The created container.
+         * @param[in] source The copied container.
+         * @return Whether the operation succeeded.
+         */
+        static auto copy(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *source) -> Status;
+
+        /**
+         * Deallocates the memory of a container.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         * @param[in,out] container The destroyed container.
+         */
+        static auto destroy(MemoryAllocator memoryAllocator, RoaringContainer *container) -> void;
+
+        /**
+         * Tests whether an integer is in a container.
+         *
+         * @param[in] container The searched container.
+         * @param[in] value The lower 16 bits of the integer.
+         * @return Whether the integer is in the container.
+         */
+        static auto contains(RoaringContainer *container, uint16_t value) -> bool;
+
+        /**
+         * Adds an integer to a container.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in,out] container The modified container.
+         * @param[in] value The lower 16 bits of the integer.
+         * @return Whether the operation succeeded.
+         */
+        static auto add(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t value) -> Status;
+
+        /**
+         * Removes an integer from a container.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in,out] container The modified container, which might become
+         * empty.
+         * @param[in] value The lower 16 bits of the integer.
+         * @return Whether the operation succeeded. On failure, the container
+         * still holds the same integers.
+         */
+        static auto remove(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t value) -> Status;
+
+        /**
+         * Keeps the integers of a container that are also in another one.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in,out] container The modified container, which might become
+         * empty.
+         * @param[in] other The container that has the same key.
+         * @return Whether the operation succeeded. On failure, the container
+         * still holds the same integers.
+         */
+        static auto intersect(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *other) -> Status;
+
+        /**
+         * Adds the integers of another container to a container.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in,out] container The modified container.
+         * @param[in] other The container that has the same key.
+         * @return Whether the operation succeeded. On failure, the container
+         * still holds the same integers.
+         */
+        static auto unite(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *other) -> Status;
+
+        /**
+         * Removes the integers of another container from a container.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in,out] container The modified container, which might become
+         * empty.
+         * @param[in] other The container that has the same key.
+         * @return Whether the operation succeeded. On failure, the container
+         * still holds the same integers.
+         */
+        static auto subtract(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *other) -> Status;
+
+        /**
+         * Turns a container into runs if they take less memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in,out] container The modified container.
+         * @return Whether the operation succeeded. On failure, the container
+         * is not changed.
+         */
+        static auto compress(MemoryAllocator memoryAllocator, RoaringContainer *container) -> Status;
+
+        /**
+         * Appends the integers of a container in ascending order.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the list.
+         * @param[in] container The read container.
+         * @param[in,out] values The list the integers are appended to.
+         * @return Whether the operation succeeded.
+         */
+        static auto copyValues(MemoryAllocator memoryAllocator, RoaringContainer *container, ArrayList<uint32_t> *values) -> Status;
+
+        /**
+         * Provides the amount of bytes of the integers of a container.
+         *
+         * @param[in] container The measured container.
+         * @return The amount of bytes of its values, runs or words.
+         */
+        static auto getDataSize(RoaringContainer *container) -> int64_t;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*intersectArrays)(uint16_t *values, int64_t count, uint16_t *otherValues, int64_t otherCount, uint16_t *result) -> int64_t;
+        };
+
+        /**
+         * The shuffles that move the bytes of the selected 16-bit lanes of a
+         * vector to its beginning, for every mask of 8 lanes.
+         */
+        struct Compactions {
+            uint8_t shuffles[256][16];
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto intersectArraysPortably(uint16_t *values, int64_t count, uint16_t *otherValues, int64_t otherCount, uint16_t *result) -> int64_t;
+        static auto intersectArraysWithSsse3(uint16_t *values, int64_t count, uint16_t *otherValues, int64_t otherCount, uint16_t *result) -> int64_t;
+
+        static constexpr auto makeCompactions() -> Compactions {
+            Compactions compactions = {};
+            for (auto mask = 0; mask != 256; mask++) {
+                auto byteIndex = 0;
+                for (auto lane = 0; lane != 8; lane++) {
+                    if ((mask & (1 << lane)) != 0) {
+                        compactions.shuffles[mask][byteIndex] = (uint8_t)(2 * lane);
+                        compactions.shuffles[mask][byteIndex + 1] = (uint8_t)(2 * lane + 1);
+                        byteIndex += 2;
+                    }
+                }
+                for (; byteIndex != 16; byteIndex++) {
+                    compactions.shuffles[mask][byteIndex] = 0x80;
+                }
+            }
+            return compactions;
+        }
+
+        static auto allocateValues(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainerKind kind, int64_t capacity) -> Status;
+        static auto allocateWords(MemoryAllocator memoryAllocator, RoaringContainer *container) -> Status;
+
+        static auto findValue(uint16_t *values, int64_t count, uint16_t value) -> int64_t;
+        static auto findRun(uint16_t *runs, int64_t count, uint16_t value) -> int64_t;
+
+        static auto fillWords(RoaringContainer *container, uint64_t *words) -> void;
+        static auto fillValues(uint64_t *words, uint16_t *values) -> void;
+        static auto fillRuns(RoaringContainer *container, uint16_t *runs) -> void;
+        static auto countRuns(RoaringContainer *container) -> int64_t;
+        static auto getUnitSize(RoaringContainerKind kind) -> int64_t;
+
+        static auto expand(MemoryAllocator memoryAllocator, RoaringContainer *container) -> Status;
+        static auto shrink(MemoryAllocator memoryAllocator, RoaringContainer *container) -> void;
+        static auto materialize(RoaringContainer *container, RoaringContainer *bitmap, uint64_t *words) -> void;
+        static auto loadValues(MemoryAllocator memoryAllocator, RoaringContainer *container, uint16_t *values, int64_t count) -> Status;
+        static auto replace(MemoryAllocator memoryAllocator, RoaringContainer *container, RoaringContainer *replacement) -> void;
+    };
+}
@@ -0,0 +1,104 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/SparseSet.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::SparseSet::initialize() -> void {
+    mDense = nullptr;
+    mSparse = nullptr;
+    mUniverseSize = 0;
+    mCount = 0;
+}
+
+auto tomurcuk::SparseSet::destroy(MemoryAllocator memoryAllocator) -> void {
+    memoryAllocator.deallocate(mDense, 2 * mUniverseSize * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+}
+
+auto tomurcuk::SparseSet::resize(MemoryAllocator memoryAllocator, int64_t universeSize) -> Status {
+    assert(universeSize >= mUniverseSize);
+    assert(universeSize <= (int64_t)UINT32_MAX + 1);
+
+    if (universeSize == mUniverseSize) {
+        return Status::eSuccess;
+    }
+    // The sparse array is zeroed, so that every entry is defined before it
+    // is first read; the dense array shares the block.
+    auto newBlockResult = memoryAllocator.allocateZeroed(2 * universeSize * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+    if (newBlockResult.isFailure()) {
+        return Status::eFailure;
+    }
+    auto newDense = (uint32_t *)*newBlockResult.value();
+    auto newSparse = newDense + universeSize;
+
+    // Only the entries of the members are carried over, as the others do
+    // not point back to a member either way.
+    for (auto i = INT64_C(0); i != mCount; i++) {
+        newDense[i] = mDense[i];
+        newSparse[mDense[i]] = (uint32_t)i;
+    }
+    memoryAllocator.deallocate(mDense, 2 * mUniverseSize * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+
+    mDense = newDense;
+    mSparse = newSparse;
+    mUniverseSize = universeSize;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::SparseSet::getUniverseSize() -> int64_t {
+    return mUniverseSize;
+}
+
+auto tomurcuk::SparseSet::getView() -> ArrayListView<uint32_t> {
+    ArrayListView<uint32_t> view;
+    if (mCount == 0) {
+        view.initializeEmpty();
+    } else {
+        view.initialize(mDense, mCount);
+    }
+    return view;
+}
+
+auto tomurcuk::SparseSet::getCount() -> int64_t {
+    return mCount;
+}
+
+auto tomurcuk::SparseSet::isEmpty() -> bool {
+    return mCount == 0;
+}
+
+auto tomurcuk::SparseSet::contains(uint32_t value) -> bool {
+    assert(value < mUniverseSize);
+
+    // The entry might be stale after a removal; so, it is bounded before it
+    // is followed.
+    auto index = mSparse[value];
+    return index < mCount && mDense[index] == value;
+}
+
+auto tomurcuk::SparseSet::insert(uint32_t value) -> bool {
+    if (contains(value)) {
+        return false;
+    }
+    mDense[mCount] = value;
+    mSparse[value] = (uint32_t)mCount;
+    mCount++;
+    return true;
+}
+
+auto tomurcuk::SparseSet::remove(uint32_t value) -> bool {
+    if (!contains(value)) {
+        return false;
+    }
+    auto index = mSparse[value];
+    mCount--;
+    auto lastValue = mDense[mCount];
+    mDense[index] = lastValue;
+    mSparse[lastValue] = index;
+    return true;
+}
+
+auto tomurcuk::SparseSet::removeAll() -> void {
+    mCount = 0;
+}
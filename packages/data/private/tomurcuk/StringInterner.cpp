@@ -0,0 +1,369 @@
+#include <assert.h>
+#include <stdint.h>
+#include <threads.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringInterner.hpp>
+#include <tomurcuk/StringInternerShard.hpp>
+
+auto tomurcuk::StringInterner::create(MemoryAllocator memoryAllocator, int64_t characterCapacity, int64_t shardCount) -> Result<StringInterner> {
+    assert(characterCapacity > 0);
+    assert(shardCount > 0);
+    assert(shardCount <= kMaxShardCount);
+
+    auto shardsResult = memoryAllocator.allocate(shardCount * (int64_t)sizeof(StringInternerShard), alignof(StringInternerShard));
+    if (shardsResult.isFailure()) {
+        return Result<StringInterner>::failure();
+    }
+
+    StringInterner interner;
+    interner.mShards = (StringInternerShard *)*shardsResult.value();
+    interner.mShardCount = shardCount;
+    interner.mAllocatorMutex = nullptr;
+    if (shardCount > 1) {
+        auto mutexResult = memoryAllocator.allocate((int64_t)sizeof(mtx_t), (int64_t)alignof(mtx_t));
+        if (mutexResult.isFailure()) {
+            memoryAllocator.deallocate(interner.mShards, shardCount * (int64_t)sizeof(StringInternerShard), alignof(StringInternerShard));
+            return Result<StringInterner>::failure();
+        }
+        interner.mAllocatorMutex = (mtx_t *)*mutexResult.value();
+        if (mtx_init(interner.mAllocatorMutex, mtx_plain) != thrd_success) {
+            memoryAllocator.deallocate(interner.mAllocatorMutex, (int64_t)sizeof(mtx_t), (int64_t)alignof(mtx_t));
+            memoryAllocator.deallocate(interner.mShards, shardCount * (int64_t)sizeof(StringInternerShard), alignof(StringInternerShard));
+            return Result<StringInterner>::failure();
+        }
+    }
+
+    // The shards that were set up are torn down in reverse when one fails.
+    for (auto i = INT64_C(0); i != shardCount; i++) {
+        auto shard = interner.mShards + i;
+        auto charactersResult = LinearMemoryAllocator::create(characterCapacity);
+        auto isCreated = charactersResult.isSuccess();
+        if (isCreated && shardCount > 1 && mtx_init(&shard->mutex, mtx_plain) != thrd_success) {
+            charactersResult.value()->destroy();
+            isCreated = false;
+        }
+        if (!isCreated) {
+            for (auto j = i - 1; j >= 0; j--) {
+                interner.mShards[j].characters.destroy();
+                if (shardCount > 1) {
+                    mtx_destroy(&interner.mShards[j].mutex);
+                }
+            }
+            if (shardCount > 1) {
+                mtx_destroy(interner.mAllocatorMutex);
+                memoryAllocator.deallocate(interner.mAllocatorMutex, (int64_t)sizeof(mtx_t), (int64_t)alignof(mtx_t));
+            }
+            memoryAllocator.deallocate(interner.mShards, shardCount * (int64_t)sizeof(StringInternerShard), alignof(StringInternerShard));
+            return Result<StringInterner>::failure();
+        }
+        shard->characters = *charactersResult.value();
+        shard->strings = nullptr;
+        shard->buckets = nullptr;
+        shard->count = 0;
+        shard->capacity = 0;
+        shard->bucketCount = 0;
+    }
+    return Results::success(interner);
+}
+
+auto tomurcuk::StringInterner::destroy(MemoryAllocator memoryAllocator) -> void {
+    for (auto i = mShardCount - 1; i >= 0; i--) {
+        auto shard = mShards + i;
+        memoryAllocator.deallocate(shard->buckets, shard->bucketCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+        memoryAllocator.deallocate(shard->strings, shard->capacity * (int64_t)sizeof(ArrayListView<char>), alignof(ArrayListView<char>));
+        shard->characters.destroy();
+        if (mAllocatorMutex != nullptr) {
+            mtx_destroy(&shard->mutex);
+        }
+    }
+    if (mAllocatorMutex != nullptr) {
+        mtx_destroy(mAllocatorMutex);
+        memoryAllocator.deallocate(mAllocatorMutex, (int64_t)sizeof(mtx_t), (int64_t)alignof(mtx_t));
+    }
+    memoryAllocator.deallocate(mShards, mShardCount * (int64_t)sizeof(StringInternerShard), alignof(StringInternerShard));
+}
+
+auto tomurcuk::StringInterner::getShardCount() -> int64_t {
+    return mShardCount;
+}
+
+auto tomurcuk::StringInterner::getCount() -> int64_t {
+    auto count = INT64_C(0);
+    for (auto i = INT64_C(0); i != mShardCount; i++) {
+        auto shard = mShards + i;
+        lockShard(shard);
+        count += shard->count;
+        unlockShard(shard);
+    }
+    return count;
+}
+
+auto tomurcuk::StringInterner::intern(MemoryAllocator memoryAllocator, ArrayListView<char> string) -> Result<uint32_t> {
+    auto hash = Bytes::checksumBlockWithXxHash64(string.getArray(), string.getCount(), 0);
+    auto shardIndex = getShardIndex(hash);
+    auto shard = mShards + shardIndex;
+    lockShard(shard);
+    auto index = internIndex(memoryAllocator, shard, hash, string);
+    unlockShard(shard);
+    if (index == -1) {
+        return Result<uint32_t>::failure();
+    }
+    return Results::success((uint32_t)(index * mShardCount + shardIndex));
+}
+
+auto tomurcuk::StringInterner::internAll(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char>> strings, ArrayListView<uint32_t> symbols) -> Status {
+    assert(strings.getCount() == symbols.getCount());
+
+    auto status = Status::eSuccess;
+    uint64_t hashes[kBatchCount];
+    int64_t shardIndices[kBatchCount];
+    for (auto begin = INT64_C(0); begin < strings.getCount(); begin += kBatchCount) {
+        auto count = strings.getCount() - begin < kBatchCount ? strings.getCount() - begin : kBatchCount;
+
+        // The hashes do not depend on each other; so, they are found before
+        // any lookup, and the set of shards they select is kept.
+        auto shardMask = UINT64_C(0);
+        for (auto i = INT64_C(0); i != count; i++) {
+            auto string = strings.getArray() + begin + i;
+            hashes[i] = Bytes::checksumBlockWithXxHash64(string->getArray(), string->getCount(), 0);
+            shardIndices[i] = getShardIndex(hashes[i]);
+            shardMask |= UINT64_C(1) << (uint64_t)shardIndices[i];
+        }
+
+        while (shardMask != 0) {
+            auto shardIndex = (int64_t)__builtin_ctzll(shardMask);
+            shardMask &= shardMask - 1;
+            auto shard = mShards + shardIndex;
+            lockShard(shard);
+
+            // The preferred buckets are fetched together, so that their
+            // cache misses overlap instead of following each other.
+            if (shard->bucketCount != 0) {
+                auto mask = (uint64_t)shard->bucketCount - 1;
+                for (auto i = INT64_C(0); i != count; i++) {
+                    if (shardIndices[i] == shardIndex) {
+                        __builtin_prefetch(shard->buckets + (hashes[i] & mask));
+                    }
+                }
+            }
+            for (auto i = INT64_C(0); i != count; i++) {
+                if (shardIndices[i] != shardIndex) {
+                    continue;
+                }
+                auto index = internIndex(memoryAllocator, shard, hashes[i], strings.getArray()[begin + i]);
+                if (index == -1) {
+                    status = Status::eFailure;
+                    continue;
+                }
+                symbols.getArray()[begin + i] = (uint32_t)(index * mShardCount + shardIndex);
+            }
+            unlockShard(shard);
+        }
+    }
+    return status;
+}
+
+auto tomurcuk::StringInterner::find(ArrayListView<char> string) -> Result<uint32_t> {
+    auto hash = Bytes::checksumBlockWithXxHash64(string.getArray(), string.getCount(), 0);
+    auto shardIndex = getShardIndex(hash);
+    auto shard = mShards + shardIndex;
+    lockShard(shard);
+    auto index = findIndex(shard, hash, string);
+    unlockShard(shard);
+    if (index == -1) {
+        return Result<uint32_t>::failure();
+    }
+    return Results::success((uint32_t)(index * mShardCount + shardIndex));
+}
+
+auto tomurcuk::StringInterner::resolve(uint32_t symbol) -> ArrayListView<char> {
+    auto shard = mShards + (int64_t)symbol % mShardCount;
+    auto index = (int64_t)symbol / mShardCount;
+    lockShard(shard);
+
+    assert(index < shard->count);
+
+    auto string = shard->strings[index];
+    unlockShard(shard);
+    return string;
+}
+
+auto tomurcuk::StringInterner::getShardIndex(uint64_t hash) -> int64_t {
+    // The buckets are selected by the lower bits; so, the shards are
+    // selected by the upper ones.
+    return (int64_t)((hash >> 32U) % (uint64_t)mShardCount);
+}
+
+auto tomurcuk::StringInterner::lockShard(StringInternerShard *shard) -> void {
+    if (mAllocatorMutex != nullptr) {
+        (void)mtx_lock(&shard->mutex);
+    }
+}
+
+auto tomurcuk::StringInterner::unlockShard(StringInternerShard *shard) -> void {
+    if (mAllocatorMutex != nullptr) {
+        (void)mtx_unlock(&shard->mutex);
+    }
+}
+
+auto tomurcuk::StringInterner::reallocate(MemoryAllocator memoryAllocator, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *> {
+    if (mAllocatorMutex == nullptr) {
+        return memoryAllocator.reallocate(oldBlock, oldSize, newSize, alignment);
+    }
+    (void)mtx_lock(mAllocatorMutex);
+    auto newBlockResult = memoryAllocator.reallocate(oldBlock, oldSize, newSize, alignment);
+    (void)mtx_unlock(mAllocatorMutex);
+    return newBlockResult;
+}
+
+auto tomurcuk::StringInterner::allocateZeroed(MemoryAllocator memoryAllocator, int64_t newSize, int64_t alignment) -> Result<void *> {
+    if (mAllocatorMutex == nullptr) {
+        return memoryAllocator.allocateZeroed(newSize, alignment);
+    }
+    (void)mtx_lock(mAllocatorMutex);
+    auto newBlockResult = memoryAllocator.allocateZeroed(newSize, alignment);
+    (void)mtx_unlock(mAllocatorMutex);
+    return newBlockResult;
+}
+
+auto tomurcuk::StringInterner::deallocate(MemoryAllocator memoryAllocator, void *oldBlock, int64_t oldSize, int64_t alignment) -> void {
+    if (mAllocatorMutex == nullptr) {
+        memoryAllocator.deallocate(oldBlock, oldSize, alignment);
+        return;
+    }
+    (void)mtx_lock(mAllocatorMutex);
+    memoryAllocator.deallocate(oldBlock, oldSize, alignment);
+    (void)mtx_unlock(mAllocatorMutex);
+}
+
+auto tomurcuk::StringInterner::findIndex(StringInternerShard *shard, uint64_t hash, ArrayListView<char> string) -> int64_t {
+    if (shard->bucketCount == 0) {
+        return -1;
+    }
+
+    auto mask = (uint64_t)shard->bucketCount - 1;
+    auto lowerHash = hash & UINT32_MAX;
+    auto bucketIndex = hash & mask;
+    for (auto probeLength = UINT64_C(0);; probeLength++) {
+        auto bucket = shard->buckets[bucketIndex];
+        if (bucket == 0) {
+            return -1;
+        }
+
+        auto testedHash = bucket >> 32U;
+        if (testedHash == lowerHash) {
+            auto testedIndex = (int64_t)(bucket & UINT32_MAX) - 1;
+            auto testedString = shard->strings[testedIndex];
+            if (Bytes::testBlockExactness(testedString.getArray(), testedString.getCount(), string.getArray(), string.getCount())) {
+                return testedIndex;
+            }
+        }
+
+        // A string that is further from its preferred bucket than the tested
+        // one would have evicted it; so, it is not in the table.
+        if (probeLength > ((bucketIndex - testedHash) & mask)) {
+            return -1;
+        }
+        bucketIndex = (bucketIndex + 1) & mask;
+    }
+}
+
+auto tomurcuk::StringInterner::internIndex(MemoryAllocator memoryAllocator, StringInternerShard *shard, uint64_t hash, ArrayListView<char> string) -> int64_t {
+    auto index = findIndex(shard, hash, string);
+    if (index != -1) {
+        return index;
+    }
+
+    // Every shard owns an equal share of the 32-bit symbols.
+    auto maxCount = ((int64_t)UINT32_MAX + 1) / mShardCount;
+    if (shard->count == (maxCount < kMaxShardStringCount ? maxCount : kMaxShardStringCount)) {
+        return -1;
+    }
+    if (shard->count == shard->capacity && growStrings(memoryAllocator, shard) == Status::eFailure) {
+        return -1;
+    }
+    if ((shard->count + 1) * 8 > shard->bucketCount * 7 && growBuckets(memoryAllocator, shard) == Status::eFailure) {
+        return -1;
+    }
+
+    ArrayListView<char> copy;
+    if (string.isEmpty()) {
+        copy.initializeEmpty();
+    } else {
+        auto charactersResult = shard->characters.memoryAllocator().allocate(string.getCount(), alignof(char));
+        if (charactersResult.isFailure()) {
+            return -1;
+        }
+        copy.initialize((char *)*charactersResult.value(), string.getCount());
+        Bytes::copyArray(copy.getArray(), string.getArray(), string.getCount());
+    }
+
+    index = shard->count;
+    shard->strings[index] = copy;
+    shard->count++;
+    insertBucket(shard, (hash << 32U) | (uint64_t)(index + 1));
+    return index;
+}
+
+auto tomurcuk::StringInterner::growStrings(MemoryAllocator memoryAllocator, StringInternerShard *shard) -> Status {
+    auto newCapacity = Bytes::growCapacity(shard->capacity, shard->count, 1);
+    auto newStringsResult = reallocate(memoryAllocator, shard->strings, shard->capacity * (int64_t)sizeof(ArrayListView<char>), newCapacity * (int64_t)sizeof(ArrayListView<char>), alignof(ArrayListView<char>));
+    if (newStringsResult.isFailure()) {
+        return Status::eFailure;
+    }
+    shard->strings = (ArrayListView<char> *)*newStringsResult.value();
+    shard->capacity = newCapacity;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::StringInterner::growBuckets(MemoryAllocator memoryAllocator, StringInternerShard *shard) -> Status {
+    auto newBucketCount = shard->bucketCount == 0 ? INT64_C(16) : 2 * shard->bucketCount;
+    auto newBucketsResult = allocateZeroed(memoryAllocator, newBucketCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    if (newBucketsResult.isFailure()) {
+        return Status::eFailure;
+    }
+
+    // The buckets hold the preferred buckets of their strings; so, they are
+    // moved without reading the strings.
+    auto oldBuckets = shard->buckets;
+    auto oldBucketCount = shard->bucketCount;
+    shard->buckets = (uint64_t *)*newBucketsResult.value();
+    shard->bucketCount = newBucketCount;
+    for (auto i = INT64_C(0); i != oldBucketCount; i++) {
+        if (oldBuckets[i] != 0) {
+            insertBucket(shard, oldBuckets[i]);
+        }
+    }
+    deallocate(memoryAllocator, oldBuckets, oldBucketCount * (int64_t)sizeof(uint64_t), alignof(uint64_t));
+    return Status::eSuccess;
+}
+
+auto tomurcuk::StringInterner::insertBucket(StringInternerShard *shard, uint64_t bucket) -> void {
+    auto mask = (uint64_t)shard->bucketCount - 1;
+    auto bucketIndex = (bucket >> 32U) & mask;
+    auto probeLength = UINT64_C(0);
+    while (true) {
+        auto testedBucket = shard->buckets[bucketIndex];
+        if (testedBucket == 0) {
+            shard->buckets[bucketIndex] = bucket;
+            return;
+        }
+
+        // The string that is closer to its preferred bucket gives way, and
+        // the evicted one continues the probing.
+        auto testedProbeLength = (bucketIndex - (testedBucket >> 32U)) & mask;
+        if (testedProbeLength < probeLength) {
+            shard->buckets[bucketIndex] = bucket;
+            bucket = testedBucket;
+            probeLength = testedProbeLength;
+        }
+        bucketIndex = (bucketIndex + 1) & mask;
+        probeLength++;
+    }
+}
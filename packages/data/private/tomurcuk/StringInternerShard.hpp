@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+#include <threads.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+
+namespace tomurcuk {
+    /**
+     * The strings of a @ref StringInterner whose hashes select the same
+     * shard, and the table that finds them.
+     *
+     * The table is a linear-probing hash table with Robin Hood insertion over
+     * the indices of the strings, like the one of @ref ArraySetView, but its
+     * amount of buckets is a power of `2` and every bucket also holds the
+     * lower half of the hash of its string. So, probing and growing the table
+     * does not read the strings, and only a matching hash does.
+     */
+    struct StringInternerShard {
+        /**
+         * The allocator of the characters, which are never moved; so, the
+         * views of the strings stay valid.
+         */
+        LinearMemoryAllocator characters;
+
+        /**
+         * Pointer to the strings in the order they were interned.
+         *
+         * @warning `nullptr` if there are no allocated strings.
+         */
+        ArrayListView<char> *strings;
+
+        /**
+         * Pointer to the buckets, each of which holds the lower half of the
+         * hash of a string in its upper half, and the index of the string plus
+         * one in its lower half; or `0` when it is empty.
+         *
+         * @warning `nullptr` if there are no buckets.
+         */
+        uint64_t *buckets;
+
+        /**
+         * The amount of strings.
+         */
+        int64_t count;
+
+        /**
+         * The amount of allocated strings.
+         */
+        int64_t capacity;
+
+        /**
+         * The amount of buckets, which is `0` or a power of `2`.
+         */
+        int64_t bucketCount;
+
+        /**
+         * The lock that is held while the shard is accessed.
+         *
+         * @warning Only initialized if the interner has multiple shards.
+         */
+        mtx_t mutex;
+    };
+}
@@ -0,0 +1,183 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/VarintCodec.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::VarintCodec::encode(MemoryAllocator memoryAllocator, ArrayList<uint8_t> *bytes, ArrayListView<uint32_t> values) -> Status {
+    if (values.isEmpty()) {
+        return Status::eSuccess;
+    }
+    if (!bytes->reserve(memoryAllocator, values.getCount() * kMaxSize32)) {
+        return Status::eFailure;
+    }
+    bytes->acknowledge(encodeAll(bytes->getEnd(), values.getArray(), values.getCount()));
+    return Status::eSuccess;
+}
+
+auto tomurcuk::VarintCodec::encode(MemoryAllocator memoryAllocator, ArrayList<uint8_t> *bytes, ArrayListView<uint64_t> values) -> Status {
+    if (values.isEmpty()) {
+        return Status::eSuccess;
+    }
+    if (!bytes->reserve(memoryAllocator, values.getCount() * kMaxSize64)) {
+        return Status::eFailure;
+    }
+    bytes->acknowledge(encodeAll(bytes->getEnd(), values.getArray(), values.getCount()));
+    return Status::eSuccess;
+}
+
+auto tomurcuk::VarintCodec::decode(ArrayListView<uint8_t> bytes, ArrayListView<uint32_t> values) -> int64_t {
+    return getKernels().decode32(bytes.getArray(), bytes.getCount(), values.getArray(), values.getCount());
+}
+
+auto tomurcuk::VarintCodec::decode(ArrayListView<uint8_t> bytes, ArrayListView<uint64_t> values) -> int64_t {
+    auto offset = INT64_C(0);
+    for (auto i = INT64_C(0); i != values.getCount(); i++) {
+        auto size = decodeOne(bytes.getArray() + offset, bytes.getCount() - offset, values.getArray() + i);
+        if (size < 0) {
+            return -1;
+        }
+        offset += size;
+    }
+    return offset;
+}
+
+auto tomurcuk::VarintCodec::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::VarintCodec::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.decode32 = &decode32Portably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.decode32 = &decode32WithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::VarintCodec::decode32Portably(uint8_t *bytes, int64_t size, uint32_t *values, int64_t count) -> int64_t {
+    auto offset = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        auto valueSize = decodeOne(bytes + offset, size - offset, values + i);
+        if (valueSize < 0) {
+            return -1;
+        }
+        offset += valueSize;
+    }
+    return offset;
+}
+
+template<typename Value>
+auto tomurcuk::VarintCodec::encodeAll(uint8_t *bytes, Value *values, int64_t count) -> int64_t {
+    auto size = INT64_C(0);
+    for (auto i = INT64_C(0); i != count; i++) {
+        auto value = values[i];
+        while (value >= 0x80) {
+            bytes[size] = (uint8_t)(value | 0x80U);
+            size++;
+            value >>= 7U;
+        }
+        bytes[size] = (uint8_t)value;
+        size++;
+    }
+    return size;
+}
+
+template<typename Value>
+auto tomurcuk::VarintCodec::decodeOne(uint8_t *bytes, int64_t size, Value *value) -> int64_t {
+    static constexpr auto kBitCount = (uint64_t)sizeof(Value) * 8;
+
+    Value result = 0;
+    auto shift = UINT64_C(0);
+    for (auto i = INT64_C(0); i != size; i++) {
+        auto byte = (Value)bytes[i];
+
+        // The last byte an integer can have must not hold any bits beyond the
+        // ones of the type, which also rules out a continuation.
+        if (shift + 7 > kBitCount && byte >= (Value)1 << (kBitCount - shift)) {
+            return -1;
+        }
+
+        result |= (byte & 0x7FU) << shift;
+        if (byte < 0x80) {
+            *value = result;
+            return i + 1;
+        }
+        shift += 7;
+    }
+    return -1;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("avx2")]]
+auto tomurcuk::VarintCodec::decode32WithAvx2(uint8_t *bytes, int64_t size, uint32_t *values, int64_t count) -> int64_t {
+    // Up to 4 bytes past the 32 bytes of a block are read for the integer
+    // that starts at the last byte of the block.
+    static constexpr auto kBlockSize = INT64_C(32);
+    static constexpr auto kReadSize = kBlockSize + 4;
+
+    auto offset = INT64_C(0);
+    auto i = INT64_C(0);
+    while (i != count && size - offset >= kReadSize) {
+        auto block = _mm256_loadu_si256((__m256i *)(bytes + offset));
+        auto ends = ~(uint32_t)_mm256_movemask_epi8(block);
+        if (ends == UINT32_MAX && count - i >= kBlockSize) {
+            auto low = _mm256_castsi256_si128(block);
+            auto high = _mm256_extracti128_si256(block, 1);
+            _mm256_storeu_si256((__m256i *)(values + i), _mm256_cvtepu8_epi32(low));
+            _mm256_storeu_si256((__m256i *)(values + i + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+            _mm256_storeu_si256((__m256i *)(values + i + 16), _mm256_cvtepu8_epi32(high));
+            _mm256_storeu_si256((__m256i *)(values + i + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+            i += kBlockSize;
+            offset += kBlockSize;
+            continue;
+        }
+
+        // Every integer that ends in the block and takes at most 4 bytes is
+        // gathered from its 7-bit groups with shifts.
+        auto begin = INT64_C(0);
+        while (ends != 0 && i != count) {
+            auto end = (int64_t)__builtin_ctz(ends);
+            auto length = end - begin + 1;
+            if (length > 4) {
+                break;
+            }
+            uint32_t word;
+            __builtin_memcpy(&word, bytes + offset + begin, sizeof(word));
+            word &= UINT32_MAX >> (uint32_t)(32 - 8 * length);
+            values[i] = (word & 0x7FU) | ((word >> 1U) & 0x3F80U) | ((word >> 2U) & 0x1F'C000U) | ((word >> 3U) & 0xFE0'0000U);
+            i++;
+            begin = end + 1;
+            ends &= ends - 1;
+        }
+        if (begin == 0) {
+            auto valueSize = decodeOne(bytes + offset, size - offset, values + i);
+            if (valueSize < 0) {
+                return -1;
+            }
+            i++;
+            begin = valueSize;
+        }
+        offset += begin;
+    }
+
+    auto restSize = decode32Portably(bytes + offset, size - offset, values + i, count - i);
+    if (restSize < 0) {
+        return -1;
+    }
+    return offset + restSize;
+}
+
+#endif
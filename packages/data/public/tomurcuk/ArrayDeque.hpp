@@ -0,0 +1,405 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Ring of elements that can be added to and removed from both ends.
+     *
+     * @tparam Element The type of the elements.
+     *
+     * @warning The backing memory might not be allocated. That case should act
+     * as if there are no elements in the deque.
+     *
+     * The capacity is always a power of two; so, positions wrap with a mask.
+     * The elements start at the head and might wrap around the end of the
+     * block; so, they are exposed as two views, where the second one is empty
+     * unless the elements wrap.
+     *
+     * To append to the deque in bulk:
+     *   1- Acquire required slots via @ref reserve.
+     *   2- Write to them via @ref getFirstUninitializedView and
+     *      @ref getSecondUninitializedView.
+     *   3- Mark the newly written elements as initialized via @ref acknowledge.
+     *
+     * To remove from the deque in bulk:
+     *   1- Read the elements via @ref getFirstView and @ref getSecondView.
+     *   2- Drop the read elements via @ref removeLeading.
+     */
+    template<typename Element>
+    class ArrayDeque {
+    public:
+        /**
+         * Creates a new deque that is empty.
+         */
+        auto initialize() -> void {
+            mArray = nullptr;
+            mCapacity = 0;
+            mHead = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            memoryAllocator.deallocate(mArray, mCapacity * (int64_t)sizeof(Element), alignof(Element));
+        }
+
+        /**
+         * Provides the elements from the head up to the end of the block or
+         * the last element, whichever comes first.
+         *
+         * @warning The deque must not be modified while the view is used.
+         *
+         * @return A view that refers to the leading elements.
+         */
+        auto getFirstView() -> ArrayListView<Element> {
+            auto count = mCapacity - mHead;
+            if (count > mCount) {
+                count = mCount;
+            }
+            return createView(mHead, count);
+        }
+
+        /**
+         * Provides the elements that wrapped around to the beginning of the
+         * block.
+         *
+         * @warning The deque must not be modified while the view is used.
+         *
+         * @return A view that refers to the trailing elements, which is empty
+         * if the elements do not wrap.
+         */
+        auto getSecondView() -> ArrayListView<Element> {
+            auto count = mHead + mCount - mCapacity;
+            if (count < 0) {
+                count = 0;
+            }
+            return createView(0, count);
+        }
+
+        /**
+         * Provides the uninitialized slots from the one after the last element
+         * up to the end of the block or the head, whichever comes first.
+         *
+         * @return A view that refers to the leading uninitialized slots.
+         */
+        auto getFirstUninitializedView() -> ArrayListView<Element> {
+            auto tail = wrap(mHead + mCount);
+            auto count = mCapacity - tail;
+            if (count > getUninitializedCount()) {
+                count = getUninitializedCount();
+            }
+            return createView(tail, count);
+        }
+
+        /**
+         * Provides the uninitialized slots that wrapped around to the
+         * beginning of the block.
+         *
+         * @return A view that refers to the trailing uninitialized slots, which
+         * is empty if the uninitialized slots do not wrap.
+         */
+        auto getSecondUninitializedView() -> ArrayListView<Element> {
+            auto tail = wrap(mHead + mCount);
+            auto count = tail + getUninitializedCount() - mCapacity;
+            if (count < 0 || tail < mHead) {
+                count = 0;
+            }
+            return createView(0, count);
+        }
+
+        /**
+         * Provides the amount of initialized elements.
+         *
+         * @return The amount of elements in the deque.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Provides the amount of allocated elements.
+         *
+         * @return The amount of elements the backing memory can hold.
+         */
+        auto getAllocatedCount() -> int64_t {
+            return mCapacity;
+        }
+
+        /**
+         * Provides the amount of uninitialized elements.
+         *
+         * @return The amount of elements that can be added without growing.
+         */
+        auto getUninitializedCount() -> int64_t {
+            return mCapacity - mCount;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the deque.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides the pointer to the first element.
+         *
+         * @return The pointer to the first element.
+         */
+        auto getFirst() -> Element * {
+            return get(0);
+        }
+
+        /**
+         * Provides the pointer to the last element.
+         *
+         * @return The pointer to the last element.
+         */
+        auto getLast() -> Element * {
+            return get(mCount - 1);
+        }
+
+        /**
+         * Provides the pointer to the element at an index.
+         *
+         * @param[in] index The amount of elements before the accessed element.
+         * @return The pointer to the element at the given index.
+         */
+        auto get(int64_t index) -> Element * {
+            assert(index >= 0);
+            assert(index < mCount);
+
+            return mArray + wrap(mHead + index);
+        }
+
+        /**
+         * Prepends an element to the beginning of the deque.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element.
+         * @return Whether the operation succeeded.
+         */
+        auto addFirst(MemoryAllocator memoryAllocator, Element element) -> Status {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            mHead = wrap(mHead - 1);
+            mArray[mHead] = element;
+            mCount++;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Appends an element to the end of the deque.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element.
+         * @return Whether the operation succeeded.
+         */
+        auto addLast(MemoryAllocator memoryAllocator, Element element) -> Status {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            mArray[wrap(mHead + mCount)] = element;
+            mCount++;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Appends another list to the end of the deque.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The added elements.
+         * @return Whether the operation succeeded.
+         */
+        auto addAll(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            auto firstView = getFirstUninitializedView();
+            auto firstCount = view.getCount();
+            if (firstCount > firstView.getCount()) {
+                firstCount = firstView.getCount();
+            }
+            if (firstCount != 0) {
+                Bytes::copyArray(firstView.getArray(), view.getArray(), firstCount);
+            }
+            if (firstCount != view.getCount()) {
+                Bytes::copyArray(mArray, view.getArray() + firstCount, view.getCount() - firstCount);
+            }
+            acknowledge(view.getCount());
+            return Status::eSuccess;
+        }
+
+        /**
+         * Removes the first element.
+         *
+         * @return The element that was previously the first one.
+         */
+        auto removeFirst() -> Element {
+            auto element = *getFirst();
+            mHead = wrap(mHead + 1);
+            mCount--;
+            return element;
+        }
+
+        /**
+         * Removes the last element.
+         *
+         * @return The element that was previously the last one.
+         */
+        auto removeLast() -> Element {
+            auto element = *getLast();
+            mCount--;
+            return element;
+        }
+
+        /**
+         * Removes some amount of elements from the beginning of the deque.
+         *
+         * @param[in] amount The amount of removed elements.
+         */
+        auto removeLeading(int64_t amount) -> void {
+            assert(amount >= 0);
+            assert(amount <= mCount);
+
+            mHead = wrap(mHead + amount);
+            mCount -= amount;
+        }
+
+        /**
+         * Removes some amount of elements from the end of the deque.
+         *
+         * @param[in] amount The amount of removed elements.
+         */
+        auto removeTrailing(int64_t amount) -> void {
+            assert(amount >= 0);
+            assert(amount <= mCount);
+
+            mCount -= amount;
+        }
+
+        /**
+         * Removes all the elements from the deque.
+         */
+        auto removeAll() -> void {
+            mHead = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Grows the amount of uninitialized elements in preparation for an
+         * add-operation.
+         *
+         * Elements that wrap are unwrapped with a single copy of the smaller
+         * one of the two views.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of uninitialized elements that
+         * must exists in the deque.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+            auto newCapacity = Bytes::growCapacity(mCapacity, mCount, amount);
+            if (newCapacity == mCapacity) {
+                return Status::eSuccess;
+            }
+            if (newCapacity > (INT64_C(1) << 62U) / (int64_t)sizeof(Element)) {
+                abort();
+            }
+            if (newCapacity > 1) {
+                newCapacity = (int64_t)(UINT64_C(1) << (64U - (uint32_t)__builtin_clzll((uint64_t)newCapacity - 1)));
+            }
+
+            auto oldCapacity = mCapacity;
+            auto newBlockResult = memoryAllocator.reallocate(mArray, oldCapacity * (int64_t)sizeof(Element), newCapacity * (int64_t)sizeof(Element), alignof(Element));
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mArray = (Element *)*newBlockResult.value();
+            mCapacity = newCapacity;
+
+            // The new capacity is at least twice the old one; so, either view
+            // fits after the old end.
+            auto wrappedCount = mHead + mCount - oldCapacity;
+            if (wrappedCount > 0) {
+                auto headCount = oldCapacity - mHead;
+                if (wrappedCount < headCount) {
+                    Bytes::copyArray(mArray + oldCapacity, mArray, wrappedCount);
+                } else {
+                    Bytes::copyArray(mArray + newCapacity - headCount, mArray + mHead, headCount);
+                    mHead = newCapacity - headCount;
+                }
+            }
+            return Status::eSuccess;
+        }
+
+        /**
+         * Marks some amount of leading uninitialized elements as initialized.
+         *
+         * @param[in] amount The amount of uninitialized elements that will be
+         * marked as initialized.
+         */
+        auto acknowledge(int64_t amount) -> void {
+            assert(amount >= 0);
+            assert(amount <= mCapacity - mCount);
+
+            mCount += amount;
+        }
+
+    private:
+        /**
+         * Pointer to the backing memory.
+         *
+         * @warning `nullptr` if there are no allocated elements.
+         */
+        Element *mArray;
+
+        /**
+         * The amount of allocated elements, which is `0` or a power of two.
+         */
+        int64_t mCapacity;
+
+        /**
+         * The index of the first element in the backing memory.
+         */
+        int64_t mHead;
+
+        /**
+         * The amount of initialized elements.
+         */
+        int64_t mCount;
+
+        auto wrap(int64_t index) -> int64_t {
+            return index & (mCapacity - 1);
+        }
+
+        auto createView(int64_t index, int64_t count) -> ArrayListView<Element> {
+            ArrayListView<Element> view;
+            if (count == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(mArray + index, count);
+            }
+            return view;
+        }
+    };
+}
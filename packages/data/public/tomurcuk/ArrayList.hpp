@@ -43,7 +43,7 @@ namespace tomurcuk {
          * memory.
          */
         auto destroy(MemoryAllocator memoryAllocator) -> void {
-            memoryAllocator.deallocateArray(mArray, mCapacity);
+            memoryAllocator.deallocate(mArray, mCapacity * (int64_t)sizeof(Element), alignof(Element));
         }
 
         /**
@@ -55,7 +55,11 @@ namespace tomurcuk {
          */
         auto getView() -> ArrayListView<Element> {
             ArrayListView<Element> view;
-            view.initialize(mArray, mCount);
+            if (mCount == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(mArray, mCount);
+            }
             return view;
         }
 
@@ -188,12 +192,15 @@ namespace tomurcuk {
             assert(index >= 0);
             assert(index < mCount);
 
-            return mArray[index];
+            return mArray + index;
         }
 
         /**
          * Removes the first element.
          *
+         * @warning This moves all the other elements. Use @ref ArrayDeque for
+         * lists that are consumed from the beginning.
+         *
          * @return The element that was previously the first one.
          */
         auto removeFirst() -> Element {
@@ -216,8 +223,10 @@ namespace tomurcuk {
          * @return The element that was previously at the given index.
          */
         auto remove(int64_t index) -> Element {
-            auto element = get(index);
-            Bytes::copyAliasingArray(mArray + index, mArray + index + 1, mCount - index - 1);
+            auto element = *get(index);
+            if (index != mCount - 1) {
+                Bytes::copyAliasingArray(mArray + index, mArray + index + 1, mCount - index - 1);
+            }
             mCount--;
             return element;
         }
@@ -233,7 +242,7 @@ namespace tomurcuk {
          * @return The element that was previously at the given index.
          */
         auto removeUnordered(int64_t index) -> Element {
-            auto element = get(index);
+            auto element = *get(index);
             mCount--;
             if (!isEmpty()) {
                 mArray[index] = mArray[mCount];
@@ -256,7 +265,9 @@ namespace tomurcuk {
             assert(beginIndex <= endIndex);
             assert(endIndex <= mCount);
 
-            Bytes::copyAliasingArray(mArray + beginIndex, mArray + endIndex, mCount - endIndex);
+            if (endIndex != mCount) {
+                Bytes::copyAliasingArray(mArray + beginIndex, mArray + endIndex, mCount - endIndex);
+            }
             mCount -= endIndex - beginIndex;
         }
 
@@ -365,12 +376,14 @@ namespace tomurcuk {
                 return true;
             }
 
-            Element *newArray;
-            if (!memoryAllocator.reallocateArray(&newArray, mArray, mCapacity, newCapacity)) {
+            assert(newCapacity <= INT64_MAX / (int64_t)sizeof(Element));
+
+            auto newBlockResult = memoryAllocator.reallocate(mArray, mCapacity * (int64_t)sizeof(Element), newCapacity * (int64_t)sizeof(Element), alignof(Element));
+            if (newBlockResult.isFailure()) {
                 return false;
             }
 
-            mArray = newArray;
+            mArray = (Element *)*newBlockResult.value();
             mCapacity = newCapacity;
             return true;
         }
@@ -107,7 +107,7 @@ namespace tomurcuk {
             assert(index >= 0);
             assert(index < mCount);
 
-            return mArray[index];
+            return mArray + index;
         }
 
     private:
@@ -0,0 +1,813 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/KeySearch.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Map that keeps its entries ordered by their keys, in a B+ tree.
+     *
+     * @tparam Key The type of the keys.
+     * @tparam Value The type of the values.
+     * @tparam Comparator The implementation of @ref OrderComparable that
+     * orders the keys.
+     * @tparam kNodeSize The size of every node in bytes, which is a multiple
+     * of a cache line.
+     *
+     * Every node spans several cache lines, and holds as many keys as fit;
+     * so, a lookup visits few nodes, and scans the keys of each one linearly.
+     * Integer keys with the default order are scanned by @ref KeySearch. The
+     * entries are only kept in the leaves, which are linked in both
+     * directions; so, range scans walk the leaves without going back up the
+     * tree.
+     *
+     * Every node is allocated separately from the allocator, with the same
+     * size and alignment; so, an allocator that pools blocks of a single size
+     * suits the map well.
+     */
+    template<typename Key, typename Value, typename Comparator = OrderComparable<Key>, int64_t kNodeSize = 512>
+    class BTreeMap {
+        static_assert(kNodeSize % 64 == 0);
+
+        struct Leaf;
+
+    public:
+        /**
+         * The alignment of every node, which is a cache line.
+         */
+        static constexpr auto kNodeAlignment = INT64_C(64);
+
+        /**
+         * Position of an entry, which is used for walking the entries in
+         * order.
+         *
+         * @warning The map must not be modified while the cursor is used.
+         */
+        class Cursor {
+        public:
+            /**
+             * Creates a cursor at an entry, which is used by the map.
+             *
+             * @param[in] leaf The pointer to the leaf of the entry, or
+             * `nullptr` for a cursor that is not at an entry.
+             * @param[in] index The index of the entry in its leaf.
+             */
+            auto initialize(Leaf *leaf, int64_t index) -> void {
+                assert(leaf == nullptr || (index >= 0 && index < leaf->count));
+
+                mLeaf = leaf;
+                mIndex = index;
+            }
+
+            /**
+             * Tests whether the cursor is at an entry.
+             *
+             * @return Whether the cursor did not move past either end of the
+             * map.
+             */
+            auto isValid() -> bool {
+                return mLeaf != nullptr;
+            }
+
+            /**
+             * Provides the key of the entry.
+             *
+             * @warning The key must not be modified in a way that changes its
+             * order.
+             *
+             * @return The pointer to the key.
+             */
+            auto getKey() -> Key * {
+                assert(isValid());
+
+                return mLeaf->keys + mIndex;
+            }
+
+            /**
+             * Provides the value of the entry.
+             *
+             * @return The pointer to the value.
+             */
+            auto getValue() -> Value * {
+                assert(isValid());
+
+                return mLeaf->values + mIndex;
+            }
+
+            /**
+             * Moves to the entry with the next greater key.
+             */
+            auto moveNext() -> void {
+                assert(isValid());
+
+                mIndex++;
+                while (mLeaf != nullptr && mIndex == mLeaf->count) {
+                    mLeaf = mLeaf->next;
+                    mIndex = 0;
+                }
+            }
+
+            /**
+             * Moves to the entry with the next lesser key.
+             */
+            auto movePrevious() -> void {
+                assert(isValid());
+
+                while (mLeaf != nullptr && mIndex == 0) {
+                    mLeaf = mLeaf->previous;
+                    mIndex = mLeaf == nullptr ? 0 : mLeaf->count;
+                }
+                if (mLeaf != nullptr) {
+                    mIndex--;
+                }
+            }
+
+        private:
+            /**
+             * Pointer to the leaf of the entry.
+             *
+             * @warning `nullptr` if the cursor is not at an entry.
+             */
+            Leaf *mLeaf;
+
+            /**
+             * The index of the entry in its leaf.
+             */
+            int64_t mIndex;
+        };
+
+        /**
+         * Creates a new map that is empty.
+         */
+        auto initialize() -> void {
+            mRoot = nullptr;
+            mHeight = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            if (mRoot != nullptr) {
+                destroyNode(memoryAllocator, mRoot, mHeight);
+            }
+        }
+
+        /**
+         * Provides the amount of entries.
+         *
+         * @return The amount of entries in the map.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Tests whether there are no entries.
+         *
+         * @return Whether there are no entries in the map.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides the value of a key.
+         *
+         * @param[in] key The key of the accessed value.
+         * @return The pointer to the value if the key is in the map.
+         * Otherwise, `nullptr`.
+         */
+        auto get(Key key) -> Value * {
+            if (mRoot == nullptr) {
+                return nullptr;
+            }
+            auto leaf = findLeaf(&key);
+            auto index = countLess(leaf->keys, leaf->count, &key);
+            if (index == leaf->count || !isEqual(leaf->keys + index, &key)) {
+                return nullptr;
+            }
+            return leaf->values + index;
+        }
+
+        /**
+         * Provides the position of the entry with the least key.
+         *
+         * @return The cursor at the first entry, which is not valid if the map
+         * is empty.
+         */
+        auto getFirst() -> Cursor {
+            if (mRoot == nullptr) {
+                return createCursor(nullptr, 0);
+            }
+            auto node = mRoot;
+            for (auto level = mHeight; level != 0; level--) {
+                node = ((Branch *)node)->children[0];
+            }
+            return createCursor((Leaf *)node, 0);
+        }
+
+        /**
+         * Provides the position of the entry with the greatest key.
+         *
+         * @return The cursor at the last entry, which is not valid if the map
+         * is empty.
+         */
+        auto getLast() -> Cursor {
+            if (mRoot == nullptr) {
+                return createCursor(nullptr, 0);
+            }
+            auto node = mRoot;
+            for (auto level = mHeight; level != 0; level--) {
+                auto branch = (Branch *)node;
+                node = branch->children[branch->count];
+            }
+
+            // The leaf is never empty, as empty leaves are deallocated.
+            auto leaf = (Leaf *)node;
+            return createCursor(leaf, leaf->count - 1);
+        }
+
+        /**
+         * Finds the entry with the least key that is not less than a key,
+         * which is where a range scan from that key begins.
+         *
+         * @param[in] key The searched key.
+         * @return The cursor at the found entry, which is not valid if every
+         * key is less than the searched one.
+         */
+        auto findCeiling(Key key) -> Cursor {
+            if (mRoot == nullptr) {
+                return createCursor(nullptr, 0);
+            }
+            auto leaf = findLeaf(&key);
+            return createCursor(leaf, countLess(leaf->keys, leaf->count, &key));
+        }
+
+        /**
+         * Finds the entry with the greatest key that is not greater than a
+         * key.
+         *
+         * @param[in] key The searched key.
+         * @return The cursor at the found entry, which is not valid if every
+         * key is greater than the searched one.
+         */
+        auto findFloor(Key key) -> Cursor {
+            auto cursor = findCeiling(key);
+            if (!cursor.isValid()) {
+                return getLast();
+            }
+            if (!isEqual(cursor.getKey(), &key)) {
+                cursor.movePrevious();
+            }
+            return cursor;
+        }
+
+        /**
+         * Adds an entry, or replaces the value of an existing key.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] key The key of the entry.
+         * @param[in] value The value of the entry.
+         * @return Whether the operation succeeded. On failure, the map is not
+         * modified.
+         */
+        auto put(MemoryAllocator memoryAllocator, Key key, Value value) -> Status {
+            if (mRoot == nullptr) {
+                auto leafResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+                if (leafResult.isFailure()) {
+                    return Status::eFailure;
+                }
+                auto leaf = (Leaf *)*leafResult.value();
+                leaf->count = 0;
+                leaf->previous = nullptr;
+                leaf->next = nullptr;
+                mRoot = leaf;
+            }
+
+            Branch *path[kMaxHeight];
+            int64_t childIndices[kMaxHeight];
+            auto leaf = findPath(&key, path, childIndices);
+            auto index = countLess(leaf->keys, leaf->count, &key);
+            if (index != leaf->count && isEqual(leaf->keys + index, &key)) {
+                leaf->values[index] = value;
+                return Status::eSuccess;
+            }
+            if (leaf->count != kLeafCapacity) {
+                insertIntoLeaf(leaf, index, &key, &value);
+                mCount++;
+                return Status::eSuccess;
+            }
+
+            // Every full node on the path splits, and so does the root; so,
+            // all the new nodes are allocated before anything moves.
+            auto splitBranchCount = INT64_C(0);
+            while (splitBranchCount != mHeight && path[splitBranchCount]->count == kBranchCapacity) {
+                splitBranchCount++;
+            }
+            auto isRootSplit = splitBranchCount == mHeight;
+            auto newBranchCount = splitBranchCount + (isRootSplit ? 1 : 0);
+            auto newLeafResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+            if (newLeafResult.isFailure()) {
+                return Status::eFailure;
+            }
+            Branch *newBranches[kMaxHeight + 1];
+            for (auto i = INT64_C(0); i != newBranchCount; i++) {
+                auto newBranchResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+                if (newBranchResult.isFailure()) {
+                    for (auto j = i - 1; j >= 0; j--) {
+                        memoryAllocator.deallocate(newBranches[j], kNodeSize, kNodeAlignment);
+                    }
+                    memoryAllocator.deallocate(*newLeafResult.value(), kNodeSize, kNodeAlignment);
+                    return Status::eFailure;
+                }
+                newBranches[i] = (Branch *)*newBranchResult.value();
+            }
+
+            auto newLeaf = (Leaf *)*newLeafResult.value();
+            splitLeaf(leaf, newLeaf, index, &key, &value);
+            mCount++;
+            auto separator = leaf->keys[leaf->count - 1];
+            void *child = newLeaf;
+            for (auto level = INT64_C(0); level != mHeight; level++) {
+                auto branch = path[level];
+                if (level == splitBranchCount) {
+                    insertIntoBranch(branch, childIndices[level], &separator, child);
+                    return Status::eSuccess;
+                }
+                splitBranch(branch, newBranches[level], childIndices[level], &separator, &child);
+            }
+
+            auto root = newBranches[newBranchCount - 1];
+            root->count = 1;
+            root->keys[0] = separator;
+            root->children[0] = mRoot;
+            root->children[1] = child;
+            mRoot = root;
+            mHeight++;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Removes the entry of a key.
+         *
+         * Nodes that become empty are deallocated, but nodes that only become
+         * sparse are not merged with their neighbors.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         * @param[in] key The key of the removed entry.
+         * @return Whether the key was in the map.
+         */
+        auto remove(MemoryAllocator memoryAllocator, Key key) -> bool {
+            if (mRoot == nullptr) {
+                return false;
+            }
+
+            Branch *path[kMaxHeight];
+            int64_t childIndices[kMaxHeight];
+            auto leaf = findPath(&key, path, childIndices);
+            auto index = countLess(leaf->keys, leaf->count, &key);
+            if (index == leaf->count || !isEqual(leaf->keys + index, &key)) {
+                return false;
+            }
+            leaf->count--;
+            moveArray(leaf->keys + index, leaf->keys + index + 1, leaf->count - index);
+            moveArray(leaf->values + index, leaf->values + index + 1, leaf->count - index);
+            mCount--;
+            if (leaf->count != 0) {
+                return true;
+            }
+
+            if (leaf->previous != nullptr) {
+                leaf->previous->next = leaf->next;
+            }
+            if (leaf->next != nullptr) {
+                leaf->next->previous = leaf->previous;
+            }
+            memoryAllocator.deallocate(leaf, kNodeSize, kNodeAlignment);
+
+            // Remove the empty node from its parent, along with one of the
+            // separators around it, which leaves the neighbor with a wider
+            // range that still holds all its keys.
+            for (auto level = INT64_C(0); level != mHeight; level++) {
+                auto branch = path[level];
+                auto childIndex = childIndices[level];
+                if (branch->count != 0) {
+                    auto keyIndex = childIndex == branch->count ? childIndex - 1 : childIndex;
+                    branch->count--;
+                    moveArray(branch->keys + keyIndex, branch->keys + keyIndex + 1, branch->count - keyIndex);
+                    moveArray(branch->children + childIndex, branch->children + childIndex + 1, branch->count + 1 - childIndex);
+                    shrinkRoot(memoryAllocator);
+                    return true;
+                }
+                memoryAllocator.deallocate(branch, kNodeSize, kNodeAlignment);
+            }
+            mRoot = nullptr;
+            mHeight = 0;
+            return true;
+        }
+
+        /**
+         * Adds entries to an empty map from keys that are in ascending order,
+         * in linear time.
+         *
+         * The nodes are filled completely, except for the last one of each
+         * level; so, the map is as shallow and as dense as it can be.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] keys The keys of the entries, in ascending order without
+         * duplicates.
+         * @param[in] values The values of the entries, one for each key.
+         * @return Whether the operation succeeded. On failure, the map is
+         * still empty.
+         */
+        auto bulkLoad(MemoryAllocator memoryAllocator, ArrayListView<Key> keys, ArrayListView<Value> values) -> Status {
+            assert(mRoot == nullptr);
+            assert(keys.getCount() == values.getCount());
+
+            auto count = keys.getCount();
+            if (count == 0) {
+                return Status::eSuccess;
+            }
+            for (auto i = INT64_C(1); i < count; i++) {
+                assert(Comparator::compare(keys.get(i - 1), keys.get(i)) == Ordering::eLess);
+            }
+
+            int64_t levelCounts[kMaxHeight + 1];
+            levelCounts[0] = (count + kLeafCapacity - 1) / kLeafCapacity;
+            auto levelCount = INT64_C(1);
+            auto nodeCount = levelCounts[0];
+            while (levelCounts[levelCount - 1] != 1) {
+                levelCounts[levelCount] = (levelCounts[levelCount - 1] + kBranchCapacity) / (kBranchCapacity + 1);
+                nodeCount += levelCounts[levelCount];
+                levelCount++;
+            }
+
+            // Every node is allocated before any of them is filled, so that a
+            // failure only needs to undo the allocations. The nodes are all of
+            // the same size; so, the allocated ones are chained through their
+            // first bytes, and taken in any order while building.
+            void *freeNodes = nullptr;
+            for (auto i = INT64_C(0); i != nodeCount; i++) {
+                auto nodeResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+                if (nodeResult.isFailure()) {
+                    while (freeNodes != nullptr) {
+                        auto nextNode = *(void **)freeNodes;
+                        memoryAllocator.deallocate(freeNodes, kNodeSize, kNodeAlignment);
+                        freeNodes = nextNode;
+                    }
+                    return Status::eFailure;
+                }
+                auto node = *nodeResult.value();
+                *(void **)node = freeNodes;
+                freeNodes = node;
+            }
+
+            // The leaves are filled in order, and every node is added to the
+            // last branch of the level above it, which starts a new branch
+            // when it is full; so, every level is filled like the leaves.
+            Branch *lastBranches[kMaxHeight + 1];
+            for (auto level = INT64_C(1); level != levelCount; level++) {
+                lastBranches[level] = nullptr;
+            }
+            Leaf *previousLeaf = nullptr;
+            for (auto begin = INT64_C(0); begin < count; begin += kLeafCapacity) {
+                auto leaf = (Leaf *)freeNodes;
+                freeNodes = *(void **)freeNodes;
+                leaf->count = count - begin < kLeafCapacity ? count - begin : kLeafCapacity;
+                leaf->previous = previousLeaf;
+                leaf->next = nullptr;
+                moveArray(leaf->keys, keys.get(begin), leaf->count);
+                moveArray(leaf->values, values.get(begin), leaf->count);
+                if (previousLeaf != nullptr) {
+                    previousLeaf->next = leaf;
+                }
+                previousLeaf = leaf;
+
+                void *child = leaf;
+                for (auto level = INT64_C(1); level != levelCount; level++) {
+                    auto branch = lastBranches[level];
+                    if (branch != nullptr && branch->count != kBranchCapacity) {
+                        branch->keys[branch->count] = *findGreatestKey(branch->children[branch->count], level - 1);
+                        branch->children[branch->count + 1] = child;
+                        branch->count++;
+                        break;
+                    }
+                    branch = (Branch *)freeNodes;
+                    freeNodes = *(void **)freeNodes;
+                    branch->count = 0;
+                    branch->children[0] = child;
+                    lastBranches[level] = branch;
+                    child = branch;
+                }
+            }
+            assert(freeNodes == nullptr);
+
+            mRoot = levelCount == 1 ? (void *)previousLeaf : (void *)lastBranches[levelCount - 1];
+            mHeight = levelCount - 1;
+            mCount = count;
+            return Status::eSuccess;
+        }
+
+    private:
+        /**
+         * The amount of entries that fit in a leaf after its count and links.
+         */
+        static constexpr auto kLeafCapacity = (kNodeSize - 3 * (int64_t)sizeof(void *)) / (int64_t)(sizeof(Key) + sizeof(Value));
+
+        /**
+         * The amount of keys that fit in a branch after its count, along with
+         * one more child than keys.
+         */
+        static constexpr auto kBranchCapacity = (kNodeSize - 2 * (int64_t)sizeof(void *)) / (int64_t)(sizeof(Key) + sizeof(void *));
+
+        static_assert(kLeafCapacity >= 2);
+        static_assert(kBranchCapacity >= 2);
+
+        /**
+         * Node at the bottom of the tree, which holds the entries.
+         */
+        struct Leaf {
+            /**
+             * The amount of entries.
+             */
+            int64_t count;
+
+            /**
+             * Pointer to the leaf with the lesser keys.
+             *
+             * @warning `nullptr` if this is the first leaf.
+             */
+            Leaf *previous;
+
+            /**
+             * Pointer to the leaf with the greater keys.
+             *
+             * @warning `nullptr` if this is the last leaf.
+             */
+            Leaf *next;
+
+            /**
+             * The keys, in ascending order.
+             */
+            Key keys[kLeafCapacity];
+
+            /**
+             * The values of each key.
+             */
+            Value values[kLeafCapacity];
+        };
+
+        /**
+         * Node above the leaves, which directs lookups to its children.
+         */
+        struct Branch {
+            /**
+             * The amount of keys, which is one less than the amount of
+             * children.
+             */
+            int64_t count;
+
+            /**
+             * The separators of the children, where every key in child `i` is
+             * not greater than key `i`, and greater than key `i - 1`.
+             */
+            Key keys[kBranchCapacity];
+
+            /**
+             * Pointers to the children, which are branches or leaves by their
+             * level.
+             */
+            void *children[kBranchCapacity + 1];
+        };
+
+        static_assert(sizeof(Leaf) <= kNodeSize);
+        static_assert(sizeof(Branch) <= kNodeSize);
+
+        /**
+         * The most branches between the root and a leaf. A branch is only
+         * created by splitting a full one, which leaves both halves with at
+         * least one key; so, every level at least doubles the amount of
+         * leaves.
+         */
+        static constexpr auto kMaxHeight = INT64_C(64);
+
+        /**
+         * Whether the keys are compared by @ref KeySearch.
+         */
+        static constexpr auto kIsSearchable = __is_same(Comparator, OrderComparable<Key>) && KeySearch::kIsSupported<Key>;
+
+        /**
+         * Pointer to the root node, which is a leaf if the height is zero.
+         *
+         * @warning `nullptr` if there are no entries.
+         */
+        void *mRoot;
+
+        /**
+         * The amount of branches between the root and a leaf, which includes
+         * the root.
+         */
+        int64_t mHeight;
+
+        /**
+         * The amount of entries.
+         */
+        int64_t mCount;
+
+        /**
+         * Copies elements between arrays that might overlap, which might be
+         * none at all.
+         */
+        template<typename Element>
+        static auto moveArray(Element *destinationArray, Element *sourceArray, int64_t count) -> void {
+            if (count != 0) {
+                Bytes::copyAliasingArray(destinationArray, sourceArray, count);
+            }
+        }
+
+        static auto isEqual(Key *key0, Key *key1) -> bool {
+            return Comparator::compare(key0, key1) == Ordering::eEqual;
+        }
+
+        /**
+         * Counts the keys of a node that are less than a key, which is the
+         * index of the child or the entry the key belongs to.
+         */
+        static auto countLess(Key *keys, int64_t count, Key *key) -> int64_t {
+            if constexpr (kIsSearchable) {
+                return KeySearch::countLess(keys, count, *key);
+            } else {
+                auto low = INT64_C(0);
+                auto high = count;
+                while (low < high) {
+                    auto middle = low + (high - low) / 2;
+                    if (Comparator::compare(keys + middle, key) == Ordering::eLess) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                return low;
+            }
+        }
+
+        /**
+         * Creates a cursor that is moved past the end of its leaf if needed.
+         */
+        static auto createCursor(Leaf *leaf, int64_t index) -> Cursor {
+            if (leaf != nullptr && index == leaf->count) {
+                leaf = leaf->next;
+                index = 0;
+            }
+            Cursor cursor;
+            cursor.initialize(leaf, index);
+            return cursor;
+        }
+
+        static auto findGreatestKey(void *node, int64_t level) -> Key * {
+            for (; level != 0; level--) {
+                auto branch = (Branch *)node;
+                node = branch->children[branch->count];
+            }
+            auto leaf = (Leaf *)node;
+            return leaf->keys + leaf->count - 1;
+        }
+
+        static auto destroyNode(MemoryAllocator memoryAllocator, void *node, int64_t level) -> void {
+            if (level == 0) {
+                memoryAllocator.deallocate(node, kNodeSize, kNodeAlignment);
+                return;
+            }
+            auto branch = (Branch *)node;
+            for (auto i = branch->count; i >= 0; i--) {
+                destroyNode(memoryAllocator, branch->children[i], level - 1);
+            }
+            memoryAllocator.deallocate(branch, kNodeSize, kNodeAlignment);
+        }
+
+        static auto insertIntoLeaf(Leaf *leaf, int64_t index, Key *key, Value *value) -> void {
+            moveArray(leaf->keys + index + 1, leaf->keys + index, leaf->count - index);
+            moveArray(leaf->values + index + 1, leaf->values + index, leaf->count - index);
+            leaf->keys[index] = *key;
+            leaf->values[index] = *value;
+            leaf->count++;
+        }
+
+        static auto insertIntoBranch(Branch *branch, int64_t childIndex, Key *separator, void *child) -> void {
+            moveArray(branch->keys + childIndex + 1, branch->keys + childIndex, branch->count - childIndex);
+            moveArray(branch->children + childIndex + 2, branch->children + childIndex + 1, branch->count - childIndex);
+            branch->keys[childIndex] = *separator;
+            branch->children[childIndex + 1] = child;
+            branch->count++;
+        }
+
+        /**
+         * Adds an entry to a full leaf by moving the greater half of its
+         * entries to a new leaf after it.
+         */
+        static auto splitLeaf(Leaf *leaf, Leaf *newLeaf, int64_t index, Key *key, Value *value) -> void {
+            auto leftCount = (kLeafCapacity + 1) / 2;
+            auto rightCount = kLeafCapacity + 1 - leftCount;
+            if (index < leftCount) {
+                moveArray(newLeaf->keys, leaf->keys + leftCount - 1, rightCount);
+                moveArray(newLeaf->values, leaf->values + leftCount - 1, rightCount);
+                leaf->count = leftCount - 1;
+                insertIntoLeaf(leaf, index, key, value);
+                newLeaf->count = rightCount;
+            } else {
+                moveArray(newLeaf->keys, leaf->keys + leftCount, rightCount - 1);
+                moveArray(newLeaf->values, leaf->values + leftCount, rightCount - 1);
+                leaf->count = leftCount;
+                newLeaf->count = rightCount - 1;
+                insertIntoLeaf(newLeaf, index - leftCount, key, value);
+            }
+
+            newLeaf->previous = leaf;
+            newLeaf->next = leaf->next;
+            if (leaf->next != nullptr) {
+                leaf->next->previous = newLeaf;
+            }
+            leaf->next = newLeaf;
+        }
+
+        /**
+         * Adds a child to a full branch by moving the greater half of its
+         * children to a new branch after it.
+         *
+         * The middle separator moves up; so, on return, the separator and the
+         * child are the ones to add to the parent.
+         */
+        static auto splitBranch(Branch *branch, Branch *newBranch, int64_t childIndex, Key *separator, void **child) -> void {
+            Key keys[kBranchCapacity + 1];
+            void *children[kBranchCapacity + 2];
+            moveArray(keys, branch->keys, childIndex);
+            keys[childIndex] = *separator;
+            moveArray(keys + childIndex + 1, branch->keys + childIndex, kBranchCapacity - childIndex);
+            moveArray(children, branch->children, childIndex + 1);
+            children[childIndex + 1] = *child;
+            moveArray(children + childIndex + 2, branch->children + childIndex + 1, kBranchCapacity - childIndex);
+
+            auto leftCount = (kBranchCapacity + 1) / 2;
+            branch->count = leftCount;
+            moveArray(branch->keys, keys, leftCount);
+            moveArray(branch->children, children, leftCount + 1);
+            newBranch->count = kBranchCapacity - leftCount;
+            moveArray(newBranch->keys, keys + leftCount + 1, newBranch->count);
+            moveArray(newBranch->children, children + leftCount + 1, newBranch->count + 1);
+            *separator = keys[leftCount];
+            *child = newBranch;
+        }
+
+        auto findLeaf(Key *key) -> Leaf * {
+            auto node = mRoot;
+            for (auto level = mHeight; level != 0; level--) {
+                auto branch = (Branch *)node;
+                node = branch->children[countLess(branch->keys, branch->count, key)];
+            }
+            return (Leaf *)node;
+        }
+
+        /**
+         * Finds the leaf a key belongs to, along with the branches above it,
+         * from the parent of the leaf up to the root.
+         */
+        auto findPath(Key *key, Branch **path, int64_t *childIndices) -> Leaf * {
+            auto node = mRoot;
+            for (auto level = mHeight - 1; level >= 0; level--) {
+                auto branch = (Branch *)node;
+                auto childIndex = countLess(branch->keys, branch->count, key);
+                path[level] = branch;
+                childIndices[level] = childIndex;
+                node = branch->children[childIndex];
+            }
+            return (Leaf *)node;
+        }
+
+        /**
+         * Replaces a root that has a single child with that child.
+         */
+        auto shrinkRoot(MemoryAllocator memoryAllocator) -> void {
+            while (mHeight != 0 && ((Branch *)mRoot)->count == 0) {
+                auto root = (Branch *)mRoot;
+                mRoot = root->children[0];
+                mHeight--;
+                memoryAllocator.deallocate(root, kNodeSize, kNodeAlignment);
+            }
+        }
+    };
+}
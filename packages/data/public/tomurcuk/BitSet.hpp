@@ -0,0 +1,150 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Set of integers in a fixed range that keeps one bit per integer.
+     *
+     * Membership tests and updates are a single word access, and the bulk
+     * operations run over whole words; so, they touch 64 integers per word and
+     * use vector instructions when the processor has them.
+     *
+     * The bits after the last one in the last word are always `0`; so, the
+     * bulk operations do not need to mask them.
+     */
+    class BitSet {
+    public:
+        /**
+         * Creates a new set that has no bits.
+         */
+        auto initialize() -> void;
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Changes the amount of bits.
+         *
+         * Added bits are `0`, and removed bits are forgotten.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] bitCount The new amount of bits.
+         * @return Whether the request succeeded.
+         */
+        auto resize(MemoryAllocator memoryAllocator, int64_t bitCount) -> Status;
+
+        /**
+         * Provides the amount of bits.
+         *
+         * @return The amount of integers the set can hold.
+         */
+        auto getBitCount() -> int64_t;
+
+        /**
+         * Provides the amount of words.
+         *
+         * @return The amount of words that hold the bits.
+         */
+        auto getWordCount() -> int64_t;
+
+        /**
+         * Provides the words, where bit `i` is bit `i % 64` of word `i / 64`.
+         *
+         * @return The pointer to the words if there are any. Otherwise,
+         * `nullptr`.
+         */
+        auto getWords() -> uint64_t *;
+
+        /**
+         * Tests whether an integer is in the set.
+         *
+         * @param[in] index The tested integer.
+         * @return Whether the bit of the integer is set.
+         */
+        auto test(int64_t index) -> bool;
+
+        /**
+         * Adds an integer to the set.
+         *
+         * @param[in] index The added integer.
+         */
+        auto set(int64_t index) -> void;
+
+        /**
+         * Removes an integer from the set.
+         *
+         * @param[in] index The removed integer.
+         */
+        auto reset(int64_t index) -> void;
+
+        /**
+         * Removes all the integers from the set.
+         */
+        auto resetAll() -> void;
+
+        /**
+         * Keeps only the integers that are also in another set.
+         *
+         * @param[in] other The set that has the same amount of bits.
+         */
+        auto intersectWith(BitSet *other) -> void;
+
+        /**
+         * Adds the integers of another set.
+         *
+         * @param[in] other The set that has the same amount of bits.
+         */
+        auto uniteWith(BitSet *other) -> void;
+
+        /**
+         * Removes the integers of another set.
+         *
+         * @param[in] other The set that has the same amount of bits.
+         */
+        auto subtract(BitSet *other) -> void;
+
+        /**
+         * Counts the integers in the set.
+         *
+         * @return The amount of set bits.
+         */
+        auto countSetBits() -> int64_t;
+
+        /**
+         * Finds the least integer in the set that is not less than a given
+         * one.
+         *
+         * @param[in] index The integer the search starts from, which might be
+         * the amount of bits.
+         * @return The found integer if there is one. Otherwise, `-1`.
+         */
+        auto findNextSetBit(int64_t index) -> int64_t;
+
+    private:
+        /**
+         * Pointer to the words.
+         *
+         * @warning `nullptr` if there are no words.
+         */
+        uint64_t *mWords;
+
+        /**
+         * The amount of words.
+         */
+        int64_t mWordCount;
+
+        /**
+         * The amount of bits.
+         */
+        int64_t mBitCount;
+    };
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Codec that stores 32-bit integers in blocks of @ref kBlockCount, each
+     * in as few bits as its largest integer needs.
+     *
+     * This is the SIMD-BP128 layout: a block is a word that holds the amount
+     * of bits `b`, followed by `4 * b` words, where the integers are packed
+     * vertically in 4 lanes, so that integer `i` goes to lane `i % 4`. A
+     * whole block is packed and unpacked with 128-bit shifts, masks and
+     * bitwise-ors, and the code for every amount of bits is generated from a
+     * template, so that all of its shifts are constants. The last block is
+     * padded with `0`s. Sorted IDs are usually encoded by @ref DeltaCodec
+     * first.
+     *
+     * The kernels use SSE2, which every x86-64 processor has; on the other
+     * processors, the lanes are packed one after the other, into the same
+     * layout.
+     */
+    class BlockPackingCodec {
+    public:
+        /**
+         * The amount of integers in a block.
+         */
+        static constexpr auto kBlockCount = INT64_C(128);
+
+        /**
+         * Appends the encoding of 32-bit integers.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the words.
+         * @param[in,out] words The list the encoded words are appended to.
+         * @param[in] values The encoded integers.
+         * @return Whether the operation succeeded. On failure, the words are
+         * not changed.
+         */
+        static auto encode(MemoryAllocator memoryAllocator, ArrayList<uint32_t> *words, ArrayListView<uint32_t> values) -> Status;
+
+        /**
+         * Decodes 32-bit integers from the beginning of some words.
+         *
+         * @param[in] words The encoded words, which might go on after the
+         * blocks of the integers.
+         * @param[out] values The decoded integers, whose count is the amount
+         * of decoded integers.
+         * @return The amount of words the integers took if they were valid.
+         * Otherwise, `-1`, and some of the integers might have been written.
+         */
+        static auto decode(ArrayListView<uint32_t> words, ArrayListView<uint32_t> values) -> int64_t;
+
+    private:
+        /**
+         * The amount of lanes the integers are interleaved in.
+         */
+        static constexpr auto kLaneCount = INT64_C(4);
+
+        /**
+         * The amount of integers in a lane of a block.
+         */
+        static constexpr auto kLaneValueCount = kBlockCount / kLaneCount;
+
+        /**
+         * Packs a block into `4 * kBitWidth` words.
+         */
+        template<int64_t kBitWidth>
+        static auto packBlock(uint32_t *values, uint32_t *words) -> void;
+
+        /**
+         * Unpacks a block from `4 * kBitWidth` words.
+         */
+        template<int64_t kBitWidth>
+        static auto unpackBlock(uint32_t *words, uint32_t *values) -> void;
+
+        static auto packBlock(int64_t bitWidth, uint32_t *values, uint32_t *words) -> void;
+        static auto unpackBlock(int64_t bitWidth, uint32_t *words, uint32_t *values) -> void;
+    };
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+
+namespace tomurcuk {
+    /**
+     * Codec that replaces integers with their differences in place, which
+     * turns sorted IDs into small gaps that other codecs store in fewer bits.
+     *
+     * The first-order encoding keeps the first integer and replaces every
+     * other one with its difference from the previous one. The second-order
+     * encoding, which suits timestamps that arrive at a steady rate, also
+     * replaces every difference after the first one with its difference from
+     * the previous difference; since those can be negative, every integer
+     * after the first one is zigzag-encoded, so that small negative and
+     * positive differences both become small unsigned integers. Differences
+     * wrap around like unsigned arithmetic does; so, decoding restores any
+     * integers, sorted or not.
+     *
+     * Decoding is a prefix sum, which has a portable implementation and an
+     * AVX2 one; the fastest one the processor supports is selected on the
+     * first use.
+     */
+    class DeltaCodec {
+    public:
+        /**
+         * Replaces 32-bit integers with their first-order differences.
+         *
+         * @param[in,out] values The integers, which become the encodings.
+         */
+        static auto encode(ArrayListView<uint32_t> values) -> void;
+
+        /**
+         * Replaces 64-bit integers with their first-order differences.
+         *
+         * @param[in,out] values The integers, which become the encodings.
+         */
+        static auto encode(ArrayListView<uint64_t> values) -> void;
+
+        /**
+         * Restores 32-bit integers from their first-order differences.
+         *
+         * @param[in,out] values The encodings, which become the integers.
+         */
+        static auto decode(ArrayListView<uint32_t> values) -> void;
+
+        /**
+         * Restores 64-bit integers from their first-order differences.
+         *
+         * @param[in,out] values The encodings, which become the integers.
+         */
+        static auto decode(ArrayListView<uint64_t> values) -> void;
+
+        /**
+         * Replaces 32-bit integers with their second-order differences.
+         *
+         * @param[in,out] values The integers, which become the encodings.
+         */
+        static auto encodeSecondOrder(ArrayListView<uint32_t> values) -> void;
+
+        /**
+         * Replaces 64-bit integers with their second-order differences.
+         *
+         * @param[in,out] values The integers, which become the encodings.
+         */
+        static auto encodeSecondOrder(ArrayListView<uint64_t> values) -> void;
+
+        /**
+         * Restores 32-bit integers from their second-order differences.
+         *
+         * @param[in,out] values The encodings, which become the integers.
+         */
+        static auto decodeSecondOrder(ArrayListView<uint32_t> values) -> void;
+
+        /**
+         * Restores 64-bit integers from their second-order differences.
+         *
+         * @param[in,out] values The encodings, which become the integers.
+         */
+        static auto decodeSecondOrder(ArrayListView<uint64_t> values) -> void;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*sumPrefixes32)(uint32_t *values, int64_t count) -> void;
+            auto (*sumPrefixes64)(uint64_t *values, int64_t count) -> void;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto sumPrefixes32Portably(uint32_t *values, int64_t count) -> void;
+        static auto sumPrefixes64Portably(uint64_t *values, int64_t count) -> void;
+
+        static auto sumPrefixes32WithAvx2(uint32_t *values, int64_t count) -> void;
+        static auto sumPrefixes64WithAvx2(uint64_t *values, int64_t count) -> void;
+
+        template<typename Value>
+        static auto encodeAll(Value *values, int64_t count) -> void;
+
+        template<typename Value>
+        static auto encodeAllSecondOrder(Value *values, int64_t count) -> void;
+
+        template<typename Value>
+        static auto decodeZigzags(Value *values, int64_t count) -> void;
+    };
+}
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Index of elements that do not change after it is built, for finding
+     * elements by their order.
+     *
+     * @tparam Element The type of the elements.
+     * @tparam Comparator The implementation of @ref OrderComparable that
+     * orders the elements.
+     *
+     * The sorted elements are laid out like a binary search tree in breadth
+     * first order, where the children of slot `k` are at `2k` and `2k + 1`.
+     * The first levels that every search visits share a few cache lines, and
+     * the next step of a search only depends on the outcome of a comparison,
+     * which is added to the index instead of branched on. The descendants of
+     * a slot on any single level are next to each other; so, the ones that
+     * fill a cache line are prefetched while the levels above them are
+     * compared.
+     */
+    template<typename Element, typename Comparator = OrderComparable<Element>>
+    class EytzingerIndex {
+    public:
+        /**
+         * The alignment of the backing memory, which is a cache line.
+         */
+        static constexpr auto kBlockAlignment = alignof(Element) > 64 ? (int64_t)alignof(Element) : INT64_C(64);
+
+        /**
+         * Creates a new index that is empty.
+         */
+        auto initialize() -> void {
+            mBlock = nullptr;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            if (mBlock != nullptr) {
+                memoryAllocator.deallocate(mBlock, getBlockSize(mCount), kBlockAlignment);
+            }
+        }
+
+        /**
+         * Provides the amount of elements.
+         *
+         * @return The amount of elements in the index.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the index.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Copies the elements of an empty index from a sorted view.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The elements, in ascending order.
+         * @return Whether the operation succeeded. On failure, the index is
+         * still empty.
+         */
+        auto build(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            assert(mBlock == nullptr);
+
+            if (view.isEmpty()) {
+                return Status::eSuccess;
+            }
+            for (auto i = INT64_C(1); i < view.getCount(); i++) {
+                assert(Comparator::compare(view.get(i), view.get(i - 1)) != Ordering::eLess);
+            }
+
+            auto blockResult = memoryAllocator.allocate(getBlockSize(view.getCount()), kBlockAlignment);
+            if (blockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mBlock = (Element *)*blockResult.value();
+            mCount = view.getCount();
+            auto sortedIndex = INT64_C(0);
+            fill(view.getArray(), &sortedIndex, 1);
+            return Status::eSuccess;
+        }
+
+        /**
+         * Finds the least element that is not less than an element.
+         *
+         * @param[in] element The searched element.
+         * @return The pointer to the found element if there is one. Otherwise,
+         * `nullptr`.
+         */
+        auto findLowerBound(Element element) -> Element * {
+            auto array = (Element *)__builtin_assume_aligned(mBlock, kBlockAlignment);
+            auto index = INT64_C(1);
+            while (index <= mCount) {
+                // The address is only a hint; so, it can be past the end.
+                __builtin_prefetch((void *)((uintptr_t)array + (uint64_t)(index * kPrefetchStride) * sizeof(Element)));
+                index = 2 * index + (Comparator::compare(array + index, &element) == Ordering::eLess ? 1 : 0);
+            }
+
+            // Every step to the right after the last one to the left is undone
+            // along with that one, which leaves the last slot that was not
+            // less.
+            index >>= __builtin_ffsll(~index);
+            return index == 0 ? nullptr : array + index;
+        }
+
+        /**
+         * Finds an element that is equal to an element.
+         *
+         * @param[in] element The searched element.
+         * @return The pointer to the found element if there is one. Otherwise,
+         * `nullptr`.
+         */
+        auto find(Element element) -> Element * {
+            auto found = findLowerBound(element);
+            if (found == nullptr || Comparator::compare(found, &element) != Ordering::eEqual) {
+                return nullptr;
+            }
+            return found;
+        }
+
+    private:
+        /**
+         * The distance to the slot whose descendants are prefetched, which is
+         * the amount of elements in a cache line.
+         */
+        static constexpr auto kPrefetchStride = sizeof(Element) < 64 ? 64 / (int64_t)sizeof(Element) : INT64_C(1);
+
+        /**
+         * Pointer to the backing memory, whose first slot is not used.
+         *
+         * @warning `nullptr` if there are no elements.
+         */
+        Element *mBlock;
+
+        /**
+         * The amount of elements.
+         */
+        int64_t mCount;
+
+        static auto getBlockSize(int64_t count) -> int64_t {
+            assert(count < INT64_MAX / (int64_t)sizeof(Element));
+
+            return (count + 1) * (int64_t)sizeof(Element);
+        }
+
+        /**
+         * Fills the subtree of a slot by visiting it in order.
+         */
+        auto fill(Element *sortedArray, int64_t *sortedIndex, int64_t index) -> void {
+            if (index > mCount) {
+                return;
+            }
+            fill(sortedArray, sortedIndex, 2 * index);
+            mBlock[index] = sortedArray[*sortedIndex];
+            (*sortedIndex)++;
+            fill(sortedArray, sortedIndex, 2 * index + 1);
+        }
+    };
+}
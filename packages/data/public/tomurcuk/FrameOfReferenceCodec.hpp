@@ -0,0 +1,86 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Codec that stores a frame of unsigned integers as their differences
+     * from the least one, in as few bits as the largest difference needs.
+     *
+     * A frame is a word that holds the least integer, a word that holds the
+     * amount of bits of every difference, and the differences, which are
+     * packed back to back in 64-bit words. A frame of integers in a narrow
+     * range, like a block of sorted IDs, takes a few bits per integer, and
+     * it is decoded with the vectorized unpacking of @ref PackedIntArray. The
+     * amount of integers is not stored; it is known to the decoder, like it
+     * is for @ref VarintCodec.
+     */
+    class FrameOfReferenceCodec {
+    public:
+        /**
+         * Appends the encoding of a frame of 32-bit integers.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the words.
+         * @param[in,out] words The list the encoded words are appended to.
+         * @param[in] values The encoded integers.
+         * @return Whether the operation succeeded. On failure, the words are
+         * not changed.
+         */
+        static auto encode(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words, ArrayListView<uint32_t> values) -> Status;
+
+        /**
+         * Appends the encoding of a frame of 64-bit integers.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the words.
+         * @param[in,out] words The list the encoded words are appended to.
+         * @param[in] values The encoded integers.
+         * @return Whether the operation succeeded. On failure, the words are
+         * not changed.
+         */
+        static auto encode(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words, ArrayListView<uint64_t> values) -> Status;
+
+        /**
+         * Decodes a frame of 32-bit integers from the beginning of some words.
+         *
+         * @param[in] words The encoded words, which might go on after the
+         * frame.
+         * @param[out] values The decoded integers, whose count is the amount
+         * of integers in the frame.
+         * @return The amount of words the frame took if it was valid.
+         * Otherwise, `-1`.
+         */
+        static auto decode(ArrayListView<uint64_t> words, ArrayListView<uint32_t> values) -> int64_t;
+
+        /**
+         * Decodes a frame of 64-bit integers from the beginning of some words.
+         *
+         * @param[in] words The encoded words, which might go on after the
+         * frame.
+         * @param[out] values The decoded integers, whose count is the amount
+         * of integers in the frame.
+         * @return The amount of words the frame took if it was valid.
+         * Otherwise, `-1`.
+         */
+        static auto decode(ArrayListView<uint64_t> words, ArrayListView<uint64_t> values) -> int64_t;
+
+    private:
+        /**
+         * The amount of words before the differences.
+         */
+        static constexpr auto kHeaderWordCount = INT64_C(2);
+
+        static auto getPackedWordCount(int64_t bitWidth, int64_t count) -> int64_t;
+
+        template<typename Value>
+        static auto encodeAll(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words, Value *values, int64_t count) -> Status;
+
+        template<typename Value>
+        static auto decodeAll(uint64_t *words, int64_t wordCount, Value *values, int64_t count) -> int64_t;
+    };
+}
@@ -0,0 +1,453 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * List that holds a few elements in itself before it allocates memory.
+     *
+     * @tparam Element The type of the elements.
+     * @tparam kInlineCount The amount of elements that are held without
+     * allocating memory.
+     *
+     * Until the inline slots run out, adding elements does not call the
+     * allocator and accessing them does not load a pointer. After that, the
+     * list works like an @ref ArrayList.
+     *
+     * The backing array is found from the capacity on every access instead of
+     * being stored; so, the list does not point into itself, and copying it
+     * bitwise moves it like any other type. As with @ref ArrayList, only one
+     * of the copies might be used afterwards.
+     *
+     * To append to the list:
+     *   1- Acquire required slots via @ref reserve.
+     *   2- Write to them via @ref getEnd and @ref getUninitializedCount.
+     *   3- Mark the newly written elements as initialized via @ref acknowledge.
+     */
+    template<typename Element, int64_t kInlineCount>
+    class InlineArrayList {
+        static_assert(kInlineCount > 0);
+
+    public:
+        /**
+         * Creates a new list that is empty.
+         */
+        auto initialize() -> void {
+            mCapacity = kInlineCount;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory if there is one.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            if (!isInline()) {
+                memoryAllocator.deallocate(mArray, mCapacity * (int64_t)sizeof(Element), alignof(Element));
+            }
+        }
+
+        /**
+         * Provides a view of the list.
+         *
+         * @warning The list must not be modified or moved while the view is
+         * used.
+         *
+         * @return A view that refers to this list.
+         */
+        auto getView() -> ArrayListView<Element> {
+            ArrayListView<Element> view;
+            if (mCount == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(getArray(), mCount);
+            }
+            return view;
+        }
+
+        /**
+         * Tests whether the elements are held in the list itself.
+         *
+         * @return Whether no memory was allocated for the list.
+         */
+        auto isInline() -> bool {
+            return mCapacity == kInlineCount;
+        }
+
+        /**
+         * Provides the backing array.
+         *
+         * @warning The list must not be moved while the pointer is used.
+         *
+         * @return The pointer to the inline slots or to the allocated memory.
+         */
+        auto getArray() -> Element * {
+            if (isInline()) {
+                return mInlineArray;
+            }
+            return mArray;
+        }
+
+        /**
+         * Provides the uninitialized slot that will hold the next added
+         * element.
+         *
+         * @return The pointer to the slot after the last initialized element.
+         */
+        auto getEnd() -> Element * {
+            return getArray() + mCount;
+        }
+
+        /**
+         * Provides the amount of initialized elements.
+         *
+         * @return The amount of initialized elements in the list.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Provides the amount of initialized bytes.
+         *
+         * @return The total amount of bytes that constitute the initialized
+         * elements.
+         */
+        auto getSize() -> int64_t {
+            return mCount * (int64_t)sizeof(Element);
+        }
+
+        /**
+         * Provides the amount of slots, including the initialized ones.
+         *
+         * @return The amount of elements the list can hold without growing.
+         */
+        auto getAllocatedCount() -> int64_t {
+            return mCapacity;
+        }
+
+        /**
+         * Provides the amount of allocated bytes.
+         *
+         * @return The total amount of bytes that constitute the allocated
+         * elements, including the inline ones.
+         */
+        auto getAllocatedSize() -> int64_t {
+            return mCapacity * (int64_t)sizeof(Element);
+        }
+
+        /**
+         * Provides the amount of uninitialized elements.
+         *
+         * @return The amount of elements that can be added without growing.
+         */
+        auto getUninitializedCount() -> int64_t {
+            return mCapacity - mCount;
+        }
+
+        /**
+         * Provides the amount of uninitialized bytes.
+         *
+         * @return The total amount of bytes that constitute the uninitialized
+         * elements.
+         */
+        auto getUninitializedSize() -> int64_t {
+            return (mCapacity - mCount) * (int64_t)sizeof(Element);
+        }
+
+        /**
+         * Tests whether there are no initialized elements.
+         *
+         * @return Whether there are no initialized elements in the list.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides the pointer to the first element.
+         *
+         * @return The pointer to the first element.
+         */
+        auto getFirst() -> Element * {
+            return get(0);
+        }
+
+        /**
+         * Provides the pointer to the last element.
+         *
+         * @return The pointer to the last element.
+         */
+        auto getLast() -> Element * {
+            return get(mCount - 1);
+        }
+
+        /**
+         * Provides the pointer to the element at an index.
+         *
+         * @param[in] index The amount of elements before the accessed element.
+         * @return The pointer to the element at the given index.
+         */
+        auto get(int64_t index) -> Element * {
+            assert(index >= 0);
+            assert(index < mCount);
+
+            return getArray() + index;
+        }
+
+        /**
+         * Removes the first element.
+         *
+         * @warning This moves all the other elements. Use @ref ArrayDeque for
+         * lists that are consumed from the beginning.
+         *
+         * @return The element that was previously the first one.
+         */
+        auto removeFirst() -> Element {
+            return remove(0);
+        }
+
+        /**
+         * Removes the last element.
+         *
+         * @return The element that was previously the last one.
+         */
+        auto removeLast() -> Element {
+            auto element = *getLast();
+            mCount--;
+            return element;
+        }
+
+        /**
+         * Removes the element at an index.
+         *
+         * @param[in] index The amount of elements before the accessed element.
+         * @return The element that was previously at the given index.
+         */
+        auto remove(int64_t index) -> Element {
+            auto element = *get(index);
+            removePortion(index, index + 1);
+            return element;
+        }
+
+        /**
+         * Removes the element at an index without preserving the order of the
+         * elements.
+         *
+         * @param[in] index The amount of elements before the accessed element.
+         * @return The element that was previously at the given index.
+         */
+        auto removeUnordered(int64_t index) -> Element {
+            auto element = *get(index);
+            mCount--;
+            getArray()[index] = getArray()[mCount];
+            return element;
+        }
+
+        /**
+         * Removes a portion of the elements from the list.
+         *
+         * @param[in] beginIndex The amount of elements from the beginning that
+         * will not be removed.
+         * @param[in] endIndex The total amount of elements from the beginning
+         * that will be considered to be removed.
+         */
+        auto removePortion(int64_t beginIndex, int64_t endIndex) -> void {
+            assert(beginIndex >= 0);
+            assert(beginIndex <= endIndex);
+            assert(endIndex <= mCount);
+
+            if (endIndex != mCount) {
+                Bytes::copyAliasingArray(getArray() + beginIndex, getArray() + endIndex, mCount - endIndex);
+            }
+            mCount -= endIndex - beginIndex;
+        }
+
+        /**
+         * Removes all the elements from the list.
+         *
+         * @warning This keeps the allocated memory.
+         */
+        auto removeAll() -> void {
+            mCount = 0;
+        }
+
+        /**
+         * Appends another list to the end of this one.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The added elements.
+         * @return Whether the operation succeeded.
+         */
+        auto addAll(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            if (view.isEmpty()) {
+                return Status::eSuccess;
+            }
+            if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            Bytes::copyArray(getEnd(), view.getArray(), view.getCount());
+            acknowledge(view.getCount());
+            return Status::eSuccess;
+        }
+
+        /**
+         * Appends an element to the end of the list.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, Element element) -> Status {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            getEnd()[0] = element;
+            acknowledge(1);
+            return Status::eSuccess;
+        }
+
+        /**
+         * Appends another list to this one at an index.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] index The amount of elements before the first newly
+         * inserted element.
+         * @param[in] view The inserted elements.
+         * @return Whether the operation succeeded.
+         */
+        auto insertAll(MemoryAllocator memoryAllocator, int64_t index, ArrayListView<Element> view) -> Status {
+            assert(index >= 0);
+            assert(index <= mCount);
+
+            if (view.isEmpty()) {
+                return Status::eSuccess;
+            }
+            if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            if (index != mCount) {
+                Bytes::copyAliasingArray(getArray() + index + view.getCount(), getArray() + index, mCount - index);
+            }
+            Bytes::copyArray(getArray() + index, view.getArray(), view.getCount());
+            acknowledge(view.getCount());
+            return Status::eSuccess;
+        }
+
+        /**
+         * Appends an element to the list at an index.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] index The amount of elements before the newly inserted
+         * element.
+         * @param[in] element The inserted element.
+         * @return Whether the operation succeeded.
+         */
+        auto insert(MemoryAllocator memoryAllocator, int64_t index, Element element) -> Status {
+            assert(index >= 0);
+            assert(index <= mCount);
+
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            if (index != mCount) {
+                Bytes::copyAliasingArray(getArray() + index + 1, getArray() + index, mCount - index);
+            }
+            getArray()[index] = element;
+            acknowledge(1);
+            return Status::eSuccess;
+        }
+
+        /**
+         * Grows the amount of uninitialized elements in preparation for an
+         * append-operation.
+         *
+         * Moves the elements out of the list into allocated memory the first
+         * time the inline slots are not enough.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of uninitialized elements that
+         * must exists in the list.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+            auto newCapacity = Bytes::growCapacity(mCapacity, mCount, amount);
+            if (newCapacity == mCapacity) {
+                return Status::eSuccess;
+            }
+
+            assert(newCapacity <= INT64_MAX / (int64_t)sizeof(Element));
+
+            if (isInline()) {
+                auto newBlockResult = memoryAllocator.allocate(newCapacity * (int64_t)sizeof(Element), alignof(Element));
+                if (newBlockResult.isFailure()) {
+                    return Status::eFailure;
+                }
+                auto newArray = (Element *)*newBlockResult.value();
+                if (mCount != 0) {
+                    Bytes::copyArray(newArray, mInlineArray, mCount);
+                }
+                mArray = newArray;
+                mCapacity = newCapacity;
+                return Status::eSuccess;
+            }
+
+            auto newBlockResult = memoryAllocator.reallocate(mArray, mCapacity * (int64_t)sizeof(Element), newCapacity * (int64_t)sizeof(Element), alignof(Element));
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mArray = (Element *)*newBlockResult.value();
+            mCapacity = newCapacity;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Marks some amount of leading uninitialized elements as initialized.
+         *
+         * @param[in] amount The amount of uninitialized elements that will be
+         * marked as initialized.
+         */
+        auto acknowledge(int64_t amount) -> void {
+            assert(amount >= 0);
+            assert(amount <= mCapacity - mCount);
+
+            mCount += amount;
+        }
+
+    private:
+        union {
+            /**
+             * The slots that hold the elements while the list is inline.
+             */
+            Element mInlineArray[kInlineCount];
+
+            /**
+             * Pointer to the allocated memory after the list is spilled.
+             */
+            Element *mArray;
+        };
+
+        /**
+         * The amount of slots, which is `kInlineCount` while the list is
+         * inline and always more than that afterwards.
+         */
+        int64_t mCapacity;
+
+        /**
+         * The amount of initialized elements.
+         */
+        int64_t mCount;
+    };
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that search short sorted arrays of integer keys, like the ones
+     * in the nodes of a tree.
+     *
+     * Every key is compared without branching on the outcome, which suits
+     * arrays that fit in a few cache lines better than a binary search does.
+     * Each operation has a portable implementation and an AVX2 one; the
+     * fastest one the processor supports is selected on the first use.
+     */
+    class KeySearch {
+    public:
+        /**
+         * Whether there are kernels for a type of keys, which compare them by
+         * their natural order.
+         *
+         * @tparam Key The type of the keys.
+         */
+        template<typename Key>
+        static constexpr auto kIsSupported = __is_same(Key, int32_t) || __is_same(Key, uint32_t) || __is_same(Key, int64_t) || __is_same(Key, uint64_t);
+
+        /**
+         * Counts the keys that are less than a key.
+         *
+         * @param[in] keys The pointer to the keys, which are in ascending
+         * order.
+         * @param[in] count The amount of keys.
+         * @param[in] key The key that is searched for.
+         * @return The index of the first key that is not less than the key,
+         * which is the amount of keys if there is none.
+         */
+        static auto countLess(int32_t *keys, int64_t count, int32_t key) -> int64_t;
+
+        /**
+         * Counts the keys that are less than a key.
+         *
+         * @param[in] keys The pointer to the keys, which are in ascending
+         * order.
+         * @param[in] count The amount of keys.
+         * @param[in] key The key that is searched for.
+         * @return The index of the first key that is not less than the key,
+         * which is the amount of keys if there is none.
+         */
+        static auto countLess(uint32_t *keys, int64_t count, uint32_t key) -> int64_t;
+
+        /**
+         * Counts the keys that are less than a key.
+         *
+         * @param[in] keys The pointer to the keys, which are in ascending
+         * order.
+         * @param[in] count The amount of keys.
+         * @param[in] key The key that is searched for.
+         * @return The index of the first key that is not less than the key,
+         * which is the amount of keys if there is none.
+         */
+        static auto countLess(int64_t *keys, int64_t count, int64_t key) -> int64_t;
+
+        /**
+         * Counts the keys that are less than a key.
+         *
+         * @param[in] keys The pointer to the keys, which are in ascending
+         * order.
+         * @param[in] count The amount of keys.
+         * @param[in] key The key that is searched for.
+         * @return The index of the first key that is not less than the key,
+         * which is the amount of keys if there is none.
+         */
+        static auto countLess(uint64_t *keys, int64_t count, uint64_t key) -> int64_t;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*countLessInt32)(int32_t *keys, int64_t count, int32_t key) -> int64_t;
+            auto (*countLessUint32)(uint32_t *keys, int64_t count, uint32_t key) -> int64_t;
+            auto (*countLessInt64)(int64_t *keys, int64_t count, int64_t key) -> int64_t;
+            auto (*countLessUint64)(uint64_t *keys, int64_t count, uint64_t key) -> int64_t;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto countLessInt32Portably(int32_t *keys, int64_t count, int32_t key) -> int64_t;
+        static auto countLessUint32Portably(uint32_t *keys, int64_t count, uint32_t key) -> int64_t;
+        static auto countLessInt64Portably(int64_t *keys, int64_t count, int64_t key) -> int64_t;
+        static auto countLessUint64Portably(uint64_t *keys, int64_t count, uint64_t key) -> int64_t;
+
+        static auto countLessInt32WithAvx2(int32_t *keys, int64_t count, int32_t key) -> int64_t;
+        static auto countLessUint32WithAvx2(uint32_t *keys, int64_t count, uint32_t key) -> int64_t;
+        static auto countLessInt64WithAvx2(int64_t *keys, int64_t count, int64_t key) -> int64_t;
+        static auto countLessUint64WithAvx2(uint64_t *keys, int64_t count, uint64_t key) -> int64_t;
+    };
+}
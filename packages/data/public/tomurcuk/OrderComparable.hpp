@@ -0,0 +1,243 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/Ordering.hpp>
+
+namespace tomurcuk {
+    /**
+     * Interface of types that can be ordered between themselves.
+     *
+     * Implementations are static, so algorithms that take the type as a
+     * template argument call them directly, which lets the comparison get
+     * inlined into their loops.
+     *
+     * @tparam Instance The type that implements this interface.
+     */
+    template<typename Instance>
+    class OrderComparable {
+    public:
+        /**
+         * Orders a pair of instances.
+         *
+         * @param[in] instance0 The first compared instance.
+         * @param[in] instance1 The second compared instance.
+         * @return The ordering of the first instance relative to the second
+         * one.
+         */
+        static auto compare(Instance *instance0, Instance *instance1) -> Ordering = delete;
+    };
+
+    template<>
+    class OrderComparable<bool> {
+    public:
+        static auto compare(bool *instance0, bool *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<char> {
+    public:
+        static auto compare(char *instance0, char *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<int8_t> {
+    public:
+        static auto compare(int8_t *instance0, int8_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<int16_t> {
+    public:
+        static auto compare(int16_t *instance0, int16_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<int32_t> {
+    public:
+        static auto compare(int32_t *instance0, int32_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<int64_t> {
+    public:
+        static auto compare(int64_t *instance0, int64_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<uint8_t> {
+    public:
+        static auto compare(uint8_t *instance0, uint8_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<uint16_t> {
+    public:
+        static auto compare(uint16_t *instance0, uint16_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<uint32_t> {
+    public:
+        static auto compare(uint32_t *instance0, uint32_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    template<>
+    class OrderComparable<uint64_t> {
+    public:
+        static auto compare(uint64_t *instance0, uint64_t *instance1) -> Ordering {
+            if (*instance0 < *instance1) {
+                return Ordering::eLess;
+            }
+            if (*instance1 < *instance0) {
+                return Ordering::eGreater;
+            }
+            return Ordering::eEqual;
+        }
+    };
+
+    /**
+     * Orders by the total order of IEEE 754, where `-NaN < -inf < -0 < +0 <
+     * +inf < +NaN`; so, sorting arrays with `NaN`s or `0`s of both signs is
+     * well-defined.
+     */
+    template<>
+    class OrderComparable<float> {
+    public:
+        static auto compare(float *instance0, float *instance1) -> Ordering {
+            auto key0 = createKey(instance0);
+            auto key1 = createKey(instance1);
+            return OrderComparable<int32_t>::compare(&key0, &key1);
+        }
+
+    private:
+        static auto createKey(float *instance) -> int32_t {
+            int32_t bits;
+            Bytes::copyObject(&bits, (int32_t *)instance);
+
+            // Negative values have their magnitude bits flipped, so that they
+            // order in reverse as signed integers.
+            return bits ^ ((bits >> 31) & INT32_MAX);
+        }
+    };
+
+    /**
+     * Orders by the total order of IEEE 754, where `-NaN < -inf < -0 < +0 <
+     * +inf < +NaN`; so, sorting arrays with `NaN`s or `0`s of both signs is
+     * well-defined.
+     */
+    template<>
+    class OrderComparable<double> {
+    public:
+        static auto compare(double *instance0, double *instance1) -> Ordering {
+            auto key0 = createKey(instance0);
+            auto key1 = createKey(instance1);
+            return OrderComparable<int64_t>::compare(&key0, &key1);
+        }
+
+    private:
+        static auto createKey(double *instance) -> int64_t {
+            int64_t bits;
+            Bytes::copyObject(&bits, (int64_t *)instance);
+
+            // Negative values have their magnitude bits flipped, so that they
+            // order in reverse as signed integers.
+            return bits ^ ((bits >> 63) & INT64_MAX);
+        }
+    };
+
+    /**
+     * Orders lexicographically by the unsigned values of the bytes.
+     */
+    template<>
+    class OrderComparable<ArrayListView<char>> {
+    public:
+        static auto compare(ArrayListView<char> *instance0, ArrayListView<char> *instance1) -> Ordering {
+            return Bytes::compareBlocks(instance0->getArray(), instance0->getSize(), instance1->getArray(), instance1->getSize());
+        }
+    };
+
+    /**
+     * Orders lexicographically by the unsigned values of the bytes.
+     */
+    template<>
+    class OrderComparable<ArrayListView<uint8_t>> {
+    public:
+        static auto compare(ArrayListView<uint8_t> *instance0, ArrayListView<uint8_t> *instance1) -> Ordering {
+            return Bytes::compareBlocks(instance0->getArray(), instance0->getSize(), instance1->getArray(), instance1->getSize());
+        }
+    };
+}
@@ -0,0 +1,207 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Dynamically-sized array of unsigned integers that keeps each one in the
+     * same amount of bits, which is chosen at run-time.
+     *
+     * The integers are packed back to back in 64-bit words without padding;
+     * so, an array of 20-bit IDs takes less than a third of the memory of an
+     * array of `int64_t`. Single integers are read and written with a couple
+     * of word accesses, and consecutive ones are unpacked into plain arrays
+     * with vector instructions when the processor has them.
+     *
+     * The capacity grows like the one of @ref ArrayList does.
+     */
+    class PackedIntArray {
+    public:
+        /**
+         * Creates a new array that is empty.
+         *
+         * @param[in] bitWidth The amount of bits of every integer, from `1` to
+         * `64`.
+         */
+        auto initialize(int64_t bitWidth) -> void;
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Provides the amount of bits of every integer.
+         *
+         * @return The bit width the array was created with.
+         */
+        auto getBitWidth() -> int64_t;
+
+        /**
+         * Provides the amount of integers.
+         *
+         * @return The amount of integers in the array.
+         */
+        auto getCount() -> int64_t;
+
+        /**
+         * Provides the amount of allocated integers.
+         *
+         * @return The amount of integers the array can hold without growing.
+         */
+        auto getAllocatedCount() -> int64_t;
+
+        /**
+         * Tests whether there are no integers.
+         *
+         * @return Whether there are no integers in the array.
+         */
+        auto isEmpty() -> bool;
+
+        /**
+         * Reads an integer.
+         *
+         * @param[in] index The amount of integers before the read one.
+         * @return The integer at the index.
+         */
+        auto get(int64_t index) -> uint64_t;
+
+        /**
+         * Writes an integer.
+         *
+         * @param[in] index The amount of integers before the written one.
+         * @param[in] value The integer, which fits in the bit width.
+         */
+        auto set(int64_t index, uint64_t value) -> void;
+
+        /**
+         * Appends an integer.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] value The integer, which fits in the bit width.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, uint64_t value) -> Status;
+
+        /**
+         * Appends integers from 32-bit ones.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The integers, which fit in the bit width.
+         * @return Whether the operation succeeded.
+         */
+        auto addAll(MemoryAllocator memoryAllocator, ArrayListView<uint32_t> view) -> Status;
+
+        /**
+         * Appends integers from 64-bit ones.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The integers, which fit in the bit width.
+         * @return Whether the operation succeeded.
+         */
+        auto addAll(MemoryAllocator memoryAllocator, ArrayListView<uint64_t> view) -> Status;
+
+        /**
+         * Reads consecutive integers into 32-bit ones.
+         *
+         * @param[in] index The amount of integers before the first read one.
+         * @param[out] view The read integers, whose count is the amount of
+         * read integers. The bit width must be at most 32.
+         */
+        auto unpack(int64_t index, ArrayListView<uint32_t> view) -> void;
+
+        /**
+         * Reads consecutive integers into 64-bit ones.
+         *
+         * @param[in] index The amount of integers before the first read one.
+         * @param[out] view The read integers, whose count is the amount of
+         * read integers.
+         */
+        auto unpack(int64_t index, ArrayListView<uint64_t> view) -> void;
+
+        /**
+         * Writes consecutive integers from 32-bit ones.
+         *
+         * @param[in] index The amount of integers before the first written
+         * one.
+         * @param[in] view The written integers, which fit in the bit width.
+         */
+        auto pack(int64_t index, ArrayListView<uint32_t> view) -> void;
+
+        /**
+         * Writes consecutive integers from 64-bit ones.
+         *
+         * @param[in] index The amount of integers before the first written
+         * one.
+         * @param[in] view The written integers, which fit in the bit width.
+         */
+        auto pack(int64_t index, ArrayListView<uint64_t> view) -> void;
+
+        /**
+         * Changes the amount of integers.
+         *
+         * Added integers are `0`.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] count The new amount of integers.
+         * @return Whether the request succeeded.
+         */
+        auto resize(MemoryAllocator memoryAllocator, int64_t count) -> Status;
+
+        /**
+         * Removes all the integers from the array.
+         *
+         * @warning This keeps the allocated memory.
+         */
+        auto removeAll() -> void;
+
+        /**
+         * Grows the capacity in preparation for additions.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of integers that must be
+         * addable without growing.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status;
+
+    private:
+        /**
+         * Pointer to the words, which are followed by one more word, so that
+         * reads never need to check for the end. The bits after the last
+         * integer are always `0`.
+         *
+         * @warning `nullptr` if there are no allocated integers.
+         */
+        uint64_t *mWords;
+
+        /**
+         * The amount of allocated integers.
+         */
+        int64_t mCapacity;
+
+        /**
+         * The amount of integers.
+         */
+        int64_t mCount;
+
+        /**
+         * The amount of bits of every integer.
+         */
+        int64_t mBitWidth;
+
+        auto getWordCount(int64_t count) -> int64_t;
+        auto resetFrom(int64_t index) -> void;
+    };
+}
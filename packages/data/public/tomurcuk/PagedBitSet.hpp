@@ -0,0 +1,187 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Set of integers in a huge range that allocates its bits in pages on
+     * demand.
+     *
+     * Works like a @ref BitSet, except that the bits are split into pages of
+     * @ref kPageBitCount bits, and a page is only allocated when one of its
+     * bits is first set. Pages that were never allocated read as `0`s, and the
+     * bulk operations skip them; so, a mostly empty range costs a pointer per
+     * page.
+     */
+    class PagedBitSet {
+    public:
+        /**
+         * The amount of bytes in a page.
+         */
+        static constexpr auto kPageSize = INT64_C(4096);
+
+        /**
+         * The amount of words in a page.
+         */
+        static constexpr auto kPageWordCount = kPageSize / (int64_t)sizeof(uint64_t);
+
+        /**
+         * The amount of bits in a page.
+         */
+        static constexpr auto kPageBitCount = kPageWordCount * 64;
+
+        /**
+         * Creates a new set that has no bits.
+         */
+        auto initialize() -> void;
+
+        /**
+         * Deallocates the pages and the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Changes the amount of bits.
+         *
+         * Added bits are `0`, and removed bits are forgotten. Only the page
+         * table grows; so, this is cheap even for huge amounts of bits.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] bitCount The new amount of bits.
+         * @return Whether the request succeeded.
+         */
+        auto resize(MemoryAllocator memoryAllocator, int64_t bitCount) -> Status;
+
+        /**
+         * Provides the amount of bits.
+         *
+         * @return The amount of integers the set can hold.
+         */
+        auto getBitCount() -> int64_t;
+
+        /**
+         * Provides the amount of pages.
+         *
+         * @return The amount of pages that cover the bits, allocated or not.
+         */
+        auto getPageCount() -> int64_t;
+
+        /**
+         * Counts the allocated pages.
+         *
+         * @return The amount of pages that had a bit set at some point.
+         */
+        auto countAllocatedPages() -> int64_t;
+
+        /**
+         * Tests whether an integer is in the set.
+         *
+         * @param[in] index The tested integer.
+         * @return Whether the bit of the integer is set.
+         */
+        auto test(int64_t index) -> bool;
+
+        /**
+         * Adds an integer to the set.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the page of the integer.
+         * @param[in] index The added integer.
+         * @return Whether the operation succeeded.
+         */
+        auto set(MemoryAllocator memoryAllocator, int64_t index) -> Status;
+
+        /**
+         * Removes an integer from the set.
+         *
+         * @warning This keeps the page of the integer.
+         *
+         * @param[in] index The removed integer.
+         */
+        auto reset(int64_t index) -> void;
+
+        /**
+         * Removes all the integers from the set and deallocates the pages.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * pages.
+         */
+        auto resetAll(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Keeps only the integers that are also in another set.
+         *
+         * Deallocates the pages that the other set does not have.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * pages.
+         * @param[in] other The set that has the same amount of bits.
+         */
+        auto intersectWith(MemoryAllocator memoryAllocator, PagedBitSet *other) -> void;
+
+        /**
+         * Adds the integers of another set.
+         *
+         * Allocates the pages that only the other set has.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the pages.
+         * @param[in] other The set that has the same amount of bits.
+         * @return Whether the operation succeeded. On failure, some of the
+         * integers might have been added.
+         */
+        auto uniteWith(MemoryAllocator memoryAllocator, PagedBitSet *other) -> Status;
+
+        /**
+         * Removes the integers of another set.
+         *
+         * @param[in] other The set that has the same amount of bits.
+         */
+        auto subtract(PagedBitSet *other) -> void;
+
+        /**
+         * Counts the integers in the set.
+         *
+         * @return The amount of set bits.
+         */
+        auto countSetBits() -> int64_t;
+
+        /**
+         * Finds the least integer in the set that is not less than a given
+         * one.
+         *
+         * @param[in] index The integer the search starts from, which might be
+         * the amount of bits.
+         * @return The found integer if there is one. Otherwise, `-1`.
+         */
+        auto findNextSetBit(int64_t index) -> int64_t;
+
+    private:
+        /**
+         * Pointer to the page table, which has a pointer to each page.
+         *
+         * @warning `nullptr` if there are no pages. The pages that were not
+         * allocated are `nullptr`.
+         */
+        uint64_t **mPages;
+
+        /**
+         * The amount of pages.
+         */
+        int64_t mPageCount;
+
+        /**
+         * The amount of bits.
+         */
+        int64_t mBitCount;
+
+        auto allocatePage(MemoryAllocator memoryAllocator, int64_t pageIndex) -> Status;
+        auto deallocatePage(MemoryAllocator memoryAllocator, int64_t pageIndex) -> void;
+    };
+}
@@ -0,0 +1,352 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <threads.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/Sorts.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Utilities for sorting the elements of arrays on multiple threads.
+     */
+    class ParallelSorts {
+    public:
+        /**
+         * The most threads a sort runs on.
+         */
+        static constexpr auto kMaxThreadCount = INT64_C(256);
+
+        /**
+         * Sorts elements with a merge sort that runs on multiple threads.
+         *
+         * The elements are split into one run per thread, and every run is
+         * sorted with @ref Sorts::sort. Then, every thread finds the part of
+         * the output it owns by the ranks of the elements in all the runs,
+         * merges that part into its own scratch memory, and copies it back
+         * after all the threads are done reading the runs.
+         *
+         * Every step is independent of the scheduling of the threads; so, the
+         * output is the same on every call with the same input and thread
+         * count. Elements that are equal but distinguishable might end up in a
+         * different order with a different thread count.
+         *
+         * If a thread cannot be started, its share of the work is done on the
+         * calling thread instead.
+         *
+         * @tparam Element The type of the elements.
+         * @tparam Comparator The implementation of @ref OrderComparable that
+         * orders the elements.
+         * @param[in,out] view The sorted elements.
+         * @param[in] threadCount The amount of threads that share the work,
+         * which is lowered for small inputs and clamped to
+         * @ref kMaxThreadCount.
+         * @return Whether the scratch memory could be allocated. On failure,
+         * the elements are sorted in runs but not merged.
+         */
+        template<typename Element, typename Comparator = OrderComparable<Element>>
+        static auto sort(ArrayListView<Element> view, int64_t threadCount) -> Status {
+            assert(threadCount > 0);
+
+            if (threadCount > kMaxThreadCount) {
+                threadCount = kMaxThreadCount;
+            }
+            if (threadCount > view.getCount() / kMinimumRunCount) {
+                threadCount = view.getCount() / kMinimumRunCount;
+            }
+            if (threadCount <= 1) {
+                Sorts::sort<Element, Comparator>(view);
+                return Status::eSuccess;
+            }
+
+            int64_t runBegins[kMaxThreadCount + 1];
+            for (auto i = INT64_C(0); i <= threadCount; i++) {
+                runBegins[i] = view.getCount() * i / threadCount;
+            }
+
+            Job<Element> jobs[kMaxThreadCount];
+            for (auto i = INT64_C(0); i != threadCount; i++) {
+                auto job = jobs + i;
+                job->array = view.getArray();
+                job->runBegins = runBegins;
+                job->runCount = threadCount;
+                job->index = i;
+                job->status = Status::eSuccess;
+            }
+
+            runJobs(jobs, threadCount, &sortRun<Element, Comparator>);
+            runJobs(jobs, threadCount, &mergeRuns<Element, Comparator>);
+
+            auto status = Status::eSuccess;
+            for (auto i = INT64_C(0); i != threadCount; i++) {
+                if (jobs[i].status == Status::eFailure) {
+                    status = Status::eFailure;
+                }
+            }
+            if (status == Status::eSuccess) {
+                runJobs(jobs, threadCount, &copyBack<Element>);
+            }
+            for (auto i = threadCount - 1; i >= 0; i--) {
+                if (jobs[i].status == Status::eSuccess) {
+                    jobs[i].linearMemoryAllocator.destroy();
+                }
+            }
+            return status;
+        }
+
+    private:
+        /**
+         * The state of a single thread of a sort.
+         */
+        template<typename Element>
+        struct Job {
+            /**
+             * Pointer to all the sorted elements.
+             */
+            Element *array;
+
+            /**
+             * Pointer to the indices where each run begins, followed by the
+             * amount of elements.
+             */
+            int64_t *runBegins;
+
+            /**
+             * The amount of runs, which is also the amount of jobs.
+             */
+            int64_t runCount;
+
+            /**
+             * The index of the job, and of the run it sorts.
+             */
+            int64_t index;
+
+            /**
+             * The allocator of the scratch memory of the job.
+             *
+             * @warning Only valid after a successful merge.
+             */
+            LinearMemoryAllocator linearMemoryAllocator;
+
+            /**
+             * Pointer to the merged part of the output in the scratch memory.
+             */
+            Element *output;
+
+            /**
+             * The index of the first element of the merged part of the output.
+             */
+            int64_t outputBegin;
+
+            /**
+             * The amount of elements in the merged part of the output.
+             */
+            int64_t outputCount;
+
+            /**
+             * Whether the scratch memory could be allocated.
+             */
+            Status status;
+
+            /**
+             * The thread that runs the job.
+             */
+            thrd_t thread;
+
+            /**
+             * Whether the thread was started, which decides whether it is
+             * joined.
+             */
+            bool isThreaded;
+        };
+
+        /**
+         * The least amount of elements each thread sorts, below which spawning
+         * threads costs more than it saves.
+         */
+        static constexpr auto kMinimumRunCount = INT64_C(4096);
+
+        template<typename Element>
+        static auto runJobs(Job<Element> *jobs, int64_t jobCount, auto (*run)(void *job)->int) -> void {
+            // The calling thread runs the first job itself.
+            for (auto i = INT64_C(1); i != jobCount; i++) {
+                jobs[i].isThreaded = thrd_create(&jobs[i].thread, run, jobs + i) == thrd_success;
+            }
+            (void)run(jobs);
+            for (auto i = INT64_C(1); i != jobCount; i++) {
+                if (jobs[i].isThreaded) {
+                    (void)thrd_join(jobs[i].thread, nullptr);
+                } else {
+                    (void)run(jobs + i);
+                }
+            }
+        }
+
+        template<typename Element, typename Comparator>
+        static auto sortRun(void *job) -> int {
+            auto state = (Job<Element> *)job;
+            auto begin = state->runBegins[state->index];
+            ArrayListView<Element> view;
+            view.initialize(state->array + begin, state->runBegins[state->index + 1] - begin);
+            Sorts::sort<Element, Comparator>(view);
+            return 0;
+        }
+
+        template<typename Element, typename Comparator>
+        static auto mergeRuns(void *job) -> int {
+            auto state = (Job<Element> *)job;
+            auto runCount = state->runCount;
+            auto count = state->runBegins[runCount];
+            auto outputBegin = count * state->index / runCount;
+            auto outputEnd = count * (state->index + 1) / runCount;
+            auto outputCount = outputEnd - outputBegin;
+
+            // The output part, the bounds of the merged part of every run, and
+            // the heap of the runs.
+            auto scratchSize = outputCount * (int64_t)sizeof(Element) + runCount * (int64_t)(3 * sizeof(int64_t)) + 4 * alignof(Element);
+            auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(scratchSize);
+            if (linearMemoryAllocatorResult.isFailure()) {
+                state->status = Status::eFailure;
+                return 0;
+            }
+            state->linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+            auto memoryAllocator = state->linearMemoryAllocator.memoryAllocator();
+            auto outputResult = memoryAllocator.allocate(outputCount * (int64_t)sizeof(Element), alignof(Element));
+            auto cursorsResult = memoryAllocator.allocate(runCount * (int64_t)sizeof(int64_t), alignof(int64_t));
+            auto endsResult = memoryAllocator.allocate(runCount * (int64_t)sizeof(int64_t), alignof(int64_t));
+            auto heapResult = memoryAllocator.allocate(runCount * (int64_t)sizeof(int64_t), alignof(int64_t));
+            if (outputResult.isFailure() || cursorsResult.isFailure() || endsResult.isFailure() || heapResult.isFailure()) {
+                state->linearMemoryAllocator.destroy();
+                state->status = Status::eFailure;
+                return 0;
+            }
+            auto output = (Element *)*outputResult.value();
+            auto cursors = (int64_t *)*cursorsResult.value();
+            auto ends = (int64_t *)*endsResult.value();
+            auto heap = (int64_t *)*heapResult.value();
+
+            findSplits<Element, Comparator>(state->array, state->runBegins, runCount, outputBegin, cursors);
+            findSplits<Element, Comparator>(state->array, state->runBegins, runCount, outputEnd, ends);
+
+            // Merge with a binary heap of the runs that have elements left,
+            // where ties go to the earlier run.
+            auto heapCount = INT64_C(0);
+            for (auto i = INT64_C(0); i != runCount; i++) {
+                if (cursors[i] != ends[i]) {
+                    heap[heapCount] = i;
+                    heapCount++;
+                }
+            }
+            for (auto i = heapCount / 2 - 1; i >= 0; i--) {
+                siftDown<Element, Comparator>(state->array, cursors, heap, heapCount, i);
+            }
+            for (auto i = INT64_C(0); i != outputCount; i++) {
+                auto run = heap[0];
+                output[i] = state->array[cursors[run]];
+                cursors[run]++;
+                if (cursors[run] == ends[run]) {
+                    heapCount--;
+                    heap[0] = heap[heapCount];
+                }
+                siftDown<Element, Comparator>(state->array, cursors, heap, heapCount, 0);
+            }
+
+            state->output = output;
+            state->outputBegin = outputBegin;
+            state->outputCount = outputCount;
+            return 0;
+        }
+
+        template<typename Element>
+        static auto copyBack(void *job) -> int {
+            auto state = (Job<Element> *)job;
+            if (state->outputCount != 0) {
+                Bytes::copyArray(state->array + state->outputBegin, state->output, state->outputCount);
+            }
+            return 0;
+        }
+
+        /**
+         * Finds how many elements of each run are among the least elements.
+         *
+         * Elements are ordered by their value, then by their run, and then by
+         * their index; so, every element has a distinct rank, and the split is
+         * exact even when there are equal elements.
+         */
+        template<typename Element, typename Comparator>
+        static auto findSplits(Element *array, int64_t *runBegins, int64_t runCount, int64_t rank, int64_t *splits) -> void {
+            for (auto i = INT64_C(0); i != runCount; i++) {
+                auto low = runBegins[i];
+                auto high = runBegins[i + 1];
+                while (low < high) {
+                    auto middle = low + (high - low) / 2;
+                    if (findRank<Element, Comparator>(array, runBegins, runCount, i, middle) < rank) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                splits[i] = low;
+            }
+        }
+
+        template<typename Element, typename Comparator>
+        static auto findRank(Element *array, int64_t *runBegins, int64_t runCount, int64_t runIndex, int64_t index) -> int64_t {
+            auto element = array + index;
+            auto rank = index - runBegins[runIndex];
+            for (auto i = INT64_C(0); i != runCount; i++) {
+                if (i == runIndex) {
+                    continue;
+                }
+                auto low = runBegins[i];
+                auto high = runBegins[i + 1];
+                while (low < high) {
+                    auto middle = low + (high - low) / 2;
+                    auto ordering = Comparator::compare(array + middle, element);
+                    if (ordering == Ordering::eLess || (ordering == Ordering::eEqual && i < runIndex)) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                rank += low - runBegins[i];
+            }
+            return rank;
+        }
+
+        template<typename Element, typename Comparator>
+        static auto isBefore(Element *array, int64_t *cursors, int64_t run0, int64_t run1) -> bool {
+            auto ordering = Comparator::compare(array + cursors[run0], array + cursors[run1]);
+            return ordering == Ordering::eLess || (ordering == Ordering::eEqual && run0 < run1);
+        }
+
+        template<typename Element, typename Comparator>
+        static auto siftDown(Element *array, int64_t *cursors, int64_t *heap, int64_t heapCount, int64_t index) -> void {
+            if (heapCount == 0) {
+                return;
+            }
+            auto run = heap[index];
+            while (true) {
+                auto child = 2 * index + 1;
+                if (child >= heapCount) {
+                    break;
+                }
+                if (child + 1 < heapCount && isBefore<Element, Comparator>(array, cursors, heap[child + 1], heap[child])) {
+                    child++;
+                }
+                if (!isBefore<Element, Comparator>(array, cursors, heap[child], run)) {
+                    break;
+                }
+                heap[index] = heap[child];
+                index = child;
+            }
+            heap[index] = run;
+        }
+    };
+}
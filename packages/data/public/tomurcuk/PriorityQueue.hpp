@@ -0,0 +1,327 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Queue that provides the least element first, kept as a d-ary heap.
+     *
+     * @tparam Element The type of the elements.
+     * @tparam Comparator The implementation of @ref OrderComparable that
+     * orders the elements.
+     * @tparam kArity The amount of children of every node.
+     *
+     * A wider heap is shallower; so, removals follow fewer levels, and each
+     * level compares children that are next to each other in memory. The
+     * elements are stored after `kArity - 1` unused slots in a block that is
+     * aligned to @ref kBlockAlignment; so, the children of every node start at
+     * a multiple of `kArity` slots from the beginning of the block, and they
+     * share a single cache line when `kArity * sizeof(Element)` divides it.
+     *
+     * The capacity grows like the one of @ref ArrayList does.
+     */
+    template<typename Element, typename Comparator = OrderComparable<Element>, int64_t kArity = 4>
+    class PriorityQueue {
+        static_assert(kArity >= 2);
+
+    public:
+        /**
+         * The alignment of the backing memory, which is a cache line.
+         */
+        static constexpr auto kBlockAlignment = alignof(Element) > 64 ? (int64_t)alignof(Element) : INT64_C(64);
+
+        /**
+         * Creates a new queue that is empty.
+         */
+        auto initialize() -> void {
+            mBlock = nullptr;
+            mCapacity = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            if (mBlock != nullptr) {
+                memoryAllocator.deallocate(mBlock, getBlockSize(mCapacity), kBlockAlignment);
+            }
+        }
+
+        /**
+         * Provides the elements in heap order, where the least one is first.
+         *
+         * @warning The queue must not be modified while the view is used.
+         *
+         * @return A view that refers to the elements.
+         */
+        auto getView() -> ArrayListView<Element> {
+            ArrayListView<Element> view;
+            if (mCount == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(getArray(), mCount);
+            }
+            return view;
+        }
+
+        /**
+         * Provides the amount of elements.
+         *
+         * @return The amount of elements in the queue.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Provides the amount of allocated elements.
+         *
+         * @return The amount of elements the queue can hold without growing.
+         */
+        auto getAllocatedCount() -> int64_t {
+            return mCapacity;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the queue.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides the pointer to the least element.
+         *
+         * @warning The element must not be modified in a way that changes its
+         * order.
+         *
+         * @return The pointer to the least element.
+         */
+        auto getFirst() -> Element * {
+            assert(mCount > 0);
+
+            return getArray();
+        }
+
+        /**
+         * Adds an element.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, Element element) -> Status {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            mCount++;
+            siftUp(mCount - 1, element);
+            return Status::eSuccess;
+        }
+
+        /**
+         * Adds multiple elements.
+         *
+         * When the added elements outnumber the ones in the queue, the whole
+         * heap is rebuilt bottom up in linear time instead of adding them one
+         * by one.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The added elements.
+         * @return Whether the operation succeeded.
+         */
+        auto addAll(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            if (view.isEmpty()) {
+                return Status::eSuccess;
+            }
+            if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+                return Status::eFailure;
+            }
+
+            auto array = getArray();
+            if (view.getCount() < mCount) {
+                for (auto i = INT64_C(0); i != view.getCount(); i++) {
+                    mCount++;
+                    siftUp(mCount - 1, *view.get(i));
+                }
+                return Status::eSuccess;
+            }
+
+            Bytes::copyArray(array + mCount, view.getArray(), view.getCount());
+            mCount += view.getCount();
+            for (auto i = (mCount - 2) / kArity; i >= 0; i--) {
+                siftDown(i, array[i]);
+            }
+            return Status::eSuccess;
+        }
+
+        /**
+         * Removes the least element.
+         *
+         * @return The element that was previously the least one.
+         */
+        auto removeFirst() -> Element {
+            assert(mCount > 0);
+
+            auto array = getArray();
+            auto element = array[0];
+            mCount--;
+            if (mCount != 0) {
+                siftDown(0, array[mCount]);
+            }
+            return element;
+        }
+
+        /**
+         * Removes the least element and adds another one, which is faster than
+         * doing them separately.
+         *
+         * This keeps the greatest elements among a stream when the queue is
+         * kept at a fixed size.
+         *
+         * @param[in] element The added element.
+         * @return The element that was previously the least one.
+         */
+        auto replaceFirst(Element element) -> Element {
+            assert(mCount > 0);
+
+            auto first = getArray()[0];
+            siftDown(0, element);
+            return first;
+        }
+
+        /**
+         * Removes all the elements from the queue.
+         *
+         * @warning This keeps the allocated memory.
+         */
+        auto removeAll() -> void {
+            mCount = 0;
+        }
+
+        /**
+         * Grows the capacity in preparation for additions.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of elements that must be
+         * addable without growing.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+            auto newCapacity = Bytes::growCapacity(mCapacity, mCount, amount);
+            if (newCapacity == mCapacity) {
+                return Status::eSuccess;
+            }
+
+            auto oldSize = mBlock == nullptr ? 0 : getBlockSize(mCapacity);
+            auto newBlockResult = memoryAllocator.reallocate(mBlock, oldSize, getBlockSize(newCapacity), kBlockAlignment);
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mBlock = (Element *)*newBlockResult.value();
+            mCapacity = newCapacity;
+            return Status::eSuccess;
+        }
+
+    private:
+        /**
+         * The amount of unused slots before the root, which puts the first
+         * child of every node at a multiple of `kArity`.
+         */
+        static constexpr auto kPaddingCount = kArity - 1;
+
+        /**
+         * Pointer to the backing memory, which starts with the unused slots.
+         *
+         * @warning `nullptr` if there are no allocated elements.
+         */
+        Element *mBlock;
+
+        /**
+         * The amount of allocated elements, without the unused slots.
+         */
+        int64_t mCapacity;
+
+        /**
+         * The amount of elements.
+         */
+        int64_t mCount;
+
+        static auto getBlockSize(int64_t capacity) -> int64_t {
+            assert(capacity <= INT64_MAX / (int64_t)sizeof(Element) - kPaddingCount);
+
+            return (capacity + kPaddingCount) * (int64_t)sizeof(Element);
+        }
+
+        static auto isLess(Element *element0, Element *element1) -> bool {
+            return Comparator::compare(element0, element1) == Ordering::eLess;
+        }
+
+        auto getArray() -> Element * {
+            return (Element *)__builtin_assume_aligned(mBlock, kBlockAlignment) + kPaddingCount;
+        }
+
+        /**
+         * Moves an element from a leaf towards the root until its parent is not
+         * greater than it.
+         */
+        auto siftUp(int64_t index, Element element) -> void {
+            auto array = getArray();
+            while (index != 0) {
+                auto parent = (index - 1) / kArity;
+                if (!isLess(&element, array + parent)) {
+                    break;
+                }
+                array[index] = array[parent];
+                index = parent;
+            }
+            array[index] = element;
+        }
+
+        /**
+         * Moves an element from a node towards the leaves until none of its
+         * children are less than it.
+         */
+        auto siftDown(int64_t index, Element element) -> void {
+            auto array = getArray();
+            while (true) {
+                auto firstChild = kArity * index + 1;
+                if (firstChild >= mCount) {
+                    break;
+                }
+                auto endChild = firstChild + kArity;
+                if (endChild > mCount) {
+                    endChild = mCount;
+                }
+                auto leastChild = firstChild;
+                for (auto i = firstChild + 1; i < endChild; i++) {
+                    if (isLess(array + i, array + leastChild)) {
+                        leastChild = i;
+                    }
+                }
+                if (!isLess(array + leastChild, &element)) {
+                    break;
+                }
+                array[index] = array[leastChild];
+                index = leastChild;
+            }
+            array[index] = element;
+        }
+    };
+}
@@ -0,0 +1,212 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/RadixSortable.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Queue that provides the least element first, for workloads where the
+     * added elements are never less than the last removed one.
+     *
+     * @tparam Element The type of the elements.
+     * @tparam Sortable The implementation of @ref RadixSortable that keys
+     * the elements.
+     *
+     * Elements are kept in buckets by the highest bit in which their key
+     * differs from the key of the last removed element. When the bucket of the
+     * equal keys runs out, the least key of the next bucket becomes the last
+     * one, and that bucket is spread over the lower ones. Each element can
+     * only move down as many times as there are bits in a key; so, removals
+     * take amortized constant time, without comparing elements with each
+     * other.
+     */
+    template<typename Element, typename Sortable = RadixSortable<Element>>
+    class RadixHeap {
+        using Key = typename Sortable::Key;
+
+    public:
+        /**
+         * Creates a new heap that is empty.
+         */
+        auto initialize() -> void {
+            for (auto &bucket : mBuckets) {
+                bucket.initialize();
+            }
+            mLastKey = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            for (auto i = kBucketCount - 1; i >= 0; i--) {
+                mBuckets[i].destroy(memoryAllocator);
+            }
+        }
+
+        /**
+         * Provides the amount of elements.
+         *
+         * @return The amount of elements in the heap.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the heap.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides the key of the last removed element.
+         *
+         * @return The least key that can be added.
+         */
+        auto getLastKey() -> Key {
+            return mLastKey;
+        }
+
+        /**
+         * Adds an element.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element, whose key must not be less
+         * than the one of the last removed element.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, Element element) -> Status {
+            auto key = Sortable::createKey(&element);
+
+            assert(key >= mLastKey);
+
+            if (!mBuckets[findBucket(key)].add(memoryAllocator, element)) {
+                return Status::eFailure;
+            }
+            mCount++;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Removes an element with the least key.
+         *
+         * Might need memory to spread a bucket over the lower ones.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @return The removed element on success. On failure, the heap is not
+         * modified.
+         */
+        auto removeFirst(MemoryAllocator memoryAllocator) -> Result<Element> {
+            assert(mCount > 0);
+
+            if (mBuckets[0].isEmpty() && refill(memoryAllocator) == Status::eFailure) {
+                return Result<Element>::failure();
+            }
+            mCount--;
+            return Results::success(mBuckets[0].removeLast());
+        }
+
+        /**
+         * Removes all the elements from the heap, which lets any key be added
+         * again.
+         *
+         * @warning This keeps the allocated memory.
+         */
+        auto removeAll() -> void {
+            for (auto &bucket : mBuckets) {
+                bucket.removeAll();
+            }
+            mLastKey = 0;
+            mCount = 0;
+        }
+
+    private:
+        /**
+         * The amount of buckets, which is one for the equal keys and one for
+         * every bit they can differ in.
+         */
+        static constexpr auto kBucketCount = (int64_t)sizeof(Key) * 8 + 1;
+
+        /**
+         * The buckets, where bucket `i` holds the keys whose highest bit that
+         * differs from the last key is bit `i - 1`.
+         */
+        ArrayList<Element> mBuckets[kBucketCount];
+
+        /**
+         * The key of the last removed element.
+         */
+        Key mLastKey;
+
+        /**
+         * The amount of elements.
+         */
+        int64_t mCount;
+
+        auto findBucket(Key key) -> int64_t {
+            auto difference = (uint64_t)(key ^ mLastKey);
+            if (difference == 0) {
+                return 0;
+            }
+            return 64 - __builtin_clzll(difference);
+        }
+
+        /**
+         * Spreads the first bucket that is not empty over the lower ones.
+         */
+        auto refill(MemoryAllocator memoryAllocator) -> Status {
+            auto bucketIndex = INT64_C(1);
+            while (mBuckets[bucketIndex].isEmpty()) {
+                bucketIndex++;
+            }
+            auto view = mBuckets[bucketIndex].getView();
+            auto leastKey = Sortable::createKey(view.get(0));
+            for (auto i = INT64_C(1); i != view.getCount(); i++) {
+                auto key = Sortable::createKey(view.get(i));
+                if (key < leastKey) {
+                    leastKey = key;
+                }
+            }
+
+            // All the keys in the bucket share the bits above the one they
+            // differ from the old last key in; so, against the new last key,
+            // they all land in lower buckets. Those are all empty, and their
+            // space is reserved before anything moves.
+            auto oldLastKey = mLastKey;
+            mLastKey = leastKey;
+            int64_t counts[kBucketCount] = {};
+            for (auto i = INT64_C(0); i != view.getCount(); i++) {
+                counts[findBucket(Sortable::createKey(view.get(i)))]++;
+            }
+            for (auto i = INT64_C(0); i != bucketIndex; i++) {
+                if (!mBuckets[i].reserve(memoryAllocator, counts[i])) {
+                    mLastKey = oldLastKey;
+                    return Status::eFailure;
+                }
+            }
+            for (auto i = INT64_C(0); i != view.getCount(); i++) {
+                auto bucket = mBuckets + findBucket(Sortable::createKey(view.get(i)));
+                *bucket->getEnd() = *view.get(i);
+                bucket->acknowledge(1);
+            }
+            mBuckets[bucketIndex].removeAll();
+            return Status::eSuccess;
+        }
+    };
+}
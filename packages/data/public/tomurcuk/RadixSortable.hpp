@@ -0,0 +1,193 @@
+#pragma once
+
+#include <limits.h>
+#include <stdint.h>
+#include <tomurcuk/Bytes.hpp>
+
+namespace tomurcuk {
+    /**
+     * Interface of types that can be sorted digit by digit.
+     *
+     * Implementations map every instance to an unsigned integer key, such that
+     * comparing the keys as integers orders the instances. The width of the
+     * key is the amount of byte-sized digits a radix sort goes through.
+     *
+     * @tparam Instance The type that implements this interface.
+     */
+    template<typename Instance>
+    class RadixSortable {
+    public:
+        /**
+         * The unsigned integer type of the keys.
+         */
+        using Key = void;
+
+        /**
+         * Creates the key of an instance.
+         *
+         * @param[in] instance The instance that is keyed.
+         * @return The key that orders the instance.
+         */
+        static auto createKey(Instance *instance) -> Key = delete;
+    };
+
+    template<>
+    class RadixSortable<bool> {
+    public:
+        using Key = uint8_t;
+
+        static auto createKey(bool *instance) -> Key {
+            return (Key)*instance;
+        }
+    };
+
+    /**
+     * Flips the sign bit where `char` is signed, so that negative values come
+     * first, like @ref OrderComparable orders them.
+     */
+    template<>
+    class RadixSortable<char> {
+    public:
+        using Key = uint8_t;
+
+        static auto createKey(char *instance) -> Key {
+            if constexpr (CHAR_MIN < 0) {
+                return (Key)((Key)*instance ^ (Key)(UINT32_C(1) << 7U));
+            } else {
+                return (Key)*instance;
+            }
+        }
+    };
+
+    template<>
+    class RadixSortable<uint8_t> {
+    public:
+        using Key = uint8_t;
+
+        static auto createKey(uint8_t *instance) -> Key {
+            return (Key)*instance;
+        }
+    };
+
+    template<>
+    class RadixSortable<uint16_t> {
+    public:
+        using Key = uint16_t;
+
+        static auto createKey(uint16_t *instance) -> Key {
+            return (Key)*instance;
+        }
+    };
+
+    template<>
+    class RadixSortable<uint32_t> {
+    public:
+        using Key = uint32_t;
+
+        static auto createKey(uint32_t *instance) -> Key {
+            return (Key)*instance;
+        }
+    };
+
+    template<>
+    class RadixSortable<uint64_t> {
+    public:
+        using Key = uint64_t;
+
+        static auto createKey(uint64_t *instance) -> Key {
+            return (Key)*instance;
+        }
+    };
+
+    /**
+     * Flips the sign bit, so that negative values come first.
+     */
+    template<>
+    class RadixSortable<int8_t> {
+    public:
+        using Key = uint8_t;
+
+        static auto createKey(int8_t *instance) -> Key {
+            return (Key)((Key)*instance ^ (Key)(UINT32_C(1) << 7U));
+        }
+    };
+
+    /**
+     * Flips the sign bit, so that negative values come first.
+     */
+    template<>
+    class RadixSortable<int16_t> {
+    public:
+        using Key = uint16_t;
+
+        static auto createKey(int16_t *instance) -> Key {
+            return (Key)((Key)*instance ^ (Key)(UINT32_C(1) << 15U));
+        }
+    };
+
+    /**
+     * Flips the sign bit, so that negative values come first.
+     */
+    template<>
+    class RadixSortable<int32_t> {
+    public:
+        using Key = uint32_t;
+
+        static auto createKey(int32_t *instance) -> Key {
+            return (Key)((Key)*instance ^ (Key)(UINT32_C(1) << 31U));
+        }
+    };
+
+    /**
+     * Flips the sign bit, so that negative values come first.
+     */
+    template<>
+    class RadixSortable<int64_t> {
+    public:
+        using Key = uint64_t;
+
+        static auto createKey(int64_t *instance) -> Key {
+            return (Key)((Key)*instance ^ (Key)(UINT64_C(1) << 63U));
+        }
+    };
+
+    /**
+     * Orders by the total order of IEEE 754, like @ref OrderComparable does.
+     */
+    template<>
+    class RadixSortable<float> {
+    public:
+        using Key = uint32_t;
+
+        static auto createKey(float *instance) -> Key {
+            Key bits;
+            Bytes::copyObject(&bits, (Key *)instance);
+
+            // Negative values have all their bits flipped, so that they order
+            // in reverse below the positive ones, which only get the sign bit
+            // set.
+            auto signMask = (Key)0 - (bits >> 31U);
+            return bits ^ (signMask | (UINT32_C(1) << 31U));
+        }
+    };
+
+    /**
+     * Orders by the total order of IEEE 754, like @ref OrderComparable does.
+     */
+    template<>
+    class RadixSortable<double> {
+    public:
+        using Key = uint64_t;
+
+        static auto createKey(double *instance) -> Key {
+            Key bits;
+            Bytes::copyObject(&bits, (Key *)instance);
+
+            // Negative values have all their bits flipped, so that they order
+            // in reverse below the positive ones, which only get the sign bit
+            // set.
+            auto signMask = (Key)0 - (bits >> 63U);
+            return bits ^ (signMask | (UINT64_C(1) << 63U));
+        }
+    };
+}
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    struct RoaringContainer;
+    class RoaringBitmapView;
+
+    /**
+     * Compressed set of 32-bit unsigned integers.
+     *
+     * The integers are split into containers by their upper 16 bits, and each
+     * container picks the representation that suits it: a sorted array of the
+     * lower 16 bits while it has at most 4096 integers, and a bitmap of all
+     * the 65536 lower 16 bits otherwise. @ref optimize also turns the
+     * containers of consecutive integers into runs. So, both sparse and dense
+     * sets take little memory, and the set operations work on whole containers
+     * with vector instructions when the processor has them.
+     *
+     * A bitmap is serialized into words that a @ref RoaringBitmapView reads
+     * without copying them; the set operations accept such views, too.
+     */
+    class RoaringBitmap {
+    public:
+        /**
+         * Creates a new bitmap that is empty.
+         */
+        auto initialize() -> void;
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Provides the amount of integers.
+         *
+         * @return The amount of integers in the bitmap.
+         */
+        auto getCount() -> int64_t;
+
+        /**
+         * Tests whether there are no integers.
+         *
+         * @return Whether there are no integers in the bitmap.
+         */
+        auto isEmpty() -> bool;
+
+        /**
+         * Tests whether an integer is in the bitmap.
+         *
+         * @param[in] value The tested integer.
+         * @return Whether the integer is in the bitmap.
+         */
+        auto contains(uint32_t value) -> bool;
+
+        /**
+         * Adds an integer.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] value The added integer.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, uint32_t value) -> Status;
+
+        /**
+         * Removes an integer.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] value The removed integer.
+         * @return Whether the operation succeeded. On failure, the integer is
+         * still in the bitmap.
+         */
+        auto remove(MemoryAllocator memoryAllocator, uint32_t value) -> Status;
+
+        /**
+         * Removes all the integers, and keeps the memory of the container
+         * directory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto removeAll(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Keeps only the integers that are also in another bitmap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] other The other bitmap.
+         * @return Whether the operation succeeded. On failure, the bitmap has
+         * all the integers of the intersection, and some of the others.
+         */
+        auto intersectWith(MemoryAllocator memoryAllocator, RoaringBitmap *other) -> Status;
+
+        /**
+         * Keeps only the integers that are also in a serialized bitmap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] other The view of the other bitmap.
+         * @return Whether the operation succeeded. On failure, the bitmap has
+         * all the integers of the intersection, and some of the others.
+         */
+        auto intersectWith(MemoryAllocator memoryAllocator, RoaringBitmapView *other) -> Status;
+
+        /**
+         * Adds the integers of another bitmap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] other The other bitmap.
+         * @return Whether the operation succeeded. On failure, the bitmap has
+         * all of its integers, and some of the added ones.
+         */
+        auto uniteWith(MemoryAllocator memoryAllocator, RoaringBitmap *other) -> Status;
+
+        /**
+         * Adds the integers of a serialized bitmap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] other The view of the other bitmap.
+         * @return Whether the operation succeeded. On failure, the bitmap has
+         * all of its integers, and some of the added ones.
+         */
+        auto uniteWith(MemoryAllocator memoryAllocator, RoaringBitmapView *other) -> Status;
+
+        /**
+         * Removes the integers of another bitmap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] other The other bitmap.
+         * @return Whether the operation succeeded. On failure, the bitmap has
+         * all the integers of the difference, and some of the removed ones.
+         */
+        auto subtract(MemoryAllocator memoryAllocator, RoaringBitmap *other) -> Status;
+
+        /**
+         * Removes the integers of a serialized bitmap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] other The view of the other bitmap.
+         * @return Whether the operation succeeded. On failure, the bitmap has
+         * all the integers of the difference, and some of the removed ones.
+         */
+        auto subtract(MemoryAllocator memoryAllocator, RoaringBitmapView *other) -> Status;
+
+        /**
+         * Turns the containers into runs where they take less memory.
+         *
+         * Runs are turned back when a container is modified; so, this suits
+         * bitmaps that are about to be serialized or only read.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @return Whether the operation succeeded. On failure, some of the
+         * containers are not turned.
+         */
+        auto optimize(MemoryAllocator memoryAllocator) -> Status;
+
+        /**
+         * Appends the integers in ascending order.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the list.
+         * @param[in,out] values The list the integers are appended to.
+         * @return Whether the operation succeeded.
+         */
+        auto copyValues(MemoryAllocator memoryAllocator, ArrayList<uint32_t> *values) -> Status;
+
+        /**
+         * Appends the serialized bitmap, which a @ref RoaringBitmapView reads.
+         *
+         * The words hold a header, a directory of the containers and then
+         * their integers, in little-endian byte order; so, they can be written
+         * to and mapped back from a file as they are.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the list.
+         * @param[in,out] words The list the words are appended to.
+         * @return Whether the operation succeeded.
+         */
+        auto serialize(MemoryAllocator memoryAllocator, ArrayList<uint64_t> *words) -> Status;
+
+    private:
+        /**
+         * Pointer to the containers in ascending order of their keys, none of
+         * which is empty.
+         *
+         * @warning `nullptr` if there are no allocated containers.
+         */
+        RoaringContainer *mContainers;
+
+        /**
+         * The amount of containers.
+         */
+        int64_t mContainerCount;
+
+        /**
+         * The amount of allocated containers.
+         */
+        int64_t mContainerCapacity;
+
+        auto getContainerCount() -> int64_t;
+        auto getContainer(int64_t index, RoaringContainer *container) -> void;
+        auto findContainer(uint16_t key) -> int64_t;
+        auto insertContainer(MemoryAllocator memoryAllocator, int64_t index, RoaringContainer *container) -> Status;
+        auto removeContainer(MemoryAllocator memoryAllocator, int64_t index) -> void;
+
+        template<typename Other>
+        auto intersectWithAll(MemoryAllocator memoryAllocator, Other *other) -> Status;
+
+        template<typename Other>
+        auto uniteWithAll(MemoryAllocator memoryAllocator, Other *other) -> Status;
+
+        template<typename Other>
+        auto subtractAll(MemoryAllocator memoryAllocator, Other *other) -> Status;
+    };
+}
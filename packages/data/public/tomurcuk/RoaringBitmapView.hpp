@@ -0,0 +1,117 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    struct RoaringContainer;
+
+    /**
+     * Read-only access to a bitmap that @ref RoaringBitmap::serialize wrote,
+     * without copying its words.
+     *
+     * The words are validated once when the view is initialized, so that the
+     * reads never leave them; after that, the view only refers to them, and
+     * they must outlive it.
+     */
+    class RoaringBitmapView {
+        static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "The serialized integers are read in place.");
+
+    public:
+        /**
+         * The magic number in the lower half of the first word, which is
+         * "ROA1" in ASCII.
+         */
+        static constexpr auto kMagic = UINT64_C(0x3141'4F52);
+
+        /**
+         * Validates a serialized bitmap and refers to it.
+         *
+         * @param[in] words The words, which begin with the serialized bitmap
+         * and might have others after it.
+         * @return Whether the words begin with a valid serialized bitmap.
+         */
+        auto initialize(ArrayListView<uint64_t> words) -> Status;
+
+        /**
+         * Provides the amount of words of the serialized bitmap.
+         *
+         * @return The amount of words from the beginning of the viewed words
+         * that belong to the bitmap.
+         */
+        auto getWordCount() -> int64_t;
+
+        /**
+         * Provides the amount of integers.
+         *
+         * @return The amount of integers in the bitmap.
+         */
+        auto getCount() -> int64_t;
+
+        /**
+         * Tests whether there are no integers.
+         *
+         * @return Whether there are no integers in the bitmap.
+         */
+        auto isEmpty() -> bool;
+
+        /**
+         * Tests whether an integer is in the bitmap.
+         *
+         * @param[in] value The tested integer.
+         * @return Whether the integer is in the bitmap.
+         */
+        auto contains(uint32_t value) -> bool;
+
+        /**
+         * Appends the integers in ascending order.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the list.
+         * @param[in,out] values The list the integers are appended to.
+         * @return Whether the operation succeeded.
+         */
+        auto copyValues(MemoryAllocator memoryAllocator, ArrayList<uint32_t> *values) -> Status;
+
+        /**
+         * Provides the amount of containers.
+         *
+         * @return The amount of containers in the bitmap, which are ordered
+         * by their keys.
+         */
+        auto getContainerCount() -> int64_t;
+
+        /**
+         * Provides a container that refers to the viewed words, which is how
+         * @ref RoaringBitmap combines itself with a view.
+         *
+         * @warning The container does not own its memory and must not be
+         * modified.
+         *
+         * @param[in] index The amount of containers before the provided one.
+         * @param[out] container The container that will refer to the words.
+         */
+        auto getContainer(int64_t index, RoaringContainer *container) -> void;
+
+    private:
+        /**
+         * Pointer to the words of the bitmap.
+         */
+        uint64_t *mWords;
+
+        /**
+         * The amount of words of the bitmap.
+         */
+        int64_t mWordCount;
+
+        /**
+         * The amount of containers.
+         */
+        int64_t mContainerCount;
+
+        auto findContainer(uint16_t key) -> int64_t;
+    };
+}
@@ -0,0 +1,845 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/KeySearch.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Sequence of elements that can be edited anywhere in logarithmic time,
+     * such as the text of a large file.
+     *
+     * @tparam Element The type of the elements.
+     * @tparam kNodeSize The size of every node in bytes, which is a multiple
+     * of a cache line.
+     *
+     * The elements are kept in chunks at the leaves of a B+ tree, and every
+     * branch holds where the elements under each of its children end; so,
+     * an index is found by walking down from the root with @ref KeySearch,
+     * and an edit only moves the elements of a chunk and updates the ends on
+     * its path. The leaves are linked in both directions; so, the elements
+     * can be visited chunk by chunk, as contiguous arrays.
+     *
+     * Every node is allocated separately from the allocator, with the same
+     * size and alignment; so, an allocator that pools blocks of a single size
+     * suits the rope well.
+     */
+    template<typename Element, int64_t kNodeSize = 2048>
+    class Rope {
+        static_assert(kNodeSize % 64 == 0);
+
+        struct Leaf;
+
+    public:
+        /**
+         * The alignment of every node, which is a cache line.
+         */
+        static constexpr auto kNodeAlignment = INT64_C(64);
+
+        /**
+         * Position of a chunk, which is used for walking the elements in
+         * order.
+         *
+         * @warning The rope must not be modified while the cursor is used.
+         */
+        class Cursor {
+        public:
+            /**
+             * Creates a cursor at a chunk, which is used by the rope.
+             *
+             * @param[in] leaf The pointer to the leaf of the chunk, or
+             * `nullptr` for a cursor that is not at a chunk.
+             * @param[in] index The index of the first element of the chunk.
+             */
+            auto initialize(Leaf *leaf, int64_t index) -> void {
+                assert(index >= 0);
+
+                mLeaf = leaf;
+                mIndex = index;
+            }
+
+            /**
+             * Tests whether the cursor is at a chunk.
+             *
+             * @return Whether the cursor did not move past either end of the
+             * rope.
+             */
+            auto isValid() -> bool {
+                return mLeaf != nullptr;
+            }
+
+            /**
+             * Provides the elements of the chunk.
+             *
+             * @return The view of the elements, which is never empty.
+             */
+            auto getChunk() -> ArrayListView<Element> {
+                assert(isValid());
+
+                ArrayListView<Element> chunk;
+                chunk.initialize(mLeaf->elements, mLeaf->count);
+                return chunk;
+            }
+
+            /**
+             * Provides the index of the first element of the chunk.
+             *
+             * @return The index in the rope.
+             */
+            auto getIndex() -> int64_t {
+                assert(isValid());
+
+                return mIndex;
+            }
+
+            /**
+             * Moves to the next chunk.
+             */
+            auto moveNext() -> void {
+                assert(isValid());
+
+                mIndex += mLeaf->count;
+                mLeaf = mLeaf->next;
+            }
+
+            /**
+             * Moves to the previous chunk.
+             */
+            auto movePrevious() -> void {
+                assert(isValid());
+
+                mLeaf = mLeaf->previous;
+                if (mLeaf != nullptr) {
+                    mIndex -= mLeaf->count;
+                }
+            }
+
+        private:
+            /**
+             * Pointer to the leaf of the chunk.
+             *
+             * @warning `nullptr` if the cursor is not at a chunk.
+             */
+            Leaf *mLeaf;
+
+            /**
+             * The index of the first element of the chunk.
+             */
+            int64_t mIndex;
+        };
+
+        /**
+         * Creates a new rope that is empty.
+         */
+        auto initialize() -> void {
+            mRoot = nullptr;
+            mHeight = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            if (mRoot != nullptr) {
+                destroyNode(memoryAllocator, mRoot, mHeight);
+            }
+        }
+
+        /**
+         * Provides the amount of elements.
+         *
+         * @return The amount of elements in the rope.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the rope.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides an element.
+         *
+         * @warning This walks down the tree. Use a @ref Cursor for visiting
+         * many elements.
+         *
+         * @param[in] index The index of the accessed element.
+         * @return The pointer to the element.
+         */
+        auto get(int64_t index) -> Element * {
+            assert(index >= 0);
+            assert(index < mCount);
+
+            int64_t offset;
+            auto leaf = findLeaf(index + 1, &offset);
+            return leaf->elements + offset - 1;
+        }
+
+        /**
+         * Provides the position of the first chunk.
+         *
+         * @return The cursor at the first chunk, which is not valid if the
+         * rope is empty.
+         */
+        auto getFirst() -> Cursor {
+            if (mRoot == nullptr) {
+                return createCursor(nullptr, 0);
+            }
+            auto node = mRoot;
+            for (auto level = mHeight; level != 0; level--) {
+                node = ((Branch *)node)->children[0];
+            }
+            return createCursor((Leaf *)node, 0);
+        }
+
+        /**
+         * Provides the position of the last chunk.
+         *
+         * @return The cursor at the last chunk, which is not valid if the rope
+         * is empty.
+         */
+        auto getLast() -> Cursor {
+            if (mRoot == nullptr) {
+                return createCursor(nullptr, 0);
+            }
+            auto node = mRoot;
+            for (auto level = mHeight; level != 0; level--) {
+                auto branch = (Branch *)node;
+                node = branch->children[branch->count - 1];
+            }
+            auto leaf = (Leaf *)node;
+            return createCursor(leaf, mCount - leaf->count);
+        }
+
+        /**
+         * Finds the chunk that holds an element, which is where a scan from
+         * that element begins.
+         *
+         * @param[in] index The index of the element, which might be the
+         * amount of elements.
+         * @return The cursor at the found chunk, which is not valid if the
+         * index is the amount of elements.
+         */
+        auto find(int64_t index) -> Cursor {
+            assert(index >= 0);
+            assert(index <= mCount);
+
+            if (index == mCount) {
+                return createCursor(nullptr, 0);
+            }
+            int64_t offset;
+            auto leaf = findLeaf(index + 1, &offset);
+            return createCursor(leaf, index + 1 - offset);
+        }
+
+        /**
+         * Inserts elements before an index.
+         *
+         * The elements are inserted into the chunk at the index, and a full
+         * chunk is split; so, this takes logarithmic time for every chunk the
+         * elements fill.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] index The index the first inserted element will have,
+         * which might be the amount of elements.
+         * @param[in] view The inserted elements.
+         * @return Whether the operation succeeded. On failure, the rope holds
+         * the same elements.
+         */
+        auto insertAll(MemoryAllocator memoryAllocator, int64_t index, ArrayListView<Element> view) -> Status {
+            assert(index >= 0);
+            assert(index <= mCount);
+
+            auto elements = view.getArray();
+            auto count = view.getCount();
+            auto insertedCount = INT64_C(0);
+            while (insertedCount != count) {
+                int64_t pieceCount;
+                if (insertPiece(memoryAllocator, index + insertedCount, elements + insertedCount, count - insertedCount, &pieceCount) == Status::eFailure) {
+                    removePortion(memoryAllocator, index, index + insertedCount);
+                    return Status::eFailure;
+                }
+                insertedCount += pieceCount;
+            }
+            return Status::eSuccess;
+        }
+
+        /**
+         * Removes the elements in a range.
+         *
+         * Chunks that become empty are deallocated, and a chunk that becomes
+         * small enough is merged with a neighbor; so, this takes logarithmic
+         * time for every chunk the range touches.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         * @param[in] beginIndex The index of the first removed element.
+         * @param[in] endIndex The index after the last removed element.
+         */
+        auto removePortion(MemoryAllocator memoryAllocator, int64_t beginIndex, int64_t endIndex) -> void {
+            assert(beginIndex >= 0);
+            assert(beginIndex <= endIndex);
+            assert(endIndex <= mCount);
+
+            while (endIndex != beginIndex) {
+                Branch *path[kMaxHeight];
+                int64_t childIndices[kMaxHeight];
+                int64_t offset;
+                auto leaf = findPath(beginIndex + 1, path, childIndices, &offset);
+                offset--;
+                auto removedCount = endIndex - beginIndex < leaf->count - offset ? endIndex - beginIndex : leaf->count - offset;
+                moveArray(leaf->elements + offset, leaf->elements + offset + removedCount, leaf->count - offset - removedCount);
+                leaf->count -= removedCount;
+                for (auto level = INT64_C(0); level != mHeight; level++) {
+                    addToEnds(path[level], childIndices[level], -removedCount);
+                }
+                mCount -= removedCount;
+                endIndex -= removedCount;
+
+                if (leaf->count == 0) {
+                    removeLeaf(memoryAllocator, leaf, path, childIndices);
+                } else {
+                    mergeLeaf(memoryAllocator, path, childIndices);
+                }
+            }
+        }
+
+    private:
+        /**
+         * The amount of elements that fit in a leaf after its count and links.
+         */
+        static constexpr auto kLeafCapacity = (kNodeSize - 3 * (int64_t)sizeof(void *)) / (int64_t)sizeof(Element);
+
+        /**
+         * The amount of children that fit in a branch after its count, along
+         * with where the elements under each one end.
+         */
+        static constexpr auto kBranchCapacity = (kNodeSize - (int64_t)sizeof(int64_t)) / (int64_t)(sizeof(int64_t) + sizeof(void *));
+
+        static_assert(kLeafCapacity >= 2);
+        static_assert(kBranchCapacity >= 2);
+
+        /**
+         * Node at the bottom of the tree, which holds a chunk.
+         */
+        struct Leaf {
+            /**
+             * The amount of elements, which is never `0`.
+             */
+            int64_t count;
+
+            /**
+             * Pointer to the leaf with the preceding chunk.
+             *
+             * @warning `nullptr` if this is the first leaf.
+             */
+            Leaf *previous;
+
+            /**
+             * Pointer to the leaf with the following chunk.
+             *
+             * @warning `nullptr` if this is the last leaf.
+             */
+            Leaf *next;
+
+            /**
+             * The elements of the chunk.
+             */
+            Element elements[kLeafCapacity];
+        };
+
+        /**
+         * Node above the leaves, which directs lookups to its children.
+         */
+        struct Branch {
+            /**
+             * The amount of children, which is never `0`.
+             */
+            int64_t count;
+
+            /**
+             * The amount of elements under every child and the ones before
+             * it, which are in ascending order; so, the child of an index is
+             * found by @ref KeySearch.
+             */
+            int64_t ends[kBranchCapacity];
+
+            /**
+             * Pointers to the children, which are branches or leaves by their
+             * level.
+             */
+            void *children[kBranchCapacity];
+        };
+
+        static_assert(sizeof(Leaf) <= kNodeSize);
+        static_assert(sizeof(Branch) <= kNodeSize);
+
+        /**
+         * The most branches between the root and a leaf. Every branch other
+         * than the root has at least half of its capacity of children, as a
+         * split halves a full branch and a removal merges or spreads a branch
+         * that drops below half; so, the height is logarithmic in the amount
+         * of leaves, and every leaf holds at least one element.
+         */
+        static constexpr auto kMaxHeight = INT64_C(64);
+
+        /**
+         * Pointer to the root node, which is a leaf if the height is zero.
+         *
+         * @warning `nullptr` if there are no elements.
+         */
+        void *mRoot;
+
+        /**
+         * The amount of branches between the root and a leaf, which includes
+         * the root.
+         */
+        int64_t mHeight;
+
+        /**
+         * The amount of elements.
+         */
+        int64_t mCount;
+
+        /**
+         * Copies elements between arrays that might overlap, which might be
+         * none at all.
+         */
+        template<typename Item>
+        static auto moveArray(Item *destinationArray, Item *sourceArray, int64_t count) -> void {
+            if (count != 0) {
+                Bytes::copyAliasingArray(destinationArray, sourceArray, count);
+            }
+        }
+
+        static auto createCursor(Leaf *leaf, int64_t index) -> Cursor {
+            Cursor cursor;
+            cursor.initialize(leaf, index);
+            return cursor;
+        }
+
+        static auto destroyNode(MemoryAllocator memoryAllocator, void *node, int64_t level) -> void {
+            if (level != 0) {
+                auto branch = (Branch *)node;
+                for (auto i = branch->count - 1; i >= 0; i--) {
+                    destroyNode(memoryAllocator, branch->children[i], level - 1);
+                }
+            }
+            memoryAllocator.deallocate(node, kNodeSize, kNodeAlignment);
+        }
+
+        /**
+         * Provides where the elements before a child of a branch end.
+         */
+        static auto getBegin(Branch *branch, int64_t childIndex) -> int64_t {
+            return childIndex == 0 ? 0 : branch->ends[childIndex - 1];
+        }
+
+        /**
+         * Adds an amount to the ends of a child of a branch and the ones
+         * after it.
+         */
+        static auto addToEnds(Branch *branch, int64_t childIndex, int64_t amount) -> void {
+            for (auto i = childIndex; i < branch->count; i++) {
+                branch->ends[i] += amount;
+            }
+        }
+
+        static auto insertIntoBranch(Branch *branch, int64_t childIndex, void *child, int64_t end) -> void {
+            moveArray(branch->ends + childIndex + 1, branch->ends + childIndex, branch->count - childIndex);
+            moveArray(branch->children + childIndex + 1, branch->children + childIndex, branch->count - childIndex);
+            branch->ends[childIndex] = end;
+            branch->children[childIndex] = child;
+            branch->count++;
+        }
+
+        /**
+         * Replaces the amount of elements under a child of a full branch,
+         * and adds a child after it by moving the greater half of its
+         * children to a new branch after it.
+         *
+         * On return, the amount of elements is the one under the branch, and
+         * the child and its amount of elements are the ones of the new
+         * branch, which is the one to add to the parent.
+         */
+        static auto splitBranch(Branch *branch, Branch *newBranch, int64_t childIndex, int64_t *nodeCount, void **child, int64_t *childCount) -> void {
+            int64_t counts[kBranchCapacity + 1];
+            void *children[kBranchCapacity + 1];
+            for (auto i = INT64_C(0); i != kBranchCapacity; i++) {
+                counts[i < childIndex ? i : i + 1] = branch->ends[i] - getBegin(branch, i);
+            }
+            counts[childIndex] = *nodeCount;
+            counts[childIndex + 1] = *childCount;
+            moveArray(children, branch->children, childIndex + 1);
+            children[childIndex + 1] = *child;
+            moveArray(children + childIndex + 2, branch->children + childIndex + 1, kBranchCapacity - childIndex - 1);
+
+            auto leftCount = (kBranchCapacity + 1) / 2;
+            branch->count = leftCount;
+            newBranch->count = kBranchCapacity + 1 - leftCount;
+            moveArray(branch->children, children, leftCount);
+            moveArray(newBranch->children, children + leftCount, newBranch->count);
+            auto end = INT64_C(0);
+            for (auto i = INT64_C(0); i != leftCount; i++) {
+                end += counts[i];
+                branch->ends[i] = end;
+            }
+            *nodeCount = end;
+            end = 0;
+            for (auto i = INT64_C(0); i != newBranch->count; i++) {
+                end += counts[leftCount + i];
+                newBranch->ends[i] = end;
+            }
+            *child = newBranch;
+            *childCount = end;
+        }
+
+        /**
+         * Moves the children of two neighboring branches into the first one
+         * if they fit, and spreads them evenly over both otherwise.
+         *
+         * @return The amount of elements under the first branch.
+         */
+        static auto spreadBranches(Branch *leftBranch, Branch *rightBranch) -> int64_t {
+            int64_t counts[kBranchCapacity * 2];
+            void *children[kBranchCapacity * 2];
+            auto count = leftBranch->count + rightBranch->count;
+            for (auto i = INT64_C(0); i != leftBranch->count; i++) {
+                counts[i] = leftBranch->ends[i] - getBegin(leftBranch, i);
+            }
+            for (auto i = INT64_C(0); i != rightBranch->count; i++) {
+                counts[leftBranch->count + i] = rightBranch->ends[i] - getBegin(rightBranch, i);
+            }
+            moveArray(children, leftBranch->children, leftBranch->count);
+            moveArray(children + leftBranch->count, rightBranch->children, rightBranch->count);
+
+            leftBranch->count = count <= kBranchCapacity ? count : count / 2;
+            rightBranch->count = count - leftBranch->count;
+            moveArray(leftBranch->children, children, leftBranch->count);
+            moveArray(rightBranch->children, children + leftBranch->count, rightBranch->count);
+            auto end = INT64_C(0);
+            for (auto i = INT64_C(0); i != leftBranch->count; i++) {
+                end += counts[i];
+                leftBranch->ends[i] = end;
+            }
+            auto leftEnd = end;
+            end = 0;
+            for (auto i = INT64_C(0); i != rightBranch->count; i++) {
+                end += counts[leftBranch->count + i];
+                rightBranch->ends[i] = end;
+            }
+            return leftEnd;
+        }
+
+        /**
+         * Finds the child of a branch a position belongs to, and makes the
+         * position relative to the child.
+         */
+        static auto findChild(Branch *branch, int64_t *position) -> int64_t {
+            auto childIndex = KeySearch::countLess(branch->ends, branch->count, *position);
+
+            assert(childIndex < branch->count);
+
+            *position -= getBegin(branch, childIndex);
+            return childIndex;
+        }
+
+        /**
+         * Finds the leaf a position belongs to, where the position `0` is
+         * before the first element. A position between two chunks belongs to
+         * the first one; so, the position after an element is in its chunk.
+         *
+         * @param[out] offset The position in the found leaf, which is not `0`
+         * unless the position is `0`.
+         */
+        auto findLeaf(int64_t position, int64_t *offset) -> Leaf * {
+            auto node = mRoot;
+            for (auto level = mHeight; level != 0; level--) {
+                auto branch = (Branch *)node;
+                node = branch->children[findChild(branch, &position)];
+            }
+            *offset = position;
+            return (Leaf *)node;
+        }
+
+        /**
+         * Finds the leaf a position belongs to as @ref findLeaf does, along
+         * with the branches above it, from the parent of the leaf up to the
+         * root.
+         */
+        auto findPath(int64_t position, Branch **path, int64_t *childIndices, int64_t *offset) -> Leaf * {
+            assert(mHeight < kMaxHeight);
+
+            auto node = mRoot;
+            for (auto level = mHeight - 1; level >= 0; level--) {
+                auto branch = (Branch *)node;
+                auto childIndex = findChild(branch, &position);
+                path[level] = branch;
+                childIndices[level] = childIndex;
+                node = branch->children[childIndex];
+            }
+            *offset = position;
+            return (Leaf *)node;
+        }
+
+        /**
+         * Inserts some of the elements at a position, which fill at most one
+         * new leaf.
+         *
+         * Elements are put into the room of the leaf at the position first. A
+         * full leaf is split: at its ends, the elements go into a leaf of
+         * their own; in its middle, a few elements are spread over both
+         * halves, and many elements are put after the first half once it is
+         * split off, so that the leaves they fill are full.
+         *
+         * @param[out] insertedCount The amount of elements that were inserted,
+         * which might be `0` if only the leaf was split.
+         */
+        auto insertPiece(MemoryAllocator memoryAllocator, int64_t position, Element *elements, int64_t count, int64_t *insertedCount) -> Status {
+            if (mRoot == nullptr) {
+                auto leafResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+                if (leafResult.isFailure()) {
+                    return Status::eFailure;
+                }
+                auto leaf = (Leaf *)*leafResult.value();
+                leaf->count = count < kLeafCapacity ? count : kLeafCapacity;
+                leaf->previous = nullptr;
+                leaf->next = nullptr;
+                Bytes::copyArray(leaf->elements, elements, leaf->count);
+                mRoot = leaf;
+                mCount = leaf->count;
+                *insertedCount = leaf->count;
+                return Status::eSuccess;
+            }
+
+            Branch *path[kMaxHeight];
+            int64_t childIndices[kMaxHeight];
+            int64_t offset;
+            auto leaf = findPath(position, path, childIndices, &offset);
+            auto room = kLeafCapacity - leaf->count;
+            if (room != 0) {
+                auto pieceCount = count < room ? count : room;
+                moveArray(leaf->elements + offset + pieceCount, leaf->elements + offset, leaf->count - offset);
+                Bytes::copyArray(leaf->elements + offset, elements, pieceCount);
+                leaf->count += pieceCount;
+                for (auto level = INT64_C(0); level != mHeight; level++) {
+                    addToEnds(path[level], childIndices[level], pieceCount);
+                }
+                mCount += pieceCount;
+                *insertedCount = pieceCount;
+                return Status::eSuccess;
+            }
+
+            // Every full node on the path splits, and so does the root; so,
+            // all the new nodes are allocated before anything moves.
+            auto splitBranchCount = INT64_C(0);
+            while (splitBranchCount != mHeight && path[splitBranchCount]->count == kBranchCapacity) {
+                splitBranchCount++;
+            }
+            assert(mHeight < kMaxHeight);
+
+            auto isRootSplit = splitBranchCount == mHeight;
+            auto newBranchCount = splitBranchCount + (isRootSplit ? 1 : 0);
+            auto newLeafResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+            if (newLeafResult.isFailure()) {
+                return Status::eFailure;
+            }
+            Branch *newBranches[kMaxHeight + 1];
+            for (auto i = INT64_C(0); i != newBranchCount; i++) {
+                auto newBranchResult = memoryAllocator.allocate(kNodeSize, kNodeAlignment);
+                if (newBranchResult.isFailure()) {
+                    for (auto j = i - 1; j >= 0; j--) {
+                        memoryAllocator.deallocate(newBranches[j], kNodeSize, kNodeAlignment);
+                    }
+                    memoryAllocator.deallocate(*newLeafResult.value(), kNodeSize, kNodeAlignment);
+                    return Status::eFailure;
+                }
+                newBranches[i] = (Branch *)*newBranchResult.value();
+            }
+
+            auto newLeaf = (Leaf *)*newLeafResult.value();
+            auto pieceCount = count < kLeafCapacity ? count : kLeafCapacity;
+            if (offset == kLeafCapacity) {
+                newLeaf->count = pieceCount;
+                Bytes::copyArray(newLeaf->elements, elements, pieceCount);
+            } else if (offset == 0) {
+                newLeaf->count = kLeafCapacity;
+                Bytes::copyArray(newLeaf->elements, leaf->elements, kLeafCapacity);
+                leaf->count = pieceCount;
+                Bytes::copyArray(leaf->elements, elements, pieceCount);
+            } else if (count < kLeafCapacity / 2) {
+                // The elements around the inserted ones are spread evenly.
+                Element sequence[kLeafCapacity + kLeafCapacity / 2];
+                Bytes::copyArray(sequence, leaf->elements, offset);
+                Bytes::copyArray(sequence + offset, elements, pieceCount);
+                Bytes::copyArray(sequence + offset + pieceCount, leaf->elements + offset, kLeafCapacity - offset);
+                leaf->count = (kLeafCapacity + pieceCount) / 2;
+                Bytes::copyArray(leaf->elements, sequence, leaf->count);
+                newLeaf->count = kLeafCapacity + pieceCount - leaf->count;
+                Bytes::copyArray(newLeaf->elements, sequence + leaf->count, newLeaf->count);
+            } else {
+                pieceCount = 0;
+                newLeaf->count = kLeafCapacity - offset;
+                Bytes::copyArray(newLeaf->elements, leaf->elements + offset, newLeaf->count);
+                leaf->count = offset;
+            }
+            newLeaf->previous = leaf;
+            newLeaf->next = leaf->next;
+            if (leaf->next != nullptr) {
+                leaf->next->previous = newLeaf;
+            }
+            leaf->next = newLeaf;
+            mCount += pieceCount;
+            *insertedCount = pieceCount;
+
+            void *child = newLeaf;
+            auto childCount = newLeaf->count;
+            auto nodeCount = leaf->count;
+            for (auto level = INT64_C(0); level != mHeight; level++) {
+                auto branch = path[level];
+                auto childIndex = childIndices[level];
+                if (level == splitBranchCount) {
+                    addToEnds(branch, childIndex + 1, pieceCount);
+                    branch->ends[childIndex] = getBegin(branch, childIndex) + nodeCount;
+                    insertIntoBranch(branch, childIndex + 1, child, branch->ends[childIndex] + childCount);
+                    for (auto upperLevel = level + 1; upperLevel != mHeight; upperLevel++) {
+                        addToEnds(path[upperLevel], childIndices[upperLevel], pieceCount);
+                    }
+                    return Status::eSuccess;
+                }
+                splitBranch(branch, newBranches[level], childIndex, &nodeCount, &child, &childCount);
+            }
+
+            auto root = newBranches[newBranchCount - 1];
+            root->count = 2;
+            root->ends[0] = nodeCount;
+            root->ends[1] = nodeCount + childCount;
+            root->children[0] = mRoot;
+            root->children[1] = child;
+            mRoot = root;
+            mHeight++;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Moves the elements of the leaf at the end of a path and a neighbor
+         * under the same parent into one of them if they fit, and removes the
+         * other one.
+         */
+        auto mergeLeaf(MemoryAllocator memoryAllocator, Branch **path, int64_t *childIndices) -> void {
+            if (mHeight == 0) {
+                return;
+            }
+            auto branch = path[0];
+            auto childIndex = childIndices[0];
+            if (childIndex == branch->count - 1) {
+                if (childIndex == 0) {
+                    return;
+                }
+                childIndex--;
+            }
+
+            auto leftLeaf = (Leaf *)branch->children[childIndex];
+            auto rightLeaf = (Leaf *)branch->children[childIndex + 1];
+            if (leftLeaf->count + rightLeaf->count > kLeafCapacity) {
+                return;
+            }
+            moveArray(leftLeaf->elements + leftLeaf->count, rightLeaf->elements, rightLeaf->count);
+            leftLeaf->count += rightLeaf->count;
+            branch->ends[childIndex] += rightLeaf->count;
+            childIndices[0] = childIndex + 1;
+            removeLeaf(memoryAllocator, rightLeaf, path, childIndices);
+        }
+
+        /**
+         * Removes a leaf whose elements are no longer counted by the branches
+         * above it, along with the branches it leaves empty, and merges or
+         * spreads the branches it leaves with less than half of their
+         * capacity.
+         */
+        auto removeLeaf(MemoryAllocator memoryAllocator, Leaf *leaf, Branch **path, int64_t *childIndices) -> void {
+            if (leaf->previous != nullptr) {
+                leaf->previous->next = leaf->next;
+            }
+            if (leaf->next != nullptr) {
+                leaf->next->previous = leaf->previous;
+            }
+            memoryAllocator.deallocate(leaf, kNodeSize, kNodeAlignment);
+
+            for (auto level = INT64_C(0); level != mHeight; level++) {
+                auto branch = path[level];
+                auto childIndex = childIndices[level];
+                branch->count--;
+                if (branch->count == 0) {
+                    memoryAllocator.deallocate(branch, kNodeSize, kNodeAlignment);
+                    continue;
+                }
+                moveArray(branch->ends + childIndex, branch->ends + childIndex + 1, branch->count - childIndex);
+                moveArray(branch->children + childIndex, branch->children + childIndex + 1, branch->count - childIndex);
+                if (level == mHeight - 1 || branch->count >= kBranchCapacity / 2 || !mergeBranch(memoryAllocator, level, path, childIndices)) {
+                    shrinkRoot(memoryAllocator);
+                    return;
+                }
+            }
+            mRoot = nullptr;
+            mHeight = 0;
+        }
+
+        /**
+         * Spreads the children of the branch at a level of a path that has
+         * less than half of its capacity and a neighbor under the same parent
+         * evenly over both, or moves them into one of them if they fit.
+         *
+         * @return Whether the other branch was deallocated, in which case the
+         * path leads to its parent and its index in it, which is still to be
+         * removed from the parent.
+         */
+        auto mergeBranch(MemoryAllocator memoryAllocator, int64_t level, Branch **path, int64_t *childIndices) -> bool {
+            auto parent = path[level + 1];
+            auto childIndex = childIndices[level + 1];
+            if (childIndex == parent->count - 1) {
+                if (childIndex == 0) {
+                    return false;
+                }
+                childIndex--;
+            }
+
+            auto leftBranch = (Branch *)parent->children[childIndex];
+            auto rightBranch = (Branch *)parent->children[childIndex + 1];
+            parent->ends[childIndex] = getBegin(parent, childIndex) + spreadBranches(leftBranch, rightBranch);
+            if (rightBranch->count != 0) {
+                return false;
+            }
+            memoryAllocator.deallocate(rightBranch, kNodeSize, kNodeAlignment);
+            childIndices[level + 1] = childIndex + 1;
+            return true;
+        }
+
+        /**
+         * Replaces a root that has a single child with that child.
+         */
+        auto shrinkRoot(MemoryAllocator memoryAllocator) -> void {
+            while (mHeight != 0 && ((Branch *)mRoot)->count == 1) {
+                auto root = (Branch *)mRoot;
+                mRoot = root->children[0];
+                mHeight--;
+                memoryAllocator.deallocate(root, kNodeSize, kNodeAlignment);
+            }
+        }
+    };
+}
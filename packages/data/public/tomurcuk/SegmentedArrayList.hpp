@@ -0,0 +1,287 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * List that grows by adding chunks instead of moving its elements.
+     *
+     * @tparam Element The type of the elements.
+     *
+     * Chunk `k` holds `kFirstChunkCount << k` elements; so, each chunk is as
+     * big as all the ones before it combined, plus the first chunk. The chunk
+     * of an index is found from its highest set bit, which makes indexing
+     * constant time.
+     *
+     * Elements never move once they are added; so, pointers to them stay valid
+     * until they are removed.
+     *
+     * To run a loop over contiguous elements, iterate the chunks via
+     * @ref getChunkCount and @ref getChunkView.
+     */
+    template<typename Element>
+    class SegmentedArrayList {
+    public:
+        /**
+         * Creates a new list that is empty.
+         */
+        auto initialize() -> void {
+            mChunkCount = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            for (auto i = mChunkCount - 1; i >= 0; i--) {
+                memoryAllocator.deallocate(mChunks[i], getChunkCapacity(i) * (int64_t)sizeof(Element), alignof(Element));
+            }
+        }
+
+        /**
+         * Provides the amount of initialized elements.
+         *
+         * @return The amount of initialized elements in the list.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Provides the amount of allocated elements.
+         *
+         * @return The amount of elements the allocated chunks can hold.
+         */
+        auto getAllocatedCount() -> int64_t {
+            return getChunkBegin(mChunkCount);
+        }
+
+        /**
+         * Tests whether there are no initialized elements.
+         *
+         * @return Whether there are no initialized elements in the list.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Provides the amount of chunks that hold elements.
+         *
+         * @return The amount of chunks that have at least one initialized
+         * element.
+         */
+        auto getChunkCount() -> int64_t {
+            if (mCount == 0) {
+                return 0;
+            }
+            return findChunk(mCount - 1) + 1;
+        }
+
+        /**
+         * Provides the initialized elements in a chunk.
+         *
+         * @warning The list must not have elements removed while the view is
+         * used.
+         *
+         * @param[in] chunkIndex The amount of chunks before the viewed chunk.
+         * @return A view that refers to the initialized elements in the given
+         * chunk.
+         */
+        auto getChunkView(int64_t chunkIndex) -> ArrayListView<Element> {
+            assert(chunkIndex >= 0);
+            assert(chunkIndex < getChunkCount());
+
+            auto count = mCount - getChunkBegin(chunkIndex);
+            if (count > getChunkCapacity(chunkIndex)) {
+                count = getChunkCapacity(chunkIndex);
+            }
+            ArrayListView<Element> view;
+            view.initialize(mChunks[chunkIndex], count);
+            return view;
+        }
+
+        /**
+         * Provides the pointer to the first element.
+         *
+         * @return The pointer to the first element.
+         */
+        auto getFirst() -> Element * {
+            return get(0);
+        }
+
+        /**
+         * Provides the pointer to the last element.
+         *
+         * @return The pointer to the last element.
+         */
+        auto getLast() -> Element * {
+            return get(mCount - 1);
+        }
+
+        /**
+         * Provides the pointer to the element at an index.
+         *
+         * @param[in] index The amount of elements before the accessed element.
+         * @return The pointer to the element at the given index, which stays
+         * the same until the element is removed.
+         */
+        auto get(int64_t index) -> Element * {
+            assert(index >= 0);
+            assert(index < mCount);
+
+            auto chunkIndex = findChunk(index);
+            return mChunks[chunkIndex] + (index - getChunkBegin(chunkIndex));
+        }
+
+        /**
+         * Removes the last element.
+         *
+         * @return The element that was previously the last one.
+         */
+        auto removeLast() -> Element {
+            auto element = *getLast();
+            mCount--;
+            return element;
+        }
+
+        /**
+         * Removes all the elements from the list.
+         *
+         * @warning This keeps the allocated chunks.
+         */
+        auto removeAll() -> void {
+            mCount = 0;
+        }
+
+        /**
+         * Appends another list to the end of this one.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The added elements.
+         * @return Whether the operation succeeded.
+         */
+        auto addAll(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            if (reserve(memoryAllocator, view.getCount()) == Status::eFailure) {
+                return Status::eFailure;
+            }
+
+            // Copy chunk by chunk, which is at most logarithmically many
+            // copies.
+            auto copiedCount = INT64_C(0);
+            while (copiedCount != view.getCount()) {
+                auto chunkIndex = findChunk(mCount);
+                auto offset = mCount - getChunkBegin(chunkIndex);
+                auto count = getChunkCapacity(chunkIndex) - offset;
+                if (count > view.getCount() - copiedCount) {
+                    count = view.getCount() - copiedCount;
+                }
+                Bytes::copyArray(mChunks[chunkIndex] + offset, view.getArray() + copiedCount, count);
+                copiedCount += count;
+                mCount += count;
+            }
+            return Status::eSuccess;
+        }
+
+        /**
+         * Appends an element to the end of the list.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, Element element) -> Status {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            mCount++;
+            *get(mCount - 1) = element;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Allocates chunks until there are enough uninitialized elements.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of uninitialized elements that
+         * must exists in the list.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+            assert(amount >= 0);
+            assert(amount <= getChunkBegin(kMaxChunkCount) - mCount);
+
+            while (getAllocatedCount() - mCount < amount) {
+                auto capacity = getChunkCapacity(mChunkCount);
+                auto newBlockResult = memoryAllocator.allocate(capacity * (int64_t)sizeof(Element), alignof(Element));
+                if (newBlockResult.isFailure()) {
+                    return Status::eFailure;
+                }
+                mChunks[mChunkCount] = (Element *)*newBlockResult.value();
+                mChunkCount++;
+            }
+            return Status::eSuccess;
+        }
+
+    private:
+        /**
+         * The binary logarithm of the amount of elements in the first chunk.
+         */
+        static constexpr auto kFirstChunkShift = 4U;
+
+        /**
+         * The amount of elements in the first chunk.
+         */
+        static constexpr auto kFirstChunkCount = INT64_C(1) << kFirstChunkShift;
+
+        /**
+         * The amount of chunks it takes to address `2^48` elements, which is
+         * more than the address space can hold.
+         */
+        static constexpr auto kMaxChunkCount = 48 - (int64_t)kFirstChunkShift;
+
+        /**
+         * Pointers to the allocated chunks.
+         *
+         * @warning Only the first `mChunkCount` are valid.
+         */
+        Element *mChunks[kMaxChunkCount];
+
+        /**
+         * The amount of allocated chunks.
+         */
+        int64_t mChunkCount;
+
+        /**
+         * The amount of initialized elements.
+         */
+        int64_t mCount;
+
+        static auto findChunk(int64_t index) -> int64_t {
+            // Offsetting the index by the first chunk's size makes the chunks
+            // start at consecutive powers of two.
+            auto shiftedIndex = (uint64_t)index + (uint64_t)kFirstChunkCount;
+            return 63 - __builtin_clzll(shiftedIndex) - (int64_t)kFirstChunkShift;
+        }
+
+        static auto getChunkBegin(int64_t chunkIndex) -> int64_t {
+            return (kFirstChunkCount << (uint64_t)chunkIndex) - kFirstChunkCount;
+        }
+
+        static auto getChunkCapacity(int64_t chunkIndex) -> int64_t {
+            return kFirstChunkCount << (uint64_t)chunkIndex;
+        }
+    };
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Reference to an element of a @ref SlotMap that detects when the element
+     * was removed.
+     */
+    class SlotHandle {
+    public:
+        /**
+         * The index of the slot that refers to the element.
+         */
+        uint32_t index;
+
+        /**
+         * The generation of the slot when the element was inserted.
+         *
+         * This is always odd for handles that were provided by a map.
+         */
+        uint32_t generation;
+    };
+}
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <tomurcuk/SlotHandle.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Collection of elements that are referred to by handles that stay valid
+     * until the element is removed.
+     *
+     * @tparam Element The type of the elements.
+     *
+     * The elements are kept densely packed, so that iterating them reads
+     * contiguous memory. Handles refer to slots, which point to the elements,
+     * and which are reused through a free list. Every slot has a generation
+     * counter that is odd while the slot is in use and is increased on every
+     * insertion and removal; so, a handle to a removed element is detected by
+     * its generation.
+     */
+    template<typename Element>
+    class SlotMap {
+    public:
+        /**
+         * Creates a new map that is empty.
+         */
+        auto initialize() -> void {
+            mElements = nullptr;
+            mElementSlots = nullptr;
+            mSlots = nullptr;
+            mCapacity = 0;
+            mSlotCount = 0;
+            mCount = 0;
+            mFreeSlot = kNoSlot;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            memoryAllocator.deallocate(mElements, getBlockSize(mCapacity), kBlockAlignment);
+        }
+
+        /**
+         * Provides the elements in no particular order.
+         *
+         * @warning The map must not be modified while the view is used.
+         *
+         * @return A view that refers to the densely packed elements.
+         */
+        auto getView() -> ArrayListView<Element> {
+            ArrayListView<Element> view;
+            if (mCount == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(mElements, mCount);
+            }
+            return view;
+        }
+
+        /**
+         * Provides the handle of an element in the view.
+         *
+         * @param[in] index The index of the element in the view.
+         * @return The handle that refers to the element.
+         */
+        auto getHandle(int64_t index) -> SlotHandle {
+            assert(index >= 0);
+            assert(index < mCount);
+
+            SlotHandle handle;
+            handle.index = mElementSlots[index];
+            handle.generation = mSlots[handle.index].generation;
+            return handle;
+        }
+
+        /**
+         * Provides the amount of elements.
+         *
+         * @return The amount of elements in the map.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the map.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Tests whether a handle refers to an element.
+         *
+         * @param[in] handle The tested handle.
+         * @return Whether the element of the handle was not removed.
+         */
+        auto contains(SlotHandle handle) -> bool {
+            return handle.index < mSlotCount && mSlots[handle.index].generation == handle.generation;
+        }
+
+        /**
+         * Provides the element of a handle.
+         *
+         * @param[in] handle The handle of the accessed element.
+         * @return The pointer to the element if it was not removed. Otherwise,
+         * `nullptr`.
+         */
+        auto get(SlotHandle handle) -> Element * {
+            if (!contains(handle)) {
+                return nullptr;
+            }
+            return mElements + mSlots[handle.index].target;
+        }
+
+        /**
+         * Adds an element.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] element The added element.
+         * @return The handle of the added element on success.
+         */
+        auto insert(MemoryAllocator memoryAllocator, Element element) -> Result<SlotHandle> {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Result<SlotHandle>::failure();
+            }
+
+            auto slotIndex = mFreeSlot;
+            if (slotIndex == kNoSlot) {
+                slotIndex = (uint32_t)mSlotCount;
+                mSlots[slotIndex].generation = 0;
+                mSlotCount++;
+            } else {
+                mFreeSlot = mSlots[slotIndex].target;
+            }
+
+            auto slot = mSlots + slotIndex;
+            slot->target = (uint32_t)mCount;
+            slot->generation++;
+            mElements[mCount] = element;
+            mElementSlots[mCount] = slotIndex;
+            mCount++;
+
+            SlotHandle handle;
+            handle.index = slotIndex;
+            handle.generation = slot->generation;
+            return Results::success(handle);
+        }
+
+        /**
+         * Removes the element of a handle.
+         *
+         * Moves the last element into the place of the removed one, which does
+         * not change any handles.
+         *
+         * @param[in] handle The handle of the removed element.
+         * @return The removed element.
+         */
+        auto remove(SlotHandle handle) -> Element {
+            assert(contains(handle));
+
+            auto slot = mSlots + handle.index;
+            auto index = slot->target;
+            auto element = mElements[index];
+
+            mCount--;
+            mElements[index] = mElements[mCount];
+            mElementSlots[index] = mElementSlots[mCount];
+            mSlots[mElementSlots[index]].target = index;
+
+            slot->target = mFreeSlot;
+            slot->generation++;
+            mFreeSlot = handle.index;
+            return element;
+        }
+
+        /**
+         * Grows the capacity in preparation for insertions.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of elements that must be
+         * insertable without growing.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+            // Slots only get added when none are free, which is when every one
+            // of them is in use; so, the slots never outnumber the elements
+            // that fit.
+            auto newCapacity = Bytes::growCapacity(mCapacity, mCount, amount);
+            if (newCapacity == mCapacity) {
+                return Status::eSuccess;
+            }
+            if (newCapacity > (int64_t)kNoSlot) {
+                return Status::eFailure;
+            }
+
+            // All the arrays are in a single block, so that growing them either
+            // fully succeeds or leaves the map as it was.
+            auto newBlockResult = memoryAllocator.allocate(getBlockSize(newCapacity), kBlockAlignment);
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            auto newBlock = (uint8_t *)*newBlockResult.value();
+            auto newElements = (Element *)newBlock;
+            auto newElementSlots = (uint32_t *)(newBlock + getElementSlotsOffset(newCapacity));
+            auto newSlots = (Slot *)(newBlock + getSlotsOffset(newCapacity));
+            if (mCount != 0) {
+                Bytes::copyArray(newElements, mElements, mCount);
+                Bytes::copyArray(newElementSlots, mElementSlots, mCount);
+            }
+            if (mSlotCount != 0) {
+                Bytes::copyArray(newSlots, mSlots, mSlotCount);
+            }
+            memoryAllocator.deallocate(mElements, getBlockSize(mCapacity), kBlockAlignment);
+
+            mElements = newElements;
+            mElementSlots = newElementSlots;
+            mSlots = newSlots;
+            mCapacity = newCapacity;
+            return Status::eSuccess;
+        }
+
+    private:
+        /**
+         * Entry of the sparse array that handles refer to.
+         */
+        struct Slot {
+            /**
+             * The index of the element while the slot is in use. Otherwise,
+             * the index of the next free slot.
+             */
+            uint32_t target;
+
+            /**
+             * The counter that detects stale handles.
+             */
+            uint32_t generation;
+        };
+
+        /**
+         * The marker of the end of the free list.
+         */
+        static constexpr auto kNoSlot = UINT32_MAX;
+
+        /**
+         * The alignment of the backing memory, which suits all the arrays in
+         * it.
+         */
+        static constexpr auto kBlockAlignment = alignof(Element) > alignof(Slot) ? (int64_t)alignof(Element) : (int64_t)alignof(Slot);
+
+        /**
+         * Pointer to the densely packed elements, which is also the beginning
+         * of the backing memory.
+         */
+        Element *mElements;
+
+        /**
+         * Pointer to the indices of the slots that refer to each element.
+         */
+        uint32_t *mElementSlots;
+
+        /**
+         * Pointer to the slots.
+         */
+        Slot *mSlots;
+
+        /**
+         * The amount of elements and slots the backing memory can hold.
+         */
+        int64_t mCapacity;
+
+        /**
+         * The amount of slots that were ever used.
+         */
+        int64_t mSlotCount;
+
+        /**
+         * The amount of elements.
+         */
+        int64_t mCount;
+
+        /**
+         * The index of the first free slot, or @ref kNoSlot.
+         */
+        uint32_t mFreeSlot;
+
+        static auto getElementSlotsOffset(int64_t capacity) -> int64_t {
+            assert(capacity <= INT64_MAX / (int64_t)sizeof(Element));
+
+            return Bytes::alignUpwards(capacity * (int64_t)sizeof(Element), alignof(Slot));
+        }
+
+        static auto getSlotsOffset(int64_t capacity) -> int64_t {
+            return getElementSlotsOffset(capacity) + Bytes::alignUpwards(capacity * (int64_t)sizeof(uint32_t), alignof(Slot));
+        }
+
+        static auto getBlockSize(int64_t capacity) -> int64_t {
+            return getSlotsOffset(capacity) + capacity * (int64_t)sizeof(Slot);
+        }
+    };
+}
@@ -0,0 +1,289 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * List of records that keeps each field in a separate column.
+     *
+     * @tparam Fields The types of the fields of a record.
+     *
+     * Loops that only touch a few fields read only their columns; so, the
+     * cache lines they load are not wasted on the other fields. All the columns
+     * are in a single allocation, and each one starts at a multiple of
+     * @ref kColumnAlignment; so, loops over them can use aligned vector loads.
+     *
+     * To append to the list in bulk:
+     *   1- Acquire required slots via @ref reserve.
+     *   2- Write to every column after @ref getCount via @ref getColumn.
+     *   3- Mark the newly written records as initialized via @ref acknowledge.
+     */
+    template<typename... Fields>
+    class SoAArrayList {
+        static_assert(sizeof...(Fields) > 0);
+
+        /**
+         * Finds the type of a field from its index.
+         */
+        template<int64_t kFieldIndex, typename First, typename... Rest>
+        struct FieldAt {
+            using Type = typename FieldAt<kFieldIndex - 1, Rest...>::Type;
+        };
+
+        template<typename First, typename... Rest>
+        struct FieldAt<0, First, Rest...> {
+            using Type = First;
+        };
+
+    public:
+        /**
+         * The type of a field.
+         *
+         * @tparam kFieldIndex The amount of fields before the field.
+         */
+        template<int64_t kFieldIndex>
+        using Field = typename FieldAt<kFieldIndex, Fields...>::Type;
+
+        /**
+         * The alignment of the beginning of every column, which is enough for
+         * the widest vector loads.
+         */
+        static constexpr auto kColumnAlignment = INT64_C(64);
+
+        /**
+         * Creates a new list that is empty.
+         */
+        auto initialize() -> void {
+            mBlock = nullptr;
+            for (auto &column : mColumns) {
+                column = nullptr;
+            }
+            mCapacity = 0;
+            mCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            memoryAllocator.deallocate(mBlock, getBlockSize(mCapacity), kColumnAlignment);
+        }
+
+        /**
+         * Provides the column of a field.
+         *
+         * @tparam kFieldIndex The amount of fields before the field.
+         * @return The pointer to the first slot of the column if there is
+         * one. Otherwise, `nullptr`.
+         */
+        template<int64_t kFieldIndex>
+        auto getColumn() -> Field<kFieldIndex> * {
+            static_assert(kFieldIndex >= 0);
+            static_assert(kFieldIndex < (int64_t)sizeof...(Fields));
+
+            return (Field<kFieldIndex> *)__builtin_assume_aligned(mColumns[kFieldIndex], kColumnAlignment);
+        }
+
+        /**
+         * Provides a view of the column of a field.
+         *
+         * @warning The list must not be modified while the view is used.
+         *
+         * @tparam kFieldIndex The amount of fields before the field.
+         * @return A view that refers to the initialized part of the column.
+         */
+        template<int64_t kFieldIndex>
+        auto getColumnView() -> ArrayListView<Field<kFieldIndex>> {
+            ArrayListView<Field<kFieldIndex>> view;
+            if (mCount == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(getColumn<kFieldIndex>(), mCount);
+            }
+            return view;
+        }
+
+        /**
+         * Provides the amount of initialized records.
+         *
+         * @return The amount of initialized records in the list.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Provides the amount of allocated records.
+         *
+         * @return The amount of records the columns have space for.
+         */
+        auto getAllocatedCount() -> int64_t {
+            return mCapacity;
+        }
+
+        /**
+         * Provides the amount of uninitialized records.
+         *
+         * @return The amount of records that can be added without growing.
+         */
+        auto getUninitializedCount() -> int64_t {
+            return mCapacity - mCount;
+        }
+
+        /**
+         * Tests whether there are no initialized records.
+         *
+         * @return Whether there are no initialized records in the list.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Appends a record to the end of the list.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] fields The fields of the added record.
+         * @return Whether the operation succeeded.
+         */
+        auto add(MemoryAllocator memoryAllocator, Fields... fields) -> Status {
+            if (reserve(memoryAllocator, 1) == Status::eFailure) {
+                return Status::eFailure;
+            }
+            auto columnIndex = 0;
+            ((((Fields *)mColumns[columnIndex])[mCount] = fields, columnIndex++), ...);
+            mCount++;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Removes the record at an index without preserving the order of the
+         * records, by moving the last record into its place.
+         *
+         * @param[in] index The amount of records before the removed record.
+         */
+        auto removeUnordered(int64_t index) -> void {
+            assert(index >= 0);
+            assert(index < mCount);
+
+            mCount--;
+            auto columnIndex = 0;
+            ((((Fields *)mColumns[columnIndex])[index] = ((Fields *)mColumns[columnIndex])[mCount], columnIndex++), ...);
+        }
+
+        /**
+         * Removes the last record.
+         */
+        auto removeLast() -> void {
+            assert(mCount > 0);
+
+            mCount--;
+        }
+
+        /**
+         * Removes all the records from the list.
+         */
+        auto removeAll() -> void {
+            mCount = 0;
+        }
+
+        /**
+         * Grows the amount of uninitialized records in preparation for an
+         * append-operation.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] amount The least amount of uninitialized records that
+         * must exists in the list.
+         * @return Whether the request succeeded.
+         */
+        auto reserve(MemoryAllocator memoryAllocator, int64_t amount) -> Status {
+            auto newCapacity = Bytes::growCapacity(mCapacity, mCount, amount);
+            if (newCapacity == mCapacity) {
+                return Status::eSuccess;
+            }
+
+            // Every column moves as their offsets depend on the capacity; so,
+            // this allocates a new block instead of reallocating.
+            auto newBlockResult = memoryAllocator.allocate(getBlockSize(newCapacity), kColumnAlignment);
+            if (newBlockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            auto newBlock = (uint8_t *)*newBlockResult.value();
+
+            auto columnIndex = 0;
+            auto offset = INT64_C(0);
+            ((mColumns[columnIndex] = moveColumn(newBlock + offset, mColumns[columnIndex], (int64_t)sizeof(Fields)),
+              offset += getColumnSize(newCapacity, (int64_t)sizeof(Fields)),
+              columnIndex++),
+             ...);
+
+            memoryAllocator.deallocate(mBlock, getBlockSize(mCapacity), kColumnAlignment);
+            mBlock = newBlock;
+            mCapacity = newCapacity;
+            return Status::eSuccess;
+        }
+
+        /**
+         * Marks some amount of leading uninitialized records as initialized.
+         *
+         * @param[in] amount The amount of uninitialized records that will be
+         * marked as initialized.
+         */
+        auto acknowledge(int64_t amount) -> void {
+            assert(amount >= 0);
+            assert(amount <= mCapacity - mCount);
+
+            mCount += amount;
+        }
+
+    private:
+        /**
+         * Pointer to the backing memory.
+         *
+         * @warning `nullptr` if there are no allocated records.
+         */
+        void *mBlock;
+
+        /**
+         * Pointers to the beginnings of the columns in the backing memory.
+         */
+        void *mColumns[sizeof...(Fields)];
+
+        /**
+         * The amount of allocated records.
+         */
+        int64_t mCapacity;
+
+        /**
+         * The amount of initialized records.
+         */
+        int64_t mCount;
+
+        static auto getColumnSize(int64_t capacity, int64_t fieldSize) -> int64_t {
+            assert(capacity <= INT64_MAX / fieldSize);
+
+            return Bytes::alignUpwards(capacity * fieldSize, kColumnAlignment);
+        }
+
+        static auto getBlockSize(int64_t capacity) -> int64_t {
+            return (getColumnSize(capacity, (int64_t)sizeof(Fields)) + ...);
+        }
+
+        auto moveColumn(void *newColumn, void *oldColumn, int64_t fieldSize) -> void * {
+            if (mCount != 0) {
+                Bytes::copyBlock(newColumn, oldColumn, mCount * fieldSize);
+            }
+            return newColumn;
+        }
+    };
+}
@@ -0,0 +1,721 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/RadixSortable.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Utilities for sorting the elements of arrays.
+     */
+    class Sorts {
+    public:
+        /**
+         * Sorts elements in place with a pattern-defeating quicksort.
+         *
+         * The sort is not stable. It runs in linear time on sorted, reversed
+         * and mostly equal inputs, and falls back to heap sort on inputs that
+         * keep producing bad pivots; so, it never takes more than `n log n`
+         * time.
+         *
+         * @tparam Element The type of the elements.
+         * @tparam Comparator The implementation of @ref OrderComparable that
+         * orders the elements.
+         * @param[in,out] view The sorted elements.
+         */
+        template<typename Element, typename Comparator = OrderComparable<Element>>
+        static auto sort(ArrayListView<Element> view) -> void {
+            if (view.getCount() < 2) {
+                return;
+            }
+            auto begin = view.getArray();
+            auto end = begin + view.getCount();
+            sortRecursively<Comparator>(begin, end, getBinaryLogarithm(view.getCount()), true);
+        }
+
+        /**
+         * Sorts elements with a least significant digit radix sort.
+         *
+         * The sort is stable. Every byte of the keys is one digit, and the
+         * digits that are the same for all the elements are skipped.
+         *
+         * @tparam Element The type of the elements.
+         * @tparam Sortable The implementation of @ref RadixSortable that keys
+         * the elements.
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the scratch memory, which is as big as the elements.
+         * @param[in,out] view The sorted elements.
+         * @return Whether the scratch memory could be allocated. On failure,
+         * the elements are not modified.
+         */
+        template<typename Element, typename Sortable = RadixSortable<Element>>
+        static auto sortByRadix(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            using Key = typename Sortable::Key;
+            static constexpr auto kDigitCount = (int64_t)sizeof(Key);
+
+            // Few elements are sorted by insertion, which keeps the sort
+            // stable without the scratch memory.
+            auto count = view.getCount();
+            if (count < kRadixThreshold) {
+                sortByInsertion<KeyComparator<Element, Sortable>>(view.getArray(), view.getArray() + count);
+                return Status::eSuccess;
+            }
+
+            auto scratchResult = memoryAllocator.allocate(count * (int64_t)sizeof(Element), alignof(Element));
+            if (scratchResult.isFailure()) {
+                return Status::eFailure;
+            }
+            auto scratch = (Element *)*scratchResult.value();
+
+            // Count every digit in a single pass over the elements.
+            int64_t offsets[kDigitCount][kBucketCount] = {};
+            auto array = view.getArray();
+            for (auto i = INT64_C(0); i != count; i++) {
+                auto key = Sortable::createKey(array + i);
+                for (auto j = INT64_C(0); j != kDigitCount; j++) {
+                    offsets[j][getDigit(key, j)]++;
+                }
+            }
+
+            auto source = array;
+            auto destination = scratch;
+            auto firstKey = Sortable::createKey(array);
+            for (auto i = INT64_C(0); i != kDigitCount; i++) {
+                if (offsets[i][getDigit(firstKey, i)] == count) {
+                    continue;
+                }
+
+                auto offset = INT64_C(0);
+                for (auto &bucketOffset : offsets[i]) {
+                    auto bucketCount = bucketOffset;
+                    bucketOffset = offset;
+                    offset += bucketCount;
+                }
+                for (auto j = INT64_C(0); j != count; j++) {
+                    auto digit = getDigit(Sortable::createKey(source + j), i);
+                    destination[offsets[i][digit]] = source[j];
+                    offsets[i][digit]++;
+                }
+
+                auto temporary = source;
+                source = destination;
+                destination = temporary;
+            }
+
+            if (source != array) {
+                Bytes::copyArray(array, source, count);
+            }
+            memoryAllocator.deallocate(scratch, count * (int64_t)sizeof(Element), alignof(Element));
+            return Status::eSuccess;
+        }
+
+        /**
+         * Sorts elements in place with a most significant digit radix sort.
+         *
+         * The sort is not stable. Elements are permuted into the buckets of a
+         * digit in place, and each bucket is sorted by the next digit; so, no
+         * scratch memory is needed. Small buckets are finished with
+         * @ref sort.
+         *
+         * @tparam Element The type of the elements.
+         * @tparam Sortable The implementation of @ref RadixSortable that keys
+         * the elements.
+         * @param[in,out] view The sorted elements.
+         */
+        template<typename Element, typename Sortable = RadixSortable<Element>>
+        static auto sortByRadixInPlace(ArrayListView<Element> view) -> void {
+            if (view.getCount() < 2) {
+                return;
+            }
+            sortByRadixRecursively<Sortable>(view.getArray(), view.getCount(), (int64_t)sizeof(typename Sortable::Key) - 1);
+        }
+
+    private:
+        /**
+         * Orders elements by their radix sort keys.
+         */
+        template<typename Element, typename Sortable>
+        class KeyComparator {
+        public:
+            static auto compare(Element *instance0, Element *instance1) -> Ordering {
+                auto key0 = Sortable::createKey(instance0);
+                auto key1 = Sortable::createKey(instance1);
+                if (key0 < key1) {
+                    return Ordering::eLess;
+                }
+                if (key1 < key0) {
+                    return Ordering::eGreater;
+                }
+                return Ordering::eEqual;
+            }
+        };
+
+        /**
+         * The result of partitioning around a pivot.
+         */
+        template<typename Element>
+        struct Partition {
+            /**
+             * Pointer to the pivot at its final place.
+             */
+            Element *pivot;
+
+            /**
+             * Whether no elements had to be swapped.
+             */
+            bool wasPartitioned;
+        };
+
+        /**
+         * The amount of elements below which insertion sort is used.
+         */
+        static constexpr auto kInsertionSortThreshold = INT64_C(24);
+
+        /**
+         * The amount of elements above which the pivot is a median of three
+         * medians.
+         */
+        static constexpr auto kNintherThreshold = INT64_C(128);
+
+        /**
+         * The amount of moves after which an insertion sort of a partition
+         * that looked sorted gives up.
+         */
+        static constexpr auto kPartialInsertionSortLimit = INT64_C(8);
+
+        /**
+         * The amount of elements in each block of the branchless partition.
+         */
+        static constexpr auto kBlockCount = INT64_C(64);
+
+        /**
+         * The amount of elements below which radix sorts use @ref sort.
+         */
+        static constexpr auto kRadixThreshold = INT64_C(64);
+
+        /**
+         * The amount of values a digit has.
+         */
+        static constexpr auto kBucketCount = INT64_C(256);
+
+        static auto getBinaryLogarithm(int64_t value) -> int64_t {
+            return 63 - __builtin_clzll((uint64_t)value);
+        }
+
+        template<typename Key>
+        static auto getDigit(Key key, int64_t digitIndex) -> int64_t {
+            return (int64_t)((uint64_t)(key >> (uint64_t)(8 * digitIndex)) & 0xFFU);
+        }
+
+        template<typename Comparator, typename Element>
+        static auto isLess(Element *element0, Element *element1) -> bool {
+            return Comparator::compare(element0, element1) == Ordering::eLess;
+        }
+
+        template<typename Element>
+        static auto swap(Element *element0, Element *element1) -> void {
+            auto temporary = *element0;
+            *element0 = *element1;
+            *element1 = temporary;
+        }
+
+        template<typename Comparator, typename Element>
+        static auto sortRecursively(Element *begin, Element *end, int64_t badPartitionLimit, bool isLeftmost) -> void {
+            // The larger partitions are handled in the loop, which bounds the
+            // recursion depth logarithmically.
+            while (true) {
+                auto count = end - begin;
+                if (count < kInsertionSortThreshold) {
+                    if (isLeftmost) {
+                        sortByInsertion<Comparator>(begin, end);
+                    } else {
+                        sortByUnguardedInsertion<Comparator>(begin, end);
+                    }
+                    return;
+                }
+
+                auto half = count / 2;
+                if (count > kNintherThreshold) {
+                    sortThree<Comparator>(begin, begin + half, end - 1);
+                    sortThree<Comparator>(begin + 1, begin + (half - 1), end - 2);
+                    sortThree<Comparator>(begin + 2, begin + (half + 1), end - 3);
+                    sortThree<Comparator>(begin + (half - 1), begin + half, begin + (half + 1));
+                    swap(begin, begin + half);
+                } else {
+                    sortThree<Comparator>(begin + half, begin, end - 1);
+                }
+
+                // The element before a partition that is not the leftmost one
+                // is its previous pivot, which is not greater than any of its
+                // elements. If it is equal to the new pivot, the elements that
+                // are equal to it are gathered on the left and skipped, which
+                // makes inputs with many duplicates take linear time.
+                if (!isLeftmost && !isLess<Comparator>(begin - 1, begin)) {
+                    begin = partitionLeft<Comparator>(begin, end) + 1;
+                    continue;
+                }
+
+                Partition<Element> partition;
+                if constexpr (sizeof(Element) <= sizeof(uint64_t)) {
+                    partition = partitionRightWithoutBranches<Comparator>(begin, end);
+                } else {
+                    partition = partitionRight<Comparator>(begin, end);
+                }
+                auto pivot = partition.pivot;
+                auto leftCount = pivot - begin;
+                auto rightCount = end - (pivot + 1);
+
+                if (leftCount < count / 8 || rightCount < count / 8) {
+                    badPartitionLimit--;
+                    if (badPartitionLimit == 0) {
+                        sortByHeap<Comparator>(begin, end);
+                        return;
+                    }
+
+                    // Shuffle a few elements so that the next pivots are
+                    // picked from elsewhere, which breaks patterns that
+                    // defeat the median selection.
+                    if (leftCount >= kInsertionSortThreshold) {
+                        swap(begin, begin + leftCount / 4);
+                        swap(pivot - 1, pivot - leftCount / 4);
+                        if (leftCount > kNintherThreshold) {
+                            swap(begin + 1, begin + (leftCount / 4 + 1));
+                            swap(begin + 2, begin + (leftCount / 4 + 2));
+                            swap(pivot - 2, pivot - (leftCount / 4 + 1));
+                            swap(pivot - 3, pivot - (leftCount / 4 + 2));
+                        }
+                    }
+                    if (rightCount >= kInsertionSortThreshold) {
+                        swap(pivot + 1, pivot + (1 + rightCount / 4));
+                        swap(end - 1, end - rightCount / 4);
+                        if (rightCount > kNintherThreshold) {
+                            swap(pivot + 2, pivot + (2 + rightCount / 4));
+                            swap(pivot + 3, pivot + (3 + rightCount / 4));
+                            swap(end - 2, end - (1 + rightCount / 4));
+                            swap(end - 3, end - (2 + rightCount / 4));
+                        }
+                    }
+                } else if (partition.wasPartitioned && sortByPartialInsertion<Comparator>(begin, pivot) && sortByPartialInsertion<Comparator>(pivot + 1, end)) {
+                    // A balanced partition that needed no swaps hints at a
+                    // sorted input, which is confirmed cheaply.
+                    return;
+                }
+
+                sortRecursively<Comparator>(begin, pivot, badPartitionLimit, isLeftmost);
+                begin = pivot + 1;
+                isLeftmost = false;
+            }
+        }
+
+        template<typename Comparator, typename Element>
+        static auto sortThree(Element *element0, Element *element1, Element *element2) -> void {
+            if (isLess<Comparator>(element1, element0)) {
+                swap(element0, element1);
+            }
+            if (isLess<Comparator>(element2, element1)) {
+                swap(element1, element2);
+                if (isLess<Comparator>(element1, element0)) {
+                    swap(element0, element1);
+                }
+            }
+        }
+
+        template<typename Comparator, typename Element>
+        static auto sortByInsertion(Element *begin, Element *end) -> void {
+            if (begin == end) {
+                return;
+            }
+            for (auto current = begin + 1; current != end; current++) {
+                if (!isLess<Comparator>(current, current - 1)) {
+                    continue;
+                }
+                auto element = *current;
+                auto hole = current;
+                do {
+                    *hole = *(hole - 1);
+                    hole--;
+                } while (hole != begin && isLess<Comparator>(&element, hole - 1));
+                *hole = element;
+            }
+        }
+
+        /**
+         * Sorts by insertion without checking the beginning, which requires an
+         * element before the beginning that is not greater than any sorted
+         * one.
+         */
+        template<typename Comparator, typename Element>
+        static auto sortByUnguardedInsertion(Element *begin, Element *end) -> void {
+            if (begin == end) {
+                return;
+            }
+            for (auto current = begin + 1; current != end; current++) {
+                if (!isLess<Comparator>(current, current - 1)) {
+                    continue;
+                }
+                auto element = *current;
+                auto hole = current;
+                do {
+                    *hole = *(hole - 1);
+                    hole--;
+                } while (isLess<Comparator>(&element, hole - 1));
+                *hole = element;
+            }
+        }
+
+        /**
+         * Sorts by insertion unless it takes too many moves.
+         *
+         * @return Whether the elements were sorted.
+         */
+        template<typename Comparator, typename Element>
+        static auto sortByPartialInsertion(Element *begin, Element *end) -> bool {
+            if (begin == end) {
+                return true;
+            }
+            auto moveCount = INT64_C(0);
+            for (auto current = begin + 1; current != end; current++) {
+                if (!isLess<Comparator>(current, current - 1)) {
+                    continue;
+                }
+                auto element = *current;
+                auto hole = current;
+                do {
+                    *hole = *(hole - 1);
+                    hole--;
+                } while (hole != begin && isLess<Comparator>(&element, hole - 1));
+                *hole = element;
+
+                moveCount += current - hole;
+                if (moveCount > kPartialInsertionSortLimit) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Partitions around the first element, putting the ones that are equal
+         * to it on the right.
+         */
+        template<typename Comparator, typename Element>
+        static auto partitionRight(Element *begin, Element *end) -> Partition<Element> {
+            auto pivot = *begin;
+            auto first = begin;
+            auto last = end;
+
+            // The median selection guarantees an element that is not less than
+            // the pivot on the right; so, the first scan needs no bound.
+            do {
+                first++;
+            } while (isLess<Comparator>(first, &pivot));
+            if (first - 1 == begin) {
+                do {
+                    last--;
+                } while (first < last && !isLess<Comparator>(last, &pivot));
+            } else {
+                do {
+                    last--;
+                } while (!isLess<Comparator>(last, &pivot));
+            }
+
+            auto wasPartitioned = first >= last;
+            while (first < last) {
+                swap(first, last);
+                do {
+                    first++;
+                } while (isLess<Comparator>(first, &pivot));
+                do {
+                    last--;
+                } while (!isLess<Comparator>(last, &pivot));
+            }
+
+            auto pivotPosition = first - 1;
+            *begin = *pivotPosition;
+            *pivotPosition = pivot;
+
+            Partition<Element> partition;
+            partition.pivot = pivotPosition;
+            partition.wasPartitioned = wasPartitioned;
+            return partition;
+        }
+
+        /**
+         * Partitions like @ref partitionRight, but compares a block of elements
+         * from each side into lists of misplaced offsets before swapping them,
+         * which turns the comparisons into data instead of branches.
+         */
+        template<typename Comparator, typename Element>
+        static auto partitionRightWithoutBranches(Element *begin, Element *end) -> Partition<Element> {
+            auto pivot = *begin;
+            auto first = begin;
+            auto last = end;
+
+            do {
+                first++;
+            } while (isLess<Comparator>(first, &pivot));
+            if (first - 1 == begin) {
+                do {
+                    last--;
+                } while (first < last && !isLess<Comparator>(last, &pivot));
+            } else {
+                do {
+                    last--;
+                } while (!isLess<Comparator>(last, &pivot));
+            }
+
+            auto wasPartitioned = first >= last;
+            if (!wasPartitioned) {
+                swap(first, last);
+                first++;
+
+                alignas(64) uint8_t leftOffsets[kBlockCount];
+                alignas(64) uint8_t rightOffsets[kBlockCount];
+                auto leftBase = first;
+                auto rightBase = last;
+                auto leftCount = INT64_C(0);
+                auto rightCount = INT64_C(0);
+                auto leftStart = INT64_C(0);
+                auto rightStart = INT64_C(0);
+                while (first < last) {
+                    // Fill the side whose offsets ran out, splitting the rest
+                    // of the elements if both did.
+                    auto unknownCount = last - first;
+                    auto leftSplit = INT64_C(0);
+                    if (leftCount == 0) {
+                        leftSplit = rightCount == 0 ? unknownCount / 2 : unknownCount;
+                    }
+                    auto rightSplit = rightCount == 0 ? unknownCount - leftSplit : INT64_C(0);
+                    if (leftSplit > kBlockCount) {
+                        leftSplit = kBlockCount;
+                    }
+                    if (rightSplit > kBlockCount) {
+                        rightSplit = kBlockCount;
+                    }
+
+                    for (auto i = INT64_C(0); i != leftSplit; i++) {
+                        leftOffsets[leftCount] = (uint8_t)i;
+                        leftCount += isLess<Comparator>(first, &pivot) ? 0 : 1;
+                        first++;
+                    }
+                    for (auto i = INT64_C(0); i != rightSplit; i++) {
+                        last--;
+                        rightOffsets[rightCount] = (uint8_t)(i + 1);
+                        rightCount += isLess<Comparator>(last, &pivot) ? 1 : 0;
+                    }
+
+                    auto swapCount = leftCount < rightCount ? leftCount : rightCount;
+                    swapOffsets(leftBase, rightBase, leftOffsets + leftStart, rightOffsets + rightStart, swapCount, leftCount == rightCount);
+                    leftCount -= swapCount;
+                    rightCount -= swapCount;
+                    leftStart += swapCount;
+                    rightStart += swapCount;
+                    if (leftCount == 0) {
+                        leftStart = 0;
+                        leftBase = first;
+                    }
+                    if (rightCount == 0) {
+                        rightStart = 0;
+                        rightBase = last;
+                    }
+                }
+
+                // Move the misplaced elements of the side that has some left
+                // to the boundary.
+                if (leftCount != 0) {
+                    while (leftCount != 0) {
+                        leftCount--;
+                        last--;
+                        swap(leftBase + leftOffsets[leftStart + leftCount], last);
+                    }
+                    first = last;
+                }
+                if (rightCount != 0) {
+                    while (rightCount != 0) {
+                        rightCount--;
+                        swap(rightBase - rightOffsets[rightStart + rightCount], first);
+                        first++;
+                    }
+                }
+            }
+
+            auto pivotPosition = first - 1;
+            *begin = *pivotPosition;
+            *pivotPosition = pivot;
+
+            Partition<Element> partition;
+            partition.pivot = pivotPosition;
+            partition.wasPartitioned = wasPartitioned;
+            return partition;
+        }
+
+        /**
+         * Swaps pairs of misplaced elements, as a single cycle of moves when
+         * the pairs do not need to stay distinct.
+         */
+        template<typename Element>
+        static auto swapOffsets(Element *leftBase, Element *rightBase, uint8_t *leftOffsets, uint8_t *rightOffsets, int64_t count, bool usesSwaps) -> void {
+            if (usesSwaps) {
+                for (auto i = INT64_C(0); i != count; i++) {
+                    swap(leftBase + leftOffsets[i], rightBase - rightOffsets[i]);
+                }
+                return;
+            }
+            if (count == 0) {
+                return;
+            }
+            auto left = leftBase + leftOffsets[0];
+            auto right = rightBase - rightOffsets[0];
+            auto temporary = *left;
+            *left = *right;
+            for (auto i = INT64_C(1); i != count; i++) {
+                left = leftBase + leftOffsets[i];
+                *right = *left;
+                right = rightBase - rightOffsets[i];
+                *left = *right;
+            }
+            *right = temporary;
+        }
+
+        /**
+         * Partitions around the first element, putting the ones that are equal
+         * to it on the left.
+         */
+        template<typename Comparator, typename Element>
+        static auto partitionLeft(Element *begin, Element *end) -> Element * {
+            auto pivot = *begin;
+            auto first = begin;
+            auto last = end;
+
+            do {
+                last--;
+            } while (isLess<Comparator>(&pivot, last));
+            if (last + 1 == end) {
+                do {
+                    first++;
+                } while (first < last && !isLess<Comparator>(&pivot, first));
+            } else {
+                do {
+                    first++;
+                } while (!isLess<Comparator>(&pivot, first));
+            }
+
+            while (first < last) {
+                swap(first, last);
+                do {
+                    last--;
+                } while (isLess<Comparator>(&pivot, last));
+                do {
+                    first++;
+                } while (!isLess<Comparator>(&pivot, first));
+            }
+
+            *begin = *last;
+            *last = pivot;
+            return last;
+        }
+
+        template<typename Comparator, typename Element>
+        static auto sortByHeap(Element *begin, Element *end) -> void {
+            auto count = end - begin;
+            for (auto i = count / 2 - 1; i >= 0; i--) {
+                siftDown<Comparator>(begin, i, count);
+            }
+            for (auto i = count - 1; i > 0; i--) {
+                swap(begin, begin + i);
+                siftDown<Comparator>(begin, 0, i);
+            }
+        }
+
+        template<typename Comparator, typename Element>
+        static auto siftDown(Element *array, int64_t index, int64_t count) -> void {
+            auto element = array[index];
+            while (true) {
+                auto child = 2 * index + 1;
+                if (child >= count) {
+                    break;
+                }
+                if (child + 1 < count && isLess<Comparator>(array + child, array + child + 1)) {
+                    child++;
+                }
+                if (!isLess<Comparator>(&element, array + child)) {
+                    break;
+                }
+                array[index] = array[child];
+                index = child;
+            }
+            array[index] = element;
+        }
+
+        template<typename Sortable, typename Element>
+        static auto sortByRadixRecursively(Element *array, int64_t count, int64_t digitIndex) -> void {
+            while (true) {
+                if (count < kRadixThreshold) {
+                    ArrayListView<Element> view;
+                    view.initialize(array, count);
+                    sort<Element, KeyComparator<Element, Sortable>>(view);
+                    return;
+                }
+
+                int64_t ends[kBucketCount] = {};
+                for (auto i = INT64_C(0); i != count; i++) {
+                    ends[getDigit(Sortable::createKey(array + i), digitIndex)]++;
+                }
+
+                // Skip the digits that are the same for all the elements.
+                if (ends[getDigit(Sortable::createKey(array), digitIndex)] == count) {
+                    if (digitIndex == 0) {
+                        return;
+                    }
+                    digitIndex--;
+                    continue;
+                }
+
+                int64_t heads[kBucketCount];
+                auto offset = INT64_C(0);
+                for (auto i = INT64_C(0); i != kBucketCount; i++) {
+                    heads[i] = offset;
+                    offset += ends[i];
+                    ends[i] = offset;
+                }
+
+                // Carry each misplaced element to the head of its bucket,
+                // picking up the element there, until one that belongs to the
+                // current bucket comes back.
+                for (auto i = INT64_C(0); i != kBucketCount; i++) {
+                    while (heads[i] < ends[i]) {
+                        auto element = array[heads[i]];
+                        auto digit = getDigit(Sortable::createKey(&element), digitIndex);
+                        while (digit != i) {
+                            auto displaced = array[heads[digit]];
+                            array[heads[digit]] = element;
+                            heads[digit]++;
+                            element = displaced;
+                            digit = getDigit(Sortable::createKey(&element), digitIndex);
+                        }
+                        array[heads[i]] = element;
+                        heads[i]++;
+                    }
+                }
+
+                if (digitIndex == 0) {
+                    return;
+                }
+                auto begin = INT64_C(0);
+                for (auto end : ends) {
+                    if (end - begin > 1) {
+                        sortByRadixRecursively<Sortable>(array + begin, end - begin, digitIndex - 1);
+                    }
+                    begin = end;
+                }
+                return;
+            }
+        }
+    };
+}
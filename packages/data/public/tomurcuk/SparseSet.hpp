@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Set of integers in a fixed range with constant time operations and
+     * dense iteration.
+     *
+     * The members are kept densely packed, and a sparse array maps each
+     * integer to its place among them. The sparse array is zeroed when the
+     * range grows, and a member is recognized by the two arrays pointing to
+     * each other; so, the stale entries of removed members are harmless, and
+     * removing all the members only forgets their count.
+     */
+    class SparseSet {
+    public:
+        /**
+         * Creates a new set that has an empty range.
+         */
+        auto initialize() -> void;
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Grows the range of the integers.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] universeSize The amount of integers the set can hold,
+         * which must not be less than the current one.
+         * @return Whether the request succeeded.
+         */
+        auto resize(MemoryAllocator memoryAllocator, int64_t universeSize) -> Status;
+
+        /**
+         * Provides the range of the integers.
+         *
+         * @return The amount of integers the set can hold.
+         */
+        auto getUniverseSize() -> int64_t;
+
+        /**
+         * Provides the members in no particular order.
+         *
+         * @warning The set must not be modified while the view is used.
+         *
+         * @return A view that refers to the densely packed members.
+         */
+        auto getView() -> ArrayListView<uint32_t>;
+
+        /**
+         * Provides the amount of members.
+         *
+         * @return The amount of integers in the set.
+         */
+        auto getCount() -> int64_t;
+
+        /**
+         * Tests whether there are no members.
+         *
+         * @return Whether there are no integers in the set.
+         */
+        auto isEmpty() -> bool;
+
+        /**
+         * Tests whether an integer is in the set.
+         *
+         * @param[in] value The tested integer.
+         * @return Whether the integer is a member.
+         */
+        auto contains(uint32_t value) -> bool;
+
+        /**
+         * Adds an integer to the set.
+         *
+         * @param[in] value The added integer.
+         * @return Whether the integer was not already a member.
+         */
+        auto insert(uint32_t value) -> bool;
+
+        /**
+         * Removes an integer from the set.
+         *
+         * Moves the last member into the place of the removed one.
+         *
+         * @param[in] value The removed integer.
+         * @return Whether the integer was a member.
+         */
+        auto remove(uint32_t value) -> bool;
+
+        /**
+         * Removes all the integers from the set in constant time.
+         */
+        auto removeAll() -> void;
+
+    private:
+        /**
+         * Pointer to the members, which is also the beginning of the backing
+         * memory.
+         *
+         * @warning `nullptr` if the range is empty.
+         */
+        uint32_t *mDense;
+
+        /**
+         * Pointer to the places of the integers among the members.
+         *
+         * @warning Only the entries of the members are initialized.
+         */
+        uint32_t *mSparse;
+
+        /**
+         * The amount of integers the set can hold.
+         */
+        int64_t mUniverseSize;
+
+        /**
+         * The amount of members.
+         */
+        int64_t mCount;
+    };
+}
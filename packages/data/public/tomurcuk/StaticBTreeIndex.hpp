@@ -0,0 +1,209 @@
+#pragma once
+
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/KeySearch.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Index of elements that do not change after it is built, for finding
+     * elements by their order.
+     *
+     * @tparam Element The type of the elements.
+     * @tparam Comparator The implementation of @ref OrderComparable that
+     * orders the elements.
+     *
+     * The sorted elements are laid out like a B-tree without pointers, where
+     * every node is a cache line of @ref kNodeCapacity elements, and the
+     * children of node `k` are the nodes from `k * (kNodeCapacity + 1) + 1`
+     * on. A search reads a single cache line on every level, and there are
+     * fewer levels than in an @ref EytzingerIndex. Integer elements with the
+     * default order are compared by @ref KeySearch, a whole node at a time.
+     */
+    template<typename Element, typename Comparator = OrderComparable<Element>>
+    class StaticBTreeIndex {
+    public:
+        /**
+         * The amount of elements in every node but the last one.
+         */
+        static constexpr auto kNodeCapacity = sizeof(Element) <= 32 ? 64 / (int64_t)sizeof(Element) : INT64_C(2);
+
+        /**
+         * The alignment of the backing memory, which is a cache line.
+         */
+        static constexpr auto kBlockAlignment = alignof(Element) > 64 ? (int64_t)alignof(Element) : INT64_C(64);
+
+        /**
+         * Creates a new index that is empty.
+         */
+        auto initialize() -> void {
+            mBlock = nullptr;
+            mCount = 0;
+            mNodeCount = 0;
+        }
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void {
+            if (mBlock != nullptr) {
+                memoryAllocator.deallocate(mBlock, mCount * (int64_t)sizeof(Element), kBlockAlignment);
+            }
+        }
+
+        /**
+         * Provides the amount of elements.
+         *
+         * @return The amount of elements in the index.
+         */
+        auto getCount() -> int64_t {
+            return mCount;
+        }
+
+        /**
+         * Tests whether there are no elements.
+         *
+         * @return Whether there are no elements in the index.
+         */
+        auto isEmpty() -> bool {
+            return mCount == 0;
+        }
+
+        /**
+         * Copies the elements of an empty index from a sorted view.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] view The elements, in ascending order.
+         * @return Whether the operation succeeded. On failure, the index is
+         * still empty.
+         */
+        auto build(MemoryAllocator memoryAllocator, ArrayListView<Element> view) -> Status {
+            assert(mBlock == nullptr);
+
+            if (view.isEmpty()) {
+                return Status::eSuccess;
+            }
+            for (auto i = INT64_C(1); i < view.getCount(); i++) {
+                assert(Comparator::compare(view.get(i), view.get(i - 1)) != Ordering::eLess);
+            }
+
+            auto blockResult = memoryAllocator.allocate(view.getCount() * (int64_t)sizeof(Element), kBlockAlignment);
+            if (blockResult.isFailure()) {
+                return Status::eFailure;
+            }
+            mBlock = (Element *)*blockResult.value();
+            mCount = view.getCount();
+            mNodeCount = (mCount + kNodeCapacity - 1) / kNodeCapacity;
+            auto sortedIndex = INT64_C(0);
+            fill(view.getArray(), &sortedIndex, 0);
+            return Status::eSuccess;
+        }
+
+        /**
+         * Finds the least element that is not less than an element.
+         *
+         * @param[in] element The searched element.
+         * @return The pointer to the found element if there is one. Otherwise,
+         * `nullptr`.
+         */
+        auto findLowerBound(Element element) -> Element * {
+            auto array = (Element *)__builtin_assume_aligned(mBlock, kBlockAlignment);
+            Element *found = nullptr;
+            auto node = INT64_C(0);
+            while (node < mNodeCount) {
+                // Only the last node is not full, and it has no children.
+                auto begin = node * kNodeCapacity;
+                auto count = mCount - begin < kNodeCapacity ? mCount - begin : kNodeCapacity;
+                auto index = countLess(array + begin, count, &element);
+                if (index != count) {
+                    found = array + begin + index;
+                }
+                node = node * (kNodeCapacity + 1) + index + 1;
+            }
+            return found;
+        }
+
+        /**
+         * Finds an element that is equal to an element.
+         *
+         * @param[in] element The searched element.
+         * @return The pointer to the found element if there is one. Otherwise,
+         * `nullptr`.
+         */
+        auto find(Element element) -> Element * {
+            auto found = findLowerBound(element);
+            if (found == nullptr || Comparator::compare(found, &element) != Ordering::eEqual) {
+                return nullptr;
+            }
+            return found;
+        }
+
+    private:
+        /**
+         * Whether the elements are compared by @ref KeySearch.
+         */
+        static constexpr auto kIsSearchable = __is_same(Comparator, OrderComparable<Element>) && KeySearch::kIsSupported<Element>;
+
+        /**
+         * Pointer to the backing memory, which holds the nodes one after the
+         * other.
+         *
+         * @warning `nullptr` if there are no elements.
+         */
+        Element *mBlock;
+
+        /**
+         * The amount of elements.
+         */
+        int64_t mCount;
+
+        /**
+         * The amount of nodes.
+         */
+        int64_t mNodeCount;
+
+        /**
+         * Counts the elements of a node that are less than an element, which
+         * is the index of the child the element belongs to.
+         */
+        static auto countLess(Element *elements, int64_t count, Element *element) -> int64_t {
+            if constexpr (kIsSearchable) {
+                return KeySearch::countLess(elements, count, *element);
+            } else {
+                auto lessCount = INT64_C(0);
+                for (auto i = INT64_C(0); i != count; i++) {
+                    lessCount += Comparator::compare(elements + i, element) == Ordering::eLess ? 1 : 0;
+                }
+                return lessCount;
+            }
+        }
+
+        /**
+         * Fills the subtree of a node by visiting it in order.
+         */
+        auto fill(Element *sortedArray, int64_t *sortedIndex, int64_t node) -> void {
+            if (node >= mNodeCount) {
+                return;
+            }
+            auto firstChild = node * (kNodeCapacity + 1) + 1;
+            for (auto i = INT64_C(0); i != kNodeCapacity; i++) {
+                fill(sortedArray, sortedIndex, firstChild + i);
+                auto index = node * kNodeCapacity + i;
+                if (index < mCount) {
+                    mBlock[index] = sortedArray[*sortedIndex];
+                    (*sortedIndex)++;
+                }
+            }
+            fill(sortedArray, sortedIndex, firstChild + kNodeCapacity);
+        }
+    };
+}
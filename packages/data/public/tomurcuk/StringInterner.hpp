@@ -0,0 +1,164 @@
+#pragma once
+
+#include <stdint.h>
+#include <threads.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    struct StringInternerShard;
+
+    /**
+     * Table that maps every distinct string to a 32-bit symbol, so that the
+     * strings are compared by comparing their symbols and hashed by using
+     * them.
+     *
+     * The characters are copied into memory that is reserved up front and
+     * never moved; so, the strings a symbol resolves to stay valid until the
+     * interner is destroyed.
+     *
+     * An interner with a single shard is not synchronized, and its symbols
+     * are `0`, `1`, `2`, ... in the order the strings were first interned. An
+     * interner with multiple shards can be used from multiple threads: every
+     * string belongs to the shard its hash selects, every shard has its own
+     * lock and characters, and symbol `s` is string `s / shardCount` of shard
+     * `s % shardCount`. So, the symbols are dense within each shard and
+     * interleaved across them, but which string gets which symbol depends on
+     * the order of the threads.
+     */
+    class StringInterner {
+    public:
+        /**
+         * The most shards an interner has.
+         */
+        static constexpr auto kMaxShardCount = INT64_C(64);
+
+        /**
+         * Creates a new interner that has no strings.
+         *
+         * @param[in,out] memoryAllocator The allocator that will provide the
+         * memory of the shards.
+         * @param[in] characterCapacity The most bytes of characters each shard
+         * holds, which are reserved but not committed.
+         * @param[in] shardCount The amount of shards, from `1` to
+         * @ref kMaxShardCount.
+         * @return The interner if the memory could be allocated.
+         */
+        static auto create(MemoryAllocator memoryAllocator, int64_t characterCapacity, int64_t shardCount) -> Result<StringInterner>;
+
+        /**
+         * Deallocates the backing memory, including the characters of the
+         * strings.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Provides the amount of shards.
+         *
+         * @return The amount of shards the interner was created with.
+         */
+        auto getShardCount() -> int64_t;
+
+        /**
+         * Provides the amount of strings.
+         *
+         * @return The amount of distinct strings that were interned.
+         */
+        auto getCount() -> int64_t;
+
+        /**
+         * Finds the symbol of a string, and interns the string if it does not
+         * have one.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the tables. With multiple shards, the interner
+         * serializes its own uses of it.
+         * @param[in] string The characters of the string, which are copied.
+         * @return The symbol of the string if it could be interned.
+         */
+        auto intern(MemoryAllocator memoryAllocator, ArrayListView<char> string) -> Result<uint32_t>;
+
+        /**
+         * Finds the symbols of strings, and interns the strings that do not
+         * have one.
+         *
+         * The strings are hashed ahead of their lookups, and each shard is
+         * locked once for every group of strings that belong to it.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the tables. With multiple shards, the interner
+         * serializes its own uses of it.
+         * @param[in] strings The strings, whose characters are copied.
+         * @param[out] symbols The symbols of the strings, whose count is the
+         * amount of strings.
+         * @return Whether all the strings could be interned. On failure, some
+         * of the strings might be interned.
+         */
+        auto internAll(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char>> strings, ArrayListView<uint32_t> symbols) -> Status;
+
+        /**
+         * Finds the symbol of a string without interning it.
+         *
+         * @param[in] string The characters of the string.
+         * @return The symbol of the string if it was interned.
+         */
+        auto find(ArrayListView<char> string) -> Result<uint32_t>;
+
+        /**
+         * Provides the string of a symbol.
+         *
+         * @param[in] symbol The symbol that was returned by the interner.
+         * @return The view of the characters of the string, which stay valid
+         * until the interner is destroyed.
+         */
+        auto resolve(uint32_t symbol) -> ArrayListView<char>;
+
+    private:
+        /**
+         * The amount of strings that are hashed ahead of their lookups.
+         */
+        static constexpr auto kBatchCount = INT64_C(64);
+
+        /**
+         * The most strings of a shard, whose indices plus one and preferred
+         * buckets fit in the halves of a bucket.
+         */
+        static constexpr auto kMaxShardStringCount = INT64_C(1) << 31U;
+
+        /**
+         * Pointer to the shards.
+         */
+        StringInternerShard *mShards;
+
+        /**
+         * The amount of shards.
+         */
+        int64_t mShardCount;
+
+        /**
+         * Pointer to the lock that is held while the memory allocator is
+         * used.
+         *
+         * @warning `nullptr` if there is a single shard.
+         */
+        mtx_t *mAllocatorMutex;
+
+        auto getShardIndex(uint64_t hash) -> int64_t;
+        auto lockShard(StringInternerShard *shard) -> void;
+        auto unlockShard(StringInternerShard *shard) -> void;
+        auto reallocate(MemoryAllocator memoryAllocator, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *>;
+        auto allocateZeroed(MemoryAllocator memoryAllocator, int64_t newSize, int64_t alignment) -> Result<void *>;
+        auto deallocate(MemoryAllocator memoryAllocator, void *oldBlock, int64_t oldSize, int64_t alignment) -> void;
+
+        auto findIndex(StringInternerShard *shard, uint64_t hash, ArrayListView<char> string) -> int64_t;
+        auto internIndex(MemoryAllocator memoryAllocator, StringInternerShard *shard, uint64_t hash, ArrayListView<char> string) -> int64_t;
+        auto growStrings(MemoryAllocator memoryAllocator, StringInternerShard *shard) -> Status;
+        auto growBuckets(MemoryAllocator memoryAllocator, StringInternerShard *shard) -> Status;
+        auto insertBucket(StringInternerShard *shard, uint64_t bucket) -> void;
+    };
+}
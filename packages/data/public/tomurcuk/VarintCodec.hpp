@@ -0,0 +1,115 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Codec that stores unsigned integers in LEB128 form, which takes fewer
+     * bytes for smaller integers.
+     *
+     * Every byte holds 7 bits of an integer, from the least significant ones
+     * on, and its highest bit is set unless it is the last byte of the
+     * integer; so, integers less than `128` take a single byte, which suits
+     * the gaps between sorted IDs.
+     *
+     * Decoding 32-bit integers has a portable implementation and an AVX2 one,
+     * which finds the ends of the integers in 32 bytes at a time and widens
+     * runs of single-byte integers directly; the fastest one the processor
+     * supports is selected on the first use.
+     */
+    class VarintCodec {
+    public:
+        /**
+         * The most bytes a 32-bit integer takes.
+         */
+        static constexpr auto kMaxSize32 = INT64_C(5);
+
+        /**
+         * The most bytes a 64-bit integer takes.
+         */
+        static constexpr auto kMaxSize64 = INT64_C(10);
+
+        /**
+         * Appends the encodings of 32-bit integers.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the bytes.
+         * @param[in,out] bytes The list the encoded bytes are appended to.
+         * @param[in] values The encoded integers.
+         * @return Whether the operation succeeded. On failure, the bytes are
+         * not changed.
+         */
+        static auto encode(MemoryAllocator memoryAllocator, ArrayList<uint8_t> *bytes, ArrayListView<uint32_t> values) -> Status;
+
+        /**
+         * Appends the encodings of 64-bit integers.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the bytes.
+         * @param[in,out] bytes The list the encoded bytes are appended to.
+         * @param[in] values The encoded integers.
+         * @return Whether the operation succeeded. On failure, the bytes are
+         * not changed.
+         */
+        static auto encode(MemoryAllocator memoryAllocator, ArrayList<uint8_t> *bytes, ArrayListView<uint64_t> values) -> Status;
+
+        /**
+         * Decodes 32-bit integers from the beginning of some bytes.
+         *
+         * @param[in] bytes The encoded bytes, which might go on after the
+         * decoded integers.
+         * @param[out] values The decoded integers, whose count is the amount
+         * of decoded integers.
+         * @return The amount of bytes the integers took if they were valid.
+         * Otherwise, `-1`, and some of the integers might have been written.
+         */
+        static auto decode(ArrayListView<uint8_t> bytes, ArrayListView<uint32_t> values) -> int64_t;
+
+        /**
+         * Decodes 64-bit integers from the beginning of some bytes.
+         *
+         * @param[in] bytes The encoded bytes, which might go on after the
+         * decoded integers.
+         * @param[out] values The decoded integers, whose count is the amount
+         * of decoded integers.
+         * @return The amount of bytes the integers took if they were valid.
+         * Otherwise, `-1`, and some of the integers might have been written.
+         */
+        static auto decode(ArrayListView<uint8_t> bytes, ArrayListView<uint64_t> values) -> int64_t;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*decode32)(uint8_t *bytes, int64_t size, uint32_t *values, int64_t count) -> int64_t;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto decode32Portably(uint8_t *bytes, int64_t size, uint32_t *values, int64_t count) -> int64_t;
+        static auto decode32WithAvx2(uint8_t *bytes, int64_t size, uint32_t *values, int64_t count) -> int64_t;
+
+        /**
+         * Writes the encodings of integers to enough memory.
+         *
+         * @return The amount of written bytes.
+         */
+        template<typename Value>
+        static auto encodeAll(uint8_t *bytes, Value *values, int64_t count) -> int64_t;
+
+        /**
+         * Reads the encoding of an integer.
+         *
+         * @return The amount of read bytes if the encoding was valid.
+         * Otherwise, `-1`.
+         */
+        template<typename Value>
+        static auto decodeOne(uint8_t *bytes, int64_t size, Value *value) -> int64_t;
+    };
+}
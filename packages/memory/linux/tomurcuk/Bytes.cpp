@@ -0,0 +1,13 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <tomurcuk/Bytes.hpp>
+
+static_assert(sizeof(size_t) == 8);
+
+auto tomurcuk::Bytes::resetSecretBlock(void *block, int64_t size) -> void {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    explicit_bzero(block, (size_t)size);
+}
@@ -0,0 +1,63 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MirroredBlock.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <unistd.h>
+
+static_assert(sizeof(size_t) == 8);
+
+auto tomurcuk::MirroredBlock::create(int64_t capacity) -> Result<MirroredBlock> {
+    assert(capacity > 0);
+    assert(capacity <= INT64_MAX / 4);
+
+    capacity = alignToAllocationGranularity(capacity);
+
+    // The pages live in an anonymous file, which is the only way to map the
+    // same pages at two addresses.
+    auto file = memfd_create("tomurcuk", MFD_CLOEXEC);
+    if (file == -1) {
+        return Result<MirroredBlock>::failure();
+    }
+    if (ftruncate(file, (off_t)capacity) != 0) {
+        close(file);
+        return Result<MirroredBlock>::failure();
+    }
+
+    // Reserve the whole range first, so that nothing else can be mapped
+    // between the two halves, and then replace each half with the file.
+    auto address = mmap(nullptr, (size_t)capacity * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (address == MAP_FAILED) {
+        close(file);
+        return Result<MirroredBlock>::failure();
+    }
+    auto firstAddress = mmap(address, (size_t)capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file, 0);
+    auto secondAddress = mmap((char *)address + capacity, (size_t)capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, file, 0);
+
+    // The mappings keep the file alive.
+    close(file);
+
+    if (firstAddress == MAP_FAILED || secondAddress == MAP_FAILED) {
+        munmap(address, (size_t)capacity * 2);
+        return Result<MirroredBlock>::failure();
+    }
+
+    MirroredBlock mirroredBlock;
+    mirroredBlock.mAddress = address;
+    mirroredBlock.mCapacity = capacity;
+    return Results::success(mirroredBlock);
+}
+
+auto tomurcuk::MirroredBlock::destroy() -> void {
+    if (munmap(mAddress, (size_t)mCapacity * 2) != 0) {
+        abort();
+    }
+}
+
+auto tomurcuk::MirroredBlock::alignToAllocationGranularity(int64_t amount) -> int64_t {
+    return Bytes::alignUpwards(amount, (int64_t)sysconf(_SC_PAGESIZE));
+}
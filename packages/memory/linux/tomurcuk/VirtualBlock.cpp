@@ -0,0 +1,82 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/VirtualBlock.hpp>
+#include <unistd.h>
+
+static_assert(sizeof(size_t) == 8);
+
+auto tomurcuk::VirtualBlock::create(int64_t capacity) -> Result<VirtualBlock> {
+    assert(capacity >= 0);
+
+    if (capacity == 0) {
+        capacity = alignToAllocationGranularity(1);
+    } else {
+        capacity = alignToAllocationGranularity(capacity);
+    }
+
+    auto address = mmap(nullptr, (size_t)capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (address == MAP_FAILED) {
+        return Result<VirtualBlock>::failure();
+    }
+
+    VirtualBlock virtualBlock;
+    virtualBlock.mAddress = address;
+    virtualBlock.mCapacity = capacity;
+    virtualBlock.mLoad = 0;
+    return Results::success(virtualBlock);
+}
+
+auto tomurcuk::VirtualBlock::destroy() -> void {
+    if (munmap(mAddress, (size_t)mCapacity) != 0) {
+        abort();
+    }
+}
+
+auto tomurcuk::VirtualBlock::reserve(int64_t amount) -> Status {
+    assert(amount >= 0);
+
+    if (mLoad > mCapacity - amount) {
+        return Status::eFailure;
+    }
+
+    auto newLoad = alignToAllocationGranularity(mLoad + amount);
+    auto actualAmount = newLoad - mLoad;
+    if (actualAmount != 0 && mprotect((char *)mAddress + mLoad, (size_t)actualAmount, PROT_READ | PROT_WRITE) != 0) {
+        return Status::eFailure;
+    }
+
+    mLoad = newLoad;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::VirtualBlock::release(int64_t amount) -> Status {
+    assert(amount >= 0);
+    assert(amount <= mLoad);
+
+    // Dropping the pages makes them read as zeros when they are reserved
+    // again, like decommitted pages on the other platforms.
+    auto newLoad = alignToAllocationGranularity(mLoad - amount);
+    auto actualAmount = mLoad - newLoad;
+    if (actualAmount != 0) {
+        if (madvise((char *)mAddress + newLoad, (size_t)actualAmount, MADV_DONTNEED) != 0) {
+            return Status::eFailure;
+        }
+        if (mprotect((char *)mAddress + newLoad, (size_t)actualAmount, PROT_NONE) != 0) {
+            return Status::eFailure;
+        }
+    }
+
+    mLoad = newLoad;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::VirtualBlock::alignToAllocationGranularity(int64_t amount) -> int64_t {
+    return Bytes::alignUpwards(amount, (int64_t)sysconf(_SC_PAGESIZE));
+}
@@ -0,0 +1,123 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/Adler32.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::Adler32::checksum(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    auto kernel = ProcessorFeatures::getKernels<Kernel, &selectKernel>();
+    return kernel(block, size, checksum);
+}
+
+auto tomurcuk::Adler32::combine(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t {
+    assert(size1 >= 0);
+
+    // The first sum of the second block starts from `1` instead of the first
+    // sum of the first block, and the second sum misses the first sum of the
+    // first block for every byte of the second block.
+    auto remainder = (uint32_t)(size1 % kModulus);
+    auto low0 = checksum0 & 0xFFFFU;
+    auto low = low0 + (checksum1 & 0xFFFFU) + kModulus - 1;
+    auto high = (remainder * low0) % kModulus;
+    high += (checksum0 >> 16U) + (checksum1 >> 16U) + kModulus - remainder;
+    if (low >= kModulus) {
+        low -= kModulus;
+    }
+    if (low >= kModulus) {
+        low -= kModulus;
+    }
+    if (high >= kModulus * 2) {
+        high -= kModulus * 2;
+    }
+    if (high >= kModulus) {
+        high -= kModulus;
+    }
+    return (high << 16U) | low;
+}
+
+auto tomurcuk::Adler32::selectKernel() -> Kernel {
+    if (ProcessorFeatures::hasSsse3()) {
+        return &updateWithSsse3;
+    }
+    return &updatePortably;
+}
+
+auto tomurcuk::Adler32::updatePortably(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t {
+    auto sum0 = checksum & 0xFFFFU;
+    auto sum1 = checksum >> 16U;
+    while (size != 0) {
+        auto run = size < kMaximumRun ? size : kMaximumRun;
+        size -= run;
+        for (; run != 0; block++, run--) {
+            sum0 += *block;
+            sum1 += sum0;
+        }
+        sum0 %= kModulus;
+        sum1 %= kModulus;
+    }
+    return (sum1 << 16U) | sum0;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("ssse3")]]
+auto tomurcuk::Adler32::updateWithSsse3(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t {
+    static constexpr auto kBlockSize = INT64_C(32);
+
+    auto sum0 = checksum & 0xFFFFU;
+    auto sum1 = checksum >> 16U;
+
+    // Each byte adds to the second sum once for itself and once for every
+    // byte after it in the block, which is a dot product with descending
+    // weights. The first sums before each block are accumulated separately
+    // and scaled by the block size at the end.
+    auto weights0 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17);
+    auto weights1 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    auto ones = _mm_set1_epi16(1);
+    auto zero = _mm_setzero_si128();
+
+    auto blockCount = size / kBlockSize;
+    size -= blockCount * kBlockSize;
+    while (blockCount != 0) {
+        auto runBlockCount = blockCount < kMaximumRun / kBlockSize ? blockCount : kMaximumRun / kBlockSize;
+        blockCount -= runBlockCount;
+
+        auto previousSums = _mm_set_epi32(0, 0, 0, (int)(sum0 * (uint32_t)runBlockCount));
+        auto sums0 = _mm_setzero_si128();
+        auto sums1 = _mm_set_epi32(0, 0, 0, (int)sum1);
+        for (; runBlockCount != 0; block += kBlockSize, runBlockCount--) {
+            auto bytes0 = _mm_loadu_si128((__m128i *)block);
+            auto bytes1 = _mm_loadu_si128((__m128i *)(block + 16));
+            previousSums = _mm_add_epi32(previousSums, sums0);
+            sums0 = _mm_add_epi32(sums0, _mm_sad_epu8(bytes0, zero));
+            sums1 = _mm_add_epi32(sums1, _mm_madd_epi16(_mm_maddubs_epi16(bytes0, weights0), ones));
+            sums0 = _mm_add_epi32(sums0, _mm_sad_epu8(bytes1, zero));
+            sums1 = _mm_add_epi32(sums1, _mm_madd_epi16(_mm_maddubs_epi16(bytes1, weights1), ones));
+        }
+        sums1 = _mm_add_epi32(sums1, _mm_slli_epi32(previousSums, 5));
+
+        // Horizontally add the lanes.
+        sums0 = _mm_add_epi32(sums0, _mm_shuffle_epi32(sums0, _MM_SHUFFLE(1, 0, 3, 2)));
+        sums0 = _mm_add_epi32(sums0, _mm_shuffle_epi32(sums0, _MM_SHUFFLE(2, 3, 0, 1)));
+        sums1 = _mm_add_epi32(sums1, _mm_shuffle_epi32(sums1, _MM_SHUFFLE(1, 0, 3, 2)));
+        sums1 = _mm_add_epi32(sums1, _mm_shuffle_epi32(sums1, _MM_SHUFFLE(2, 3, 0, 1)));
+        sum0 = (sum0 + (uint32_t)_mm_cvtsi128_si32(sums0)) % kModulus;
+        sum1 = (uint32_t)_mm_cvtsi128_si32(sums1) % kModulus;
+    }
+
+    return updatePortably(block, size, (sum1 << 16U) | sum0);
+}
+
+#else
+
+auto tomurcuk::Adler32::updateWithSsse3(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t {
+    return updatePortably(block, size, checksum);
+}
+
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that calculate the Adler-32 checksum.
+     */
+    class Adler32 {
+    public:
+        /**
+         * Continues a checksum over a block of bytes.
+         *
+         * @param[in] block The pointer to the checksummed bytes.
+         * @param[in] size The amount of checksummed bytes.
+         * @param[in] checksum The checksum of the preceding bytes.
+         * @return The checksum of the preceding bytes and the given block.
+         */
+        static auto checksum(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t;
+
+        /**
+         * Finds the checksum of two consecutive blocks from their checksums.
+         *
+         * @param[in] checksum0 The checksum of the first block.
+         * @param[in] checksum1 The checksum of the second block.
+         * @param[in] size1 The amount of bytes in the second block.
+         * @return The checksum of the concatenated blocks.
+         */
+        static auto combine(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t;
+
+    private:
+        /**
+         * Signature of the functions that update the checksum.
+         */
+        using Kernel = auto (*)(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t;
+
+        /**
+         * The modulus of both sums, which is the largest prime below `2^16`.
+         */
+        static constexpr auto kModulus = UINT32_C(65'521);
+
+        /**
+         * The largest amount of bytes that can be summed before the second sum
+         * might overflow 32 bits.
+         */
+        static constexpr auto kMaximumRun = INT64_C(5552);
+
+        static auto selectKernel() -> Kernel;
+        static auto updatePortably(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t;
+        static auto updateWithSsse3(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t;
+    };
+}
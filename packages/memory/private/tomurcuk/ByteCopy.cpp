@@ -0,0 +1,147 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <tomurcuk/ByteCopy.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+static_assert(sizeof(size_t) == 8);
+
+auto tomurcuk::ByteCopy::copyStreaming(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void {
+    assert((destinationBlock == nullptr) == (size == 0));
+    assert((sourceBlock == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    auto kernel = ProcessorFeatures::getKernels<CopyKernel, &selectCopyKernel>();
+    kernel(destinationBlock, sourceBlock, size);
+}
+
+auto tomurcuk::ByteCopy::resetStreaming(uint8_t *block, int64_t size) -> void {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    auto kernel = ProcessorFeatures::getKernels<ResetKernel, &selectResetKernel>();
+    kernel(block, size);
+}
+
+auto tomurcuk::ByteCopy::selectCopyKernel() -> CopyKernel {
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        return &copyWithAvx2;
+    }
+    if (ProcessorFeatures::hasSse2()) {
+        return &copyWithSse2;
+    }
+#endif
+    return &copyPortably;
+}
+
+auto tomurcuk::ByteCopy::selectResetKernel() -> ResetKernel {
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        return &resetWithAvx2;
+    }
+    if (ProcessorFeatures::hasSse2()) {
+        return &resetWithSse2;
+    }
+#endif
+    return &resetPortably;
+}
+
+auto tomurcuk::ByteCopy::findHeadSize(uint8_t *destinationBlock, int64_t size) -> int64_t {
+    auto headSize = (int64_t)((uint64_t)(-(uintptr_t)destinationBlock) % (uint64_t)kAlignment);
+    if (headSize > size) {
+        return size;
+    }
+    return headSize;
+}
+
+auto tomurcuk::ByteCopy::copyPortably(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void {
+    memcpy(destinationBlock, sourceBlock, (size_t)size);
+}
+
+auto tomurcuk::ByteCopy::resetPortably(uint8_t *block, int64_t size) -> void {
+    memset(block, 0, (size_t)size);
+}
+
+#if defined(__x86_64__)
+
+// The unaligned head and the tail are written through the caches, which is
+// at most two cache lines. Stores are fenced at the end as non-temporal stores
+// are weakly ordered.
+
+auto tomurcuk::ByteCopy::copyWithSse2(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void {
+    auto headSize = findHeadSize(destinationBlock, size);
+    memcpy(destinationBlock, sourceBlock, (size_t)headSize);
+    auto i = headSize;
+    for (; size - i >= kAlignment; i += kAlignment) {
+        _mm_prefetch((char *)(sourceBlock + i + kPrefetchDistance), _MM_HINT_NTA);
+        auto bytes0 = _mm_loadu_si128((__m128i *)(sourceBlock + i));
+        auto bytes1 = _mm_loadu_si128((__m128i *)(sourceBlock + i + 16));
+        auto bytes2 = _mm_loadu_si128((__m128i *)(sourceBlock + i + 32));
+        auto bytes3 = _mm_loadu_si128((__m128i *)(sourceBlock + i + 48));
+        _mm_stream_si128((__m128i *)(destinationBlock + i), bytes0);
+        _mm_stream_si128((__m128i *)(destinationBlock + i + 16), bytes1);
+        _mm_stream_si128((__m128i *)(destinationBlock + i + 32), bytes2);
+        _mm_stream_si128((__m128i *)(destinationBlock + i + 48), bytes3);
+    }
+    _mm_sfence();
+    memcpy(destinationBlock + i, sourceBlock + i, (size_t)(size - i));
+}
+
+auto tomurcuk::ByteCopy::resetWithSse2(uint8_t *block, int64_t size) -> void {
+    auto headSize = findHeadSize(block, size);
+    memset(block, 0, (size_t)headSize);
+    auto zero = _mm_setzero_si128();
+    auto i = headSize;
+    for (; size - i >= kAlignment; i += kAlignment) {
+        _mm_stream_si128((__m128i *)(block + i), zero);
+        _mm_stream_si128((__m128i *)(block + i + 16), zero);
+        _mm_stream_si128((__m128i *)(block + i + 32), zero);
+        _mm_stream_si128((__m128i *)(block + i + 48), zero);
+    }
+    _mm_sfence();
+    memset(block + i, 0, (size_t)(size - i));
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteCopy::copyWithAvx2(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void {
+    auto headSize = findHeadSize(destinationBlock, size);
+    memcpy(destinationBlock, sourceBlock, (size_t)headSize);
+    auto i = headSize;
+    for (; size - i >= kAlignment * 2; i += kAlignment * 2) {
+        _mm_prefetch((char *)(sourceBlock + i + kPrefetchDistance), _MM_HINT_NTA);
+        _mm_prefetch((char *)(sourceBlock + i + kPrefetchDistance + kAlignment), _MM_HINT_NTA);
+        auto bytes0 = _mm256_loadu_si256((__m256i *)(sourceBlock + i));
+        auto bytes1 = _mm256_loadu_si256((__m256i *)(sourceBlock + i + 32));
+        auto bytes2 = _mm256_loadu_si256((__m256i *)(sourceBlock + i + 64));
+        auto bytes3 = _mm256_loadu_si256((__m256i *)(sourceBlock + i + 96));
+        _mm256_stream_si256((__m256i *)(destinationBlock + i), bytes0);
+        _mm256_stream_si256((__m256i *)(destinationBlock + i + 32), bytes1);
+        _mm256_stream_si256((__m256i *)(destinationBlock + i + 64), bytes2);
+        _mm256_stream_si256((__m256i *)(destinationBlock + i + 96), bytes3);
+    }
+    _mm_sfence();
+    memcpy(destinationBlock + i, sourceBlock + i, (size_t)(size - i));
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteCopy::resetWithAvx2(uint8_t *block, int64_t size) -> void {
+    auto headSize = findHeadSize(block, size);
+    memset(block, 0, (size_t)headSize);
+    auto zero = _mm256_setzero_si256();
+    auto i = headSize;
+    for (; size - i >= kAlignment * 2; i += kAlignment * 2) {
+        _mm256_stream_si256((__m256i *)(block + i), zero);
+        _mm256_stream_si256((__m256i *)(block + i + 32), zero);
+        _mm256_stream_si256((__m256i *)(block + i + 64), zero);
+        _mm256_stream_si256((__m256i *)(block + i + 96), zero);
+    }
+    _mm_sfence();
+    memset(block + i, 0, (size_t)(size - i));
+}
+
+#endif
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that write big blocks of bytes with non-temporal stores.
+     *
+     * Non-temporal stores go around the caches; so, writing a block that does
+     * not fit into the last level cache does not evict the working sets of the
+     * other cores.
+     */
+    class ByteCopy {
+    public:
+        /**
+         * Copies bytes from a block to another one that does not overlap with
+         * it, without caching the destination.
+         *
+         * @param[out] destinationBlock The pointer to the block that will be
+         * copied to.
+         * @param[in] sourceBlock The pointer to the block that will be copied
+         * from.
+         * @param[in] size The amount of bytes that will be copied.
+         */
+        static auto copyStreaming(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void;
+
+        /**
+         * Fills a block with `0`s, without caching it.
+         *
+         * @param[out] block The pointer to the block that will be reset.
+         * @param[in] size The amount of bytes that will be reset.
+         */
+        static auto resetStreaming(uint8_t *block, int64_t size) -> void;
+
+    private:
+        /**
+         * Signature of the functions that copy.
+         */
+        using CopyKernel = auto (*)(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void;
+
+        /**
+         * Signature of the functions that reset.
+         */
+        using ResetKernel = auto (*)(uint8_t *block, int64_t size) -> void;
+
+        /**
+         * The alignment of the destination the streaming loops need, which is
+         * a cache line so that every line is written fully.
+         */
+        static constexpr auto kAlignment = INT64_C(64);
+
+        /**
+         * How far ahead of the copied bytes the source is prefetched.
+         */
+        static constexpr auto kPrefetchDistance = INT64_C(512);
+
+        static auto selectCopyKernel() -> CopyKernel;
+        static auto selectResetKernel() -> ResetKernel;
+        static auto findHeadSize(uint8_t *destinationBlock, int64_t size) -> int64_t;
+        static auto copyPortably(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void;
+        static auto resetPortably(uint8_t *block, int64_t size) -> void;
+        static auto copyWithSse2(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void;
+        static auto resetWithSse2(uint8_t *block, int64_t size) -> void;
+        static auto copyWithAvx2(uint8_t *destinationBlock, uint8_t *sourceBlock, int64_t size) -> void;
+        static auto resetWithAvx2(uint8_t *block, int64_t size) -> void;
+    };
+}
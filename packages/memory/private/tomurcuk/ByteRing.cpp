@@ -0,0 +1,65 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ByteRing.hpp>
+#include <tomurcuk/MirroredBlock.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+
+auto tomurcuk::ByteRing::create(int64_t capacity) -> Result<ByteRing> {
+    auto mirroredBlock = MirroredBlock::create(capacity);
+    if (mirroredBlock.isFailure()) {
+        return Result<ByteRing>::failure();
+    }
+
+    ByteRing byteRing;
+    byteRing.mMirroredBlock = *mirroredBlock.value();
+    byteRing.mReadCursor = 0;
+    byteRing.mReadableSize = 0;
+    return Results::success(byteRing);
+}
+
+auto tomurcuk::ByteRing::destroy() -> void {
+    mMirroredBlock.destroy();
+}
+
+auto tomurcuk::ByteRing::getCapacity() -> int64_t {
+    return mMirroredBlock.capacity();
+}
+
+auto tomurcuk::ByteRing::getReadable() -> uint8_t * {
+    return (uint8_t *)mMirroredBlock.address() + mReadCursor;
+}
+
+auto tomurcuk::ByteRing::getReadableSize() -> int64_t {
+    return mReadableSize;
+}
+
+auto tomurcuk::ByteRing::getWritable() -> uint8_t * {
+    // This might be in the second mapping, which is still fine as the
+    // writable span ends before the read cursor does in there.
+    return getReadable() + mReadableSize;
+}
+
+auto tomurcuk::ByteRing::getWritableSize() -> int64_t {
+    return mMirroredBlock.capacity() - mReadableSize;
+}
+
+auto tomurcuk::ByteRing::acknowledgeWritten(int64_t amount) -> void {
+    assert(amount >= 0);
+    assert(amount <= getWritableSize());
+
+    mReadableSize += amount;
+}
+
+auto tomurcuk::ByteRing::acknowledgeRead(int64_t amount) -> void {
+    assert(amount >= 0);
+    assert(amount <= mReadableSize);
+
+    // Keep the cursor in the first mapping, so that both spans fit in the
+    // mirrored range.
+    mReadCursor += amount;
+    if (mReadCursor >= mMirroredBlock.capacity()) {
+        mReadCursor -= mMirroredBlock.capacity();
+    }
+    mReadableSize -= amount;
+}
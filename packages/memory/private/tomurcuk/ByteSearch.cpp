@@ -0,0 +1,461 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ByteSearch.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::ByteSearch::findByte(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    return getKernels().findByte(block, size, byte);
+}
+
+auto tomurcuk::ByteSearch::findLastByte(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    return getKernels().findLastByte(block, size, byte);
+}
+
+auto tomurcuk::ByteSearch::findAnyByte(uint8_t *block, int64_t size, uint8_t *needles, int64_t needleCount) -> int64_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+    assert((needles == nullptr) == (needleCount == 0));
+    assert(needleCount >= 0);
+    assert(needleCount <= 16);
+
+    auto needleSet = createNeedleSet(needles, needleCount);
+    return getKernels().findAnyByte(block, size, &needleSet);
+}
+
+auto tomurcuk::ByteSearch::countByte(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    return getKernels().countByte(block, size, byte);
+}
+
+auto tomurcuk::ByteSearch::findMismatch(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t {
+    assert((block0 == nullptr) == (size == 0));
+    assert((block1 == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    return getKernels().findMismatch(block0, block1, size);
+}
+
+auto tomurcuk::ByteSearch::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::ByteSearch::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.findByte = &findBytePortably;
+    kernels.findLastByte = &findLastBytePortably;
+    kernels.findAnyByte = &findAnyBytePortably;
+    kernels.countByte = &countBytePortably;
+    kernels.findMismatch = &findMismatchPortably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasSse2()) {
+        kernels.findByte = &findByteWithSse2;
+        kernels.findLastByte = &findLastByteWithSse2;
+        kernels.countByte = &countByteWithSse2;
+        kernels.findMismatch = &findMismatchWithSse2;
+    }
+
+    if (ProcessorFeatures::hasSsse3()) {
+        kernels.findAnyByte = &findAnyByteWithSsse3;
+    }
+
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.findByte = &findByteWithAvx2;
+        kernels.findLastByte = &findLastByteWithAvx2;
+        kernels.findAnyByte = &findAnyByteWithAvx2;
+        kernels.countByte = &countByteWithAvx2;
+        kernels.findMismatch = &findMismatchWithAvx2;
+    }
+
+    if (ProcessorFeatures::hasAvx512()) {
+        kernels.findByte = &findByteWithAvx512;
+        kernels.findLastByte = &findLastByteWithAvx512;
+        kernels.findAnyByte = &findAnyByteWithAvx512;
+        kernels.countByte = &countByteWithAvx512;
+        kernels.findMismatch = &findMismatchWithAvx512;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::ByteSearch::createNeedleSet(uint8_t *needles, int64_t needleCount) -> NeedleSet {
+    NeedleSet needleSet{};
+
+    // Bucket of each high nibble; `-1` if no needle has it.
+    int8_t buckets[16];
+    for (auto &bucket : buckets) {
+        bucket = -1;
+    }
+    auto bucketCount = 0;
+
+    for (auto i = INT64_C(0); i != needleCount; i++) {
+        auto needle = needles[i];
+        auto low = needle & 0x0FU;
+        auto high = needle >> 4U;
+        if (buckets[high] == -1) {
+            buckets[high] = (int8_t)bucketCount;
+            bucketCount++;
+        }
+        auto table = buckets[high] / 8;
+        auto bit = (uint8_t)(1U << (uint32_t)(buckets[high] % 8));
+        needleSet.highTables[table][high] |= bit;
+        needleSet.lowTables[table][low] |= bit;
+        needleSet.bitmap[needle / 64U] |= UINT64_C(1) << (needle % 64U);
+    }
+
+    return needleSet;
+}
+
+auto tomurcuk::ByteSearch::offsetIndex(int64_t index, int64_t offset) -> int64_t {
+    if (index == -1) {
+        return -1;
+    }
+    return index + offset;
+}
+
+auto tomurcuk::ByteSearch::findBytePortably(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    for (auto i = INT64_C(0); i != size; i++) {
+        if (block[i] == byte) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+auto tomurcuk::ByteSearch::findLastBytePortably(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    for (auto i = size - 1; i != -1; i--) {
+        if (block[i] == byte) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+auto tomurcuk::ByteSearch::findAnyBytePortably(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t {
+    for (auto i = INT64_C(0); i != size; i++) {
+        if ((needleSet->bitmap[block[i] / 64U] & (UINT64_C(1) << (block[i] % 64U))) != 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+auto tomurcuk::ByteSearch::countBytePortably(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto count = INT64_C(0);
+    for (auto i = INT64_C(0); i != size; i++) {
+        count += (int64_t)(block[i] == byte);
+    }
+    return count;
+}
+
+auto tomurcuk::ByteSearch::findMismatchPortably(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t {
+    for (auto i = INT64_C(0); i != size; i++) {
+        if (block0[i] != block1[i]) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#if defined(__x86_64__)
+
+auto tomurcuk::ByteSearch::findByteWithSse2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm_set1_epi8((char)byte);
+    auto i = INT64_C(0);
+    for (; size - i >= 16; i += 16) {
+        auto bytes = _mm_loadu_si128((__m128i *)(block + i));
+        auto mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return offsetIndex(findBytePortably(block + i, size - i, byte), i);
+}
+
+auto tomurcuk::ByteSearch::findLastByteWithSse2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm_set1_epi8((char)byte);
+    auto end = size;
+    for (; end >= 16; end -= 16) {
+        auto bytes = _mm_loadu_si128((__m128i *)(block + end - 16));
+        auto mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, needle));
+        if (mask != 0) {
+            return end - 16 + 31 - __builtin_clz(mask);
+        }
+    }
+    return findLastBytePortably(block, end, byte);
+}
+
+[[gnu::target("ssse3")]]
+auto tomurcuk::ByteSearch::findAnyByteWithSsse3(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t {
+    auto lowTable0 = _mm_load_si128((__m128i *)needleSet->lowTables[0]);
+    auto lowTable1 = _mm_load_si128((__m128i *)needleSet->lowTables[1]);
+    auto highTable0 = _mm_load_si128((__m128i *)needleSet->highTables[0]);
+    auto highTable1 = _mm_load_si128((__m128i *)needleSet->highTables[1]);
+    auto nibbleMask = _mm_set1_epi8(0x0F);
+    auto zero = _mm_setzero_si128();
+    auto i = INT64_C(0);
+    for (; size - i >= 16; i += 16) {
+        auto bytes = _mm_loadu_si128((__m128i *)(block + i));
+        auto lows = _mm_and_si128(bytes, nibbleMask);
+        auto highs = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+        auto buckets0 = _mm_and_si128(_mm_shuffle_epi8(lowTable0, lows), _mm_shuffle_epi8(highTable0, highs));
+        auto buckets1 = _mm_and_si128(_mm_shuffle_epi8(lowTable1, lows), _mm_shuffle_epi8(highTable1, highs));
+        auto misses = _mm_cmpeq_epi8(_mm_or_si128(buckets0, buckets1), zero);
+        auto mask = ~(uint32_t)_mm_movemask_epi8(misses) & 0xFFFFU;
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return offsetIndex(findAnyBytePortably(block + i, size - i, needleSet), i);
+}
+
+auto tomurcuk::ByteSearch::countByteWithSse2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm_set1_epi8((char)byte);
+    auto zero = _mm_setzero_si128();
+    auto count = INT64_C(0);
+    auto i = INT64_C(0);
+    while (size - i >= 16) {
+        // Matches are `-1`; so, subtracting them counts up to 255 in each
+        // lane before the lanes are summed.
+        auto counts = _mm_setzero_si128();
+        auto runEnd = i + (16 * 255);
+        if (runEnd > size - 15) {
+            runEnd = size - 15;
+        }
+        for (; i < runEnd; i += 16) {
+            auto bytes = _mm_loadu_si128((__m128i *)(block + i));
+            counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(bytes, needle));
+        }
+        auto sums = _mm_sad_epu8(counts, zero);
+        count += _mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums));
+    }
+    return count + countBytePortably(block + i, size - i, byte);
+}
+
+auto tomurcuk::ByteSearch::findMismatchWithSse2(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t {
+    auto i = INT64_C(0);
+    for (; size - i >= 16; i += 16) {
+        auto bytes0 = _mm_loadu_si128((__m128i *)(block0 + i));
+        auto bytes1 = _mm_loadu_si128((__m128i *)(block1 + i));
+        auto mask = ~(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes0, bytes1)) & 0xFFFFU;
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return offsetIndex(findMismatchPortably(block0 + i, block1 + i, size - i), i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteSearch::findByteWithAvx2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm256_set1_epi8((char)byte);
+    auto i = INT64_C(0);
+
+    // Test two vectors at once, and only find out which one matched after
+    // there is a match.
+    for (; size - i >= 64; i += 64) {
+        auto matches0 = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *)(block + i)), needle);
+        auto matches1 = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *)(block + i + 32)), needle);
+        if (_mm256_testz_si256(_mm256_or_si256(matches0, matches1), _mm256_or_si256(matches0, matches1)) == 0) {
+            auto mask = ((uint64_t)(uint32_t)_mm256_movemask_epi8(matches1) << 32U) | (uint32_t)_mm256_movemask_epi8(matches0);
+            return i + __builtin_ctzll(mask);
+        }
+    }
+    for (; size - i >= 32; i += 32) {
+        auto bytes = _mm256_loadu_si256((__m256i *)(block + i));
+        auto mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, needle));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return offsetIndex(findBytePortably(block + i, size - i, byte), i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteSearch::findLastByteWithAvx2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm256_set1_epi8((char)byte);
+    auto end = size;
+    for (; end >= 32; end -= 32) {
+        auto bytes = _mm256_loadu_si256((__m256i *)(block + end - 32));
+        auto mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, needle));
+        if (mask != 0) {
+            return end - 32 + 31 - __builtin_clz(mask);
+        }
+    }
+    return findLastBytePortably(block, end, byte);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteSearch::findAnyByteWithAvx2(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t {
+    // Shuffles work inside 128-bit lanes; so, the tables are repeated.
+    auto lowTable0 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)needleSet->lowTables[0]));
+    auto lowTable1 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)needleSet->lowTables[1]));
+    auto highTable0 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)needleSet->highTables[0]));
+    auto highTable1 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)needleSet->highTables[1]));
+    auto nibbleMask = _mm256_set1_epi8(0x0F);
+    auto zero = _mm256_setzero_si256();
+    auto i = INT64_C(0);
+    for (; size - i >= 32; i += 32) {
+        auto bytes = _mm256_loadu_si256((__m256i *)(block + i));
+        auto lows = _mm256_and_si256(bytes, nibbleMask);
+        auto highs = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibbleMask);
+        auto buckets0 = _mm256_and_si256(_mm256_shuffle_epi8(lowTable0, lows), _mm256_shuffle_epi8(highTable0, highs));
+        auto buckets1 = _mm256_and_si256(_mm256_shuffle_epi8(lowTable1, lows), _mm256_shuffle_epi8(highTable1, highs));
+        auto misses = _mm256_cmpeq_epi8(_mm256_or_si256(buckets0, buckets1), zero);
+        auto mask = ~(uint32_t)_mm256_movemask_epi8(misses);
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return offsetIndex(findAnyBytePortably(block + i, size - i, needleSet), i);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteSearch::countByteWithAvx2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm256_set1_epi8((char)byte);
+    auto zero = _mm256_setzero_si256();
+    auto count = INT64_C(0);
+    auto i = INT64_C(0);
+    while (size - i >= 32) {
+        auto counts = _mm256_setzero_si256();
+        auto runEnd = i + (32 * 255);
+        if (runEnd > size - 31) {
+            runEnd = size - 31;
+        }
+        for (; i < runEnd; i += 32) {
+            auto bytes = _mm256_loadu_si256((__m256i *)(block + i));
+            counts = _mm256_sub_epi8(counts, _mm256_cmpeq_epi8(bytes, needle));
+        }
+        auto sums = _mm256_sad_epu8(counts, zero);
+        count += _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) + _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3);
+    }
+    return count + countBytePortably(block + i, size - i, byte);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::ByteSearch::findMismatchWithAvx2(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t {
+    auto i = INT64_C(0);
+    for (; size - i >= 32; i += 32) {
+        auto bytes0 = _mm256_loadu_si256((__m256i *)(block0 + i));
+        auto bytes1 = _mm256_loadu_si256((__m256i *)(block1 + i));
+        auto mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes0, bytes1));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    return offsetIndex(findMismatchPortably(block0 + i, block1 + i, size - i), i);
+}
+
+// AVX-512 kernels handle the tail with masked loads, which do not fault on the
+// bytes that are masked out.
+
+[[gnu::target("avx512f,avx512bw,avx512vl")]]
+auto tomurcuk::ByteSearch::findByteWithAvx512(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm512_set1_epi8((char)byte);
+    for (auto i = INT64_C(0); i < size; i += 64) {
+        auto loadMask = ~UINT64_C(0);
+        if (size - i < 64) {
+            loadMask = (UINT64_C(1) << (uint64_t)(size - i)) - 1;
+        }
+        auto bytes = _mm512_maskz_loadu_epi8(loadMask, block + i);
+        auto mask = _mm512_mask_cmpeq_epi8_mask(loadMask, bytes, needle);
+        if (mask != 0) {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+    return -1;
+}
+
+[[gnu::target("avx512f,avx512bw,avx512vl")]]
+auto tomurcuk::ByteSearch::findLastByteWithAvx512(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm512_set1_epi8((char)byte);
+    auto end = size;
+    for (; end >= 64; end -= 64) {
+        auto bytes = _mm512_loadu_si512(block + end - 64);
+        auto mask = _mm512_cmpeq_epi8_mask(bytes, needle);
+        if (mask != 0) {
+            return end - 64 + 63 - __builtin_clzll(mask);
+        }
+    }
+    if (end != 0) {
+        auto loadMask = (UINT64_C(1) << (uint64_t)end) - 1;
+        auto bytes = _mm512_maskz_loadu_epi8(loadMask, block);
+        auto mask = _mm512_mask_cmpeq_epi8_mask(loadMask, bytes, needle);
+        if (mask != 0) {
+            return 63 - __builtin_clzll(mask);
+        }
+    }
+    return -1;
+}
+
+[[gnu::target("avx512f,avx512bw,avx512vl")]]
+auto tomurcuk::ByteSearch::findAnyByteWithAvx512(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t {
+    auto lowTable0 = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)needleSet->lowTables[0]));
+    auto lowTable1 = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)needleSet->lowTables[1]));
+    auto highTable0 = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)needleSet->highTables[0]));
+    auto highTable1 = _mm512_broadcast_i32x4(_mm_load_si128((__m128i *)needleSet->highTables[1]));
+    auto nibbleMask = _mm512_set1_epi8(0x0F);
+    for (auto i = INT64_C(0); i < size; i += 64) {
+        auto loadMask = ~UINT64_C(0);
+        if (size - i < 64) {
+            loadMask = (UINT64_C(1) << (uint64_t)(size - i)) - 1;
+        }
+        auto bytes = _mm512_maskz_loadu_epi8(loadMask, block + i);
+        auto lows = _mm512_and_si512(bytes, nibbleMask);
+        auto highs = _mm512_and_si512(_mm512_srli_epi16(bytes, 4), nibbleMask);
+        auto buckets0 = _mm512_and_si512(_mm512_shuffle_epi8(lowTable0, lows), _mm512_shuffle_epi8(highTable0, highs));
+        auto buckets1 = _mm512_and_si512(_mm512_shuffle_epi8(lowTable1, lows), _mm512_shuffle_epi8(highTable1, highs));
+        auto buckets = _mm512_or_si512(buckets0, buckets1);
+        auto mask = _mm512_mask_test_epi8_mask(loadMask, buckets, buckets);
+        if (mask != 0) {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+    return -1;
+}
+
+[[gnu::target("avx512f,avx512bw,avx512vl,popcnt")]]
+auto tomurcuk::ByteSearch::countByteWithAvx512(uint8_t *block, int64_t size, uint8_t byte) -> int64_t {
+    auto needle = _mm512_set1_epi8((char)byte);
+    auto count = INT64_C(0);
+    for (auto i = INT64_C(0); i < size; i += 64) {
+        auto loadMask = ~UINT64_C(0);
+        if (size - i < 64) {
+            loadMask = (UINT64_C(1) << (uint64_t)(size - i)) - 1;
+        }
+        auto bytes = _mm512_maskz_loadu_epi8(loadMask, block + i);
+        count += __builtin_popcountll(_mm512_mask_cmpeq_epi8_mask(loadMask, bytes, needle));
+    }
+    return count;
+}
+
+[[gnu::target("avx512f,avx512bw,avx512vl")]]
+auto tomurcuk::ByteSearch::findMismatchWithAvx512(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t {
+    for (auto i = INT64_C(0); i < size; i += 64) {
+        auto loadMask = ~UINT64_C(0);
+        if (size - i < 64) {
+            loadMask = (UINT64_C(1) << (uint64_t)(size - i)) - 1;
+        }
+        auto bytes0 = _mm512_maskz_loadu_epi8(loadMask, block0 + i);
+        auto bytes1 = _mm512_maskz_loadu_epi8(loadMask, block1 + i);
+        auto mask = _mm512_mask_cmpneq_epi8_mask(loadMask, bytes0, bytes1);
+        if (mask != 0) {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+    return -1;
+}
+
+#endif
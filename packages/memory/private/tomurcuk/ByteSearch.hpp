@@ -0,0 +1,128 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that scan blocks of bytes.
+     *
+     * Each operation has a portable implementation and SSE2, AVX2 and AVX-512
+     * implementations; the fastest one the processor supports is selected on
+     * the first use.
+     */
+    class ByteSearch {
+    public:
+        /**
+         * Finds the first occurrence of a byte.
+         *
+         * @param[in] block The pointer to the searched bytes.
+         * @param[in] size The amount of searched bytes.
+         * @param[in] byte The searched byte.
+         * @return The index of the first occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        static auto findByte(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+
+        /**
+         * Finds the last occurrence of a byte.
+         *
+         * @param[in] block The pointer to the searched bytes.
+         * @param[in] size The amount of searched bytes.
+         * @param[in] byte The searched byte.
+         * @return The index of the last occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        static auto findLastByte(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+
+        /**
+         * Finds the first occurrence of any byte from a set.
+         *
+         * @param[in] block The pointer to the searched bytes.
+         * @param[in] size The amount of searched bytes.
+         * @param[in] needles The pointer to the set of searched bytes.
+         * @param[in] needleCount The amount of searched bytes, which must be at
+         * most `16`.
+         * @return The index of the first occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        static auto findAnyByte(uint8_t *block, int64_t size, uint8_t *needles, int64_t needleCount) -> int64_t;
+
+        /**
+         * Counts the occurrences of a byte.
+         *
+         * @param[in] block The pointer to the searched bytes.
+         * @param[in] size The amount of searched bytes.
+         * @param[in] byte The counted byte.
+         * @return The amount of occurrences.
+         */
+        static auto countByte(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+
+        /**
+         * Finds the first index where a pair of blocks differ.
+         *
+         * @param[in] block0 The pointer to the first compared block.
+         * @param[in] block1 The pointer to the second compared block.
+         * @param[in] size The amount of compared bytes.
+         * @return The index of the first differing byte if there is one.
+         * Otherwise, `-1`.
+         */
+        static auto findMismatch(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t;
+
+    private:
+        /**
+         * Searched set of bytes in the forms the kernels use.
+         *
+         * Every distinct high nibble in the set gets a bucket, which is a bit
+         * in one of the two table pairs. The high table of a pair maps the
+         * high nibble to its bucket, and the low table maps the low nibble to
+         * the buckets of the bytes that end with it. A byte is in the set if
+         * the lookups of its nibbles share a bucket. This is exact as each
+         * high nibble has a separate bucket.
+         */
+        struct NeedleSet {
+            alignas(16) uint8_t lowTables[2][16];
+            alignas(16) uint8_t highTables[2][16];
+            uint64_t bitmap[4];
+        };
+
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*findByte)(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+            auto (*findLastByte)(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+            auto (*findAnyByte)(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t;
+            auto (*countByte)(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+            auto (*findMismatch)(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+        static auto createNeedleSet(uint8_t *needles, int64_t needleCount) -> NeedleSet;
+        static auto offsetIndex(int64_t index, int64_t offset) -> int64_t;
+
+        static auto findBytePortably(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findLastBytePortably(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findAnyBytePortably(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t;
+        static auto countBytePortably(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findMismatchPortably(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t;
+
+        static auto findByteWithSse2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findLastByteWithSse2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findAnyByteWithSsse3(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t;
+        static auto countByteWithSse2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findMismatchWithSse2(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t;
+
+        static auto findByteWithAvx2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findLastByteWithAvx2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findAnyByteWithAvx2(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t;
+        static auto countByteWithAvx2(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findMismatchWithAvx2(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t;
+
+        static auto findByteWithAvx512(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findLastByteWithAvx512(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findAnyByteWithAvx512(uint8_t *block, int64_t size, NeedleSet *needleSet) -> int64_t;
+        static auto countByteWithAvx512(uint8_t *block, int64_t size, uint8_t byte) -> int64_t;
+        static auto findMismatchWithAvx512(uint8_t *block0, uint8_t *block1, int64_t size) -> int64_t;
+    };
+}
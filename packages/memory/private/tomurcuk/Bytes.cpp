@@ -2,7 +2,13 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <tomurcuk/Adler32.hpp>
+#include <tomurcuk/ByteCopy.hpp>
+#include <tomurcuk/ByteSearch.hpp>
 #include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/Crc32c.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/XxHash64.hpp>
 
 static_assert(sizeof(size_t) == 8);
 
@@ -47,10 +53,26 @@ auto tomurcuk::Bytes::growCapacity(int64_t capacity, int64_t load, int64_t reser
     return requiredCapacity;
 }
 
+auto tomurcuk::Bytes::getStreamingThreshold() -> int64_t {
+    return sStreamingThreshold;
+}
+
+auto tomurcuk::Bytes::setStreamingThreshold(int64_t streamingThreshold) -> void {
+    assert(streamingThreshold >= 0);
+
+    sStreamingThreshold = streamingThreshold;
+}
+
+int64_t tomurcuk::Bytes::sStreamingThreshold = kDefaultStreamingThreshold;
+
 auto tomurcuk::Bytes::resetBlock(void *block, int64_t size) -> void {
     assert((block == nullptr) == (size == 0));
     assert(size >= 0);
 
+    if (size >= sStreamingThreshold) {
+        ByteCopy::resetStreaming((uint8_t *)block, size);
+        return;
+    }
     memset(block, 0, (size_t)size);
 }
 
@@ -59,6 +81,10 @@ auto tomurcuk::Bytes::copyBlock(void *destinationBlock, void *sourceBlock, int64
     assert((sourceBlock == nullptr) == (size == 0));
     assert(size >= 0);
 
+    if (size >= sStreamingThreshold) {
+        ByteCopy::copyStreaming((uint8_t *)destinationBlock, (uint8_t *)sourceBlock, size);
+        return;
+    }
     memcpy(destinationBlock, sourceBlock, (size_t)size);
 }
 
@@ -67,6 +93,16 @@ auto tomurcuk::Bytes::copyAliasingBlock(void *destinationBlock, void *sourceBloc
     assert((sourceBlock == nullptr) == (size == 0));
     assert(size >= 0);
 
+    // Streaming is only done when the blocks happen to not overlap, as the
+    // kernels do not order the stores against the loads.
+    if (size >= sStreamingThreshold) {
+        auto destinationBegin = (uint64_t)destinationBlock;
+        auto sourceBegin = (uint64_t)sourceBlock;
+        if (destinationBegin + (uint64_t)size <= sourceBegin || sourceBegin + (uint64_t)size <= destinationBegin) {
+            ByteCopy::copyStreaming((uint8_t *)destinationBlock, (uint8_t *)sourceBlock, size);
+            return;
+        }
+    }
     memmove(destinationBlock, sourceBlock, (size_t)size);
 }
 
@@ -82,3 +118,85 @@ auto tomurcuk::Bytes::testBlockExactness(void *block0, int64_t size0, void *bloc
 
     return memcmp(block0, block1, (size_t)size0) == 0;
 }
+
+auto tomurcuk::Bytes::compareBlocks(void *block0, int64_t size0, void *block1, int64_t size1) -> Ordering {
+    assert((block0 == nullptr) == (size0 == 0));
+    assert((block1 == nullptr) == (size1 == 0));
+    assert(size0 >= 0);
+    assert(size1 >= 0);
+
+    auto size = size0 < size1 ? size0 : size1;
+    auto bytes0 = (uint8_t *)block0;
+    auto bytes1 = (uint8_t *)block1;
+
+    // Short keys are the common case when sorting; so, they are compared as
+    // big-endian words, which order the same as their bytes, without the
+    // call into the vectorized kernels.
+    auto index = INT64_C(0);
+    if (size < kShortComparisonLimit) {
+        for (; index + 8 <= size; index += 8) {
+            uint64_t word0;
+            uint64_t word1;
+            memcpy(&word0, bytes0 + index, sizeof(word0));
+            memcpy(&word1, bytes1 + index, sizeof(word1));
+            if (word0 != word1) {
+                return __builtin_bswap64(word0) < __builtin_bswap64(word1) ? Ordering::eLess : Ordering::eGreater;
+            }
+        }
+        for (; index != size && bytes0[index] == bytes1[index]; index++) {
+        }
+        if (index == size) {
+            index = -1;
+        }
+    } else {
+        index = ByteSearch::findMismatch(bytes0, bytes1, size);
+    }
+
+    if (index != -1) {
+        return bytes0[index] < bytes1[index] ? Ordering::eLess : Ordering::eGreater;
+    }
+    if (size0 != size1) {
+        return size0 < size1 ? Ordering::eLess : Ordering::eGreater;
+    }
+    return Ordering::eEqual;
+}
+
+auto tomurcuk::Bytes::findByte(void *block, int64_t size, uint8_t byte) -> int64_t {
+    return ByteSearch::findByte((uint8_t *)block, size, byte);
+}
+
+auto tomurcuk::Bytes::findLastByte(void *block, int64_t size, uint8_t byte) -> int64_t {
+    return ByteSearch::findLastByte((uint8_t *)block, size, byte);
+}
+
+auto tomurcuk::Bytes::findAnyByte(void *block, int64_t size, uint8_t *needles, int64_t needleCount) -> int64_t {
+    return ByteSearch::findAnyByte((uint8_t *)block, size, needles, needleCount);
+}
+
+auto tomurcuk::Bytes::countByte(void *block, int64_t size, uint8_t byte) -> int64_t {
+    return ByteSearch::countByte((uint8_t *)block, size, byte);
+}
+
+auto tomurcuk::Bytes::findMismatch(void *block0, void *block1, int64_t size) -> int64_t {
+    return ByteSearch::findMismatch((uint8_t *)block0, (uint8_t *)block1, size);
+}
+
+auto tomurcuk::Bytes::checksumBlockWithCrc32c(void *block, int64_t size, uint32_t checksum) -> uint32_t {
+    return Crc32c::checksum((uint8_t *)block, size, checksum);
+}
+
+auto tomurcuk::Bytes::combineCrc32cChecksums(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t {
+    return Crc32c::combine(checksum0, checksum1, size1);
+}
+
+auto tomurcuk::Bytes::checksumBlockWithAdler32(void *block, int64_t size, uint32_t checksum) -> uint32_t {
+    return Adler32::checksum((uint8_t *)block, size, checksum);
+}
+
+auto tomurcuk::Bytes::combineAdler32Checksums(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t {
+    return Adler32::combine(checksum0, checksum1, size1);
+}
+
+auto tomurcuk::Bytes::checksumBlockWithXxHash64(void *block, int64_t size, uint64_t seed) -> uint64_t {
+    return XxHash64::hash((uint8_t *)block, size, seed);
+}
@@ -0,0 +1,155 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <tomurcuk/Crc32c.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+constexpr auto tomurcuk::Crc32c::createTable() -> Table {
+    Table table{};
+    for (auto i = 0; i != 256; i++) {
+        auto crc = (uint32_t)i;
+        for (auto j = 0; j != 8; j++) {
+            crc = (crc >> 1U) ^ (kPolynomial & (0U - (crc & 1U)));
+        }
+        table.entries[0][i] = crc;
+    }
+    for (auto i = 0; i != 256; i++) {
+        for (auto j = 1; j != 8; j++) {
+            auto previous = table.entries[j - 1][i];
+            table.entries[j][i] = (previous >> 8U) ^ table.entries[0][previous & 0xFFU];
+        }
+    }
+    return table;
+}
+
+auto tomurcuk::Crc32c::checksum(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    auto kernel = ProcessorFeatures::getKernels<Kernel, &selectKernel>();
+    return ~kernel(block, size, ~checksum);
+}
+
+auto tomurcuk::Crc32c::combine(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t {
+    assert(size1 >= 0);
+    assert(size1 <= INT64_MAX / 8);
+
+    // Appending `size1` bytes shifts the first checksum by as many bits, and
+    // the rest is the contribution of the second block alone.
+    return multiply(raise(size1 * 8), checksum0) ^ checksum1;
+}
+
+auto tomurcuk::Crc32c::selectKernel() -> Kernel {
+    if (ProcessorFeatures::hasSse42() && ProcessorFeatures::hasPclmul()) {
+        return &updateWithHardware;
+    }
+    return &updatePortably;
+}
+
+auto tomurcuk::Crc32c::updatePortably(uint8_t *block, int64_t size, uint32_t crc) -> uint32_t {
+    static constexpr auto kTable = createTable();
+
+    // Slicing-by-8: combine the remainders of eight bytes at once, which are
+    // independent table lookups.
+    for (; size >= 8; block += 8, size -= 8) {
+        uint64_t word;
+        memcpy(&word, block, sizeof(word));
+        word ^= crc;
+        crc = kTable.entries[7][word & 0xFFU]
+            ^ kTable.entries[6][(word >> 8U) & 0xFFU]
+            ^ kTable.entries[5][(word >> 16U) & 0xFFU]
+            ^ kTable.entries[4][(word >> 24U) & 0xFFU]
+            ^ kTable.entries[3][(word >> 32U) & 0xFFU]
+            ^ kTable.entries[2][(word >> 40U) & 0xFFU]
+            ^ kTable.entries[1][(word >> 48U) & 0xFFU]
+            ^ kTable.entries[0][word >> 56U];
+    }
+    for (; size != 0; block++, size--) {
+        crc = (crc >> 8U) ^ kTable.entries[0][(crc ^ *block) & 0xFFU];
+    }
+    return crc;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("sse4.2,pclmul")]]
+auto tomurcuk::Crc32c::updateWithHardware(uint8_t *block, int64_t size, uint32_t crc) -> uint32_t {
+    // The `crc32` instruction has a latency of 3 cycles but a throughput of 1
+    // per cycle; so, three independent streams keep it busy. Their results
+    // are merged by shifting with a carry-less multiplication, which gives
+    // `x^(8 * shift - 33)` times the checksum, and the `crc32` instruction,
+    // which multiplies the rest by `x^33` while reducing it.
+    static auto const kShift1 = raise(kStreamSize * 8 - 33);
+    static auto const kShift2 = raise(kStreamSize * 16 - 33);
+
+    for (; size != 0 && (uintptr_t)block % 8 != 0; block++, size--) {
+        crc = _mm_crc32_u8(crc, *block);
+    }
+
+    uint64_t word;
+    for (; size >= kStreamSize * 3; block += kStreamSize * 3, size -= kStreamSize * 3) {
+        auto crc0 = (uint64_t)crc;
+        auto crc1 = UINT64_C(0);
+        auto crc2 = UINT64_C(0);
+        for (auto i = INT64_C(0); i != kStreamSize; i += 8) {
+            memcpy(&word, block + i, sizeof(word));
+            crc0 = _mm_crc32_u64(crc0, word);
+            memcpy(&word, block + kStreamSize + i, sizeof(word));
+            crc1 = _mm_crc32_u64(crc1, word);
+            memcpy(&word, block + (kStreamSize * 2) + i, sizeof(word));
+            crc2 = _mm_crc32_u64(crc2, word);
+        }
+        auto shifted0 = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int)crc0), _mm_cvtsi32_si128((int)kShift2), 0x00);
+        auto shifted1 = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int)crc1), _mm_cvtsi32_si128((int)kShift1), 0x00);
+        crc = (uint32_t)_mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(shifted0))
+            ^ (uint32_t)_mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(shifted1))
+            ^ (uint32_t)crc2;
+    }
+
+    for (; size >= 8; block += 8, size -= 8) {
+        memcpy(&word, block, sizeof(word));
+        crc = (uint32_t)_mm_crc32_u64(crc, word);
+    }
+    for (; size != 0; block++, size--) {
+        crc = _mm_crc32_u8(crc, *block);
+    }
+    return crc;
+}
+
+#else
+
+auto tomurcuk::Crc32c::updateWithHardware(uint8_t *block, int64_t size, uint32_t crc) -> uint32_t {
+    return updatePortably(block, size, crc);
+}
+
+#endif
+
+auto tomurcuk::Crc32c::multiply(uint32_t polynomial0, uint32_t polynomial1) -> uint32_t {
+    auto product = UINT32_C(0);
+    for (auto mask = UINT32_C(1) << 31U; mask != 0; mask >>= 1U) {
+        if ((polynomial0 & mask) != 0) {
+            product ^= polynomial1;
+        }
+        polynomial1 = (polynomial1 >> 1U) ^ (kPolynomial & (0U - (polynomial1 & 1U)));
+    }
+    return product;
+}
+
+auto tomurcuk::Crc32c::raise(int64_t exponent) -> uint32_t {
+    assert(exponent >= 0);
+
+    // Square-and-multiply, starting from `x^0` and `x^1`.
+    auto result = UINT32_C(1) << 31U;
+    auto power = UINT32_C(1) << 30U;
+    for (; exponent != 0; exponent >>= 1) {
+        if ((exponent & 1) != 0) {
+            result = multiply(result, power);
+        }
+        power = multiply(power, power);
+    }
+    return result;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernels that calculate the CRC-32C (Castagnoli) checksum.
+     *
+     * Checksums are kept in the reflected representation, where the most
+     * significant bit is the coefficient of `x^0`.
+     */
+    class Crc32c {
+    public:
+        /**
+         * Continues a checksum over a block of bytes.
+         *
+         * @param[in] block The pointer to the checksummed bytes.
+         * @param[in] size The amount of checksummed bytes.
+         * @param[in] checksum The checksum of the preceding bytes.
+         * @return The checksum of the preceding bytes and the given block.
+         */
+        static auto checksum(uint8_t *block, int64_t size, uint32_t checksum) -> uint32_t;
+
+        /**
+         * Finds the checksum of two consecutive blocks from their checksums.
+         *
+         * @param[in] checksum0 The checksum of the first block.
+         * @param[in] checksum1 The checksum of the second block.
+         * @param[in] size1 The amount of bytes in the second block.
+         * @return The checksum of the concatenated blocks.
+         */
+        static auto combine(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t;
+
+    private:
+        /**
+         * Lookup tables for slicing-by-8, where entry `[i][b]` is the remainder
+         * of byte `b` followed by `i` zero bytes.
+         */
+        struct Table {
+            uint32_t entries[8][256];
+        };
+
+        /**
+         * Signature of the functions that update the raw checksum register.
+         */
+        using Kernel = auto (*)(uint8_t *block, int64_t size, uint32_t crc) -> uint32_t;
+
+        /**
+         * Bytes processed by each of the interleaved streams of the hardware
+         * kernel before they are merged.
+         */
+        static constexpr auto kStreamSize = INT64_C(4096);
+
+        /**
+         * Reversed generator polynomial of CRC-32C.
+         */
+        static constexpr auto kPolynomial = UINT32_C(0x82F6'3B78);
+
+        static constexpr auto createTable() -> Table;
+        static auto selectKernel() -> Kernel;
+        static auto updatePortably(uint8_t *block, int64_t size, uint32_t crc) -> uint32_t;
+        static auto updateWithHardware(uint8_t *block, int64_t size, uint32_t crc) -> uint32_t;
+
+        /**
+         * Multiplies a pair of polynomials modulo the generator polynomial.
+         *
+         * @param[in] polynomial0 The first multiplied polynomial.
+         * @param[in] polynomial1 The second multiplied polynomial.
+         * @return The remainder of the product.
+         */
+        static auto multiply(uint32_t polynomial0, uint32_t polynomial1) -> uint32_t;
+
+        /**
+         * Raises `x` to a power modulo the generator polynomial.
+         *
+         * @param[in] exponent The power `x` is raised to.
+         * @return The remainder of `x^exponent`.
+         */
+        static auto raise(int64_t exponent) -> uint32_t;
+    };
+}
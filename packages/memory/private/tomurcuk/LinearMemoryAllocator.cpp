@@ -19,6 +19,7 @@ auto tomurcuk::LinearMemoryAllocator::create(int64_t capacity) -> Result<LinearM
     LinearMemoryAllocator linearMemoryAllocator;
     linearMemoryAllocator.mVirtualBlock = *virtualBlock.value();
     linearMemoryAllocator.mCursor = 0;
+    linearMemoryAllocator.mDirtyCursor = 0;
     return Results::success(linearMemoryAllocator);
 }
 
@@ -27,7 +28,7 @@ auto tomurcuk::LinearMemoryAllocator::destroy() -> void {
 }
 
 auto tomurcuk::LinearMemoryAllocator::memoryAllocator() -> MemoryAllocator {
-    return MemoryAllocator::create(this, &reallocateImplementation);
+    return MemoryAllocator::create(this, &reallocateImplementation, &allocateZeroedImplementation);
 }
 
 auto tomurcuk::LinearMemoryAllocator::cursor() -> int64_t {
@@ -46,13 +47,21 @@ auto tomurcuk::LinearMemoryAllocator::deallocateAll() -> void {
 }
 
 auto tomurcuk::LinearMemoryAllocator::releaseUnused() -> Status {
-    return mVirtualBlock.release(mVirtualBlock.load() - mCursor);
+    auto status = mVirtualBlock.release(mVirtualBlock.load() - mCursor);
+    if (mDirtyCursor > mVirtualBlock.load()) {
+        mDirtyCursor = mVirtualBlock.load();
+    }
+    return status;
 }
 
 auto tomurcuk::LinearMemoryAllocator::reallocateImplementation(void *state, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *> {
     return ((LinearMemoryAllocator *)state)->reallocate(oldBlock, oldSize, newSize, alignment);
 }
 
+auto tomurcuk::LinearMemoryAllocator::allocateZeroedImplementation(void *state, int64_t newSize, int64_t alignment) -> Result<void *> {
+    return ((LinearMemoryAllocator *)state)->allocateZeroed(newSize, alignment);
+}
+
 auto tomurcuk::LinearMemoryAllocator::reallocate(void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *> {
     assert((oldBlock == nullptr) == (oldSize == 0));
     assert(oldSize >= 0);
@@ -127,6 +136,33 @@ auto tomurcuk::LinearMemoryAllocator::reallocate(void *oldBlock, int64_t oldSize
     return allocate(newSize, alignment);
 }
 
+auto tomurcuk::LinearMemoryAllocator::allocateZeroed(int64_t size, int64_t alignment) -> Result<void *> {
+    assert(size >= 0);
+    assert(alignment > 0);
+
+    if (size == 0) {
+        return Result<void *>::success(nullptr);
+    }
+
+    auto dirtyCursor = mDirtyCursor;
+    auto block = allocate(size, alignment);
+    if (block.isFailure()) {
+        return block;
+    }
+
+    // Only reset the part that might have been handed out before, and leave
+    // the untouched pages that are fresh from the operating system alone.
+    auto blockCursor = (int64_t)((char *)*block.value() - (char *)mVirtualBlock.address());
+    if (blockCursor < dirtyCursor) {
+        auto dirtySize = dirtyCursor - blockCursor;
+        if (dirtySize > size) {
+            dirtySize = size;
+        }
+        Bytes::resetBlock(*block.value(), dirtySize);
+    }
+    return block;
+}
+
 auto tomurcuk::LinearMemoryAllocator::isLastAllocation(void *block, int64_t size) -> bool {
     if (block == nullptr) {
         return false;
@@ -155,5 +191,8 @@ auto tomurcuk::LinearMemoryAllocator::allocate(int64_t size, int64_t alignment)
 
     auto block = (void *)((char *)mVirtualBlock.address() + mCursor + padding);
     mCursor += amount;
+    if (mDirtyCursor < mCursor) {
+        mDirtyCursor = mCursor;
+    }
     return Results::success(block);
 }
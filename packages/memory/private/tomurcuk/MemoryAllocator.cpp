@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <stdint.h>
+#include <tomurcuk/Bytes.hpp>
 #include <tomurcuk/MemoryAllocator.hpp>
 #include <tomurcuk/Result.hpp>
 
@@ -9,6 +10,15 @@ auto tomurcuk::MemoryAllocator::create(void *state, auto (*reallocate)(void *sta
     MemoryAllocator memoryAllocator;
     memoryAllocator.mState = state;
     memoryAllocator.mReallocate = reallocate;
+    memoryAllocator.mAllocateZeroed = nullptr;
+    return memoryAllocator;
+}
+
+auto tomurcuk::MemoryAllocator::create(void *state, auto (*reallocate)(void *state, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment)->Result<void *>, auto (*allocateZeroed)(void *state, int64_t newSize, int64_t alignment)->Result<void *>) -> MemoryAllocator {
+    assert(allocateZeroed != nullptr);
+
+    auto memoryAllocator = create(state, reallocate);
+    memoryAllocator.mAllocateZeroed = allocateZeroed;
     return memoryAllocator;
 }
 
@@ -16,6 +26,18 @@ auto tomurcuk::MemoryAllocator::allocate(int64_t newSize, int64_t alignment) ->
     return mReallocate(mState, nullptr, 0, newSize, alignment);
 }
 
+auto tomurcuk::MemoryAllocator::allocateZeroed(int64_t newSize, int64_t alignment) -> Result<void *> {
+    if (mAllocateZeroed != nullptr) {
+        return mAllocateZeroed(mState, newSize, alignment);
+    }
+
+    auto newBlock = allocate(newSize, alignment);
+    if (newBlock.isSuccess()) {
+        Bytes::resetBlock(*newBlock.value(), newSize);
+    }
+    return newBlock;
+}
+
 auto tomurcuk::MemoryAllocator::reallocate(void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *> {
     return mReallocate(mState, oldBlock, oldSize, newSize, alignment);
 }
@@ -0,0 +1,10 @@
+#include <stdint.h>
+#include <tomurcuk/MirroredBlock.hpp>
+
+auto tomurcuk::MirroredBlock::address() -> void * {
+    return mAddress;
+}
+
+auto tomurcuk::MirroredBlock::capacity() -> int64_t {
+    return mCapacity;
+}
@@ -0,0 +1,134 @@
+#include <stdint.h>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+
+#if defined(__x86_64__)
+    #include <cpuid.h>
+#endif
+
+auto tomurcuk::ProcessorFeatures::hasSse2() -> bool {
+    return getCurrent().mHasSse2 && sLevel >= ProcessorLevel::eSse2;
+}
+
+auto tomurcuk::ProcessorFeatures::hasSsse3() -> bool {
+    return getCurrent().mHasSsse3 && sLevel >= ProcessorLevel::eSse42;
+}
+
+auto tomurcuk::ProcessorFeatures::hasSse41() -> bool {
+    return getCurrent().mHasSse41 && sLevel >= ProcessorLevel::eSse42;
+}
+
+auto tomurcuk::ProcessorFeatures::hasSse42() -> bool {
+    return getCurrent().mHasSse42 && sLevel >= ProcessorLevel::eSse42;
+}
+
+auto tomurcuk::ProcessorFeatures::hasPclmul() -> bool {
+    return getCurrent().mHasPclmul && sLevel >= ProcessorLevel::eSse42;
+}
+
+auto tomurcuk::ProcessorFeatures::hasPopcnt() -> bool {
+    return getCurrent().mHasPopcnt && sLevel >= ProcessorLevel::eSse42;
+}
+
+auto tomurcuk::ProcessorFeatures::hasAvx2() -> bool {
+    return getCurrent().mHasAvx2 && sLevel >= ProcessorLevel::eAvx2;
+}
+
+auto tomurcuk::ProcessorFeatures::hasBmi2() -> bool {
+    return getCurrent().mHasBmi2 && sLevel >= ProcessorLevel::eAvx2;
+}
+
+auto tomurcuk::ProcessorFeatures::hasAvx512() -> bool {
+    return getCurrent().mHasAvx512 && sLevel >= ProcessorLevel::eAvx512;
+}
+
+auto tomurcuk::ProcessorFeatures::getSupportedLevel() -> ProcessorLevel {
+    auto processorFeatures = getCurrent();
+    if (processorFeatures.mHasAvx512) {
+        return ProcessorLevel::eAvx512;
+    }
+    if (processorFeatures.mHasAvx2) {
+        return ProcessorLevel::eAvx2;
+    }
+    if (processorFeatures.mHasSse42) {
+        return ProcessorLevel::eSse42;
+    }
+    if (processorFeatures.mHasSse2) {
+        return ProcessorLevel::eSse2;
+    }
+    return ProcessorLevel::ePortable;
+}
+
+auto tomurcuk::ProcessorFeatures::getLevel() -> ProcessorLevel {
+    return sLevel;
+}
+
+auto tomurcuk::ProcessorFeatures::setLevel(ProcessorLevel level) -> void {
+    sLevel = level;
+}
+
+auto tomurcuk::ProcessorFeatures::getCurrent() -> ProcessorFeatures {
+    // Initialization of local statics is thread-safe, and the detection gives
+    // the same result every time; so, it is done once.
+    static auto const kProcessorFeatures = detect();
+    return kProcessorFeatures;
+}
+
+auto tomurcuk::ProcessorFeatures::detect() -> ProcessorFeatures {
+    ProcessorFeatures processorFeatures;
+    processorFeatures.mHasSse2 = false;
+    processorFeatures.mHasSsse3 = false;
+    processorFeatures.mHasSse41 = false;
+    processorFeatures.mHasSse42 = false;
+    processorFeatures.mHasPclmul = false;
+    processorFeatures.mHasPopcnt = false;
+    processorFeatures.mHasAvx2 = false;
+    processorFeatures.mHasBmi2 = false;
+    processorFeatures.mHasAvx512 = false;
+
+#if defined(__x86_64__)
+    // SSE2 is a part of the x86-64 baseline.
+    processorFeatures.mHasSse2 = true;
+
+    auto eax = 0U;
+    auto ebx = 0U;
+    auto ecx = 0U;
+    auto edx = 0U;
+    if (__get_cpuid_count(1, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return processorFeatures;
+    }
+    processorFeatures.mHasSsse3 = (ecx & (1U << 9U)) != 0;
+    processorFeatures.mHasSse41 = (ecx & (1U << 19U)) != 0;
+    processorFeatures.mHasSse42 = (ecx & (1U << 20U)) != 0;
+    processorFeatures.mHasPclmul = (ecx & (1U << 1U)) != 0;
+    processorFeatures.mHasPopcnt = (ecx & (1U << 23U)) != 0;
+
+    // The wide registers are only usable if the operating system saves them
+    // on context switches, which is reported through `XCR0`.
+    auto hasOsxsave = (ecx & (1U << 27U)) != 0;
+    auto hasAvx = (ecx & (1U << 28U)) != 0;
+    auto xcr0 = UINT64_C(0);
+    if (hasOsxsave) {
+        auto xcr0Low = 0U;
+        auto xcr0High = 0U;
+        __asm__("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+        xcr0 = ((uint64_t)xcr0High << 32U) | xcr0Low;
+    }
+    auto savesAvxState = (xcr0 & UINT64_C(0x06)) == UINT64_C(0x06);
+    auto savesAvx512State = (xcr0 & UINT64_C(0xE6)) == UINT64_C(0xE6);
+
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return processorFeatures;
+    }
+    processorFeatures.mHasAvx2 = hasAvx && savesAvxState && (ebx & (1U << 5U)) != 0;
+    processorFeatures.mHasBmi2 = (ebx & (1U << 8U)) != 0;
+    processorFeatures.mHasAvx512 = savesAvx512State
+                                && (ebx & (1U << 16U)) != 0
+                                && (ebx & (1U << 30U)) != 0
+                                && (ebx & (1U << 31U)) != 0;
+#endif
+
+    return processorFeatures;
+}
+
+tomurcuk::ProcessorLevel tomurcuk::ProcessorFeatures::sLevel = ProcessorLevel::eAvx512;
@@ -0,0 +1,83 @@
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <tomurcuk/XxHash64.hpp>
+
+auto tomurcuk::XxHash64::hash(uint8_t *block, int64_t size, uint64_t seed) -> uint64_t {
+    assert((block == nullptr) == (size == 0));
+    assert(size >= 0);
+
+    auto hash = UINT64_C(0);
+    auto remaining = size;
+    if (remaining >= 32) {
+        // Four independent lanes keep the multipliers busy.
+        auto accumulator0 = seed + kPrime1 + kPrime2;
+        auto accumulator1 = seed + kPrime2;
+        auto accumulator2 = seed;
+        auto accumulator3 = seed - kPrime1;
+        for (; remaining >= 32; block += 32, remaining -= 32) {
+            accumulator0 = round(accumulator0, load64(block));
+            accumulator1 = round(accumulator1, load64(block + 8));
+            accumulator2 = round(accumulator2, load64(block + 16));
+            accumulator3 = round(accumulator3, load64(block + 24));
+        }
+        hash = rotate(accumulator0, 1) + rotate(accumulator1, 7) + rotate(accumulator2, 12) + rotate(accumulator3, 18);
+        hash = merge(hash, accumulator0);
+        hash = merge(hash, accumulator1);
+        hash = merge(hash, accumulator2);
+        hash = merge(hash, accumulator3);
+    } else {
+        hash = seed + kPrime5;
+    }
+    hash += (uint64_t)size;
+
+    for (; remaining >= 8; block += 8, remaining -= 8) {
+        hash ^= round(0, load64(block));
+        hash = rotate(hash, 27) * kPrime1 + kPrime4;
+    }
+    if (remaining >= 4) {
+        hash ^= (uint64_t)load32(block) * kPrime1;
+        hash = rotate(hash, 23) * kPrime2 + kPrime3;
+        block += 4;
+        remaining -= 4;
+    }
+    for (; remaining != 0; block++, remaining--) {
+        hash ^= *block * kPrime5;
+        hash = rotate(hash, 11) * kPrime1;
+    }
+
+    // Avalanche the bits.
+    hash ^= hash >> 33U;
+    hash *= kPrime2;
+    hash ^= hash >> 29U;
+    hash *= kPrime3;
+    hash ^= hash >> 32U;
+    return hash;
+}
+
+auto tomurcuk::XxHash64::round(uint64_t accumulator, uint64_t lane) -> uint64_t {
+    accumulator += lane * kPrime2;
+    accumulator = rotate(accumulator, 31);
+    return accumulator * kPrime1;
+}
+
+auto tomurcuk::XxHash64::merge(uint64_t hash, uint64_t accumulator) -> uint64_t {
+    hash ^= round(0, accumulator);
+    return hash * kPrime1 + kPrime4;
+}
+
+auto tomurcuk::XxHash64::rotate(uint64_t value, uint32_t amount) -> uint64_t {
+    return (value << amount) | (value >> (64U - amount));
+}
+
+auto tomurcuk::XxHash64::load64(uint8_t *bytes) -> uint64_t {
+    uint64_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+auto tomurcuk::XxHash64::load32(uint8_t *bytes) -> uint32_t {
+    uint32_t value;
+    memcpy(&value, bytes, sizeof(value));
+    return value;
+}
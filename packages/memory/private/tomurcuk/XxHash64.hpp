@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Kernel that calculates the 64-bit xxHash.
+     */
+    class XxHash64 {
+    public:
+        /**
+         * Hashes a block of bytes.
+         *
+         * @param[in] block The pointer to the hashed bytes.
+         * @param[in] size The amount of hashed bytes.
+         * @param[in] seed The value that selects a member of the hash family.
+         * @return The hash of the given block.
+         */
+        static auto hash(uint8_t *block, int64_t size, uint64_t seed) -> uint64_t;
+
+    private:
+        static constexpr auto kPrime1 = UINT64_C(0x9E37'79B1'85EB'CA87);
+        static constexpr auto kPrime2 = UINT64_C(0xC2B2'AE3D'27D4'EB4F);
+        static constexpr auto kPrime3 = UINT64_C(0x1656'67B1'9E37'79F9);
+        static constexpr auto kPrime4 = UINT64_C(0x85EB'CA77'C2B2'AE63);
+        static constexpr auto kPrime5 = UINT64_C(0x27D4'EB2F'1656'67C5);
+
+        static auto round(uint64_t accumulator, uint64_t lane) -> uint64_t;
+        static auto merge(uint64_t hash, uint64_t accumulator) -> uint64_t;
+        static auto rotate(uint64_t value, uint32_t amount) -> uint64_t;
+        static auto load64(uint8_t *bytes) -> uint64_t;
+        static auto load32(uint8_t *bytes) -> uint32_t;
+    };
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/MirroredBlock.hpp>
+#include <tomurcuk/Result.hpp>
+
+namespace tomurcuk {
+    /**
+     * First-in-first-out queue of bytes over a @ref MirroredBlock.
+     *
+     * The readable and the writable bytes are both exposed as single
+     * contiguous spans, even when they wrap around the end of the block; so,
+     * parsers and @ref Bytes kernels can work on them in place.
+     *
+     * To write to the ring:
+     *   1- Write to the span provided by @ref getWritable and
+     *      @ref getWritableSize.
+     *   2- Mark the newly written bytes as readable via
+     *      @ref acknowledgeWritten.
+     *
+     * To read from the ring:
+     *   1- Read from the span provided by @ref getReadable and
+     *      @ref getReadableSize.
+     *   2- Mark the read bytes as writable via @ref acknowledgeRead.
+     */
+    class ByteRing {
+    public:
+        /**
+         * Creates a new ring that is empty.
+         *
+         * @param[in] capacity The least amount of bytes the ring can hold,
+         * which is rounded up to the allocation granularity of the platform.
+         * @return The created ring on success.
+         */
+        static auto create(int64_t capacity) -> Result<ByteRing>;
+
+        /**
+         * Unmaps the backing memory.
+         */
+        auto destroy() -> void;
+
+        /**
+         * Provides the amount of bytes the ring can hold.
+         *
+         * @return The capacity of the backing block.
+         */
+        auto getCapacity() -> int64_t;
+
+        /**
+         * Provides the oldest byte that was not read yet.
+         *
+         * @return The pointer to the beginning of the readable span.
+         */
+        auto getReadable() -> uint8_t *;
+
+        /**
+         * Provides the amount of bytes that can be read.
+         *
+         * @return The size of the readable span.
+         */
+        auto getReadableSize() -> int64_t;
+
+        /**
+         * Provides the slot that will hold the next written byte.
+         *
+         * @return The pointer to the beginning of the writable span.
+         */
+        auto getWritable() -> uint8_t *;
+
+        /**
+         * Provides the amount of bytes that can be written.
+         *
+         * @return The size of the writable span.
+         */
+        auto getWritableSize() -> int64_t;
+
+        /**
+         * Marks some amount of leading writable bytes as readable.
+         *
+         * @param[in] amount The amount of bytes that were written.
+         */
+        auto acknowledgeWritten(int64_t amount) -> void;
+
+        /**
+         * Marks some amount of leading readable bytes as writable.
+         *
+         * @param[in] amount The amount of bytes that were read.
+         */
+        auto acknowledgeRead(int64_t amount) -> void;
+
+    private:
+        MirroredBlock mMirroredBlock;
+
+        /**
+         * The offset of the oldest readable byte in the first mapping.
+         */
+        int64_t mReadCursor;
+
+        /**
+         * The amount of readable bytes.
+         */
+        int64_t mReadableSize;
+    };
+}
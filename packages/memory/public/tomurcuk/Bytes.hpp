@@ -2,10 +2,17 @@
 
 #include <assert.h>
 #include <stdint.h>
+#include <tomurcuk/Ordering.hpp>
 
 namespace tomurcuk {
     /*
      * Utilities to work with memory without manually calculating byte counts.
+     *
+     * Objects and arrays of a small constant size are handled inline, which
+     * lets the compiler use plain moves instead of calling into the library.
+     * Blocks that are at least as big as the streaming threshold are written
+     * with non-temporal stores, so that they do not evict the caches of the
+     * other cores.
      */
     class Bytes {
     public:
@@ -48,6 +55,10 @@ namespace tomurcuk {
             assert(count >= 0);
             assert(count <= INT64_MAX / (int64_t)sizeof(Element));
 
+            if (__builtin_constant_p(count) && count <= kInlineSizeLimit / (int64_t)sizeof(Element)) {
+                __builtin_memset(array, 0, (uint64_t)count * sizeof(Element));
+                return;
+            }
             resetBlock(array, count * (int64_t)sizeof(Element));
         }
 
@@ -84,6 +95,10 @@ namespace tomurcuk {
             assert(count >= 0);
             assert(count <= INT64_MAX / (int64_t)sizeof(Element));
 
+            if (__builtin_constant_p(count) && count <= kInlineSizeLimit / (int64_t)sizeof(Element)) {
+                __builtin_memcpy(destinationArray, sourceArray, (uint64_t)count * sizeof(Element));
+                return;
+            }
             copyBlock(destinationArray, sourceArray, count * (int64_t)sizeof(Element));
         }
 
@@ -102,6 +117,10 @@ namespace tomurcuk {
             assert(count >= 0);
             assert(count <= INT64_MAX / (int64_t)sizeof(Element));
 
+            if (__builtin_constant_p(count) && count <= kInlineSizeLimit / (int64_t)sizeof(Element)) {
+                __builtin_memmove(destinationArray, sourceArray, (uint64_t)count * sizeof(Element));
+                return;
+            }
             copyAliasingBlock(destinationArray, sourceArray, count * (int64_t)sizeof(Element));
         }
 
@@ -135,7 +154,11 @@ namespace tomurcuk {
          */
         template<typename Object>
         static auto resetObject(Object *object) -> void {
-            resetBlock(object, sizeof(Object));
+            if constexpr ((int64_t)sizeof(Object) <= kInlineSizeLimit) {
+                __builtin_memset(object, 0, sizeof(Object));
+            } else {
+                resetBlock(object, sizeof(Object));
+            }
         }
 
         /**
@@ -163,7 +186,11 @@ namespace tomurcuk {
          */
         template<typename Object>
         static auto copyObject(Object *destinationObject, Object *sourceObject) -> void {
-            copyBlock(destinationObject, sourceObject, sizeof(Object));
+            if constexpr ((int64_t)sizeof(Object) <= kInlineSizeLimit) {
+                __builtin_memcpy(destinationObject, sourceObject, sizeof(Object));
+            } else {
+                copyBlock(destinationObject, sourceObject, sizeof(Object));
+            }
         }
 
         /**
@@ -177,7 +204,11 @@ namespace tomurcuk {
          */
         template<typename Object>
         static auto copyAliasingObject(Object *destinationObject, Object *sourceObject) -> void {
-            copyAliasingBlock(destinationObject, sourceObject, sizeof(Object));
+            if constexpr ((int64_t)sizeof(Object) <= kInlineSizeLimit) {
+                __builtin_memmove(destinationObject, sourceObject, sizeof(Object));
+            } else {
+                copyAliasingBlock(destinationObject, sourceObject, sizeof(Object));
+            }
         }
 
         /**
@@ -193,6 +224,29 @@ namespace tomurcuk {
             return testBlockExactness(object0, sizeof(Object), object1, sizeof(Object));
         }
 
+        /**
+         * Provides the size from which on blocks are written with
+         * non-temporal stores.
+         *
+         * @return The current streaming threshold in bytes.
+         */
+        static auto getStreamingThreshold() -> int64_t;
+
+        /**
+         * Sets the size from which on blocks are written with non-temporal
+         * stores.
+         *
+         * Should be around the size of the last level cache that is available
+         * to a core. Blocks that are bigger would evict the whole cache anyway,
+         * while the smaller ones might be read again before they are evicted.
+         *
+         * @warning This is not thread-safe!
+         *
+         * @param[in] streamingThreshold The amount of bytes from which on
+         * blocks are streamed. By default, 4 MiB.
+         */
+        static auto setStreamingThreshold(int64_t streamingThreshold) -> void;
+
         /**
          * Fills an array of bytes with `0`s.
          *
@@ -245,5 +299,162 @@ namespace tomurcuk {
          * @return Whether the bytes in the given blocks are exactly the same.
          */
         static auto testBlockExactness(void *block0, int64_t size0, void *block1, int64_t size1) -> bool;
+
+        /**
+         * Orders a pair of blocks lexicographically by their unsigned bytes.
+         *
+         * A block that is a prefix of the other one is ordered first.
+         *
+         * @param[in] block0 The pointer to the first compared block.
+         * @param[in] size0 The amount of bytes in the first compared block.
+         * @param[in] block1 The pointer to the second compared block.
+         * @param[in] size1 The amount of bytes in the second compared block.
+         * @return The ordering of the first block relative to the second one.
+         */
+        static auto compareBlocks(void *block0, int64_t size0, void *block1, int64_t size1) -> Ordering;
+
+        /**
+         * Finds the first occurrence of a byte in an array of bytes.
+         *
+         * @param[in] block The pointer to the searched block.
+         * @param[in] size The amount of bytes that will be searched.
+         * @param[in] byte The searched byte.
+         * @return The index of the first occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        static auto findByte(void *block, int64_t size, uint8_t byte) -> int64_t;
+
+        /**
+         * Finds the last occurrence of a byte in an array of bytes.
+         *
+         * @param[in] block The pointer to the searched block.
+         * @param[in] size The amount of bytes that will be searched.
+         * @param[in] byte The searched byte.
+         * @return The index of the last occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        static auto findLastByte(void *block, int64_t size, uint8_t byte) -> int64_t;
+
+        /**
+         * Finds the first occurrence of any byte from a set in an array of
+         * bytes.
+         *
+         * @param[in] block The pointer to the searched block.
+         * @param[in] size The amount of bytes that will be searched.
+         * @param[in] needles The pointer to the searched bytes.
+         * @param[in] needleCount The amount of searched bytes, which must be at
+         * most `16`.
+         * @return The index of the first occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        static auto findAnyByte(void *block, int64_t size, uint8_t *needles, int64_t needleCount) -> int64_t;
+
+        /**
+         * Counts the occurrences of a byte in an array of bytes.
+         *
+         * @param[in] block The pointer to the searched block.
+         * @param[in] size The amount of bytes that will be searched.
+         * @param[in] byte The counted byte.
+         * @return The amount of occurrences.
+         */
+        static auto countByte(void *block, int64_t size, uint8_t byte) -> int64_t;
+
+        /**
+         * Finds the first index where a pair of blocks have different bytes.
+         *
+         * @param[in] block0 The pointer to the first compared block.
+         * @param[in] block1 The pointer to the second compared block.
+         * @param[in] size The amount of bytes that will be compared.
+         * @return The index of the first differing byte if there is one.
+         * Otherwise, `-1`.
+         */
+        static auto findMismatch(void *block0, void *block1, int64_t size) -> int64_t;
+
+        /**
+         * Continues a CRC-32C (Castagnoli) checksum over an array of bytes.
+         *
+         * Uses the `crc32` instruction when the processor supports it.
+         *
+         * @param[in] block The pointer to the checksummed block.
+         * @param[in] size The amount of bytes that will be checksummed.
+         * @param[in] checksum The checksum of the bytes that came before the
+         * block, or `0` if the block is the first one.
+         * @return The checksum of the preceding bytes followed by the block.
+         */
+        static auto checksumBlockWithCrc32c(void *block, int64_t size, uint32_t checksum) -> uint32_t;
+
+        /**
+         * Finds the CRC-32C checksum of a pair of consecutive blocks from the
+         * checksums of the blocks.
+         *
+         * This lets the parts of a big block be checksummed in parallel.
+         *
+         * @param[in] checksum0 The checksum of the first block.
+         * @param[in] checksum1 The checksum of the second block, which was
+         * started from `0`.
+         * @param[in] size1 The amount of bytes in the second block.
+         * @return The checksum of the first block followed by the second one.
+         */
+        static auto combineCrc32cChecksums(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t;
+
+        /**
+         * Continues an Adler-32 checksum over an array of bytes.
+         *
+         * @param[in] block The pointer to the checksummed block.
+         * @param[in] size The amount of bytes that will be checksummed.
+         * @param[in] checksum The checksum of the bytes that came before the
+         * block, or `1` if the block is the first one.
+         * @return The checksum of the preceding bytes followed by the block.
+         */
+        static auto checksumBlockWithAdler32(void *block, int64_t size, uint32_t checksum) -> uint32_t;
+
+        /**
+         * Finds the Adler-32 checksum of a pair of consecutive blocks from the
+         * checksums of the blocks.
+         *
+         * @param[in] checksum0 The checksum of the first block.
+         * @param[in] checksum1 The checksum of the second block, which was
+         * started from `1`.
+         * @param[in] size1 The amount of bytes in the second block.
+         * @return The checksum of the first block followed by the second one.
+         */
+        static auto combineAdler32Checksums(uint32_t checksum0, uint32_t checksum1, int64_t size1) -> uint32_t;
+
+        /**
+         * Calculates the 64-bit xxHash of an array of bytes.
+         *
+         * @warning This cannot be continued or combined; the whole block must
+         * be given at once.
+         *
+         * @param[in] block The pointer to the checksummed block.
+         * @param[in] size The amount of bytes that will be checksummed.
+         * @param[in] seed The value that selects a member of the hash family.
+         * @return The checksum of the block.
+         */
+        static auto checksumBlockWithXxHash64(void *block, int64_t size, uint64_t seed) -> uint64_t;
+
+    private:
+        /**
+         * The amount of bytes up to which objects and constant-sized arrays
+         * are handled inline.
+         */
+        static constexpr auto kInlineSizeLimit = INT64_C(64);
+
+        /**
+         * The default value of @ref sStreamingThreshold.
+         */
+        static constexpr auto kDefaultStreamingThreshold = INT64_C(4) << 20U;
+
+        /**
+         * The amount of bytes below which blocks are compared word by word
+         * instead of with the vectorized kernels.
+         */
+        static constexpr auto kShortComparisonLimit = INT64_C(32);
+
+        /**
+         * The amount of bytes from which on blocks are written with
+         * non-temporal stores.
+         */
+        static int64_t sStreamingThreshold;
     };
 }
@@ -19,11 +19,22 @@ namespace tomurcuk {
 
     private:
         static auto reallocateImplementation(void *state, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *>;
+        static auto allocateZeroedImplementation(void *state, int64_t newSize, int64_t alignment) -> Result<void *>;
         auto reallocate(void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *>;
+        auto allocateZeroed(int64_t size, int64_t alignment) -> Result<void *>;
         auto isLastAllocation(void *block, int64_t size) -> bool;
         auto allocate(int64_t size, int64_t alignment) -> Result<void *>;
 
         VirtualBlock mVirtualBlock;
         int64_t mCursor;
+
+        /**
+         * The highest the cursor has been since the memory after it was last
+         * given back to the operating system.
+         *
+         * The reserved memory after this was never handed out; so, it still
+         * holds the `0`s the operating system filled it with.
+         */
+        int64_t mDirtyCursor;
     };
 }
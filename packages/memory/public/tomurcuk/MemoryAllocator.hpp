@@ -8,12 +8,22 @@ namespace tomurcuk {
     class MemoryAllocator {
     public:
         static auto create(void *state, auto (*reallocate)(void *state, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment)->Result<void *>) -> MemoryAllocator;
+        static auto create(void *state, auto (*reallocate)(void *state, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment)->Result<void *>, auto (*allocateZeroed)(void *state, int64_t newSize, int64_t alignment)->Result<void *>) -> MemoryAllocator;
         auto allocate(int64_t newSize, int64_t alignment) -> Result<void *>;
+        auto allocateZeroed(int64_t newSize, int64_t alignment) -> Result<void *>;
         auto reallocate(void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *>;
         auto deallocate(void *oldBlock, int64_t oldSize, int64_t alignment) -> void;
 
     private:
         void *mState;
         auto (*mReallocate)(void *state, void *oldBlock, int64_t oldSize, int64_t newSize, int64_t alignment) -> Result<void *>;
+
+        /**
+         * Allocates a block that reads as `0`s, which might skip resetting the
+         * memory that is known to be fresh from the operating system.
+         *
+         * Might be `nullptr`, in which case the allocated block is reset.
+         */
+        auto (*mAllocateZeroed)(void *state, int64_t newSize, int64_t alignment) -> Result<void *>;
     };
 }
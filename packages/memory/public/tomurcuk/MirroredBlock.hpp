@@ -0,0 +1,52 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/Result.hpp>
+
+namespace tomurcuk {
+    /**
+     * Block of memory that is mapped twice back to back.
+     *
+     * The bytes at `address() + i` and `address() + capacity() + i` are the
+     * same physical bytes; so, any span of at most `capacity()` bytes that
+     * starts in the first mapping is contiguous, even if it wraps around the
+     * end of the block.
+     */
+    class MirroredBlock {
+    public:
+        /**
+         * Maps a new block.
+         *
+         * @param[in] capacity The least amount of bytes in a single mapping,
+         * which is rounded up to the allocation granularity of the platform.
+         * @return The created block on success.
+         */
+        static auto create(int64_t capacity) -> Result<MirroredBlock>;
+
+        /**
+         * Unmaps both mappings of the block.
+         */
+        auto destroy() -> void;
+
+        /**
+         * Provides the beginning of the first mapping.
+         *
+         * @return The address of the first mapping, which is followed by the
+         * second one.
+         */
+        auto address() -> void *;
+
+        /**
+         * Provides the size of a single mapping.
+         *
+         * @return The amount of bytes in a single mapping.
+         */
+        auto capacity() -> int64_t;
+
+    private:
+        static auto alignToAllocationGranularity(int64_t amount) -> int64_t;
+
+        void *mAddress;
+        int64_t mCapacity;
+    };
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Result of a three-way comparison, which tells how the first compared
+     * value is placed relative to the second one.
+     */
+    enum class Ordering : int8_t {
+        eLess = -1,
+        eEqual = 0,
+        eGreater = 1,
+    };
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <tomurcuk/ProcessorLevel.hpp>
+
+namespace tomurcuk {
+    /**
+     * Instruction set extensions of the processor the program runs on.
+     *
+     * Used for selecting the fastest implementation of a kernel at run-time.
+     * Extensions that need operating system support for their registers are
+     * only reported when the operating system saves those registers.
+     *
+     * The extensions above a level can be hidden, so that the tests can run
+     * the implementations of every level the processor supports.
+     */
+    class ProcessorFeatures {
+    public:
+        /**
+         * Tests whether SSE2 instructions can be used.
+         *
+         * @return Whether SSE2 is supported.
+         */
+        static auto hasSse2() -> bool;
+
+        /**
+         * Tests whether SSSE3 instructions can be used.
+         *
+         * @return Whether SSSE3 is supported.
+         */
+        static auto hasSsse3() -> bool;
+
+        /**
+         * Tests whether SSE4.1 instructions can be used.
+         *
+         * @return Whether SSE4.1 is supported.
+         */
+        static auto hasSse41() -> bool;
+
+        /**
+         * Tests whether SSE4.2 instructions, which include `crc32`, can be
+         * used.
+         *
+         * @return Whether SSE4.2 is supported.
+         */
+        static auto hasSse42() -> bool;
+
+        /**
+         * Tests whether carry-less multiplication instructions can be used.
+         *
+         * @return Whether PCLMULQDQ is supported.
+         */
+        static auto hasPclmul() -> bool;
+
+        /**
+         * Tests whether the `popcnt` instruction can be used.
+         *
+         * @return Whether POPCNT is supported.
+         */
+        static auto hasPopcnt() -> bool;
+
+        /**
+         * Tests whether AVX2 instructions can be used.
+         *
+         * @return Whether AVX2 is supported by both the processor and the
+         * operating system.
+         */
+        static auto hasAvx2() -> bool;
+
+        /**
+         * Tests whether BMI2 instructions, which include `pdep` and `pext`, can
+         * be used.
+         *
+         * @return Whether BMI2 is supported.
+         */
+        static auto hasBmi2() -> bool;
+
+        /**
+         * Tests whether the AVX-512 foundation, byte-word and vector-length
+         * extensions can be used together.
+         *
+         * @return Whether AVX-512F, AVX-512BW and AVX-512VL are supported by
+         * both the processor and the operating system.
+         */
+        static auto hasAvx512() -> bool;
+
+        /**
+         * Provides the highest level of extensions the processor supports.
+         *
+         * @return The level of the fastest implementations.
+         */
+        static auto getSupportedLevel() -> ProcessorLevel;
+
+        /**
+         * Provides the highest level of extensions that are not hidden.
+         *
+         * @return The level the kernels are selected from.
+         */
+        static auto getLevel() -> ProcessorLevel;
+
+        /**
+         * Hides the extensions above a level, so that the kernels select the
+         * implementations of that level on their next use.
+         *
+         * @warning This is not thread-safe!
+         *
+         * @param[in] level The highest level of extensions that might be
+         * used. By default, all of them.
+         */
+        static auto setLevel(ProcessorLevel level) -> void;
+
+        /**
+         * Provides the implementations of a kernel that were selected by the
+         * extensions, and selects them again if the level changed since.
+         *
+         * @tparam Kernels The type of the implementations.
+         * @tparam kSelect The function that selects the implementations.
+         * @return The selected implementations.
+         */
+        template<typename Kernels, auto (*kSelect)() -> Kernels>
+        static auto getKernels() -> Kernels {
+            static auto level = sLevel;
+            static auto kernels = kSelect();
+            if (level != sLevel) {
+                level = sLevel;
+                kernels = kSelect();
+            }
+            return kernels;
+        }
+
+    private:
+        /**
+         * The highest level of extensions that are not hidden.
+         */
+        static ProcessorLevel sLevel;
+
+        /**
+         * Provides the features that were detected on the first call.
+         *
+         * @return The cached features.
+         */
+        static auto getCurrent() -> ProcessorFeatures;
+
+        /**
+         * Queries the processor and the operating system for the features.
+         *
+         * @return The detected features.
+         */
+        static auto detect() -> ProcessorFeatures;
+
+        bool mHasSse2;
+        bool mHasSsse3;
+        bool mHasSse41;
+        bool mHasSse42;
+        bool mHasPclmul;
+        bool mHasPopcnt;
+        bool mHasAvx2;
+        bool mHasBmi2;
+        bool mHasAvx512;
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace tomurcuk {
+    /**
+     * Group of instruction set extensions that the kernels are implemented
+     * for, where every level includes the extensions of the ones below it.
+     */
+    enum class ProcessorLevel : int8_t {
+        /**
+         * No extensions, which selects the portable implementations.
+         */
+        ePortable,
+
+        /**
+         * SSE2, which is a part of the x86-64 baseline.
+         */
+        eSse2,
+
+        /**
+         * SSSE3, SSE4.1, SSE4.2, PCLMULQDQ and POPCNT.
+         */
+        eSse42,
+
+        /**
+         * AVX2 and BMI2.
+         */
+        eAvx2,
+
+        /**
+         * AVX-512F, AVX-512BW and AVX-512VL.
+         */
+        eAvx512,
+    };
+}
@@ -0,0 +1,81 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MirroredBlock.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <tomurcuk/Windows.hpp>
+
+// `VirtualAlloc2` and `MapViewOfFile3` are only exported through this.
+#pragma comment(lib, "onecore.lib")
+
+static_assert(sizeof(size_t) == 8);
+static_assert(sizeof(DWORD) == 4);
+
+auto tomurcuk::MirroredBlock::create(int64_t capacity) -> Result<MirroredBlock> {
+    assert(capacity > 0);
+    assert(capacity <= INT64_MAX / 4);
+
+    capacity = alignToAllocationGranularity(capacity);
+
+    // The pages live in a section backed by the paging file, which is the
+    // only way to map the same pages at two addresses.
+    auto section = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)((uint64_t)capacity >> 32U), (DWORD)capacity, nullptr);
+    if (section == nullptr) {
+        return Result<MirroredBlock>::failure();
+    }
+
+    // Reserve the whole range as a placeholder, so that nothing else can be
+    // mapped between the two halves, split it, and then replace each half
+    // with a view of the section.
+    auto address = VirtualAlloc2(nullptr, nullptr, (size_t)capacity * 2, MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS, nullptr, 0);
+    if (address == nullptr) {
+        CloseHandle(section);
+        return Result<MirroredBlock>::failure();
+    }
+    if (VirtualFree(address, (size_t)capacity, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER) == 0) {
+        VirtualFree(address, 0, MEM_RELEASE);
+        CloseHandle(section);
+        return Result<MirroredBlock>::failure();
+    }
+
+    auto firstView = MapViewOfFile3(section, nullptr, address, 0, (size_t)capacity, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    if (firstView == nullptr) {
+        VirtualFree(address, 0, MEM_RELEASE);
+        VirtualFree((char *)address + capacity, 0, MEM_RELEASE);
+        CloseHandle(section);
+        return Result<MirroredBlock>::failure();
+    }
+    auto secondView = MapViewOfFile3(section, nullptr, (char *)address + capacity, 0, (size_t)capacity, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    if (secondView == nullptr) {
+        UnmapViewOfFile(firstView);
+        VirtualFree((char *)address + capacity, 0, MEM_RELEASE);
+        CloseHandle(section);
+        return Result<MirroredBlock>::failure();
+    }
+
+    // The views keep the section alive.
+    CloseHandle(section);
+
+    MirroredBlock mirroredBlock;
+    mirroredBlock.mAddress = address;
+    mirroredBlock.mCapacity = capacity;
+    return Results::success(mirroredBlock);
+}
+
+auto tomurcuk::MirroredBlock::destroy() -> void {
+    if (UnmapViewOfFile(mAddress) == 0) {
+        abort();
+    }
+    if (UnmapViewOfFile((char *)mAddress + mCapacity) == 0) {
+        abort();
+    }
+}
+
+auto tomurcuk::MirroredBlock::alignToAllocationGranularity(int64_t amount) -> int64_t {
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return Bytes::alignUpwards(amount, (int64_t)systemInfo.dwAllocationGranularity);
+}
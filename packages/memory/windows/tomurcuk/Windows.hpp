@@ -52,6 +52,7 @@
 
 #include <Windows.h>
 #include <errhandlingapi.h>
+#include <handleapi.h>
 #include <memoryapi.h>
 #include <minwindef.h>
 #include <sysinfoapi.h>
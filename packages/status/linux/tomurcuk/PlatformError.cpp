@@ -0,0 +1,22 @@
+#include <stdint.h>
+#include <tomurcuk/PlatformError.hpp>
+#include <tomurcuk/StandardError.hpp>
+
+// The errors of the operating system are reported through `errno`; so, they
+// are handled as errors of the C standard library.
+
+auto tomurcuk::PlatformError::getCurrent() -> PlatformError {
+    PlatformError result;
+    result.mCode = StandardError::getCurrent().getCode();
+    return result;
+}
+
+auto tomurcuk::PlatformError::format(char *buffer, uint64_t capacity) -> uint64_t {
+    StandardError standardError;
+    standardError.initialize(mCode);
+    return standardError.format(buffer, capacity);
+}
+
+auto tomurcuk::PlatformError::getCode() -> uint32_t {
+    return mCode;
+}
@@ -0,0 +1,38 @@
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <tomurcuk/StandardError.hpp>
+
+static_assert(sizeof(errno) <= 4);
+
+auto tomurcuk::StandardError::getCurrent() -> StandardError {
+    StandardError result;
+    result.mCode = (uint32_t)errno;
+    return result;
+}
+
+auto tomurcuk::StandardError::initialize(uint32_t code) -> void {
+    mCode = code;
+}
+
+auto tomurcuk::StandardError::format(char *buffer, uint64_t capacity) -> uint64_t {
+    if (capacity == 0) {
+        return 0;
+    }
+
+    // The GNU version might return a static message instead of using the
+    // buffer.
+    auto message = strerror_r((int)mCode, buffer, capacity);
+    auto load = strlen(message) + 1;
+    if (load > capacity) {
+        return 0;
+    }
+    if (message != buffer) {
+        memcpy(buffer, message, load);
+    }
+    return load;
+}
+
+auto tomurcuk::StandardError::getCode() -> uint32_t {
+    return mCode;
+}
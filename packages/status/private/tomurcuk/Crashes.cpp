@@ -8,7 +8,7 @@
 #include <tomurcuk/StandardError.hpp>
 
 auto tomurcuk::Crashes::crash(char *format, ...) -> void {
-    auto arguments = va_list{};
+    va_list arguments;
     va_start(arguments, format);
     crashWith(format, arguments);
     va_end(arguments);
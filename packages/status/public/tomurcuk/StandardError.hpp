@@ -15,6 +15,13 @@ namespace tomurcuk {
          */
         static auto getCurrent() -> StandardError;
 
+        /**
+         * Creates an error from its code.
+         *
+         * @param[in] code The integer that represents the error.
+         */
+        auto initialize(uint32_t code) -> void;
+
         /**
          * Formats the error message to a buffer.
          *
@@ -11,6 +11,10 @@ auto tomurcuk::StandardError::getCurrent() -> StandardError {
     return result;
 }
 
+auto tomurcuk::StandardError::initialize(uint32_t code) -> void {
+    mCode = code;
+}
+
 auto tomurcuk::StandardError::format(char *buffer, uint64_t capacity) -> uint64_t {
     if (strerror_s(buffer, capacity, (int)mCode) != 0) {
         return 0;
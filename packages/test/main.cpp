@@ -1,12 +1,74 @@
 #include <greatest.h>
+#include <tomurcuk/ArrayDequeTest.hpp>
 #include <tomurcuk/ArrayOwnerTest.hpp>
+#include <tomurcuk/BTreeMapTest.hpp>
+#include <tomurcuk/BitSetTest.hpp>
+#include <tomurcuk/BlockPackingCodecTest.hpp>
+#include <tomurcuk/ByteRingTest.hpp>
+#include <tomurcuk/BytesTest.hpp>
+#include <tomurcuk/DeltaCodecTest.hpp>
+#include <tomurcuk/EytzingerIndexTest.hpp>
+#include <tomurcuk/FrameOfReferenceCodecTest.hpp>
+#include <tomurcuk/InlineArrayListTest.hpp>
 #include <tomurcuk/LinearMemoryAllocatorTest.hpp>
+#include <tomurcuk/OrderComparableTest.hpp>
+#include <tomurcuk/PackedIntArrayTest.hpp>
+#include <tomurcuk/PagedBitSetTest.hpp>
+#include <tomurcuk/ParallelSortsTest.hpp>
+#include <tomurcuk/PriorityQueueTest.hpp>
+#include <tomurcuk/RadixHeapTest.hpp>
+#include <tomurcuk/RoaringBitmapTest.hpp>
+#include <tomurcuk/RopeTest.hpp>
+#include <tomurcuk/SegmentedArrayListTest.hpp>
+#include <tomurcuk/SlotMapTest.hpp>
+#include <tomurcuk/SoAArrayListTest.hpp>
+#include <tomurcuk/SortsTest.hpp>
+#include <tomurcuk/SparseSetTest.hpp>
+#include <tomurcuk/StaticBTreeIndexTest.hpp>
+#include <tomurcuk/StringInternerTest.hpp>
+#include <tomurcuk/StringTest.hpp>
+#include <tomurcuk/SubstringFinderTest.hpp>
+#include <tomurcuk/SubstringSetFinderTest.hpp>
+#include <tomurcuk/TranscoderTest.hpp>
+#include <tomurcuk/Utf8CodecTest.hpp>
+#include <tomurcuk/VarintCodecTest.hpp>
 
 GREATEST_MAIN_DEFS(); // NOLINT
 
 auto main(int argc, char **argv) -> int {
     GREATEST_MAIN_BEGIN();
+    GREATEST_RUN_SUITE(tomurcuk::ArrayDequeTest::suite);
     GREATEST_RUN_SUITE(tomurcuk::ArrayOwnerTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::BTreeMapTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::BitSetTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::BlockPackingCodecTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::ByteRingTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::BytesTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::DeltaCodecTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::EytzingerIndexTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::FrameOfReferenceCodecTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::InlineArrayListTest::suite);
     GREATEST_RUN_SUITE(tomurcuk::LinearMemoryAllocatorTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::OrderComparableTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::PackedIntArrayTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::PagedBitSetTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::ParallelSortsTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::PriorityQueueTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::RadixHeapTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::RoaringBitmapTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::RopeTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SegmentedArrayListTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SlotMapTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SoAArrayListTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SortsTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SparseSetTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::StaticBTreeIndexTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::StringInternerTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::StringTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SubstringFinderTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::SubstringSetFinderTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::TranscoderTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::Utf8CodecTest::suite);
+    GREATEST_RUN_SUITE(tomurcuk::VarintCodecTest::suite);
     GREATEST_MAIN_END();
 }
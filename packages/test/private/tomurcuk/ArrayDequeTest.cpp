@@ -0,0 +1,133 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayDeque.hpp>
+#include <tomurcuk/ArrayDequeTest.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::ArrayDequeTest::suite() -> void {
+    GREATEST_RUN_TEST(testAddingAndRemoving);
+    GREATEST_RUN_TEST(testGrowingWhileWrapped);
+    GREATEST_RUN_TEST(testAddingInBulk);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::ArrayDequeTest::testAddingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    ArrayDeque<int64_t> deque;
+    deque.initialize();
+
+    // Use it as a queue that is never longer than a few elements, which makes
+    // it wrap many times without growing.
+    auto nextRemoved = INT64_C(0);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(deque.addLast(memoryAllocator, i) == Status::eSuccess);
+        if (deque.getCount() == 3) {
+            GREATEST_ASSERT_EQ_FMT(nextRemoved, deque.removeFirst(), "%" PRId64);
+            nextRemoved++;
+        }
+    }
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(4), deque.getAllocatedCount(), "%" PRId64);
+
+    GREATEST_ASSERT(deque.addFirst(memoryAllocator, -1) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), *deque.getFirst(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kCount - 1, deque.removeLast(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), deque.removeFirst(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kCount - 2, deque.removeFirst(), "%" PRId64);
+    GREATEST_ASSERT(deque.isEmpty());
+
+    deque.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::ArrayDequeTest::testGrowingWhileWrapped() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(100);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    ArrayDeque<int64_t> deque;
+    deque.initialize();
+
+    // Adding to the beginning keeps the elements wrapped on every growth.
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(deque.addLast(memoryAllocator, i) == Status::eSuccess);
+        GREATEST_ASSERT(deque.addFirst(memoryAllocator, -i - 1) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount * 2, deque.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != kCount * 2; i++) {
+        GREATEST_ASSERT_EQ_FMT(i - kCount, *deque.get(i), "%" PRId64);
+    }
+
+    auto firstView = deque.getFirstView();
+    auto secondView = deque.getSecondView();
+
+    GREATEST_ASSERT_EQ_FMT(kCount * 2, firstView.getCount() + secondView.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(-kCount, *firstView.getFirst(), "%" PRId64);
+
+    deque.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::ArrayDequeTest::testAddingInBulk() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(6);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    ArrayDeque<int64_t> deque;
+    deque.initialize();
+
+    int64_t elements[kCount] = {0, 1, 2, 3, 4, 5};
+    ArrayListView<int64_t> view;
+    view.initialize(elements, kCount);
+
+    GREATEST_ASSERT(deque.addAll(memoryAllocator, view) == Status::eSuccess);
+
+    deque.removeLeading(kCount - 1);
+
+    // The block holds 8 elements and the head is at 5; so, these wrap.
+    GREATEST_ASSERT(deque.addAll(memoryAllocator, view) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(8), deque.getAllocatedCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(3), deque.getFirstView().getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(4), deque.getSecondView().getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(1), deque.getFirstUninitializedView().getCount(), "%" PRId64);
+    GREATEST_ASSERT(deque.getSecondUninitializedView().isEmpty());
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, *deque.get(i + 1), "%" PRId64);
+    }
+
+    deque.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
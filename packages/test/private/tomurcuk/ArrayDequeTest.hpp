@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class ArrayDequeTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testAddingAndRemoving() -> greatest_test_res;
+        static auto testGrowingWhileWrapped() -> greatest_test_res;
+        static auto testAddingInBulk() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,262 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BTreeMap.hpp>
+#include <tomurcuk/BTreeMapTest.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::BTreeMapTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testPuttingAndRemoving);
+        GREATEST_RUN_TEST(testBulkLoading);
+        GREATEST_RUN_TEST(testOrderingByComparator);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::BTreeMapTest::testPuttingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kKeyCount = INT64_C(2048);
+    static constexpr auto kOperationCount = INT64_C(100'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Small nodes make the tree deep, so that splits and removals reach the
+    // root many times.
+    BTreeMap<int64_t, int64_t, OrderComparable<int64_t>, 128> map;
+    map.initialize();
+    int64_t values[kKeyCount];
+    for (auto &value : values) {
+        value = -1;
+    }
+    auto count = INT64_C(0);
+
+    auto state = UINT64_C(1);
+    for (auto i = INT64_C(0); i != kOperationCount; i++) {
+        state = state * UINT64_C(6'364'136'223'846'793'005) + UINT64_C(1'442'695'040'888'963'407);
+        auto key = (int64_t)((state >> 32U) % kKeyCount);
+
+        // Grow for a while, then shrink, so that nodes get both split and
+        // deallocated.
+        auto isRemoval = ((state >> 20U) & 7U) < (i < kOperationCount / 2 ? 3U : 6U);
+        if (isRemoval) {
+            GREATEST_ASSERT_EQ(values[key] != -1, map.remove(memoryAllocator, key));
+
+            if (values[key] != -1) {
+                values[key] = -1;
+                count--;
+            }
+        } else {
+            GREATEST_ASSERT(map.put(memoryAllocator, key, i) == Status::eSuccess);
+
+            if (values[key] == -1) {
+                count++;
+            }
+            values[key] = i;
+        }
+
+        GREATEST_ASSERT_EQ_FMT(count, map.getCount(), "%" PRId64);
+
+        if (i % 1000 == 0) {
+            auto cursor = map.getFirst();
+            for (auto j = INT64_C(0); j != kKeyCount; j++) {
+                if (values[j] == -1) {
+                    GREATEST_ASSERT_EQ(nullptr, map.get(j));
+                    continue;
+                }
+
+                GREATEST_ASSERT(cursor.isValid());
+                GREATEST_ASSERT_EQ_FMT(j, *cursor.getKey(), "%" PRId64);
+                GREATEST_ASSERT_EQ_FMT(values[j], *cursor.getValue(), "%" PRId64);
+                GREATEST_ASSERT_EQ_FMT(values[j], *map.get(j), "%" PRId64);
+
+                cursor.moveNext();
+            }
+
+            GREATEST_ASSERT(!cursor.isValid());
+        }
+    }
+
+    // Every key gets the nearest ones on both sides.
+    auto floorKey = INT64_C(-1);
+    for (auto i = INT64_C(0); i != kKeyCount; i++) {
+        if (values[i] != -1) {
+            floorKey = i;
+        }
+        auto floor = map.findFloor(i);
+
+        GREATEST_ASSERT_EQ(floorKey != -1, floor.isValid());
+
+        if (floorKey != -1) {
+            GREATEST_ASSERT_EQ_FMT(floorKey, *floor.getKey(), "%" PRId64);
+        }
+    }
+    auto ceilingKey = INT64_C(-1);
+    for (auto i = kKeyCount - 1; i >= 0; i--) {
+        if (values[i] != -1) {
+            ceilingKey = i;
+        }
+        auto ceiling = map.findCeiling(i);
+
+        GREATEST_ASSERT_EQ(ceilingKey != -1, ceiling.isValid());
+
+        if (ceilingKey != -1) {
+            GREATEST_ASSERT_EQ_FMT(ceilingKey, *ceiling.getKey(), "%" PRId64);
+        }
+    }
+
+    for (auto i = INT64_C(0); i != kKeyCount; i++) {
+        GREATEST_ASSERT_EQ(values[i] != -1, map.remove(memoryAllocator, i));
+    }
+
+    GREATEST_ASSERT(map.isEmpty());
+    GREATEST_ASSERT(!map.getFirst().isValid());
+    GREATEST_ASSERT(!map.getLast().isValid());
+
+    map.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BTreeMapTest::testBulkLoading() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(100'000'000);
+    static constexpr auto kCount = INT64_C(1'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto keysResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(uint32_t), alignof(uint32_t));
+    auto valuesResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(int64_t), alignof(int64_t));
+
+    GREATEST_ASSERT(keysResult.isSuccess());
+    GREATEST_ASSERT(valuesResult.isSuccess());
+
+    auto keyArray = (uint32_t *)*keysResult.value();
+    auto valueArray = (int64_t *)*valuesResult.value();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        keyArray[i] = (uint32_t)(2 * i + 1);
+        valueArray[i] = -i;
+    }
+    ArrayListView<uint32_t> keys;
+    keys.initialize(keyArray, kCount);
+    ArrayListView<int64_t> values;
+    values.initialize(valueArray, kCount);
+
+    BTreeMap<uint32_t, int64_t> map;
+    map.initialize();
+
+    GREATEST_ASSERT(map.bulkLoad(memoryAllocator, keys, values) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(kCount, map.getCount(), "%" PRId64);
+
+    auto cursor = map.getFirst();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(cursor.isValid());
+        GREATEST_ASSERT_EQ_FMT(keyArray[i], *cursor.getKey(), "%" PRIu32);
+
+        cursor.moveNext();
+    }
+
+    GREATEST_ASSERT(!cursor.isValid());
+
+    // The even keys fall between the loaded ones.
+    for (auto i = INT64_C(0); i <= kCount; i++) {
+        auto key = (uint32_t)(2 * i);
+
+        GREATEST_ASSERT_EQ(nullptr, map.get(key));
+
+        auto floor = map.findFloor(key);
+        auto ceiling = map.findCeiling(key);
+
+        GREATEST_ASSERT_EQ(i != 0, floor.isValid());
+        GREATEST_ASSERT_EQ(i != kCount, ceiling.isValid());
+
+        if (i != 0) {
+            GREATEST_ASSERT_EQ_FMT(key - 1, *floor.getKey(), "%" PRIu32);
+        }
+        if (i != kCount) {
+            GREATEST_ASSERT_EQ_FMT(key + 1, *ceiling.getKey(), "%" PRIu32);
+            GREATEST_ASSERT_EQ_FMT(-i, *map.get(key + 1), "%" PRId64);
+        }
+    }
+
+    // The packed nodes split when the gaps get filled.
+    for (auto i = INT64_C(0); i < kCount; i += 7) {
+        GREATEST_ASSERT(map.put(memoryAllocator, (uint32_t)(2 * i), i) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount + (kCount + 6) / 7, map.getCount(), "%" PRId64);
+
+    auto last = map.getLast();
+    auto previousKey = UINT32_MAX;
+    auto scannedCount = INT64_C(0);
+    for (; last.isValid(); last.movePrevious()) {
+        GREATEST_ASSERT(*last.getKey() < previousKey);
+
+        previousKey = *last.getKey();
+        scannedCount++;
+    }
+
+    GREATEST_ASSERT_EQ_FMT(map.getCount(), scannedCount, "%" PRId64);
+
+    map.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BTreeMapTest::testOrderingByComparator() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    BTreeMap<double, int64_t> map;
+    map.initialize();
+
+    for (auto i = kCount - 1; i >= 0; i--) {
+        GREATEST_ASSERT(map.put(memoryAllocator, (double)i / 4, i) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount, map.getCount(), "%" PRId64);
+
+    auto ceiling = map.findCeiling(10.1);
+
+    GREATEST_ASSERT(ceiling.isValid());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(41), *ceiling.getValue(), "%" PRId64);
+
+    auto floor = map.findFloor(10.1);
+
+    GREATEST_ASSERT(floor.isValid());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(40), *floor.getValue(), "%" PRId64);
+    GREATEST_ASSERT(!map.findFloor(-0.5).isValid());
+    GREATEST_ASSERT(!map.findCeiling(1000.0).isValid());
+
+    map.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class BTreeMapTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testPuttingAndRemoving() -> greatest_test_res;
+        static auto testBulkLoading() -> greatest_test_res;
+        static auto testOrderingByComparator() -> greatest_test_res;
+    };
+}
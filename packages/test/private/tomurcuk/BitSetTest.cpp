@@ -0,0 +1,121 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/BitSet.hpp>
+#include <tomurcuk/BitSetTest.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::BitSetTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testSettingAndFinding);
+        GREATEST_RUN_TEST(testCombining);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::BitSetTest::testSettingAndFinding() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kBitCount = INT64_C(10'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    BitSet set;
+    set.initialize();
+
+    GREATEST_ASSERT(set.resize(memoryAllocator, kBitCount) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), set.countSetBits(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), set.findNextSetBit(0), "%" PRId64);
+
+    for (auto i = INT64_C(0); i < kBitCount; i += 7) {
+        set.set(i);
+    }
+    set.reset(7);
+
+    GREATEST_ASSERT(set.test(0));
+    GREATEST_ASSERT(!set.test(7));
+    GREATEST_ASSERT(set.test(14));
+    GREATEST_ASSERT_EQ_FMT((kBitCount + 6) / 7 - 1, set.countSetBits(), "%" PRId64);
+
+    auto count = INT64_C(0);
+    for (auto i = set.findNextSetBit(0); i != -1; i = set.findNextSetBit(i + 1)) {
+        GREATEST_ASSERT_EQ_FMT(INT64_C(0), i % 7, "%" PRId64);
+        count++;
+    }
+
+    GREATEST_ASSERT_EQ_FMT(set.countSetBits(), count, "%" PRId64);
+
+    // Shrinking forgets the bits after the end, which stay forgotten after
+    // growing back.
+    GREATEST_ASSERT(set.resize(memoryAllocator, 100) == Status::eSuccess);
+    GREATEST_ASSERT(set.resize(memoryAllocator, kBitCount) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(14), set.countSetBits(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), set.findNextSetBit(99), "%" PRId64);
+
+    set.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BitSetTest::testCombining() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kBitCount = INT64_C(1'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    BitSet sets[4];
+    for (auto &set : sets) {
+        set.initialize();
+
+        GREATEST_ASSERT(set.resize(memoryAllocator, kBitCount) == Status::eSuccess);
+    }
+
+    // Multiples of 2 and of 3 are combined in every way.
+    for (auto i = INT64_C(0); i != kBitCount; i++) {
+        if (i % 2 == 0) {
+            sets[0].set(i);
+            sets[1].set(i);
+            sets[2].set(i);
+        }
+        if (i % 3 == 0) {
+            sets[3].set(i);
+        }
+    }
+    sets[0].intersectWith(sets + 3);
+    sets[1].uniteWith(sets + 3);
+    sets[2].subtract(sets + 3);
+
+    for (auto i = INT64_C(0); i != kBitCount; i++) {
+        GREATEST_ASSERT(sets[0].test(i) == (i % 2 == 0 && i % 3 == 0));
+        GREATEST_ASSERT(sets[1].test(i) == (i % 2 == 0 || i % 3 == 0));
+        GREATEST_ASSERT(sets[2].test(i) == (i % 2 == 0 && i % 3 != 0));
+    }
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(167), sets[0].countSetBits(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(667), sets[1].countSetBits(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(333), sets[2].countSetBits(), "%" PRId64);
+
+    for (auto i = INT64_C(3); i >= 0; i--) {
+        sets[i].destroy(memoryAllocator);
+    }
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class BitSetTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testSettingAndFinding() -> greatest_test_res;
+        static auto testCombining() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,114 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/BlockPackingCodec.hpp>
+#include <tomurcuk/BlockPackingCodecTest.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::BlockPackingCodecTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testRoundTrips);
+        GREATEST_RUN_TEST(testRejectingShortBlocks);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::BlockPackingCodecTest::testRoundTrips() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kBlockCount = BlockPackingCodec::kBlockCount;
+    static constexpr auto kCount = 33 * kBlockCount;
+    static constexpr int64_t kCounts[] = {0, 1, kBlockCount - 1, kBlockCount, kBlockCount + 1, kCount - 5, kCount};
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Block `b` has integers of up to `b` bits; so, every kernel is used.
+    static uint32_t values[kCount];
+    static uint32_t decoded[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto bitWidth = (uint64_t)(i / kBlockCount);
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        values[i] = bitWidth == 0 ? 0 : (uint32_t)(hash >> (64 - bitWidth));
+    }
+    values[32 * kBlockCount] = UINT32_MAX;
+
+    for (auto count : kCounts) {
+        ArrayListView<uint32_t> view;
+        ArrayListView<uint32_t> decodedView;
+        if (count == 0) {
+            view.initializeEmpty();
+            decodedView.initializeEmpty();
+        } else {
+            view.initialize(values, count);
+            decodedView.initialize(decoded, count);
+        }
+        ArrayList<uint32_t> words;
+        words.initialize();
+
+        GREATEST_ASSERT(BlockPackingCodec::encode(memoryAllocator, &words, view) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(words.getCount(), BlockPackingCodec::decode(words.getView(), decodedView), "%" PRId64);
+
+        for (auto i = INT64_C(0); i != count; i++) {
+            GREATEST_ASSERT_EQ_FMT(values[i], decoded[i], "%" PRIu32);
+        }
+
+        words.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BlockPackingCodecTest::testRejectingShortBlocks() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = 2 * BlockPackingCodec::kBlockCount;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    uint32_t values[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        values[i] = (uint32_t)i;
+    }
+    ArrayListView<uint32_t> view;
+    view.initialize(values, kCount);
+    ArrayList<uint32_t> words;
+    words.initialize();
+
+    GREATEST_ASSERT(BlockPackingCodec::encode(memoryAllocator, &words, view) == Status::eSuccess);
+
+    // The blocks must have all of their words, and at most 32 bits.
+    ArrayListView<uint32_t> wordsView;
+    wordsView.initialize(words.getArray(), words.getCount() - 1);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), BlockPackingCodec::decode(wordsView, view), "%" PRId64);
+
+    *words.getFirst() = 33;
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), BlockPackingCodec::decode(words.getView(), view), "%" PRId64);
+
+    words.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
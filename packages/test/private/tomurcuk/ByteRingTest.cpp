@@ -0,0 +1,61 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ByteRing.hpp>
+#include <tomurcuk/ByteRingTest.hpp>
+#include <tomurcuk/Bytes.hpp>
+
+auto tomurcuk::ByteRingTest::suite() -> void {
+    GREATEST_RUN_TEST(testWrappingContiguously);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::ByteRingTest::testWrappingContiguously() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1);
+    static constexpr auto kChunkSize = INT64_C(1000);
+
+    auto byteRingResult = ByteRing::create(kCapacity);
+
+    GREATEST_ASSERT(byteRingResult.isSuccess());
+
+    auto byteRing = *byteRingResult.value();
+    auto capacity = byteRing.getCapacity();
+
+    GREATEST_ASSERT(capacity >= kChunkSize * 2);
+
+    // Move the cursors close to the end of the block, and then write a chunk
+    // that wraps around it.
+    byteRing.acknowledgeWritten(capacity - (kChunkSize / 2));
+    byteRing.acknowledgeRead(capacity - (kChunkSize / 2));
+
+    GREATEST_ASSERT_EQ_FMT(capacity, byteRing.getWritableSize(), "%" PRId64);
+
+    static uint8_t expected[kChunkSize];
+    auto writable = byteRing.getWritable();
+    for (auto i = INT64_C(0); i != kChunkSize; i++) {
+        expected[i] = (uint8_t)i;
+        writable[i] = (uint8_t)i;
+    }
+    byteRing.acknowledgeWritten(kChunkSize);
+
+    auto readable = byteRing.getReadable();
+
+    GREATEST_ASSERT_EQ_FMT(kChunkSize, byteRing.getReadableSize(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Bytes::findMismatch(readable, expected, kChunkSize), "%" PRId64);
+
+    byteRing.acknowledgeRead(kChunkSize);
+
+    // The wrapped part was written through the second mapping and must be
+    // visible at the beginning of the first one, where the read cursor is now
+    // past it.
+    auto block = byteRing.getReadable() - (kChunkSize / 2);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Bytes::findMismatch(block, expected + (kChunkSize / 2), kChunkSize / 2), "%" PRId64);
+
+    byteRing.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class ByteRingTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testWrappingContiguously() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,176 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/BytesTest.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+
+auto tomurcuk::BytesTest::suite() -> void {
+    // Every implementation of the kernels that the processor supports is
+    // tested.
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testChecksummingKnownValues);
+        GREATEST_RUN_TEST(testCombiningChecksums);
+        GREATEST_RUN_TEST(testSearchingBytes);
+        GREATEST_RUN_TEST(testComparingBlocks);
+        GREATEST_RUN_TEST(testStreamingBlocks);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::BytesTest::testChecksummingKnownValues() -> greatest_test_res {
+    char digits[] = "123456789";
+    char word[] = "Wikipedia";
+
+    GREATEST_ASSERT_EQ_FMT(UINT32_C(0xE306'9283), Bytes::checksumBlockWithCrc32c(digits, 9, 0), "%08" PRIX32);
+    GREATEST_ASSERT_EQ_FMT(UINT32_C(0x11E6'0398), Bytes::checksumBlockWithAdler32(word, 9, 1), "%08" PRIX32);
+    GREATEST_ASSERT_EQ_FMT(UINT64_C(0xEF46'DB37'51D8'E999), Bytes::checksumBlockWithXxHash64(nullptr, 0, 0), "%016" PRIX64);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BytesTest::testCombiningChecksums() -> greatest_test_res {
+    static constexpr auto kSize = INT64_C(100'003);
+    static constexpr auto kSplit = INT64_C(40'961);
+
+    static uint8_t block[kSize];
+    auto state = UINT32_C(1);
+    for (auto i = INT64_C(0); i != kSize; i++) {
+        state = state * UINT32_C(1'664'525) + UINT32_C(1'013'904'223);
+        block[i] = (uint8_t)(state >> 24U);
+    }
+
+    auto crc32c = Bytes::checksumBlockWithCrc32c(block, kSize, 0);
+    auto crc32c0 = Bytes::checksumBlockWithCrc32c(block, kSplit, 0);
+    auto crc32c1 = Bytes::checksumBlockWithCrc32c(block + kSplit, kSize - kSplit, 0);
+
+    GREATEST_ASSERT_EQ_FMT(crc32c, Bytes::checksumBlockWithCrc32c(block + kSplit, kSize - kSplit, crc32c0), "%08" PRIX32);
+    GREATEST_ASSERT_EQ_FMT(crc32c, Bytes::combineCrc32cChecksums(crc32c0, crc32c1, kSize - kSplit), "%08" PRIX32);
+
+    auto adler32 = Bytes::checksumBlockWithAdler32(block, kSize, 1);
+    auto adler320 = Bytes::checksumBlockWithAdler32(block, kSplit, 1);
+    auto adler321 = Bytes::checksumBlockWithAdler32(block + kSplit, kSize - kSplit, 1);
+
+    GREATEST_ASSERT_EQ_FMT(adler32, Bytes::checksumBlockWithAdler32(block + kSplit, kSize - kSplit, adler320), "%08" PRIX32);
+    GREATEST_ASSERT_EQ_FMT(adler32, Bytes::combineAdler32Checksums(adler320, adler321, kSize - kSplit), "%08" PRIX32);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BytesTest::testSearchingBytes() -> greatest_test_res {
+    static constexpr auto kSize = INT64_C(1000);
+
+    static uint8_t block0[kSize];
+    static uint8_t block1[kSize];
+    for (auto i = INT64_C(0); i != kSize; i++) {
+        block0[i] = (uint8_t)('a' + (i % 26));
+    }
+    block0[100] = ';';
+    block0[700] = ';';
+    block0[900] = '{';
+    Bytes::copyBlock(block1, block0, kSize);
+    block1[777] = '!';
+
+    uint8_t needles[] = {'{', '}', '!'};
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(100), Bytes::findByte(block0, kSize, ';'), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(700), Bytes::findLastByte(block0, kSize, ';'), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Bytes::findByte(block0, kSize, '?'), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(900), Bytes::findAnyByte(block0, kSize, needles, 3), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(777), Bytes::findAnyByte(block1, kSize, needles, 3), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), Bytes::countByte(block0, kSize, ';'), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(777), Bytes::findMismatch(block0, block1, kSize), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Bytes::findMismatch(block0, block1, 777), "%" PRId64);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BytesTest::testComparingBlocks() -> greatest_test_res {
+    static constexpr auto kSize = INT64_C(1000);
+
+    static uint8_t block0[kSize];
+    static uint8_t block1[kSize];
+    for (auto i = INT64_C(0); i != kSize; i++) {
+        block0[i] = (uint8_t)i;
+    }
+    Bytes::copyBlock(block1, block0, kSize);
+    block1[600] = 0xFF;
+
+    GREATEST_ASSERT(Bytes::compareBlocks(block0, kSize, block1, kSize) == Ordering::eLess);
+    GREATEST_ASSERT(Bytes::compareBlocks(block1, kSize, block0, kSize) == Ordering::eGreater);
+    GREATEST_ASSERT(Bytes::compareBlocks(block0, 600, block1, 600) == Ordering::eEqual);
+    GREATEST_ASSERT(Bytes::compareBlocks(block0, 599, block1, 600) == Ordering::eLess);
+    GREATEST_ASSERT(Bytes::compareBlocks(nullptr, 0, block1, 1) == Ordering::eLess);
+    GREATEST_ASSERT(Bytes::compareBlocks(nullptr, 0, nullptr, 0) == Ordering::eEqual);
+
+    // Short blocks take a separate path, and bytes are ordered as unsigned.
+    block1[13] = 0x80;
+
+    GREATEST_ASSERT(Bytes::compareBlocks(block0, 20, block1, 20) == Ordering::eLess);
+    GREATEST_ASSERT(Bytes::compareBlocks(block1, 20, block0, 20) == Ordering::eGreater);
+    GREATEST_ASSERT(Bytes::compareBlocks(block0, 13, block1, 20) == Ordering::eLess);
+    GREATEST_ASSERT(Bytes::compareBlocks(block1, 14, block0, 13) == Ordering::eGreater);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BytesTest::testStreamingBlocks() -> greatest_test_res {
+    // Every block of bytes is streamed, starting from misaligned addresses.
+    // The threshold is restored before asserting, as the other tests depend
+    // on it.
+    auto streamingThreshold = Bytes::getStreamingThreshold();
+    Bytes::setStreamingThreshold(0);
+
+    auto isCopied = checkStreaming(3, 4'805, 4'099, false);
+    auto isCopiedBackward = checkStreaming(5, 262, 4'099, true);
+    auto isCopiedForward = checkStreaming(262, 5, 4'099, true);
+    auto isCopiedApart = checkStreaming(9, 4'110, 877, true);
+    auto isReset = checkStreaming(7, -1, 4'099, false);
+    auto isResetShort = checkStreaming(70, -1, 1, false);
+
+    Bytes::setStreamingThreshold(streamingThreshold);
+
+    GREATEST_ASSERT(isCopied);
+    GREATEST_ASSERT(isCopiedBackward);
+    GREATEST_ASSERT(isCopiedForward);
+    GREATEST_ASSERT(isCopiedApart);
+    GREATEST_ASSERT(isReset);
+    GREATEST_ASSERT(isResetShort);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::BytesTest::checkStreaming(int64_t destinationIndex, int64_t sourceIndex, int64_t size, bool isAliasing) -> bool {
+    static uint8_t block[kStreamingSize];
+    static uint8_t expected[kStreamingSize];
+    for (auto i = INT64_C(0); i != kStreamingSize; i++) {
+        block[i] = (uint8_t)(i * 7);
+        expected[i] = (uint8_t)(i * 7);
+    }
+
+    if (sourceIndex == -1) {
+        Bytes::resetBlock(block + destinationIndex, size);
+        for (auto i = INT64_C(0); i != size; i++) {
+            expected[destinationIndex + i] = 0;
+        }
+    } else {
+        if (isAliasing) {
+            Bytes::copyAliasingBlock(block + destinationIndex, block + sourceIndex, size);
+        } else {
+            Bytes::copyBlock(block + destinationIndex, block + sourceIndex, size);
+        }
+        for (auto i = INT64_C(0); i != size; i++) {
+            expected[destinationIndex + i] = (uint8_t)((sourceIndex + i) * 7);
+        }
+    }
+
+    return Bytes::findMismatch(block, expected, kStreamingSize) == -1;
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
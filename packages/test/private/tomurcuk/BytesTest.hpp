@@ -0,0 +1,29 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+
+namespace tomurcuk {
+    class BytesTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of bytes in the blocks that streaming is tested on.
+         */
+        static constexpr auto kStreamingSize = INT64_C(10'000);
+
+        static auto testChecksummingKnownValues() -> greatest_test_res;
+        static auto testCombiningChecksums() -> greatest_test_res;
+        static auto testSearchingBytes() -> greatest_test_res;
+        static auto testComparingBlocks() -> greatest_test_res;
+        static auto testStreamingBlocks() -> greatest_test_res;
+
+        /**
+         * Tests whether streaming a copy, or a reset when the source index is
+         * `-1`, agrees with writing the bytes one by one.
+         */
+        static auto checkStreaming(int64_t destinationIndex, int64_t sourceIndex, int64_t size, bool isAliasing) -> bool;
+    };
+}
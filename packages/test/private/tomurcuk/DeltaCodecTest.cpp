@@ -0,0 +1,97 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/DeltaCodec.hpp>
+#include <tomurcuk/DeltaCodecTest.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+
+auto tomurcuk::DeltaCodecTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testRoundTrips);
+        GREATEST_RUN_TEST(testRoundTripsOfSecondOrder);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::DeltaCodecTest::testRoundTrips() -> greatest_test_res {
+    static constexpr auto kCount = INT64_C(100);
+
+    // Every count covers a different remainder after the vectorized loops.
+    uint32_t values32[kCount];
+    uint64_t values64[kCount];
+    for (auto count = INT64_C(1); count <= kCount; count++) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+            values32[i] = (uint32_t)(i * 1000 + (int64_t)(hash >> 54U));
+            values64[i] = hash;
+        }
+        ArrayListView<uint32_t> view32;
+        view32.initialize(values32, count);
+        ArrayListView<uint64_t> view64;
+        view64.initialize(values64, count);
+        DeltaCodec::encode(view32);
+        DeltaCodec::encode(view64);
+
+        GREATEST_ASSERT_EQ_FMT((uint32_t)((UINT64_C(0x9E37'79B9'7F4A'7C15)) >> 54U), values32[0], "%" PRIu32);
+
+        for (auto i = INT64_C(1); i < count; i++) {
+            GREATEST_ASSERT(values32[i] < 2000);
+        }
+
+        DeltaCodec::decode(view32);
+        DeltaCodec::decode(view64);
+        for (auto i = INT64_C(0); i != count; i++) {
+            auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+
+            GREATEST_ASSERT_EQ_FMT((uint32_t)(i * 1000 + (int64_t)(hash >> 54U)), values32[i], "%" PRIu32);
+            GREATEST_ASSERT_EQ_FMT(hash, values64[i], "%" PRIu64);
+        }
+    }
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::DeltaCodecTest::testRoundTripsOfSecondOrder() -> greatest_test_res {
+    static constexpr auto kCount = INT64_C(100);
+
+    // Timestamps at a steady rate with a little jitter have tiny second-order
+    // differences of both signs.
+    uint32_t values32[kCount];
+    uint64_t values64[kCount];
+    for (auto count = INT64_C(1); count <= kCount; count++) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            auto jitter = (int64_t)(((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15)) >> 61U);
+            values32[i] = (uint32_t)(1'000'000 + i * 60 + jitter);
+            values64[i] = (uint64_t)(INT64_C(1'700'000'000'000) + i * 60 + jitter);
+        }
+        ArrayListView<uint32_t> view32;
+        view32.initialize(values32, count);
+        ArrayListView<uint64_t> view64;
+        view64.initialize(values64, count);
+        DeltaCodec::encodeSecondOrder(view32);
+        DeltaCodec::encodeSecondOrder(view64);
+        for (auto i = INT64_C(2); i < count; i++) {
+            GREATEST_ASSERT(values32[i] < 32);
+            GREATEST_ASSERT(values64[i] < 32);
+        }
+
+        DeltaCodec::decodeSecondOrder(view32);
+        DeltaCodec::decodeSecondOrder(view64);
+        for (auto i = INT64_C(0); i != count; i++) {
+            auto jitter = (int64_t)(((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15)) >> 61U);
+
+            GREATEST_ASSERT_EQ_FMT((uint32_t)(1'000'000 + i * 60 + jitter), values32[i], "%" PRIu32);
+            GREATEST_ASSERT_EQ_FMT((uint64_t)(INT64_C(1'700'000'000'000) + i * 60 + jitter), values64[i], "%" PRIu64);
+        }
+    }
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class DeltaCodecTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testRoundTrips() -> greatest_test_res;
+        static auto testRoundTripsOfSecondOrder() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,69 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/EytzingerIndex.hpp>
+#include <tomurcuk/EytzingerIndexTest.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::EytzingerIndexTest::suite() -> void {
+    GREATEST_RUN_TEST(testFindingLowerBounds);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::EytzingerIndexTest::testFindingLowerBounds() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr int64_t kCounts[] = {0, 1, 2, 3, 15, 16, 17, 1000, 100'000};
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Every third value is skipped, and every other one is repeated.
+    static int32_t array[100'000];
+    for (auto count : kCounts) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            array[i] = (int32_t)(i / 2 * 3);
+        }
+        ArrayListView<int32_t> view;
+        if (count == 0) {
+            view.initializeEmpty();
+        } else {
+            view.initialize(array, count);
+        }
+        EytzingerIndex<int32_t> index;
+        index.initialize();
+
+        GREATEST_ASSERT(index.build(memoryAllocator, view) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(count, index.getCount(), "%" PRId64);
+
+        auto sortedIndex = INT64_C(0);
+        for (auto value = -1; value <= (int32_t)(count / 2 * 3 + 1); value++) {
+            while (sortedIndex != count && array[sortedIndex] < value) {
+                sortedIndex++;
+            }
+            auto found = index.findLowerBound(value);
+
+            GREATEST_ASSERT_EQ(sortedIndex == count, found == nullptr);
+
+            if (found != nullptr) {
+                GREATEST_ASSERT_EQ_FMT(array[sortedIndex], *found, "%" PRId32);
+            }
+
+            GREATEST_ASSERT_EQ(sortedIndex != count && array[sortedIndex] == value, index.find(value) != nullptr);
+        }
+
+        index.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class EytzingerIndexTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testFindingLowerBounds() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,130 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/FrameOfReferenceCodec.hpp>
+#include <tomurcuk/FrameOfReferenceCodecTest.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::FrameOfReferenceCodecTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testRoundTrips);
+        GREATEST_RUN_TEST(testRejectingShortFrames);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::FrameOfReferenceCodecTest::testRoundTrips() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Every range width is encoded into frames that follow each other, from
+    // frames of a single repeated integer to frames of the whole range.
+    static uint32_t values32[kCount];
+    static uint64_t values64[kCount];
+    static uint32_t decoded32[kCount];
+    static uint64_t decoded64[kCount];
+    for (auto rangeShift = INT64_C(0); rangeShift <= 64; rangeShift++) {
+        auto count = kCount - rangeShift * 7;
+        for (auto i = INT64_C(0); i != count; i++) {
+            auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+            auto offset = rangeShift == 0 ? 0 : hash >> (uint64_t)(64 - rangeShift);
+            values32[i] = (uint32_t)(UINT64_C(123'456) + (rangeShift <= 32 ? offset : offset >> 32U));
+            values64[i] = rangeShift == 64 ? offset : UINT64_C(1) << 63U | offset;
+        }
+        ArrayListView<uint32_t> view32;
+        view32.initialize(values32, count);
+        ArrayListView<uint64_t> view64;
+        view64.initialize(values64, count);
+        ArrayList<uint64_t> words;
+        words.initialize();
+
+        GREATEST_ASSERT(FrameOfReferenceCodec::encode(memoryAllocator, &words, view32) == Status::eSuccess);
+
+        auto wordCount32 = words.getCount();
+
+        GREATEST_ASSERT(FrameOfReferenceCodec::encode(memoryAllocator, &words, view64) == Status::eSuccess);
+
+        ArrayListView<uint32_t> decodedView32;
+        decodedView32.initialize(decoded32, count);
+        ArrayListView<uint64_t> decodedView64;
+        decodedView64.initialize(decoded64, count);
+
+        GREATEST_ASSERT_EQ_FMT(wordCount32, FrameOfReferenceCodec::decode(words.getView(), decodedView32), "%" PRId64);
+
+        ArrayListView<uint64_t> wordsView64;
+        wordsView64.initialize(words.getArray() + wordCount32, words.getCount() - wordCount32);
+
+        GREATEST_ASSERT_EQ_FMT(words.getCount() - wordCount32, FrameOfReferenceCodec::decode(wordsView64, decodedView64), "%" PRId64);
+
+        for (auto i = INT64_C(0); i != count; i++) {
+            GREATEST_ASSERT_EQ_FMT(values32[i], decoded32[i], "%" PRIu32);
+            GREATEST_ASSERT_EQ_FMT(values64[i], decoded64[i], "%" PRIu64);
+        }
+
+        words.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::FrameOfReferenceCodecTest::testRejectingShortFrames() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(100);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    uint64_t values[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        values[i] = UINT64_C(1) << 40U | (uint64_t)i;
+    }
+    ArrayListView<uint64_t> view;
+    view.initialize(values, kCount);
+    ArrayList<uint64_t> words;
+    words.initialize();
+
+    GREATEST_ASSERT(FrameOfReferenceCodec::encode(memoryAllocator, &words, view) == Status::eSuccess);
+
+    // A frame must have all of its words, and a reference that fits.
+    uint32_t decoded[kCount];
+    ArrayListView<uint32_t> decodedView;
+    decodedView.initialize(decoded, kCount);
+    ArrayListView<uint64_t> wordsView;
+    wordsView.initialize(words.getArray(), words.getCount() - 1);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), FrameOfReferenceCodec::decode(wordsView, view), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), FrameOfReferenceCodec::decode(words.getView(), decodedView), "%" PRId64);
+
+    wordsView.initialize(words.getArray(), 1);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), FrameOfReferenceCodec::decode(wordsView, view), "%" PRId64);
+
+    words.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
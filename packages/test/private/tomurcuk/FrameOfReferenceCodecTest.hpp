@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class FrameOfReferenceCodecTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testRoundTrips() -> greatest_test_res;
+        static auto testRejectingShortFrames() -> greatest_test_res;
+    };
+}
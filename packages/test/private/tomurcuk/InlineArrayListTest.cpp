@@ -0,0 +1,138 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/InlineArrayList.hpp>
+#include <tomurcuk/InlineArrayListTest.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::InlineArrayListTest::suite() -> void {
+    GREATEST_RUN_TEST(testSpilling);
+    GREATEST_RUN_TEST(testCopying);
+    GREATEST_RUN_TEST(testInserting);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::InlineArrayListTest::testSpilling() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kInlineCount = INT64_C(4);
+    static constexpr auto kCount = INT64_C(100);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    InlineArrayList<int64_t, kInlineCount> list;
+    list.initialize();
+
+    for (auto i = INT64_C(0); i != kInlineCount; i++) {
+        GREATEST_ASSERT(list.add(memoryAllocator, i) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT(list.isInline());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), linearMemoryAllocator.cursor(), "%" PRId64);
+
+    for (auto i = kInlineCount; i != kCount; i++) {
+        GREATEST_ASSERT(list.add(memoryAllocator, i) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT(!list.isInline());
+    GREATEST_ASSERT_EQ_FMT(kCount, list.getView().getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, *list.get(i), "%" PRId64);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(1), list.remove(1), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), *list.get(1), "%" PRId64);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::InlineArrayListTest::testCopying() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kInlineCount = INT64_C(8);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // The copy must not refer to the slots of the original one.
+    InlineArrayList<int64_t, kInlineCount> lists[2];
+    lists[0].initialize();
+    for (auto i = INT64_C(0); i != kInlineCount; i++) {
+        GREATEST_ASSERT(lists[0].add(memoryAllocator, i) == Status::eSuccess);
+    }
+    lists[1] = lists[0];
+    lists[0].removeAll();
+    GREATEST_ASSERT(lists[0].add(memoryAllocator, -1) == Status::eSuccess);
+
+    GREATEST_ASSERT(lists[1].getArray() == lists[1].getView().getArray());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), *lists[1].getFirst(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kInlineCount - 1, *lists[1].getLast(), "%" PRId64);
+
+    lists[1].destroy(memoryAllocator);
+    lists[0].destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::InlineArrayListTest::testInserting() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kInlineCount = INT64_C(4);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    InlineArrayList<int64_t, kInlineCount> list;
+    list.initialize();
+
+    // The list is 1, 3 while inline, and then spills to 1, 2, 3, 4, 5, 6.
+    GREATEST_ASSERT(list.insert(memoryAllocator, 0, 3) == Status::eSuccess);
+    GREATEST_ASSERT(list.insert(memoryAllocator, 0, 1) == Status::eSuccess);
+
+    GREATEST_ASSERT(list.isInline());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(1), *list.getFirst(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(3), *list.getLast(), "%" PRId64);
+
+    int64_t elements[] = {4, 5, 6};
+    ArrayListView<int64_t> view;
+    view.initialize(elements, 3);
+
+    GREATEST_ASSERT(list.insertAll(memoryAllocator, 2, view) == Status::eSuccess);
+    GREATEST_ASSERT(list.insert(memoryAllocator, 1, 2) == Status::eSuccess);
+
+    GREATEST_ASSERT(!list.isInline());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(6), list.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(list.getAllocatedCount() * 8, list.getAllocatedSize(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(list.getUninitializedCount() * 8, list.getUninitializedSize(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != 6; i++) {
+        GREATEST_ASSERT_EQ_FMT(i + 1, *list.get(i), "%" PRId64);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(1), list.removeFirst(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), *list.getFirst(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(5), list.getCount(), "%" PRId64);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
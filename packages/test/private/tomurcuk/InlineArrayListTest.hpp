@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class InlineArrayListTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testSpilling() -> greatest_test_res;
+        static auto testCopying() -> greatest_test_res;
+        static auto testInserting() -> greatest_test_res;
+    };
+}
@@ -10,6 +10,7 @@ auto tomurcuk::LinearMemoryAllocatorTest::suite() -> void {
     GREATEST_RUN_TEST(testAllocating);
     GREATEST_RUN_TEST(testCursor);
     GREATEST_RUN_TEST(testDeallocatingAll);
+    GREATEST_RUN_TEST(testAllocatingZeroed);
 }
 
 // NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -122,4 +123,47 @@ auto tomurcuk::LinearMemoryAllocatorTest::testDeallocatingAll() -> greatest_test
     GREATEST_PASS();
 }
 
+auto tomurcuk::LinearMemoryAllocatorTest::testAllocatingZeroed() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kSize = INT64_C(10'000);
+    static constexpr auto kAlignment = INT64_C(16);
+    static constexpr auto kDirtyValue = 0xA5;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Dirty a block, give it back, and then ask for a larger one that covers
+    // both the dirtied and the fresh memory.
+    auto dirtyBlockResult = memoryAllocator.allocate(kSize, kAlignment);
+
+    GREATEST_ASSERT(dirtyBlockResult.isSuccess());
+
+    auto dirtyBlock = (uint8_t *)*dirtyBlockResult.value();
+    for (auto i = INT64_C(0); i != kSize; i++) {
+        dirtyBlock[i] = kDirtyValue;
+    }
+    linearMemoryAllocator.deallocateAll();
+
+    auto blockResult = memoryAllocator.allocateZeroed(kSize * 2, kAlignment);
+
+    GREATEST_ASSERT(blockResult.isSuccess());
+
+    auto block = (uint8_t *)*blockResult.value();
+
+    GREATEST_ASSERT((uint64_t)block % (uint64_t)kAlignment == 0);
+
+    for (auto i = INT64_C(0); i != kSize * 2; i++) {
+        GREATEST_ASSERT_EQ_FMT(0, (int)block[i], "%d");
+    }
+
+    memoryAllocator.deallocate(block, kSize * 2, kAlignment);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
 // NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -11,5 +11,6 @@ namespace tomurcuk {
         static auto testAllocating() -> greatest_test_res;
         static auto testCursor() -> greatest_test_res;
         static auto testDeallocatingAll() -> greatest_test_res;
+        static auto testAllocatingZeroed() -> greatest_test_res;
     };
 }
@@ -0,0 +1,59 @@
+#include <greatest.h>
+#include <math.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/OrderComparableTest.hpp>
+#include <tomurcuk/Ordering.hpp>
+
+auto tomurcuk::OrderComparableTest::suite() -> void {
+    GREATEST_RUN_TEST(testOrderingScalars);
+    GREATEST_RUN_TEST(testOrderingByteArrays);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::OrderComparableTest::testOrderingScalars() -> greatest_test_res {
+    int8_t negative = -1;
+    int8_t positive = 1;
+    auto small = UINT64_C(1);
+    auto big = UINT64_MAX;
+    auto negativeZero = -0.0;
+    auto positiveZero = 0.0;
+    auto infinity = (double)INFINITY;
+    auto notNumber = (double)NAN;
+
+    GREATEST_ASSERT(OrderComparable<int8_t>::compare(&negative, &positive) == Ordering::eLess);
+    GREATEST_ASSERT(OrderComparable<int8_t>::compare(&positive, &negative) == Ordering::eGreater);
+    GREATEST_ASSERT(OrderComparable<int8_t>::compare(&positive, &positive) == Ordering::eEqual);
+    GREATEST_ASSERT(OrderComparable<uint64_t>::compare(&small, &big) == Ordering::eLess);
+    GREATEST_ASSERT(OrderComparable<double>::compare(&negativeZero, &positiveZero) == Ordering::eLess);
+    GREATEST_ASSERT(OrderComparable<double>::compare(&infinity, &notNumber) == Ordering::eLess);
+    GREATEST_ASSERT(OrderComparable<double>::compare(&notNumber, &notNumber) == Ordering::eEqual);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::OrderComparableTest::testOrderingByteArrays() -> greatest_test_res {
+    char apple[] = "apple";
+    char apples[] = "apples";
+    char banana[] = "banana";
+
+    ArrayListView<char> appleView;
+    appleView.initialize(apple, 5);
+    ArrayListView<char> applesView;
+    applesView.initialize(apples, 6);
+    ArrayListView<char> bananaView;
+    bananaView.initialize(banana, 6);
+    ArrayListView<char> emptyView;
+    emptyView.initializeEmpty();
+
+    GREATEST_ASSERT(OrderComparable<ArrayListView<char>>::compare(&appleView, &applesView) == Ordering::eLess);
+    GREATEST_ASSERT(OrderComparable<ArrayListView<char>>::compare(&bananaView, &applesView) == Ordering::eGreater);
+    GREATEST_ASSERT(OrderComparable<ArrayListView<char>>::compare(&emptyView, &appleView) == Ordering::eLess);
+    GREATEST_ASSERT(OrderComparable<ArrayListView<char>>::compare(&appleView, &appleView) == Ordering::eEqual);
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
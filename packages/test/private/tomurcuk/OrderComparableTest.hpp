@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class OrderComparableTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testOrderingScalars() -> greatest_test_res;
+        static auto testOrderingByteArrays() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,186 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/PackedIntArray.hpp>
+#include <tomurcuk/PackedIntArrayTest.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::PackedIntArrayTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testGettingAndSetting);
+        GREATEST_RUN_TEST(testPackingAndUnpacking);
+        GREATEST_RUN_TEST(testResizing);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::PackedIntArrayTest::testGettingAndSetting() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    static uint64_t expected[kCount];
+    for (auto bitWidth = INT64_C(1); bitWidth <= 64; bitWidth++) {
+        auto mask = bitWidth == 64 ? UINT64_MAX : (UINT64_C(1) << (uint64_t)bitWidth) - 1;
+        PackedIntArray array;
+        array.initialize(bitWidth);
+        for (auto i = INT64_C(0); i != kCount; i++) {
+            expected[i] = ((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15)) & mask;
+
+            GREATEST_ASSERT(array.add(memoryAllocator, expected[i]) == Status::eSuccess);
+        }
+
+        GREATEST_ASSERT_EQ_FMT(bitWidth, array.getBitWidth(), "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT(kCount, array.getCount(), "%" PRId64);
+
+        // Every other integer is overwritten, which must keep its neighbors.
+        for (auto i = INT64_C(0); i < kCount; i += 2) {
+            expected[i] = ~expected[i] & mask;
+            array.set(i, expected[i]);
+        }
+        for (auto i = INT64_C(0); i != kCount; i++) {
+            GREATEST_ASSERT_EQ_FMT(expected[i], array.get(i), "%" PRIu64);
+        }
+
+        array.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::PackedIntArrayTest::testPackingAndUnpacking() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    static uint64_t expected[kCount];
+    static uint64_t values[kCount];
+    static uint32_t narrowValues[kCount];
+    for (auto bitWidth = INT64_C(1); bitWidth <= 64; bitWidth++) {
+        auto mask = bitWidth == 64 ? UINT64_MAX : (UINT64_C(1) << (uint64_t)bitWidth) - 1;
+        for (auto i = INT64_C(0); i != kCount; i++) {
+            expected[i] = ((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15)) & mask;
+        }
+        ArrayListView<uint64_t> view;
+        view.initialize(expected, kCount);
+        PackedIntArray array;
+        array.initialize(bitWidth);
+
+        GREATEST_ASSERT(array.addAll(memoryAllocator, view) == Status::eSuccess);
+
+        // Unaligned ranges of odd lengths cover the vectorized loops and their
+        // remainders.
+        for (auto index = INT64_C(0); index < kCount; index += 97) {
+            auto count = (kCount - index) / 3 + 1;
+            ArrayListView<uint64_t> valuesView;
+            valuesView.initialize(values, count);
+            array.unpack(index, valuesView);
+            for (auto i = INT64_C(0); i != count; i++) {
+                GREATEST_ASSERT_EQ_FMT(expected[index + i], values[i], "%" PRIu64);
+            }
+            if (bitWidth <= 32) {
+                ArrayListView<uint32_t> narrowView;
+                narrowView.initialize(narrowValues, count);
+                array.unpack(index, narrowView);
+                for (auto i = INT64_C(0); i != count; i++) {
+                    GREATEST_ASSERT_EQ_FMT(expected[index + i], (uint64_t)narrowValues[i], "%" PRIu64);
+                }
+            }
+        }
+
+        // Packing a range in the middle must keep the integers around it.
+        static constexpr auto kIndex = INT64_C(123);
+        static constexpr auto kPackedCount = INT64_C(456);
+        for (auto i = INT64_C(0); i != kPackedCount; i++) {
+            expected[kIndex + i] = ~expected[kIndex + i] & mask;
+            values[i] = expected[kIndex + i];
+            narrowValues[i] = (uint32_t)expected[kIndex + i];
+        }
+        if (bitWidth <= 32) {
+            ArrayListView<uint32_t> narrowView;
+            narrowView.initialize(narrowValues, kPackedCount);
+            array.pack(kIndex, narrowView);
+        } else {
+            ArrayListView<uint64_t> valuesView;
+            valuesView.initialize(values, kPackedCount);
+            array.pack(kIndex, valuesView);
+        }
+        for (auto i = INT64_C(0); i != kCount; i++) {
+            GREATEST_ASSERT_EQ_FMT(expected[i], array.get(i), "%" PRIu64);
+        }
+
+        array.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::PackedIntArrayTest::testResizing() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    PackedIntArray array;
+    array.initialize(13);
+
+    GREATEST_ASSERT(array.isEmpty());
+    GREATEST_ASSERT(array.resize(memoryAllocator, 100) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(100), array.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != 100; i++) {
+        GREATEST_ASSERT_EQ_FMT(UINT64_C(0), array.get(i), "%" PRIu64);
+
+        array.set(i, 0x1FFF);
+    }
+
+    // The removed integers must read as `0` when they are added back.
+    GREATEST_ASSERT(array.resize(memoryAllocator, 37) == Status::eSuccess);
+    GREATEST_ASSERT(array.resize(memoryAllocator, 100) == Status::eSuccess);
+
+    for (auto i = INT64_C(0); i != 100; i++) {
+        GREATEST_ASSERT_EQ_FMT(i < 37 ? UINT64_C(0x1FFF) : UINT64_C(0), array.get(i), "%" PRIu64);
+    }
+
+    array.removeAll();
+
+    GREATEST_ASSERT(array.isEmpty());
+    GREATEST_ASSERT(array.getAllocatedCount() >= 100);
+    GREATEST_ASSERT(array.resize(memoryAllocator, 1) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(UINT64_C(0), array.get(0), "%" PRIu64);
+
+    array.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class PackedIntArrayTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testGettingAndSetting() -> greatest_test_res;
+        static auto testPackingAndUnpacking() -> greatest_test_res;
+        static auto testResizing() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,108 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/PagedBitSet.hpp>
+#include <tomurcuk/PagedBitSetTest.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::PagedBitSetTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testAllocatingPagesLazily);
+        GREATEST_RUN_TEST(testCombining);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::PagedBitSetTest::testAllocatingPagesLazily() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(2'000'000);
+    static constexpr auto kBitCount = INT64_C(1) << 32U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    PagedBitSet set;
+    set.initialize();
+
+    // The whole 32-bit range only costs the page table.
+    GREATEST_ASSERT(set.resize(memoryAllocator, kBitCount) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), set.countAllocatedPages(), "%" PRId64);
+    GREATEST_ASSERT(!set.test(12345));
+
+    GREATEST_ASSERT(set.set(memoryAllocator, 5) == Status::eSuccess);
+    GREATEST_ASSERT(set.set(memoryAllocator, 6) == Status::eSuccess);
+    GREATEST_ASSERT(set.set(memoryAllocator, kBitCount - 1) == Status::eSuccess);
+    set.reset(6);
+    set.reset(PagedBitSet::kPageBitCount);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), set.countAllocatedPages(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), set.countSetBits(), "%" PRId64);
+    GREATEST_ASSERT(set.test(5));
+    GREATEST_ASSERT(!set.test(6));
+    GREATEST_ASSERT_EQ_FMT(INT64_C(5), set.findNextSetBit(0), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kBitCount - 1, set.findNextSetBit(6), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), set.findNextSetBit(kBitCount), "%" PRId64);
+
+    set.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::PagedBitSetTest::testCombining() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kBitCount = 8 * PagedBitSet::kPageBitCount;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    PagedBitSet sets[2];
+    for (auto &set : sets) {
+        set.initialize();
+
+        GREATEST_ASSERT(set.resize(memoryAllocator, kBitCount) == Status::eSuccess);
+    }
+
+    // The first set has pages 0 and 1, and the second one has pages 1 and 2.
+    for (auto i = INT64_C(0); i < 3 * PagedBitSet::kPageBitCount; i += 5) {
+        if (i < 2 * PagedBitSet::kPageBitCount) {
+            GREATEST_ASSERT(sets[0].set(memoryAllocator, i) == Status::eSuccess);
+        }
+        if (i >= PagedBitSet::kPageBitCount) {
+            GREATEST_ASSERT(sets[1].set(memoryAllocator, i) == Status::eSuccess);
+        }
+    }
+
+    GREATEST_ASSERT(sets[0].uniteWith(memoryAllocator, sets + 1) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(3), sets[0].countAllocatedPages(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(3 * PagedBitSet::kPageBitCount / 5 + 1, sets[0].countSetBits(), "%" PRId64);
+
+    sets[0].subtract(sets + 1);
+
+    GREATEST_ASSERT_EQ_FMT(PagedBitSet::kPageBitCount / 5 + 1, sets[0].countSetBits(), "%" PRId64);
+
+    sets[0].intersectWith(memoryAllocator, sets + 1);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), sets[0].countAllocatedPages(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), sets[0].countSetBits(), "%" PRId64);
+
+    sets[1].destroy(memoryAllocator);
+    sets[0].destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
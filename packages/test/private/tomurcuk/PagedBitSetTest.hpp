@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class PagedBitSetTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testAllocatingPagesLazily() -> greatest_test_res;
+        static auto testCombining() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,73 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/ParallelSorts.hpp>
+#include <tomurcuk/ParallelSortsTest.hpp>
+#include <tomurcuk/Sorts.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::ParallelSortsTest::suite() -> void {
+    GREATEST_RUN_TEST(testSortingLikeSequentially);
+    GREATEST_RUN_TEST(testSortingDuplicates);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::ParallelSortsTest::testSortingLikeSequentially() -> greatest_test_res {
+    static constexpr auto kCount = INT64_C(300'001);
+    static constexpr int64_t kThreadCounts[] = {1, 2, 3, 8, 1000};
+
+    static int64_t expected[kCount];
+    static int64_t actual[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        expected[i] = (int64_t)((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15));
+    }
+    ArrayListView<int64_t> expectedView;
+    expectedView.initialize(expected, kCount);
+    ArrayListView<int64_t> actualView;
+    actualView.initialize(actual, kCount);
+
+    for (auto threadCount : kThreadCounts) {
+        Bytes::copyArray(actual, expected, kCount);
+        if (threadCount == 1) {
+            Sorts::sort(expectedView);
+        }
+
+        GREATEST_ASSERT(ParallelSorts::sort(actualView, threadCount) == Status::eSuccess);
+        GREATEST_ASSERT(Bytes::testArrayExactness(expected, kCount, actual, kCount));
+    }
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::ParallelSortsTest::testSortingDuplicates() -> greatest_test_res {
+    static constexpr auto kCount = INT64_C(100'000);
+    static constexpr auto kThreadCount = INT64_C(7);
+
+    // Few distinct values put the same value in every run, which the splits
+    // between the threads must cut through exactly.
+    static int32_t array[kCount];
+    int64_t counts[16] = {};
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        array[i] = (int32_t)(((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15)) >> 60U);
+        counts[array[i]]++;
+    }
+    ArrayListView<int32_t> view;
+    view.initialize(array, kCount);
+
+    GREATEST_ASSERT(ParallelSorts::sort(view, kThreadCount) == Status::eSuccess);
+
+    auto index = INT64_C(0);
+    for (auto value = 0; value != 16; value++) {
+        for (auto i = INT64_C(0); i != counts[value]; i++) {
+            GREATEST_ASSERT_EQ_FMT(value, array[index], "%d");
+            index++;
+        }
+    }
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class ParallelSortsTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testSortingLikeSequentially() -> greatest_test_res;
+        static auto testSortingDuplicates() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,131 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/PriorityQueue.hpp>
+#include <tomurcuk/PriorityQueueTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::PriorityQueueTest::suite() -> void {
+    GREATEST_RUN_TEST(testRemovingInOrder);
+    GREATEST_RUN_TEST(testAddingAll);
+    GREATEST_RUN_TEST(testKeepingGreatest);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::PriorityQueueTest::testRemovingInOrder() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(10'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    PriorityQueue<int64_t, OrderComparable<int64_t>, 8> queue;
+    queue.initialize();
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(queue.add(memoryAllocator, (i * 7919) % kCount) == Status::eSuccess);
+    }
+
+    // The block is aligned to a cache line and padded, so that the children of
+    // the root fill one.
+    GREATEST_ASSERT_EQ_FMT(UINT64_C(0), (uint64_t)(queue.getFirst() + 1) % 64, "%" PRIu64);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, *queue.getFirst(), "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT(i, queue.removeFirst(), "%" PRId64);
+    }
+
+    GREATEST_ASSERT(queue.isEmpty());
+
+    queue.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::PriorityQueueTest::testAddingAll() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    PriorityQueue<int32_t> queue;
+    queue.initialize();
+
+    static int32_t elements[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        elements[i] = (int32_t)(kCount - i);
+    }
+
+    // The first addition rebuilds the heap, and the second one is smaller
+    // than the queue; so, it adds the elements one by one.
+    ArrayListView<int32_t> view;
+    view.initialize(elements, kCount);
+
+    GREATEST_ASSERT(queue.addAll(memoryAllocator, view) == Status::eSuccess);
+
+    view.initialize(elements, kCount / 2);
+
+    GREATEST_ASSERT(queue.addAll(memoryAllocator, view) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(kCount + kCount / 2, queue.getCount(), "%" PRId64);
+
+    auto previous = queue.removeFirst();
+    while (!queue.isEmpty()) {
+        auto current = queue.removeFirst();
+
+        GREATEST_ASSERT(previous <= current);
+
+        previous = current;
+    }
+
+    queue.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::PriorityQueueTest::testKeepingGreatest() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(10'000);
+    static constexpr auto kKeptCount = INT64_C(10);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    PriorityQueue<int64_t> queue;
+    queue.initialize();
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto element = (i * 7919) % kCount;
+        if (queue.getCount() < kKeptCount) {
+            GREATEST_ASSERT(queue.add(memoryAllocator, element) == Status::eSuccess);
+        } else if (*queue.getFirst() < element) {
+            queue.replaceFirst(element);
+        }
+    }
+
+    for (auto i = kCount - kKeptCount; i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, queue.removeFirst(), "%" PRId64);
+    }
+
+    queue.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
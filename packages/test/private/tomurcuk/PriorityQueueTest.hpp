@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class PriorityQueueTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testRemovingInOrder() -> greatest_test_res;
+        static auto testAddingAll() -> greatest_test_res;
+        static auto testKeepingGreatest() -> greatest_test_res;
+    };
+}
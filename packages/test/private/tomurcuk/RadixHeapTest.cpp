@@ -0,0 +1,65 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/PriorityQueue.hpp>
+#include <tomurcuk/RadixHeap.hpp>
+#include <tomurcuk/RadixHeapTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RadixHeapTest::suite() -> void {
+    GREATEST_RUN_TEST(testRemovingMonotonically);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::RadixHeapTest::testRemovingMonotonically() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kCount = INT64_C(100'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    RadixHeap<uint64_t> heap;
+    heap.initialize();
+    PriorityQueue<uint64_t> queue;
+    queue.initialize();
+
+    // Like a shortest path search, every removed key adds a few keys that are
+    // somewhat greater, and both queues must agree on the order.
+    GREATEST_ASSERT(heap.add(memoryAllocator, 0) == Status::eSuccess);
+    GREATEST_ASSERT(queue.add(memoryAllocator, 0) == Status::eSuccess);
+
+    auto state = UINT64_C(1);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto keyResult = heap.removeFirst(memoryAllocator);
+
+        GREATEST_ASSERT(keyResult.isSuccess());
+
+        auto key = *keyResult.value();
+
+        GREATEST_ASSERT_EQ_FMT(queue.removeFirst(), key, "%" PRIu64);
+        GREATEST_ASSERT_EQ_FMT(key, heap.getLastKey(), "%" PRIu64);
+
+        for (auto j = 0; j != 2; j++) {
+            state = state * UINT64_C(6'364'136'223'846'793'005) + UINT64_C(1'442'695'040'888'963'407);
+            auto addedKey = key + (state >> 54U);
+
+            GREATEST_ASSERT(heap.add(memoryAllocator, addedKey) == Status::eSuccess);
+            GREATEST_ASSERT(queue.add(memoryAllocator, addedKey) == Status::eSuccess);
+        }
+    }
+
+    GREATEST_ASSERT_EQ_FMT(queue.getCount(), heap.getCount(), "%" PRId64);
+
+    queue.destroy(memoryAllocator);
+    heap.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class RadixHeapTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testRemovingMonotonically() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,298 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/RoaringBitmap.hpp>
+#include <tomurcuk/RoaringBitmapTest.hpp>
+#include <tomurcuk/RoaringBitmapView.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RoaringBitmapTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testAddingAndRemoving);
+        GREATEST_RUN_TEST(testSetOperations);
+        GREATEST_RUN_TEST(testSerializing);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::RoaringBitmapTest::testAddingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kCount = INT64_C(10'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // The even integers of a chunk turn its array into a bitmap halfway, and
+    // removing them turns it back; the integers in other chunks stay.
+    RoaringBitmap bitmap;
+    bitmap.initialize();
+
+    GREATEST_ASSERT(bitmap.isEmpty());
+    GREATEST_ASSERT(bitmap.add(memoryAllocator, UINT32_MAX) == Status::eSuccess);
+    GREATEST_ASSERT(bitmap.add(memoryAllocator, 7) == Status::eSuccess);
+
+    for (auto i = kCount - 1; i >= 0; i--) {
+        GREATEST_ASSERT(bitmap.add(memoryAllocator, (uint32_t)(0x5'0000 + 2 * i)) == Status::eSuccess);
+        GREATEST_ASSERT(bitmap.add(memoryAllocator, (uint32_t)(0x5'0000 + 2 * i)) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount + 2, bitmap.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != 2 * kCount; i++) {
+        GREATEST_ASSERT_EQ(i % 2 == 0, bitmap.contains((uint32_t)(0x5'0000 + i)));
+    }
+    GREATEST_ASSERT(bitmap.contains(7));
+    GREATEST_ASSERT(bitmap.contains(UINT32_MAX));
+    GREATEST_ASSERT(!bitmap.contains(8));
+    GREATEST_ASSERT(!bitmap.contains(0x4'0000));
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(bitmap.remove(memoryAllocator, (uint32_t)(0x5'0000 + 2 * i + 1)) == Status::eSuccess);
+        if (i % 3 != 0) {
+            GREATEST_ASSERT(bitmap.remove(memoryAllocator, (uint32_t)(0x5'0000 + 2 * i)) == Status::eSuccess);
+        }
+    }
+
+    ArrayList<uint32_t> values;
+    values.initialize();
+
+    GREATEST_ASSERT(bitmap.copyValues(memoryAllocator, &values) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT((kCount + 2) / 3 + 2, values.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(UINT32_C(7), *values.get(0), "%" PRIu32);
+
+    for (auto i = INT64_C(0); i != (kCount + 2) / 3; i++) {
+        GREATEST_ASSERT_EQ_FMT((uint32_t)(0x5'0000 + 6 * i), *values.get(1 + i), "%" PRIu32);
+    }
+    GREATEST_ASSERT_EQ_FMT(UINT32_MAX, *values.getLast(), "%" PRIu32);
+
+    // A chunk that becomes empty is forgotten.
+    for (auto i = INT64_C(0); i < kCount; i += 3) {
+        GREATEST_ASSERT(bitmap.remove(memoryAllocator, (uint32_t)(0x5'0000 + 2 * i)) == Status::eSuccess);
+    }
+    GREATEST_ASSERT(bitmap.remove(memoryAllocator, 7) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(1), bitmap.getCount(), "%" PRId64);
+    GREATEST_ASSERT(bitmap.remove(memoryAllocator, UINT32_MAX) == Status::eSuccess);
+    GREATEST_ASSERT(bitmap.isEmpty());
+
+    values.destroy(memoryAllocator);
+    bitmap.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::RoaringBitmapTest::testSetOperations() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(100'000'000);
+    static constexpr auto kRange = INT64_C(5) << 16U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // The chunks of both sets are sparse, dense, of runs and missing from one
+    // of them; so, every pair of representations meets.
+    static bool isContained[2][kRange];
+    for (auto set = INT64_C(0); set != 2; set++) {
+        for (auto i = INT64_C(0); i != kRange; i++) {
+            auto hash = (uint64_t)(i + 1 + set * 1'000'003) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+            auto low = i % 65536;
+            switch (i >> 16U) {
+            case 0:
+                isContained[set][i] = hash >> 58U == 0;
+                break;
+            case 1:
+                isContained[set][i] = hash >> 63U == 0;
+                break;
+            case 2:
+                isContained[set][i] = (low + set * 50) % 300 < 100;
+                break;
+            case 3:
+                isContained[set][i] = set == 0 && low % 7 == 0;
+                break;
+            default:
+                isContained[set][i] = set == 1 && hash >> 59U == 0;
+                break;
+            }
+        }
+    }
+
+    for (auto variant = 0; variant != 12; variant++) {
+        auto operation = variant % 3;
+        auto isOptimized = variant / 3 % 2 != 0;
+        auto isViewed = variant / 6 != 0;
+        RoaringBitmap bitmaps[2];
+        for (auto set = 0; set != 2; set++) {
+            bitmaps[set].initialize();
+            for (auto i = INT64_C(0); i != kRange; i++) {
+                if (isContained[set][i]) {
+                    GREATEST_ASSERT(bitmaps[set].add(memoryAllocator, (uint32_t)i) == Status::eSuccess);
+                }
+            }
+            if (isOptimized) {
+                GREATEST_ASSERT(bitmaps[set].optimize(memoryAllocator) == Status::eSuccess);
+            }
+        }
+
+        ArrayList<uint64_t> words;
+        words.initialize();
+        RoaringBitmapView view;
+        if (isViewed) {
+            GREATEST_ASSERT(bitmaps[1].serialize(memoryAllocator, &words) == Status::eSuccess);
+            GREATEST_ASSERT(view.initialize(words.getView()) == Status::eSuccess);
+        }
+
+        auto status = Status::eSuccess;
+        if (operation == 0) {
+            status = isViewed ? bitmaps[0].intersectWith(memoryAllocator, &view) : bitmaps[0].intersectWith(memoryAllocator, &bitmaps[1]);
+        } else if (operation == 1) {
+            status = isViewed ? bitmaps[0].uniteWith(memoryAllocator, &view) : bitmaps[0].uniteWith(memoryAllocator, &bitmaps[1]);
+        } else {
+            status = isViewed ? bitmaps[0].subtract(memoryAllocator, &view) : bitmaps[0].subtract(memoryAllocator, &bitmaps[1]);
+        }
+
+        GREATEST_ASSERT(status == Status::eSuccess);
+
+        auto count = INT64_C(0);
+        for (auto i = INT64_C(0); i != kRange; i++) {
+            auto isExpected = operation == 0 ? isContained[0][i] && isContained[1][i] : operation == 1 ? isContained[0][i] || isContained[1][i] : isContained[0][i] && !isContained[1][i];
+            count += (int64_t)isExpected;
+
+            GREATEST_ASSERT_EQ(isExpected, bitmaps[0].contains((uint32_t)i));
+        }
+        GREATEST_ASSERT_EQ_FMT(count, bitmaps[0].getCount(), "%" PRId64);
+
+        words.destroy(memoryAllocator);
+        bitmaps[0].destroy(memoryAllocator);
+        bitmaps[1].destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::RoaringBitmapTest::testSerializing() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kCount = INT64_C(20'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // An array, a bitmap and runs are serialized after an empty bitmap, and
+    // both are read back from the same words.
+    RoaringBitmap bitmap;
+    bitmap.initialize();
+    ArrayList<uint64_t> words;
+    words.initialize();
+
+    GREATEST_ASSERT(bitmap.serialize(memoryAllocator, &words) == Status::eSuccess);
+
+    auto emptyWordCount = words.getCount();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+
+        GREATEST_ASSERT(bitmap.add(memoryAllocator, (uint32_t)(hash >> 48U)) == Status::eSuccess);
+        GREATEST_ASSERT(bitmap.add(memoryAllocator, (uint32_t)(0x1'0000 + i / 10 * 30)) == Status::eSuccess);
+        GREATEST_ASSERT(bitmap.add(memoryAllocator, (uint32_t)(0xFFFF'0000 + i)) == Status::eSuccess);
+    }
+    GREATEST_ASSERT(bitmap.optimize(memoryAllocator) == Status::eSuccess);
+    GREATEST_ASSERT(bitmap.serialize(memoryAllocator, &words) == Status::eSuccess);
+
+    RoaringBitmapView emptyView;
+
+    GREATEST_ASSERT(emptyView.initialize(words.getView()) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(emptyWordCount, emptyView.getWordCount(), "%" PRId64);
+    GREATEST_ASSERT(emptyView.isEmpty());
+
+    ArrayListView<uint64_t> wordsView;
+    wordsView.initialize(words.getArray() + emptyWordCount, words.getCount() - emptyWordCount);
+    RoaringBitmapView view;
+
+    GREATEST_ASSERT(view.initialize(wordsView) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(wordsView.getCount(), view.getWordCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(bitmap.getCount(), view.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != 3 * kCount; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        auto value = (uint32_t)(hash >> 32U);
+
+        GREATEST_ASSERT_EQ(bitmap.contains(value), view.contains(value));
+        GREATEST_ASSERT_EQ(bitmap.contains((uint32_t)(0x1'0000 + i)), view.contains((uint32_t)(0x1'0000 + i)));
+        GREATEST_ASSERT_EQ(bitmap.contains((uint32_t)(0xFFFF'0000 + i)), view.contains((uint32_t)(0xFFFF'0000 + i)));
+    }
+
+    ArrayList<uint32_t> values;
+    values.initialize();
+    ArrayList<uint32_t> viewValues;
+    viewValues.initialize();
+
+    GREATEST_ASSERT(bitmap.copyValues(memoryAllocator, &values) == Status::eSuccess);
+    GREATEST_ASSERT(view.copyValues(memoryAllocator, &viewValues) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(values.getCount(), viewValues.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != values.getCount(); i++) {
+        GREATEST_ASSERT_EQ_FMT(*values.get(i), *viewValues.get(i), "%" PRIu32);
+    }
+
+    // Uniting an empty bitmap with the view copies all of its containers.
+    RoaringBitmap copy;
+    copy.initialize();
+
+    GREATEST_ASSERT(copy.uniteWith(memoryAllocator, &view) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(bitmap.getCount(), copy.getCount(), "%" PRId64);
+    GREATEST_ASSERT(copy.subtract(memoryAllocator, &view) == Status::eSuccess);
+    GREATEST_ASSERT(copy.isEmpty());
+
+    // Truncated words, a wrong magic number and out-of-order keys are
+    // rejected.
+    wordsView.initialize(words.getArray() + emptyWordCount, words.getCount() - emptyWordCount - 1);
+
+    GREATEST_ASSERT(view.initialize(wordsView) == Status::eFailure);
+
+    auto array = words.getArray() + emptyWordCount;
+    wordsView.initialize(array, words.getCount() - emptyWordCount);
+    array[0] ^= 1U;
+
+    GREATEST_ASSERT(view.initialize(wordsView) == Status::eFailure);
+
+    array[0] ^= 1U;
+    auto key = array[3] & UINT16_MAX;
+    array[3] = (array[3] & ~UINT64_C(0xFFFF)) | (array[1] & UINT16_MAX);
+
+    GREATEST_ASSERT(view.initialize(wordsView) == Status::eFailure);
+
+    array[3] = (array[3] & ~UINT64_C(0xFFFF)) | key;
+
+    GREATEST_ASSERT(view.initialize(wordsView) == Status::eSuccess);
+
+    copy.destroy(memoryAllocator);
+    viewValues.destroy(memoryAllocator);
+    values.destroy(memoryAllocator);
+    words.destroy(memoryAllocator);
+    bitmap.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class RoaringBitmapTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testAddingAndRemoving() -> greatest_test_res;
+        static auto testSetOperations() -> greatest_test_res;
+        static auto testSerializing() -> greatest_test_res;
+    };
+}
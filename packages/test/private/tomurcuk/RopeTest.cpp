@@ -0,0 +1,250 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/Rope.hpp>
+#include <tomurcuk/RopeTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::RopeTest::suite() -> void {
+    GREATEST_RUN_TEST(testInsertingAndRemoving);
+    GREATEST_RUN_TEST(testWalkingChunks);
+    GREATEST_RUN_TEST(testInsertingWithoutMemory);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::RopeTest::testInsertingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kMaxCount = INT64_C(100'000);
+    static constexpr auto kMaxEditCount = INT64_C(300);
+    static constexpr auto kOperationCount = INT64_C(20'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto expectedResult = memoryAllocator.allocate(kMaxCount + kMaxEditCount, 1);
+    auto sourceResult = memoryAllocator.allocate(kMaxEditCount, 1);
+
+    GREATEST_ASSERT(expectedResult.isSuccess());
+    GREATEST_ASSERT(sourceResult.isSuccess());
+
+    auto expected = (char *)*expectedResult.value();
+    auto source = (char *)*sourceResult.value();
+
+    // Small nodes make the tree deep, so that splits and removals reach the
+    // root many times, and edits span many chunks.
+    Rope<char, 128> rope;
+    rope.initialize();
+    auto count = INT64_C(0);
+
+    auto state = UINT64_C(1);
+    for (auto i = INT64_C(0); i != kOperationCount; i++) {
+        state = state * UINT64_C(6'364'136'223'846'793'005) + UINT64_C(1'442'695'040'888'963'407);
+        auto index = count == 0 ? 0 : (int64_t)((state >> 32U) % (uint64_t)(count + 1));
+        auto editCount = (int64_t)((state >> 16U) % (uint64_t)kMaxEditCount);
+
+        // Most edits are a few elements, like typing, but some are large.
+        if (((state >> 8U) & 3U) != 0) {
+            editCount %= 4;
+        }
+
+        // Grow for a while, then shrink, so that chunks get both split and
+        // merged.
+        auto isRemoval = ((state >> 4U) & 7U) < (i < kOperationCount / 2 ? 3U : 5U) || count + editCount > kMaxCount;
+        if (isRemoval) {
+            auto endIndex = index + editCount < count ? index + editCount : count;
+            rope.removePortion(memoryAllocator, index, endIndex);
+            if (endIndex != count) {
+                Bytes::copyAliasingArray(expected + index, expected + endIndex, count - endIndex);
+            }
+            count -= endIndex - index;
+        } else {
+            for (auto j = INT64_C(0); j != editCount; j++) {
+                source[j] = (char)('a' + (i + j) % 26);
+            }
+            ArrayListView<char> view;
+            view.initialize(editCount == 0 ? nullptr : source, editCount);
+
+            GREATEST_ASSERT(rope.insertAll(memoryAllocator, index, view) == Status::eSuccess);
+
+            if (editCount != 0) {
+                if (index != count) {
+                    Bytes::copyAliasingArray(expected + index + editCount, expected + index, count - index);
+                }
+                Bytes::copyArray(expected + index, source, editCount);
+            }
+            count += editCount;
+        }
+
+        GREATEST_ASSERT_EQ_FMT(count, rope.getCount(), "%" PRId64);
+
+        if (i % 500 == 0 || i == kOperationCount - 1) {
+            auto cursor = rope.getFirst();
+            auto walkedCount = INT64_C(0);
+            for (; cursor.isValid(); cursor.moveNext()) {
+                auto chunk = cursor.getChunk();
+
+                GREATEST_ASSERT(!chunk.isEmpty());
+                GREATEST_ASSERT_EQ_FMT(walkedCount, cursor.getIndex(), "%" PRId64);
+                GREATEST_ASSERT(Bytes::testArrayExactness(chunk.getArray(), chunk.getCount(), expected + walkedCount, chunk.getCount()));
+
+                walkedCount += chunk.getCount();
+            }
+
+            GREATEST_ASSERT_EQ_FMT(count, walkedCount, "%" PRId64);
+
+            for (auto j = INT64_C(0); j < count; j += 97) {
+                GREATEST_ASSERT_EQ(expected[j], *rope.get(j));
+            }
+        }
+    }
+
+    rope.removePortion(memoryAllocator, 0, rope.getCount());
+
+    GREATEST_ASSERT(rope.isEmpty());
+    GREATEST_ASSERT(!rope.getFirst().isValid());
+    GREATEST_ASSERT(!rope.getLast().isValid());
+
+    rope.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::RopeTest::testWalkingChunks() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(100'000'000);
+    static constexpr auto kCount = INT64_C(1'000'000);
+    static constexpr auto kPieceCount = INT64_C(4096);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto elementsResult = memoryAllocator.allocate(kCount * (int64_t)sizeof(int32_t), alignof(int32_t));
+
+    GREATEST_ASSERT(elementsResult.isSuccess());
+
+    auto elements = (int32_t *)*elementsResult.value();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        elements[i] = (int32_t)i;
+    }
+
+    // Appending fills every chunk before starting the next one.
+    Rope<int32_t> rope;
+    rope.initialize();
+    for (auto i = INT64_C(0); i < kCount; i += kPieceCount) {
+        ArrayListView<int32_t> view;
+        view.initialize(elements + i, kCount - i < kPieceCount ? kCount - i : kPieceCount);
+
+        GREATEST_ASSERT(rope.insertAll(memoryAllocator, i, view) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount, rope.getCount(), "%" PRId64);
+
+    auto chunkCount = INT64_C(0);
+    auto first = rope.getFirst();
+    auto chunkSize = first.getChunk().getCount();
+    for (; first.isValid(); first.moveNext()) {
+        auto chunk = first.getChunk();
+        if (first.getIndex() + chunk.getCount() != kCount) {
+            GREATEST_ASSERT_EQ_FMT(chunkSize, chunk.getCount(), "%" PRId64);
+        }
+        chunkCount++;
+    }
+
+    GREATEST_ASSERT_EQ_FMT((kCount + chunkSize - 1) / chunkSize, chunkCount, "%" PRId64);
+
+    // Inserting into the middle splits a single chunk.
+    int32_t marker = -1;
+    ArrayListView<int32_t> markerView;
+    markerView.initialize(&marker, 1);
+
+    GREATEST_ASSERT(rope.insertAll(memoryAllocator, kCount / 2, markerView) == Status::eSuccess);
+    GREATEST_ASSERT_EQ(-1, *rope.get(kCount / 2));
+    GREATEST_ASSERT_EQ_FMT(kCount / 2 - 1, (int64_t)*rope.get(kCount / 2 - 1), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kCount / 2, (int64_t)*rope.get(kCount / 2 + 1), "%" PRId64);
+
+    // A scan from any element begins at the chunk that holds it.
+    for (auto i = INT64_C(0); i <= kCount; i += 9973) {
+        auto cursor = rope.find(i);
+
+        GREATEST_ASSERT(cursor.isValid());
+
+        auto offset = i - cursor.getIndex();
+
+        GREATEST_ASSERT(offset >= 0);
+        GREATEST_ASSERT(offset < cursor.getChunk().getCount());
+        GREATEST_ASSERT_EQ(*rope.get(i), *cursor.getChunk().get(offset));
+    }
+
+    GREATEST_ASSERT(!rope.find(rope.getCount()).isValid());
+
+    auto last = rope.getLast();
+    auto walkedCount = INT64_C(0);
+    for (; last.isValid(); last.movePrevious()) {
+        auto chunk = last.getChunk();
+        walkedCount += chunk.getCount();
+
+        GREATEST_ASSERT_EQ_FMT(rope.getCount() - walkedCount, last.getIndex(), "%" PRId64);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(rope.getCount(), walkedCount, "%" PRId64);
+
+    rope.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::RopeTest::testInsertingWithoutMemory() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1) << 16U;
+    static constexpr auto kCount = INT64_C(1000);
+    static constexpr auto kLargeCount = INT64_C(1) << 17U;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    static char elements[kLargeCount];
+    for (auto i = INT64_C(0); i != kLargeCount; i++) {
+        elements[i] = (char)('a' + i % 26);
+    }
+
+    Rope<char> rope;
+    rope.initialize();
+    ArrayListView<char> view;
+    view.initialize(elements, kCount);
+
+    GREATEST_ASSERT(rope.insertAll(memoryAllocator, 0, view) == Status::eSuccess);
+
+    // The allocator runs out partway, and the inserted elements are removed
+    // again.
+    view.initialize(elements, kLargeCount);
+
+    GREATEST_ASSERT(rope.insertAll(memoryAllocator, kCount / 2, view) == Status::eFailure);
+    GREATEST_ASSERT_EQ_FMT(kCount, rope.getCount(), "%" PRId64);
+
+    auto cursor = rope.getFirst();
+    for (; cursor.isValid(); cursor.moveNext()) {
+        auto chunk = cursor.getChunk();
+
+        GREATEST_ASSERT(Bytes::testArrayExactness(chunk.getArray(), chunk.getCount(), elements + cursor.getIndex(), chunk.getCount()));
+    }
+
+    rope.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
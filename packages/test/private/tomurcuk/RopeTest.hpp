@@ -0,0 +1,15 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class RopeTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testInsertingAndRemoving() -> greatest_test_res;
+        static auto testWalkingChunks() -> greatest_test_res;
+        static auto testInsertingWithoutMemory() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,92 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/SegmentedArrayList.hpp>
+#include <tomurcuk/SegmentedArrayListTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::SegmentedArrayListTest::suite() -> void {
+    GREATEST_RUN_TEST(testKeepingAddresses);
+    GREATEST_RUN_TEST(testIteratingChunks);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SegmentedArrayListTest::testKeepingAddresses() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(10'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SegmentedArrayList<int64_t> list;
+    list.initialize();
+
+    GREATEST_ASSERT(list.add(memoryAllocator, 0) == Status::eSuccess);
+
+    auto first = list.getFirst();
+    for (auto i = INT64_C(1); i != kCount; i++) {
+        GREATEST_ASSERT(list.add(memoryAllocator, i) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT(first == list.getFirst());
+    GREATEST_ASSERT_EQ_FMT(kCount, list.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, *list.get(i), "%" PRId64);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount - 1, list.removeLast(), "%" PRId64);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SegmentedArrayListTest::testIteratingChunks() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SegmentedArrayList<int64_t> list;
+    list.initialize();
+
+    static int64_t elements[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        elements[i] = i;
+    }
+    ArrayListView<int64_t> view;
+    view.initialize(elements, kCount);
+
+    GREATEST_ASSERT(list.add(memoryAllocator, -1) == Status::eSuccess);
+    GREATEST_ASSERT(list.addAll(memoryAllocator, view) == Status::eSuccess);
+
+    auto expected = INT64_C(-1);
+    for (auto i = INT64_C(0); i != list.getChunkCount(); i++) {
+        auto chunkView = list.getChunkView(i);
+        for (auto j = INT64_C(0); j != chunkView.getCount(); j++) {
+            GREATEST_ASSERT_EQ_FMT(expected, *chunkView.get(j), "%" PRId64);
+            expected++;
+        }
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount, expected, "%" PRId64);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class SegmentedArrayListTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testKeepingAddresses() -> greatest_test_res;
+        static auto testIteratingChunks() -> greatest_test_res;
+    };
+}
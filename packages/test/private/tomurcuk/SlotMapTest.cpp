@@ -0,0 +1,98 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/SlotHandle.hpp>
+#include <tomurcuk/SlotMap.hpp>
+#include <tomurcuk/SlotMapTest.hpp>
+
+auto tomurcuk::SlotMapTest::suite() -> void {
+    GREATEST_RUN_TEST(testInsertingAndRemoving);
+    GREATEST_RUN_TEST(testDetectingStaleHandles);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SlotMapTest::testInsertingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SlotMap<int64_t> map;
+    map.initialize();
+
+    static SlotHandle handles[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto handleResult = map.insert(memoryAllocator, i);
+
+        GREATEST_ASSERT(handleResult.isSuccess());
+
+        handles[i] = *handleResult.value();
+    }
+
+    // Removing the even ones moves the odd ones around in the dense array,
+    // which must not affect their handles.
+    for (auto i = INT64_C(0); i < kCount; i += 2) {
+        GREATEST_ASSERT_EQ_FMT(i, map.remove(handles[i]), "%" PRId64);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount / 2, map.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(1); i < kCount; i += 2) {
+        GREATEST_ASSERT_EQ_FMT(i, *map.get(handles[i]), "%" PRId64);
+    }
+
+    auto view = map.getView();
+    for (auto i = INT64_C(0); i != view.getCount(); i++) {
+        GREATEST_ASSERT(map.get(map.getHandle(i)) == view.get(i));
+    }
+
+    map.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SlotMapTest::testDetectingStaleHandles() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SlotMap<int64_t> map;
+    map.initialize();
+
+    auto oldHandleResult = map.insert(memoryAllocator, 1);
+
+    GREATEST_ASSERT(oldHandleResult.isSuccess());
+
+    auto oldHandle = *oldHandleResult.value();
+    map.remove(oldHandle);
+
+    // The new element reuses the slot of the removed one.
+    auto newHandleResult = map.insert(memoryAllocator, 2);
+
+    GREATEST_ASSERT(newHandleResult.isSuccess());
+
+    auto newHandle = *newHandleResult.value();
+
+    GREATEST_ASSERT_EQ_FMT(oldHandle.index, newHandle.index, "%" PRIu32);
+    GREATEST_ASSERT(!map.contains(oldHandle));
+    GREATEST_ASSERT(map.get(oldHandle) == nullptr);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(2), *map.get(newHandle), "%" PRId64);
+
+    map.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
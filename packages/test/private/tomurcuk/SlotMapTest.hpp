@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class SlotMapTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testInsertingAndRemoving() -> greatest_test_res;
+        static auto testDetectingStaleHandles() -> greatest_test_res;
+    };
+}
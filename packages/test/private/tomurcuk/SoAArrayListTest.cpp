@@ -0,0 +1,213 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/SoAArrayList.hpp>
+#include <tomurcuk/SoAArrayListTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::SoAArrayListTest::suite() -> void {
+    GREATEST_RUN_TEST(testAddingAndRemoving);
+    GREATEST_RUN_TEST(testAppendingInBulk);
+    GREATEST_RUN_TEST(testReservingWithoutMemory);
+    GREATEST_RUN_TEST(testAligningAfterGrowing);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SoAArrayListTest::testAddingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SoAArrayList<int64_t, uint8_t, int32_t> list;
+    list.initialize();
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(list.add(memoryAllocator, i, (uint8_t)i, (int32_t)-i) == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount, list.getCount(), "%" PRId64);
+    GREATEST_ASSERT((uint64_t)list.getColumn<0>() % (uint64_t)list.kColumnAlignment == 0);
+    GREATEST_ASSERT((uint64_t)list.getColumn<1>() % (uint64_t)list.kColumnAlignment == 0);
+    GREATEST_ASSERT((uint64_t)list.getColumn<2>() % (uint64_t)list.kColumnAlignment == 0);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, *list.getColumnView<0>().get(i), "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT((int)(uint8_t)i, (int)list.getColumn<1>()[i], "%d");
+        GREATEST_ASSERT_EQ_FMT((int32_t)-i, list.getColumn<2>()[i], "%" PRId32);
+    }
+
+    list.removeUnordered(0);
+
+    GREATEST_ASSERT_EQ_FMT(kCount - 1, list.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kCount - 1, list.getColumn<0>()[0], "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT((int)(uint8_t)(kCount - 1), (int)list.getColumn<1>()[0], "%d");
+    GREATEST_ASSERT_EQ_FMT((int32_t)(1 - kCount), list.getColumn<2>()[0], "%" PRId32);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SoAArrayListTest::testAppendingInBulk() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SoAArrayList<int64_t, uint8_t, int32_t> list;
+    list.initialize();
+
+    GREATEST_ASSERT(list.add(memoryAllocator, -1, (uint8_t)255, (int32_t)1) == Status::eSuccess);
+
+    // The columns are written past the records, and the written records are
+    // acknowledged at once.
+    GREATEST_ASSERT(list.reserve(memoryAllocator, kCount) == Status::eSuccess);
+    GREATEST_ASSERT(list.getUninitializedCount() >= kCount);
+
+    auto keys = list.getColumn<0>() + list.getCount();
+    auto tags = list.getColumn<1>() + list.getCount();
+    auto weights = list.getColumn<2>() + list.getCount();
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        keys[i] = i;
+        tags[i] = (uint8_t)i;
+        weights[i] = (int32_t)-i;
+    }
+    list.acknowledge(kCount);
+
+    GREATEST_ASSERT_EQ_FMT(kCount + 1, list.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), list.getColumn<0>()[0], "%" PRId64);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, list.getColumn<0>()[i + 1], "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT((int)(uint8_t)i, (int)list.getColumn<1>()[i + 1], "%d");
+        GREATEST_ASSERT_EQ_FMT((int32_t)-i, list.getColumn<2>()[i + 1], "%" PRId32);
+    }
+
+    // Removing only forgets the records, and keeps the memory for the next
+    // ones.
+    auto allocatedCount = list.getAllocatedCount();
+    list.removeLast();
+
+    GREATEST_ASSERT_EQ_FMT(kCount, list.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(kCount - 2, *list.getColumnView<0>().getLast(), "%" PRId64);
+
+    list.removeAll();
+
+    GREATEST_ASSERT(list.isEmpty());
+    GREATEST_ASSERT_EQ_FMT(allocatedCount, list.getAllocatedCount(), "%" PRId64);
+    GREATEST_ASSERT(list.add(memoryAllocator, 7, (uint8_t)7, (int32_t)7) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(7), list.getColumn<0>()[0], "%" PRId64);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SoAArrayListTest::testReservingWithoutMemory() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1) << 16U;
+    static constexpr auto kCount = INT64_C(100);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SoAArrayList<int64_t, uint8_t, int32_t> list;
+    list.initialize();
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT(list.add(memoryAllocator, i, (uint8_t)i, (int32_t)-i) == Status::eSuccess);
+    }
+
+    auto allocatedCount = list.getAllocatedCount();
+    auto keys = list.getColumn<0>();
+    auto tags = list.getColumn<1>();
+    auto weights = list.getColumn<2>();
+
+    GREATEST_ASSERT(list.reserve(memoryAllocator, kCapacity) == Status::eFailure);
+
+    // The list is left as it was.
+    GREATEST_ASSERT_EQ_FMT(kCount, list.getCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(allocatedCount, list.getAllocatedCount(), "%" PRId64);
+    GREATEST_ASSERT_EQ(keys, list.getColumn<0>());
+    GREATEST_ASSERT_EQ(tags, list.getColumn<1>());
+    GREATEST_ASSERT_EQ(weights, list.getColumn<2>());
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(i, keys[i], "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT((int)(uint8_t)i, (int)tags[i], "%d");
+        GREATEST_ASSERT_EQ_FMT((int32_t)-i, weights[i], "%" PRId32);
+    }
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SoAArrayListTest::testAligningAfterGrowing() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // The fields are of odd sizes, so that the columns would not be aligned
+    // by their sizes alone.
+    SoAArrayList<uint8_t, int16_t, int64_t> list;
+    list.initialize();
+
+    auto moveCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto tags = list.getColumn<0>();
+        auto lengths = list.getColumn<1>();
+        auto offsets = list.getColumn<2>();
+
+        GREATEST_ASSERT(list.add(memoryAllocator, (uint8_t)i, (int16_t)(3 * i), 5 * i) == Status::eSuccess);
+
+        if (list.getColumn<0>() == tags) {
+            continue;
+        }
+
+        // Every column moves to its place in the new block.
+        GREATEST_ASSERT(list.getColumn<1>() != lengths);
+        GREATEST_ASSERT(list.getColumn<2>() != offsets);
+        GREATEST_ASSERT((uint64_t)list.getColumn<0>() % (uint64_t)list.kColumnAlignment == 0);
+        GREATEST_ASSERT((uint64_t)list.getColumn<1>() % (uint64_t)list.kColumnAlignment == 0);
+        GREATEST_ASSERT((uint64_t)list.getColumn<2>() % (uint64_t)list.kColumnAlignment == 0);
+
+        for (auto j = INT64_C(0); j <= i; j++) {
+            GREATEST_ASSERT_EQ_FMT((int)(uint8_t)j, (int)list.getColumn<0>()[j], "%d");
+            GREATEST_ASSERT_EQ_FMT((int)(int16_t)(3 * j), (int)list.getColumn<1>()[j], "%d");
+            GREATEST_ASSERT_EQ_FMT(5 * j, list.getColumn<2>()[j], "%" PRId64);
+        }
+        moveCount++;
+    }
+
+    GREATEST_ASSERT(moveCount > 1);
+
+    list.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
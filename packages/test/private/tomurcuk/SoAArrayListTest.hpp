@@ -0,0 +1,16 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class SoAArrayListTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testAddingAndRemoving() -> greatest_test_res;
+        static auto testAppendingInBulk() -> greatest_test_res;
+        static auto testReservingWithoutMemory() -> greatest_test_res;
+        static auto testAligningAfterGrowing() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,303 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/OrderComparable.hpp>
+#include <tomurcuk/Ordering.hpp>
+#include <tomurcuk/RadixSortable.hpp>
+#include <tomurcuk/Sorts.hpp>
+#include <tomurcuk/SortsTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Element that is too wide for the branchless partition, and whose
+     * payload shows whether it moved together with its key.
+     */
+    struct SortsTestRecord {
+        int64_t key;
+        int64_t payload[3];
+    };
+
+    template<>
+    class OrderComparable<SortsTestRecord> {
+    public:
+        static auto compare(SortsTestRecord *instance0, SortsTestRecord *instance1) -> Ordering {
+            return OrderComparable<int64_t>::compare(&instance0->key, &instance1->key);
+        }
+    };
+
+    template<>
+    class RadixSortable<SortsTestRecord> {
+    public:
+        using Key = uint64_t;
+
+        static auto createKey(SortsTestRecord *instance) -> Key {
+            return RadixSortable<int64_t>::createKey(&instance->key);
+        }
+    };
+}
+
+auto tomurcuk::SortsTest::suite() -> void {
+    GREATEST_RUN_TEST(testSortingComparably);
+    GREATEST_RUN_TEST(testSortingWideElements);
+    GREATEST_RUN_TEST(testSortingByRadix);
+    GREATEST_RUN_TEST(testSortingFloatsByRadix);
+    GREATEST_RUN_TEST(testSortingStablyByRadix);
+    GREATEST_RUN_TEST(testSortingCharsByRadix);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SortsTest::testSortingComparably() -> greatest_test_res {
+    static constexpr auto kDistributionCount = INT64_C(6);
+    static constexpr int64_t kCounts[] = {0, 1, 2, 23, 24, 129, 1000, 100'000};
+
+    static int64_t array[100'000];
+    for (auto distribution = INT64_C(0); distribution != kDistributionCount; distribution++) {
+        for (auto count : kCounts) {
+            fill(array, count, distribution);
+            auto sum = UINT64_C(0);
+            for (auto i = INT64_C(0); i != count; i++) {
+                sum += (uint64_t)array[i];
+            }
+
+            ArrayListView<int64_t> view;
+            if (count == 0) {
+                view.initializeEmpty();
+            } else {
+                view.initialize(array, count);
+            }
+            Sorts::sort(view);
+
+            for (auto i = INT64_C(1); i < count; i++) {
+                GREATEST_ASSERT(array[i - 1] <= array[i]);
+            }
+            for (auto i = INT64_C(0); i != count; i++) {
+                sum -= (uint64_t)array[i];
+            }
+
+            GREATEST_ASSERT_EQ_FMT(UINT64_C(0), sum, "%" PRIu64);
+        }
+    }
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SortsTest::testSortingWideElements() -> greatest_test_res {
+    static constexpr auto kCount = INT64_C(10'000);
+
+    static int64_t keys[kCount];
+    static SortsTestRecord records[kCount];
+    fill(keys, kCount, 0);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        records[i].key = keys[i] % 100;
+        records[i].payload[0] = records[i].key * 3;
+        records[i].payload[1] = i;
+        records[i].payload[2] = records[i].key * 5;
+    }
+
+    ArrayListView<SortsTestRecord> view;
+    view.initialize(records, kCount);
+    Sorts::sort(view);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        if (i != 0) {
+            GREATEST_ASSERT(records[i - 1].key <= records[i].key);
+        }
+
+        GREATEST_ASSERT_EQ_FMT(records[i].key * 3, records[i].payload[0], "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT(records[i].key * 5, records[i].payload[2], "%" PRId64);
+    }
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SortsTest::testSortingByRadix() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kDistributionCount = INT64_C(6);
+    static constexpr auto kCount = INT64_C(100'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    static int64_t expected[kCount];
+    static int64_t actual[kCount];
+    for (auto distribution = INT64_C(0); distribution != kDistributionCount; distribution++) {
+        fill(expected, kCount, distribution);
+        ArrayListView<int64_t> expectedView;
+        expectedView.initialize(expected, kCount);
+        ArrayListView<int64_t> actualView;
+        actualView.initialize(actual, kCount);
+
+        Bytes::copyArray(actual, expected, kCount);
+        Sorts::sort(expectedView);
+
+        GREATEST_ASSERT(Sorts::sortByRadix(memoryAllocator, actualView) == Status::eSuccess);
+        GREATEST_ASSERT(Bytes::testArrayExactness(expected, kCount, actual, kCount));
+
+        // The scratch memory is returned to the allocator.
+        GREATEST_ASSERT_EQ_FMT(INT64_C(0), linearMemoryAllocator.cursor(), "%" PRId64);
+
+        fill(actual, kCount, distribution);
+        Sorts::sortByRadixInPlace(actualView);
+
+        GREATEST_ASSERT(Bytes::testArrayExactness(expected, kCount, actual, kCount));
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SortsTest::testSortingFloatsByRadix() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(10'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    static int64_t keys[kCount];
+    static double values[kCount];
+    fill(keys, kCount, 0);
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        values[i] = (double)(keys[i] % 2000 - 1000) / 8.0;
+    }
+
+    ArrayListView<double> view;
+    view.initialize(values, kCount);
+
+    GREATEST_ASSERT(Sorts::sortByRadix(memoryAllocator, view) == Status::eSuccess);
+
+    for (auto i = INT64_C(1); i != kCount; i++) {
+        GREATEST_ASSERT(values[i - 1] <= values[i]);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SortsTest::testSortingStablyByRadix() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr int64_t kCounts[] = {2, 24, 63, 64, 65, 1000};
+    static constexpr auto kMaxCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Few keys with negative ones among them, and the payload is the
+    // original position, which must stay ascending among equal keys.
+    static int64_t keys[kMaxCount];
+    static SortsTestRecord records[kMaxCount];
+    fill(keys, kMaxCount, 0);
+    for (auto count : kCounts) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            records[i].key = keys[i] % 5;
+            records[i].payload[0] = i;
+        }
+        ArrayListView<SortsTestRecord> view;
+        view.initialize(records, count);
+
+        GREATEST_ASSERT(Sorts::sortByRadix(memoryAllocator, view) == Status::eSuccess);
+
+        for (auto i = INT64_C(1); i != count; i++) {
+            GREATEST_ASSERT(records[i - 1].key <= records[i].key);
+
+            if (records[i - 1].key == records[i].key) {
+                GREATEST_ASSERT(records[i - 1].payload[0] < records[i].payload[0]);
+            }
+        }
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SortsTest::testSortingCharsByRadix() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr int64_t kCounts[] = {40, 1000};
+    static constexpr auto kMaxCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Every byte value occurs, so that the chars are of both signs where
+    // `char` is signed.
+    static int64_t keys[kMaxCount];
+    static char expected[kMaxCount];
+    static char actual[kMaxCount];
+    fill(keys, kMaxCount, 0);
+    for (auto count : kCounts) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            expected[i] = (char)(uint8_t)(keys[i] >> 56U);
+        }
+        Bytes::copyArray(actual, expected, count);
+        ArrayListView<char> expectedView;
+        expectedView.initialize(expected, count);
+        ArrayListView<char> actualView;
+        actualView.initialize(actual, count);
+        Sorts::sort(expectedView);
+
+        GREATEST_ASSERT(Sorts::sortByRadix(memoryAllocator, actualView) == Status::eSuccess);
+        GREATEST_ASSERT(Bytes::testArrayExactness(expected, count, actual, count));
+
+        for (auto i = INT64_C(0); i != count; i++) {
+            actual[i] = (char)(uint8_t)(keys[i] >> 56U);
+        }
+        Sorts::sortByRadixInPlace(actualView);
+
+        GREATEST_ASSERT(Bytes::testArrayExactness(expected, count, actual, count));
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SortsTest::fill(int64_t *array, int64_t count, int64_t distribution) -> void {
+    for (auto i = INT64_C(0); i != count; i++) {
+        auto hash = (int64_t)((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15));
+        switch (distribution) {
+        case 0:
+            array[i] = hash;
+            break;
+        case 1:
+            array[i] = i;
+            break;
+        case 2:
+            array[i] = count - i;
+            break;
+        case 3:
+            array[i] = hash & 15;
+            break;
+        case 4:
+            array[i] = i < count / 2 ? i : count - i;
+            break;
+        default:
+            array[i] = -7;
+            break;
+        }
+    }
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
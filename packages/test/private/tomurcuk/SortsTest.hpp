@@ -0,0 +1,21 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+
+namespace tomurcuk {
+    class SortsTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testSortingComparably() -> greatest_test_res;
+        static auto testSortingWideElements() -> greatest_test_res;
+        static auto testSortingByRadix() -> greatest_test_res;
+        static auto testSortingFloatsByRadix() -> greatest_test_res;
+        static auto testSortingStablyByRadix() -> greatest_test_res;
+        static auto testSortingCharsByRadix() -> greatest_test_res;
+
+        static auto fill(int64_t *array, int64_t count, int64_t distribution) -> void;
+    };
+}
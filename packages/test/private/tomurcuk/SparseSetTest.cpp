@@ -0,0 +1,71 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/SparseSet.hpp>
+#include <tomurcuk/SparseSetTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::SparseSetTest::suite() -> void {
+    GREATEST_RUN_TEST(testInsertingAndRemoving);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SparseSetTest::testInsertingAndRemoving() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kUniverseSize = INT64_C(1200);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    SparseSet set;
+    set.initialize();
+
+    GREATEST_ASSERT(set.resize(memoryAllocator, kUniverseSize / 2) == Status::eSuccess);
+
+    for (auto i = UINT32_C(0); i < kUniverseSize / 2; i += 3) {
+        GREATEST_ASSERT(set.insert(i));
+    }
+
+    GREATEST_ASSERT(!set.insert(3));
+
+    // Growing keeps the members.
+    GREATEST_ASSERT(set.resize(memoryAllocator, kUniverseSize) == Status::eSuccess);
+
+    for (auto i = UINT32_C(kUniverseSize / 2); i < kUniverseSize; i += 3) {
+        GREATEST_ASSERT(set.insert(i));
+    }
+    for (auto i = UINT32_C(0); i < kUniverseSize; i += 6) {
+        GREATEST_ASSERT(set.remove(i));
+    }
+
+    GREATEST_ASSERT(!set.remove(0));
+
+    for (auto i = UINT32_C(0); i != kUniverseSize; i++) {
+        GREATEST_ASSERT(set.contains(i) == (i % 3 == 0 && i % 6 != 0));
+    }
+
+    auto view = set.getView();
+
+    GREATEST_ASSERT_EQ_FMT(set.getCount(), view.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != view.getCount(); i++) {
+        GREATEST_ASSERT(set.contains(*view.get(i)));
+    }
+
+    set.removeAll();
+
+    GREATEST_ASSERT(set.isEmpty());
+    GREATEST_ASSERT(!set.contains(9));
+
+    set.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class SparseSetTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testInsertingAndRemoving() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,108 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/StaticBTreeIndex.hpp>
+#include <tomurcuk/StaticBTreeIndexTest.hpp>
+#include <tomurcuk/Status.hpp>
+
+auto tomurcuk::StaticBTreeIndexTest::suite() -> void {
+    GREATEST_RUN_TEST(testFindingLowerBounds);
+    GREATEST_RUN_TEST(testFindingByComparator);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::StaticBTreeIndexTest::testFindingLowerBounds() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr int64_t kCounts[] = {0, 1, 2, 7, 8, 9, 72, 73, 1000, 100'000};
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Every third value is skipped, and every other one is repeated.
+    static uint64_t array[100'000];
+    for (auto count : kCounts) {
+        for (auto i = INT64_C(0); i != count; i++) {
+            array[i] = (uint64_t)(i / 2 * 3);
+        }
+        ArrayListView<uint64_t> view;
+        if (count == 0) {
+            view.initializeEmpty();
+        } else {
+            view.initialize(array, count);
+        }
+        StaticBTreeIndex<uint64_t> index;
+        index.initialize();
+
+        GREATEST_ASSERT(index.build(memoryAllocator, view) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(count, index.getCount(), "%" PRId64);
+
+        auto sortedIndex = INT64_C(0);
+        for (auto value = UINT64_C(0); value <= (uint64_t)(count / 2 * 3 + 1); value++) {
+            while (sortedIndex != count && array[sortedIndex] < value) {
+                sortedIndex++;
+            }
+            auto found = index.findLowerBound(value);
+
+            GREATEST_ASSERT_EQ(sortedIndex == count, found == nullptr);
+
+            if (found != nullptr) {
+                GREATEST_ASSERT_EQ_FMT(array[sortedIndex], *found, "%" PRIu64);
+            }
+
+            GREATEST_ASSERT_EQ(sortedIndex != count && array[sortedIndex] == value, index.find(value) != nullptr);
+        }
+
+        index.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::StaticBTreeIndexTest::testFindingByComparator() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(1000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    double array[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        array[i] = (double)i / 4;
+    }
+    ArrayListView<double> view;
+    view.initialize(array, kCount);
+    StaticBTreeIndex<double> index;
+    index.initialize();
+
+    GREATEST_ASSERT(index.build(memoryAllocator, view) == Status::eSuccess);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto found = index.findLowerBound((double)i / 4 - 0.1);
+
+        GREATEST_ASSERT(found != nullptr);
+        GREATEST_ASSERT_EQ_FMT(array[i], *found, "%f");
+    }
+
+    GREATEST_ASSERT_EQ(nullptr, index.findLowerBound((double)kCount));
+    GREATEST_ASSERT_EQ(nullptr, index.find(0.1));
+
+    index.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class StaticBTreeIndexTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testFindingLowerBounds() -> greatest_test_res;
+        static auto testFindingByComparator() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,232 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <threads.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringInterner.hpp>
+#include <tomurcuk/StringInternerTest.hpp>
+
+auto tomurcuk::StringInternerTest::suite() -> void {
+    GREATEST_RUN_TEST(testInterning);
+    GREATEST_RUN_TEST(testInterningInBatches);
+    GREATEST_RUN_TEST(testInterningOnThreads);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::StringInternerTest::testInterning() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto internerResult = StringInterner::create(memoryAllocator, kCapacity, 1);
+
+    GREATEST_ASSERT(internerResult.isSuccess());
+
+    auto interner = *internerResult.value();
+
+    // The symbols of a single shard count up from `0`, and the empty string
+    // is a string like any other.
+    static char characters[kCount][16];
+    static ArrayListView<char> strings[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        strings[i] = createString(characters[i], i);
+        auto symbolResult = interner.intern(memoryAllocator, strings[i]);
+
+        GREATEST_ASSERT(symbolResult.isSuccess());
+        GREATEST_ASSERT_EQ_FMT((uint32_t)i, *symbolResult.value(), "%" PRIu32);
+    }
+
+    ArrayListView<char> empty;
+    empty.initializeEmpty();
+
+    GREATEST_ASSERT(interner.find(empty).isFailure());
+
+    auto emptySymbolResult = interner.intern(memoryAllocator, empty);
+
+    GREATEST_ASSERT(emptySymbolResult.isSuccess());
+    GREATEST_ASSERT_EQ_FMT((uint32_t)kCount, *emptySymbolResult.value(), "%" PRIu32);
+    GREATEST_ASSERT(interner.resolve((uint32_t)kCount).isEmpty());
+
+    // Interning a string again, even from other characters, finds its
+    // symbol; and resolving a symbol provides a copy of the characters.
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        char copy[16];
+        auto string = createString(copy, i);
+        auto symbolResult = interner.intern(memoryAllocator, string);
+
+        GREATEST_ASSERT(symbolResult.isSuccess());
+        GREATEST_ASSERT_EQ_FMT((uint32_t)i, *symbolResult.value(), "%" PRIu32);
+
+        auto foundSymbolResult = interner.find(string);
+
+        GREATEST_ASSERT(foundSymbolResult.isSuccess());
+        GREATEST_ASSERT_EQ_FMT((uint32_t)i, *foundSymbolResult.value(), "%" PRIu32);
+
+        auto resolved = interner.resolve((uint32_t)i);
+
+        GREATEST_ASSERT(resolved.getArray() != strings[i].getArray());
+        GREATEST_ASSERT(Bytes::testBlockExactness(resolved.getArray(), resolved.getCount(), string.getArray(), string.getCount()));
+    }
+    GREATEST_ASSERT_EQ_FMT(kCount + 1, interner.getCount(), "%" PRId64);
+
+    // A prefix is a distinct string.
+    ArrayListView<char> prefix;
+    prefix.initialize(strings[0].getArray(), strings[0].getCount() - 1);
+
+    GREATEST_ASSERT(interner.find(prefix).isFailure());
+
+    interner.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::StringInternerTest::testInterningInBatches() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kBatchCount = 3 * kCount;
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Every string appears three times in a batch, and the symbols agree with
+    // the ones of interning them one by one, with every shard count.
+    static char characters[kCount][16];
+    static ArrayListView<char> strings[kBatchCount];
+    static uint32_t symbols[kBatchCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        strings[i] = createString(characters[i], i);
+    }
+    for (auto i = kCount; i != kBatchCount; i++) {
+        strings[i] = strings[((uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15)) % (uint64_t)kCount];
+    }
+    ArrayListView<ArrayListView<char>> stringsView;
+    stringsView.initialize(strings, kBatchCount);
+    ArrayListView<uint32_t> symbolsView;
+    symbolsView.initialize(symbols, kBatchCount);
+
+    for (auto shardCount = INT64_C(1); shardCount <= StringInterner::kMaxShardCount; shardCount *= 4) {
+        auto internerResult = StringInterner::create(memoryAllocator, kCapacity, shardCount);
+
+        GREATEST_ASSERT(internerResult.isSuccess());
+
+        auto interner = *internerResult.value();
+
+        GREATEST_ASSERT(interner.internAll(memoryAllocator, stringsView, symbolsView) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(kCount, interner.getCount(), "%" PRId64);
+
+        for (auto i = INT64_C(0); i != kBatchCount; i++) {
+            auto symbolResult = interner.intern(memoryAllocator, strings[i]);
+
+            GREATEST_ASSERT(symbolResult.isSuccess());
+            GREATEST_ASSERT_EQ_FMT(symbols[i], *symbolResult.value(), "%" PRIu32);
+
+            auto resolved = interner.resolve(symbols[i]);
+
+            GREATEST_ASSERT(Bytes::testBlockExactness(resolved.getArray(), resolved.getCount(), strings[i].getArray(), strings[i].getCount()));
+        }
+
+        interner.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::StringInternerTest::testInterningOnThreads() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(10'000'000);
+    static constexpr auto kThreadCount = INT64_C(4);
+    static constexpr auto kShardCount = INT64_C(8);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+    auto internerResult = StringInterner::create(memoryAllocator, kCapacity, kShardCount);
+
+    GREATEST_ASSERT(internerResult.isSuccess());
+
+    auto interner = *internerResult.value();
+
+    // Every thread interns all the strings from a different one, so that
+    // they race to intern each string first; yet, they must agree on the
+    // symbols.
+    static char characters[kCount][16];
+    static ArrayListView<char> strings[kCount];
+    static uint32_t symbols[kThreadCount][kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        strings[i] = createString(characters[i], i);
+    }
+
+    Job jobs[kThreadCount];
+    thrd_t threads[kThreadCount];
+    for (auto i = INT64_C(0); i != kThreadCount; i++) {
+        jobs[i].interner = &interner;
+        jobs[i].memoryAllocator = memoryAllocator;
+        jobs[i].offset = kCount * i / kThreadCount;
+        jobs[i].strings = strings;
+        jobs[i].symbols = symbols[i];
+        jobs[i].status = Status::eFailure;
+
+        GREATEST_ASSERT(thrd_create(threads + i, &internOnThread, jobs + i) == thrd_success);
+    }
+    for (auto i = INT64_C(0); i != kThreadCount; i++) {
+        GREATEST_ASSERT(thrd_join(threads[i], nullptr) == thrd_success);
+        GREATEST_ASSERT(jobs[i].status == Status::eSuccess);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(kCount, interner.getCount(), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        for (auto j = INT64_C(1); j != kThreadCount; j++) {
+            GREATEST_ASSERT_EQ_FMT(symbols[0][i], symbols[j][i], "%" PRIu32);
+        }
+
+        auto resolved = interner.resolve(symbols[0][i]);
+
+        GREATEST_ASSERT(Bytes::testBlockExactness(resolved.getArray(), resolved.getCount(), strings[i].getArray(), strings[i].getCount()));
+    }
+
+    interner.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::StringInternerTest::createString(char *characters, int64_t index) -> ArrayListView<char> {
+    ArrayListView<char> string;
+    string.initialize(characters, snprintf(characters, 16, "symbol_%" PRId64, index));
+    return string;
+}
+
+auto tomurcuk::StringInternerTest::internOnThread(void *job) -> int {
+    auto state = (Job *)job;
+    state->status = Status::eSuccess;
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto index = (state->offset + i) % kCount;
+        auto symbolResult = state->interner->intern(state->memoryAllocator, state->strings[index]);
+        if (symbolResult.isFailure()) {
+            state->status = Status::eFailure;
+            return 0;
+        }
+        state->symbols[index] = *symbolResult.value();
+    }
+    return 0;
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringInterner.hpp>
+
+namespace tomurcuk {
+    class StringInternerTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The work of a thread that interns every test string.
+         */
+        struct Job {
+            /**
+             * Pointer to the shared interner.
+             */
+            StringInterner *interner;
+
+            /**
+             * The shared allocator of the tables.
+             */
+            MemoryAllocator memoryAllocator;
+
+            /**
+             * The index of the first interned string, after which the others
+             * follow and wrap around.
+             */
+            int64_t offset;
+
+            /**
+             * Pointer to the strings.
+             */
+            ArrayListView<char> *strings;
+
+            /**
+             * Pointer to the symbols of the strings in their original order.
+             */
+            uint32_t *symbols;
+
+            /**
+             * Whether all the strings could be interned.
+             */
+            Status status;
+        };
+
+        /**
+         * The amount of distinct test strings.
+         */
+        static constexpr auto kCount = INT64_C(10'000);
+
+        static auto testInterning() -> greatest_test_res;
+        static auto testInterningInBatches() -> greatest_test_res;
+        static auto testInterningOnThreads() -> greatest_test_res;
+
+        static auto createString(char *characters, int64_t index) -> ArrayListView<char>;
+        static auto internOnThread(void *job) -> int;
+    };
+}
@@ -0,0 +1,126 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/String.hpp>
+#include <tomurcuk/StringTest.hpp>
+#include <tomurcuk/StringView.hpp>
+
+auto tomurcuk::StringTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testAppending);
+        GREATEST_RUN_TEST(testSlicing);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::StringTest::testAppending() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    String string;
+    string.initialize();
+
+    GREATEST_ASSERT(string.isEmpty());
+    GREATEST_ASSERT(string.getView().isAscii());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), string.getView().countCodePoints(), "%" PRId64);
+
+    // Code points are encoded, and valid bytes are copied.
+    char32_t codePoints[] = {U'G', U'ü', U'€', U'\U0001F600'};
+    for (auto codePoint : codePoints) {
+        GREATEST_ASSERT(string.appendCodePoint(memoryAllocator, codePoint) == Status::eSuccess);
+    }
+    char8_t valid[] = u8"-çığ";
+    ArrayListView<char8_t> validView;
+    validView.initialize(valid, sizeof(valid) - 1);
+
+    GREATEST_ASSERT(string.appendBytes(memoryAllocator, validView) == Status::eSuccess);
+
+    char8_t expected[] = u8"Gü€\U0001F600-çığ";
+
+    GREATEST_ASSERT_EQ_FMT((int64_t)sizeof(expected) - 1, string.getSize(), "%" PRId64);
+    GREATEST_ASSERT(Bytes::testBlockExactness(string.getView().getBytes().getArray(), string.getSize(), expected, (int64_t)sizeof(expected) - 1));
+    GREATEST_ASSERT_EQ_FMT(INT64_C(8), string.getView().countCodePoints(), "%" PRId64);
+    GREATEST_ASSERT(!string.getView().isAscii());
+
+    // Invalid bytes are rejected as a whole.
+    char8_t invalid[] = {u8'a', 0xE2, 0x82};
+    ArrayListView<char8_t> invalidView;
+    invalidView.initialize(invalid, sizeof(invalid));
+
+    GREATEST_ASSERT(string.appendBytes(memoryAllocator, invalidView) == Status::eFailure);
+    GREATEST_ASSERT_EQ_FMT((int64_t)sizeof(expected) - 1, string.getSize(), "%" PRId64);
+
+    // Another string is appended without validation.
+    String copy;
+    copy.initialize();
+
+    GREATEST_ASSERT(copy.append(memoryAllocator, string.getView()) == Status::eSuccess);
+    GREATEST_ASSERT(copy.append(memoryAllocator, string.getView()) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(2 * string.getSize(), copy.getSize(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(16), copy.getView().countCodePoints(), "%" PRId64);
+
+    copy.removeAll();
+
+    GREATEST_ASSERT(copy.isEmpty());
+
+    copy.destroy(memoryAllocator);
+    string.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::StringTest::testSlicing() -> greatest_test_res {
+    char8_t bytes[] = u8"aé€\U0001F600z";
+    ArrayListView<char8_t> bytesView;
+    bytesView.initialize(bytes, sizeof(bytes) - 1);
+    StringView string;
+
+    GREATEST_ASSERT(string.initialize(bytesView) == Status::eSuccess);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(11), string.getSize(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(5), string.countCodePoints(), "%" PRId64);
+
+    // The slices begin and end at code points.
+    auto middle = string.getSlice(1, 10);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(9), middle.getSize(), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(3), middle.countCodePoints(), "%" PRId64);
+    GREATEST_ASSERT(middle.getBytes().getArray() == bytes + 1);
+
+    auto last = string.getSlice(10, 11);
+
+    GREATEST_ASSERT(last.isAscii());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(1), last.countCodePoints(), "%" PRId64);
+    GREATEST_ASSERT(string.getSlice(11, 11).isEmpty());
+
+    // Bytes that are cut in the middle of a code point are rejected.
+    ArrayListView<char8_t> cutView;
+    cutView.initialize(bytes, 5);
+
+    GREATEST_ASSERT(string.initialize(cutView) == Status::eFailure);
+
+    string.initializeEmpty();
+
+    GREATEST_ASSERT(string.isEmpty());
+    GREATEST_ASSERT_EQ_FMT(INT64_C(0), string.countCodePoints(), "%" PRId64);
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class StringTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testAppending() -> greatest_test_res;
+        static auto testSlicing() -> greatest_test_res;
+    };
+}
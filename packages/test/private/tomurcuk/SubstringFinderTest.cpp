@@ -0,0 +1,147 @@
+#include <greatest.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/SubstringFinder.hpp>
+#include <tomurcuk/SubstringFinderTest.hpp>
+
+auto tomurcuk::SubstringFinderTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testFinding);
+        GREATEST_RUN_TEST(testFindingPeriodicNeedles);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SubstringFinderTest::testFinding() -> greatest_test_res {
+    static constexpr auto kAllocatorCapacity = INT64_C(100'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kAllocatorCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // A small alphabet makes the needles occur often, and their first and
+    // last bytes match at many more windows.
+    static char8_t haystack[kCapacity];
+    for (auto i = INT64_C(0); i != kCapacity; i++) {
+        haystack[i] = (char8_t)(u8'a' + (uint64_t)(i * i + i / 7) % 11 % 3);
+    }
+
+    // The needles are taken from the haystack, and some of them get their
+    // last byte changed, which might not occur anymore.
+    static char8_t needle[kCapacity];
+    for (auto needleSize = INT64_C(0); needleSize <= 100; needleSize++) {
+        for (auto offset = INT64_C(0); offset < kCapacity - needleSize; offset += 397) {
+            for (auto i = INT64_C(0); i != needleSize; i++) {
+                needle[i] = haystack[offset + i];
+            }
+
+            GREATEST_ASSERT(checkFinding(memoryAllocator, haystack, kCapacity, needle, needleSize));
+            GREATEST_ASSERT(checkFinding(memoryAllocator, haystack, kCapacity - 1 - offset % 61, needle, needleSize));
+
+            if (needleSize != 0) {
+                needle[needleSize - 1] = (char8_t)(u8'a' + (uint64_t)offset % 5);
+
+                GREATEST_ASSERT(checkFinding(memoryAllocator, haystack, kCapacity, needle, needleSize));
+            }
+        }
+    }
+
+    // Every window of a haystack that is not much longer than the needle is
+    // handled without the vectors.
+    for (auto size = INT64_C(0); size != 70; size++) {
+        GREATEST_ASSERT(checkFinding(memoryAllocator, size == 0 ? nullptr : haystack, size, haystack + 3, 2));
+        GREATEST_ASSERT(checkFinding(memoryAllocator, size == 0 ? nullptr : haystack, size, haystack + 3, 40));
+    }
+
+    linearMemoryAllocator.destroy();
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SubstringFinderTest::testFindingPeriodicNeedles() -> greatest_test_res {
+    static constexpr auto kAllocatorCapacity = INT64_C(100'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kAllocatorCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Runs of a repeated pattern are broken by single bytes, so that the
+    // periodic needles keep matching and then fail at their ends.
+    static char8_t haystack[kCapacity];
+    static char8_t needle[kCapacity];
+    for (auto period = INT64_C(1); period <= 5; period++) {
+        for (auto i = INT64_C(0); i != kCapacity; i++) {
+            haystack[i] = i % 211 == 210 ? u8'x' : (char8_t)(u8'a' + i % period);
+        }
+        for (auto needleSize = INT64_C(1); needleSize <= 150; needleSize += needleSize < 40 ? 1 : 7) {
+            for (auto i = INT64_C(0); i != needleSize; i++) {
+                needle[i] = (char8_t)(u8'a' + i % period);
+            }
+
+            GREATEST_ASSERT(checkFinding(memoryAllocator, haystack, kCapacity, needle, needleSize));
+
+            needle[needleSize - 1] = u8'x';
+
+            GREATEST_ASSERT(checkFinding(memoryAllocator, haystack, kCapacity, needle, needleSize));
+
+            needle[needleSize / 2] = u8'x';
+
+            GREATEST_ASSERT(checkFinding(memoryAllocator, haystack, kCapacity, needle, needleSize));
+        }
+    }
+
+    linearMemoryAllocator.destroy();
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SubstringFinderTest::checkFinding(MemoryAllocator memoryAllocator, char8_t *haystack, int64_t size, char8_t *needle, int64_t needleSize) -> bool {
+    static int64_t expectedIndices[kCapacity + 1];
+    auto expectedCount = INT64_C(0);
+    for (auto i = INT64_C(0); i <= size - needleSize; i++) {
+        auto j = INT64_C(0);
+        while (j != needleSize && haystack[i + j] == needle[j]) {
+            j++;
+        }
+        if (j == needleSize) {
+            expectedIndices[expectedCount] = i;
+            expectedCount++;
+        }
+    }
+
+    ArrayListView<char8_t> haystackView;
+    haystackView.initialize(haystack, size);
+    ArrayListView<char8_t> needleView;
+    needleView.initialize(needleSize == 0 ? nullptr : needle, needleSize);
+    SubstringFinder finder;
+    finder.initialize(needleView);
+    if (finder.find(haystackView) != (expectedCount == 0 ? -1 : expectedIndices[0])) {
+        return false;
+    }
+
+    // The indices are added after an element that must be kept.
+    ArrayList<int64_t> indices;
+    indices.initialize();
+    auto isFound = indices.add(memoryAllocator, -1) && finder.findAll(memoryAllocator, haystackView, &indices) == Status::eSuccess;
+    isFound = isFound && indices.getCount() == expectedCount + 1 && *indices.getFirst() == -1;
+    isFound = isFound && (expectedCount == 0 || Bytes::testArrayExactness(indices.getArray() + 1, expectedCount, expectedIndices, expectedCount));
+    indices.destroy(memoryAllocator);
+    return isFound;
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
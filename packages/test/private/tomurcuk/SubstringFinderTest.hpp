@@ -0,0 +1,26 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class SubstringFinderTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The most bytes of the test haystacks.
+         */
+        static constexpr auto kCapacity = INT64_C(3'000);
+
+        static auto testFinding() -> greatest_test_res;
+        static auto testFindingPeriodicNeedles() -> greatest_test_res;
+
+        /**
+         * Tests whether a finder agrees with a naive search.
+         */
+        static auto checkFinding(MemoryAllocator memoryAllocator, char8_t *haystack, int64_t size, char8_t *needle, int64_t needleSize) -> bool;
+    };
+}
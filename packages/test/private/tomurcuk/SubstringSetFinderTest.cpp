@@ -0,0 +1,177 @@
+#include <greatest.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/SubstringSetFinder.hpp>
+#include <tomurcuk/SubstringSetFinderTest.hpp>
+
+auto tomurcuk::SubstringSetFinderTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testFindingFewNeedles);
+        GREATEST_RUN_TEST(testFindingManyNeedles);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::SubstringSetFinderTest::testFindingFewNeedles() -> greatest_test_res {
+    static constexpr auto kAllocatorCapacity = INT64_C(100'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kAllocatorCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    static char8_t haystack[kCapacity];
+    fillHaystack(haystack, kCapacity);
+
+    // The needles are taken from the haystack with various sizes, including
+    // ones that are shorter than the mask, and some of them get their last
+    // byte changed.
+    ArrayListView<char8_t> needles[kMaxNeedleCount];
+    static char8_t changedBytes[kMaxNeedleCount][16];
+    for (auto needleCount = INT64_C(1); needleCount <= SubstringSetFinder::kMaxTeddyNeedleCount; needleCount += needleCount < 10 ? 1 : 9) {
+        for (auto minSize = INT64_C(1); minSize <= 4; minSize++) {
+            for (auto i = INT64_C(0); i != needleCount; i++) {
+                auto offset = (i * 977 + minSize * 131) % (kCapacity - 16);
+                auto size = minSize + (i * 7 + minSize) % 9;
+                if (i % 3 == 2) {
+                    Bytes::copyArray(changedBytes[i], haystack + offset, size);
+                    changedBytes[i][size - 1] = (char8_t)(changedBytes[i][size - 1] + 1);
+                    needles[i].initialize(changedBytes[i], size);
+                } else {
+                    needles[i].initialize(haystack + offset, size);
+                }
+            }
+            ArrayListView<ArrayListView<char8_t>> needlesView;
+            needlesView.initialize(needles, needleCount);
+            ArrayListView<char8_t> haystackView;
+            haystackView.initialize(haystack, kCapacity - minSize);
+
+            GREATEST_ASSERT(checkFinding(memoryAllocator, haystackView, needlesView));
+        }
+    }
+
+    // Haystacks that are shorter than a vector are searched too.
+    needles[0].initialize(haystack + 10, 3);
+    needles[1].initialize(haystack + 20, 1);
+    ArrayListView<ArrayListView<char8_t>> needlesView;
+    needlesView.initialize(needles, 2);
+    for (auto size = INT64_C(0); size != 40; size++) {
+        ArrayListView<char8_t> haystackView;
+        haystackView.initialize(size == 0 ? nullptr : haystack + 10, size);
+
+        GREATEST_ASSERT(checkFinding(memoryAllocator, haystackView, needlesView));
+    }
+
+    linearMemoryAllocator.destroy();
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SubstringSetFinderTest::testFindingManyNeedles() -> greatest_test_res {
+    static constexpr auto kAllocatorCapacity = INT64_C(100'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kAllocatorCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    static char8_t haystack[kCapacity];
+    fillHaystack(haystack, kCapacity);
+
+    // Needles that are suffixes and prefixes of each other make the
+    // occurrences end in a different order than they begin.
+    ArrayListView<char8_t> needles[kMaxNeedleCount];
+    for (auto needleCount = SubstringSetFinder::kMaxTeddyNeedleCount + 1; needleCount <= kMaxNeedleCount; needleCount += 63) {
+        for (auto i = INT64_C(0); i != needleCount; i++) {
+            auto offset = (i * 389) % (kCapacity - 200);
+            auto size = 1 + (i * i) % (i % 4 == 0 ? 200 : 12);
+            needles[i].initialize(haystack + offset, size);
+        }
+        ArrayListView<ArrayListView<char8_t>> needlesView;
+        needlesView.initialize(needles, needleCount);
+        ArrayListView<char8_t> haystackView;
+        haystackView.initialize(haystack, kCapacity);
+
+        GREATEST_ASSERT(checkFinding(memoryAllocator, haystackView, needlesView));
+    }
+
+    // Every byte occurs in some needle.
+    static char8_t bytes[kMaxNeedleCount];
+    for (auto i = INT64_C(0); i != kMaxNeedleCount; i++) {
+        bytes[i] = (char8_t)(255 - i);
+        needles[i].initialize(bytes + i, i % 2 == 0 ? 1 : kMaxNeedleCount - i);
+    }
+    ArrayListView<ArrayListView<char8_t>> needlesView;
+    needlesView.initialize(needles, kMaxNeedleCount);
+    ArrayListView<char8_t> haystackView;
+    haystackView.initialize(haystack, kCapacity);
+
+    GREATEST_ASSERT(checkFinding(memoryAllocator, haystackView, needlesView));
+
+    linearMemoryAllocator.destroy();
+    GREATEST_PASS();
+}
+
+auto tomurcuk::SubstringSetFinderTest::fillHaystack(char8_t *haystack, int64_t size) -> void {
+    // A few bytes with both halves and a byte that no needle might have.
+    static constexpr char8_t kBytes[] = {u8'a', u8'b', u8'c', u8'a', 0xC3, 0xA9, 0x00, 0xFF, u8'a', u8'b'};
+
+    for (auto i = INT64_C(0); i != size; i++) {
+        haystack[i] = kBytes[(uint64_t)(i * i + i / 5) % 13 % sizeof(kBytes)];
+    }
+    for (auto i = INT64_C(0); i < size; i += 101) {
+        haystack[i] = u8'z';
+    }
+}
+
+auto tomurcuk::SubstringSetFinderTest::checkFinding(MemoryAllocator memoryAllocator, ArrayListView<char8_t> haystack, ArrayListView<ArrayListView<char8_t>> needles) -> bool {
+    static int64_t expectedIndices[kCapacity];
+    auto expectedCount = INT64_C(0);
+    for (auto i = INT64_C(0); i != haystack.getCount(); i++) {
+        for (auto k = INT64_C(0); k != needles.getCount(); k++) {
+            auto needle = needles.get(k);
+            auto j = INT64_C(0);
+            while (j != needle->getCount() && i + j != haystack.getCount() && *haystack.get(i + j) == *needle->get(j)) {
+                j++;
+            }
+            if (j == needle->getCount()) {
+                expectedIndices[expectedCount] = i;
+                expectedCount++;
+                break;
+            }
+        }
+    }
+
+    auto finderResult = SubstringSetFinder::create(memoryAllocator, needles);
+    if (finderResult.isFailure()) {
+        return false;
+    }
+    auto finder = *finderResult.value();
+    auto isFound = finder.find(haystack) == (expectedCount == 0 ? -1 : expectedIndices[0]);
+
+    // The indices are added after an element that must be kept.
+    ArrayList<int64_t> indices;
+    indices.initialize();
+    isFound = isFound && indices.add(memoryAllocator, -1) && finder.findAll(memoryAllocator, haystack, &indices) == Status::eSuccess;
+    isFound = isFound && indices.getCount() == expectedCount + 1 && *indices.getFirst() == -1;
+    isFound = isFound && (expectedCount == 0 || Bytes::testArrayExactness(indices.getArray() + 1, expectedCount, expectedIndices, expectedCount));
+    indices.destroy(memoryAllocator);
+    finder.destroy(memoryAllocator);
+    return isFound;
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
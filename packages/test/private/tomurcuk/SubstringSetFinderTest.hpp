@@ -0,0 +1,34 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+
+namespace tomurcuk {
+    class SubstringSetFinderTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The amount of bytes of the test haystack.
+         */
+        static constexpr auto kCapacity = INT64_C(5'000);
+
+        /**
+         * The most needles of a test set.
+         */
+        static constexpr auto kMaxNeedleCount = INT64_C(256);
+
+        static auto testFindingFewNeedles() -> greatest_test_res;
+        static auto testFindingManyNeedles() -> greatest_test_res;
+
+        static auto fillHaystack(char8_t *haystack, int64_t size) -> void;
+
+        /**
+         * Tests whether a finder agrees with a naive search.
+         */
+        static auto checkFinding(MemoryAllocator memoryAllocator, ArrayListView<char8_t> haystack, ArrayListView<ArrayListView<char8_t>> needles) -> bool;
+    };
+}
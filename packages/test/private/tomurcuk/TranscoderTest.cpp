@@ -0,0 +1,250 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringView.hpp>
+#include <tomurcuk/Transcoder.hpp>
+#include <tomurcuk/TranscoderTest.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+
+auto tomurcuk::TranscoderTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testTranscoding);
+        GREATEST_RUN_TEST(testRejectingInvalidInput);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::TranscoderTest::testTranscoding() -> greatest_test_res {
+    static constexpr auto kAllocatorCapacity = INT64_C(100'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kAllocatorCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // The expected encodings are written one code point at a time after an
+    // element that the conversions must keep.
+    static char32_t codePoints[kCapacity + 1];
+    static char16_t units[2 * kCapacity + 1];
+    static char8_t bytes[Utf8Codec::kMaxSize * kCapacity + 1];
+    codePoints[0] = U'#';
+    units[0] = u'#';
+    bytes[0] = u8'#';
+    fillCodePoints(codePoints + 1, kCapacity);
+
+    // Every prefix is converted in every direction, including the ones that
+    // end at every offset of a block.
+    for (auto count = INT64_C(0); count <= kCapacity; count += count < 300 ? 1 : 1'009) {
+        auto unitCount = INT64_C(0);
+        auto size = INT64_C(0);
+        for (auto i = INT64_C(1); i <= count; i++) {
+            auto codePoint = codePoints[i];
+            if (codePoint >= 0x1'0000) {
+                units[unitCount + 1] = (char16_t)(0xD800U | ((codePoint - 0x1'0000) >> 10U));
+                units[unitCount + 2] = (char16_t)(0xDC00U | (codePoint & 0x3FFU));
+                unitCount += 2;
+            } else {
+                units[unitCount + 1] = (char16_t)codePoint;
+                unitCount++;
+            }
+            size += Utf8Codec::encode(bytes + 1 + size, codePoint);
+        }
+        ArrayListView<char8_t> bytesView;
+        bytesView.initialize(size == 0 ? nullptr : bytes + 1, size);
+        ArrayListView<char16_t> unitsView;
+        unitsView.initialize(unitCount == 0 ? nullptr : units + 1, unitCount);
+        ArrayListView<char32_t> codePointsView;
+        codePointsView.initialize(count == 0 ? nullptr : codePoints + 1, count);
+
+        ArrayList<char16_t> convertedUnits;
+        convertedUnits.initialize();
+        ArrayList<char32_t> convertedCodePoints;
+        convertedCodePoints.initialize();
+        ArrayList<char8_t> convertedBytes;
+        convertedBytes.initialize();
+
+        GREATEST_ASSERT(convertedUnits.add(memoryAllocator, u'#'));
+        GREATEST_ASSERT(convertedCodePoints.add(memoryAllocator, U'#'));
+        GREATEST_ASSERT(convertedBytes.add(memoryAllocator, u8'#'));
+
+        auto invalidIndex = INT64_C(0);
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, bytesView, &convertedUnits, &invalidIndex) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(INT64_C(-1), invalidIndex, "%" PRId64);
+        GREATEST_ASSERT(Bytes::testArrayExactness(convertedUnits.getArray(), convertedUnits.getCount(), units, unitCount + 1));
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, bytesView, &convertedCodePoints, &invalidIndex) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(INT64_C(-1), invalidIndex, "%" PRId64);
+        GREATEST_ASSERT(Bytes::testArrayExactness(convertedCodePoints.getArray(), convertedCodePoints.getCount(), codePoints, count + 1));
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, unitsView, &convertedBytes, &invalidIndex) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(INT64_C(-1), invalidIndex, "%" PRId64);
+        GREATEST_ASSERT(Bytes::testArrayExactness(convertedBytes.getArray(), convertedBytes.getCount(), bytes, size + 1));
+
+        convertedBytes.removePortion(1, convertedBytes.getCount());
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, codePointsView, &convertedBytes, &invalidIndex) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(INT64_C(-1), invalidIndex, "%" PRId64);
+        GREATEST_ASSERT(Bytes::testArrayExactness(convertedBytes.getArray(), convertedBytes.getCount(), bytes, size + 1));
+
+        // A string skips the validation.
+        StringView string;
+
+        GREATEST_ASSERT(string.initialize(bytesView) == Status::eSuccess);
+
+        convertedUnits.removeAll();
+        convertedCodePoints.removeAll();
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, string, &convertedUnits) == Status::eSuccess);
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, string, &convertedCodePoints) == Status::eSuccess);
+        GREATEST_ASSERT_EQ_FMT(unitCount, convertedUnits.getCount(), "%" PRId64);
+        GREATEST_ASSERT_EQ_FMT(count, convertedCodePoints.getCount(), "%" PRId64);
+
+        convertedUnits.destroy(memoryAllocator);
+        convertedCodePoints.destroy(memoryAllocator);
+        convertedBytes.destroy(memoryAllocator);
+    }
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::TranscoderTest::testRejectingInvalidInput() -> greatest_test_res {
+    static constexpr auto kSize = INT64_C(100);
+    static constexpr auto kAllocatorCapacity = INT64_C(1'000'000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kAllocatorCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    ArrayList<char16_t> convertedUnits;
+    convertedUnits.initialize();
+    ArrayList<char32_t> convertedCodePoints;
+    convertedCodePoints.initialize();
+    ArrayList<char8_t> convertedBytes;
+    convertedBytes.initialize();
+
+    // An invalid element is written after valid text at every offset, so
+    // that it is found wherever it crosses a block, and nothing is appended.
+    static char32_t codePoints[kSize];
+    fillCodePoints(codePoints, kSize);
+    for (auto offset = INT64_C(0); offset != kSize - 2; offset++) {
+        char8_t bytes[Utf8Codec::kMaxSize * kSize];
+        auto size = INT64_C(0);
+        for (auto i = INT64_C(0); i != offset; i++) {
+            size += Utf8Codec::encode(bytes + size, codePoints[i]);
+        }
+        auto invalidOffset = size;
+        bytes[size] = 0xE2;
+        bytes[size + 1] = 0x82;
+        bytes[size + 2] = u8'x';
+        size += 3;
+        for (; size < kSize; size++) {
+            bytes[size] = u8'y';
+        }
+        ArrayListView<char8_t> bytesView;
+        bytesView.initialize(bytes, size);
+
+        auto invalidIndex = INT64_C(-1);
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, bytesView, &convertedUnits, &invalidIndex) == Status::eFailure);
+        GREATEST_ASSERT_EQ_FMT(invalidOffset, invalidIndex, "%" PRId64);
+
+        invalidIndex = -1;
+
+        GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, bytesView, &convertedCodePoints, &invalidIndex) == Status::eFailure);
+        GREATEST_ASSERT_EQ_FMT(invalidOffset, invalidIndex, "%" PRId64);
+
+        // A surrogate is invalid alone, after another high surrogate, before
+        // the end and as a code point.
+        char16_t invalidUnits[][2] = {
+            {0xDC00, u'a'},
+            {0xD800, u'a'},
+            {0xD800, 0xD800},
+            {0xDBFF, 0xE000},
+        };
+        for (auto invalidUnit : invalidUnits) {
+            char16_t units[kSize];
+            for (auto i = INT64_C(0); i != kSize; i++) {
+                units[i] = (char16_t)(codePoints[i] < 0xD800 ? codePoints[i] : u'z');
+            }
+            units[offset] = invalidUnit[0];
+            units[offset + 1] = invalidUnit[1];
+            ArrayListView<char16_t> unitsView;
+            unitsView.initialize(units, kSize);
+
+            GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, unitsView, &convertedBytes, &invalidIndex) == Status::eFailure);
+            GREATEST_ASSERT_EQ_FMT(offset, invalidIndex, "%" PRId64);
+
+            unitsView.initialize(units, offset + 1);
+
+            GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, unitsView, &convertedBytes, &invalidIndex) == Status::eFailure);
+            GREATEST_ASSERT_EQ_FMT(offset, invalidIndex, "%" PRId64);
+        }
+
+        char32_t invalidCodePoints[] = {0xD800, 0xDFFF, Utf8Codec::kMaxCodePoint + 1, 0xFFFF'FFFF};
+        for (auto invalidCodePoint : invalidCodePoints) {
+            char32_t codePointsCopy[kSize];
+            Bytes::copyArray(codePointsCopy, codePoints, kSize);
+            codePointsCopy[offset] = invalidCodePoint;
+            ArrayListView<char32_t> codePointsView;
+            codePointsView.initialize(codePointsCopy, kSize);
+
+            GREATEST_ASSERT(Transcoder::transcode(memoryAllocator, codePointsView, &convertedBytes, &invalidIndex) == Status::eFailure);
+            GREATEST_ASSERT_EQ_FMT(offset, invalidIndex, "%" PRId64);
+        }
+    }
+
+    GREATEST_ASSERT(convertedUnits.isEmpty());
+    GREATEST_ASSERT(convertedCodePoints.isEmpty());
+    GREATEST_ASSERT(convertedBytes.isEmpty());
+
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::TranscoderTest::fillCodePoints(char32_t *codePoints, int64_t count) -> void {
+    // Runs of code points of a single size, which take the vectorized paths,
+    // alternate with runs of code points of mixed sizes.
+    for (auto i = INT64_C(0); i != count; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        auto run = (uint64_t)(i / 40) % 6;
+        auto kind = run < 4 ? run : (hash >> 32U) % (run == 4 ? 3 : 4);
+        char32_t codePoint;
+        switch (kind) {
+            case 0:
+                codePoint = (char32_t)(u8'a' + (hash >> 40U) % 26);
+                break;
+            case 1:
+                codePoint = (char32_t)(0x80 + (hash >> 40U) % (0x800 - 0x80));
+                break;
+            case 2:
+                codePoint = (char32_t)(0x800 + (hash >> 40U) % (0x1'0000 - 0x800));
+                break;
+            default:
+                codePoint = (char32_t)(0x1'0000 + (hash >> 40U) % (Utf8Codec::kMaxCodePoint + 1 - 0x1'0000));
+                break;
+        }
+        codePoints[i] = Utf8Codec::isEncodable(codePoint) ? codePoint : U'\uFFFD';
+    }
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+
+namespace tomurcuk {
+    class TranscoderTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The most code points of the test strings.
+         */
+        static constexpr auto kCapacity = INT64_C(20'000);
+
+        static auto testTranscoding() -> greatest_test_res;
+        static auto testRejectingInvalidInput() -> greatest_test_res;
+
+        static auto fillCodePoints(char32_t *codePoints, int64_t count) -> void;
+    };
+}
@@ -0,0 +1,222 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+#include <tomurcuk/Utf8CodecTest.hpp>
+
+auto tomurcuk::Utf8CodecTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testValidating);
+        GREATEST_RUN_TEST(testRejectingInvalidSequences);
+        GREATEST_RUN_TEST(testCounting);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::Utf8CodecTest::testValidating() -> greatest_test_res {
+    static char8_t bytes[kCapacity];
+    auto codePointCount = fillMixedText(bytes, kCapacity);
+
+    // Every prefix that ends at a code point is valid, including the ones
+    // that end at every offset of a block.
+    for (auto size = INT64_C(0); size <= kCapacity; size += size < 200 ? 1 : 997) {
+        auto validSize = size;
+        while (validSize != kCapacity && (bytes[validSize] & 0xC0U) == 0x80) {
+            validSize--;
+        }
+        ArrayListView<char8_t> view;
+        view.initialize(validSize == 0 ? nullptr : bytes, validSize);
+
+        GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Utf8Codec::findInvalidIndex(view), "%" PRId64);
+    }
+
+    ArrayListView<char8_t> view;
+    view.initialize(bytes, kCapacity);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Utf8Codec::findInvalidIndex(view), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(codePointCount, Utf8Codec::countCodePoints(view), "%" PRId64);
+
+    // The boundaries of the code points.
+    char8_t boundaries[] = u8"\u007F\u0080\u07FF\u0800\uD7FF\uE000\uFFFF\U00010000\U0010FFFF";
+    view.initialize(boundaries, sizeof(boundaries) - 1);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), Utf8Codec::findInvalidIndex(view), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(9), Utf8Codec::countCodePoints(view), "%" PRId64);
+
+    // Encoding every code point gives the same bytes as the compiler.
+    char8_t encoded[sizeof(boundaries)];
+    char32_t codePoints[] = {U'\u007F', U'\u0080', U'\u07FF', U'\u0800', U'\uD7FF', U'\uE000', U'\uFFFF', U'\U00010000', U'\U0010FFFF'};
+    auto size = INT64_C(0);
+    for (auto codePoint : codePoints) {
+        GREATEST_ASSERT(Utf8Codec::isEncodable(codePoint));
+
+        auto codePointSize = Utf8Codec::encode(encoded + size, codePoint);
+
+        GREATEST_ASSERT_EQ_FMT(Utf8Codec::getSize(codePoint), codePointSize, "%" PRId64);
+
+        size += codePointSize;
+    }
+
+    GREATEST_ASSERT_EQ_FMT((int64_t)sizeof(boundaries) - 1, size, "%" PRId64);
+    GREATEST_ASSERT(Bytes::testBlockExactness(encoded, size, boundaries, size));
+    GREATEST_ASSERT(!Utf8Codec::isEncodable(U'\xD800'));
+    GREATEST_ASSERT(!Utf8Codec::isEncodable(U'\xDFFF'));
+    GREATEST_ASSERT(!Utf8Codec::isEncodable(Utf8Codec::kMaxCodePoint + 1));
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::Utf8CodecTest::testRejectingInvalidSequences() -> greatest_test_res {
+    static constexpr auto kSize = INT64_C(300);
+
+    // Every invalid sequence is written after mixed text at every offset,
+    // so that it is found wherever it crosses a block.
+    char8_t invalidSequences[][5] = {
+        {0x80},                   // A continuation without a leading byte.
+        {0xBF, 0x80},             // Two continuations without a leading byte.
+        {0xC0, 0x80},             // An overlong encoding of `U+0000`.
+        {0xC1, 0xBF},             // An overlong encoding of `U+007F`.
+        {0xE0, 0x9F, 0xBF},       // An overlong encoding of `U+07FF`.
+        {0xED, 0xA0, 0x80},       // The surrogate `U+D800`.
+        {0xED, 0xBF, 0xBF},       // The surrogate `U+DFFF`.
+        {0xF0, 0x8F, 0xBF, 0xBF}, // An overlong encoding of `U+FFFF`.
+        {0xF4, 0x90, 0x80, 0x80}, // `U+110000`.
+        {0xF5, 0x80, 0x80, 0x80}, // A leading byte that is never valid.
+        {0xFF},                   // A byte that is never valid.
+        {0xC2, 0x41},             // A sequence that is cut by an ASCII character.
+        {0xE2, 0x82, 0x41},       // A sequence that is cut by an ASCII character.
+        {0xF0, 0x9F, 0x98, 0x41}, // A sequence that is cut by an ASCII character.
+        {0xE2, 0x82, 0xE2},       // A sequence that is cut by a leading byte.
+        {0xC3, 0xA9, 0xA9},       // A sequence that is too long.
+    };
+    int64_t invalidSizes[] = {1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 1, 2, 3, 4, 3, 3};
+    int64_t invalidIndices[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2};
+    static_assert(sizeof(invalidSequences) / sizeof(invalidSequences[0]) == sizeof(invalidSizes) / sizeof(invalidSizes[0]));
+    static_assert(sizeof(invalidSizes) == sizeof(invalidIndices));
+
+    static char8_t bytes[kSize];
+    for (auto i = INT64_C(0); i != (int64_t)(sizeof(invalidSizes) / sizeof(invalidSizes[0])); i++) {
+        for (auto offset = INT64_C(0); offset + invalidSizes[i] <= kSize; offset++) {
+            fillMixedText(bytes, offset);
+            for (auto j = offset; j != kSize; j++) {
+                bytes[j] = u8'a';
+            }
+            Bytes::copyArray(bytes + offset, invalidSequences[i], invalidSizes[i]);
+            ArrayListView<char8_t> view;
+            view.initialize(bytes, kSize);
+
+            GREATEST_ASSERT_EQ_FMT(offset + invalidIndices[i], Utf8Codec::findInvalidIndex(view), "%" PRId64);
+        }
+    }
+
+    // A sequence that is cut by the end of the bytes is invalid at every size
+    // of the bytes.
+    char8_t codePoint[] = u8"\U0001F600";
+    for (auto size = INT64_C(1); size <= kSize; size++) {
+        for (auto cutSize = INT64_C(1); cutSize != 4; cutSize++) {
+            if (cutSize > size) {
+                continue;
+            }
+            for (auto j = INT64_C(0); j != size - cutSize; j++) {
+                bytes[j] = u8'a';
+            }
+            Bytes::copyArray(bytes + size - cutSize, codePoint, cutSize);
+            ArrayListView<char8_t> view;
+            view.initialize(bytes, size);
+
+            GREATEST_ASSERT_EQ_FMT(size - cutSize, Utf8Codec::findInvalidIndex(view), "%" PRId64);
+        }
+    }
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::Utf8CodecTest::testCounting() -> greatest_test_res {
+    static char8_t bytes[kCapacity];
+    for (auto i = INT64_C(0); i != kCapacity; i++) {
+        bytes[i] = (char8_t)(u8'a' + i % 26);
+    }
+
+    // ASCII characters are counted as they are, and a byte that is not ASCII
+    // is found at every offset.
+    for (auto size = INT64_C(0); size <= kCapacity; size += size < 300 ? 1 : 997) {
+        ArrayListView<char8_t> view;
+        view.initialize(size == 0 ? nullptr : bytes, size);
+
+        GREATEST_ASSERT(Utf8Codec::isAscii(view));
+        GREATEST_ASSERT_EQ_FMT(size, Utf8Codec::countCodePoints(view), "%" PRId64);
+    }
+    for (auto offset = INT64_C(0); offset < kCapacity; offset += offset < 300 ? 1 : 997) {
+        bytes[offset] = 0xC3;
+        ArrayListView<char8_t> view;
+        view.initialize(bytes, kCapacity);
+
+        GREATEST_ASSERT(!Utf8Codec::isAscii(view));
+
+        bytes[offset] = u8'a';
+    }
+
+    // Mixed text is counted at every size, and its counts add up.
+    auto codePointCount = fillMixedText(bytes, kCapacity);
+    auto sum = INT64_C(0);
+    for (auto offset = INT64_C(0); offset < kCapacity; offset += 1001) {
+        auto size = kCapacity - offset < 1001 ? kCapacity - offset : INT64_C(1001);
+        ArrayListView<char8_t> view;
+        view.initialize(bytes + offset, size);
+        sum += Utf8Codec::countCodePoints(view);
+    }
+
+    GREATEST_ASSERT_EQ_FMT(codePointCount, sum, "%" PRId64);
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::Utf8CodecTest::fillMixedText(char8_t *bytes, int64_t size) -> int64_t {
+    // Code points of every size alternate with runs of ASCII characters.
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    for (auto i = INT64_C(0);; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        auto codePoint = (char32_t)(u8'a' + (hash >> 32U) % 26);
+        if (i % 200 < 100) {
+            switch ((hash >> 32U) % 4) {
+                case 0:
+                    break;
+                case 1:
+                    codePoint = (char32_t)(0x80 + (hash >> 40U) % (0x800 - 0x80));
+                    break;
+                case 2:
+                    codePoint = (char32_t)(0x800 + (hash >> 40U) % (0x1'0000 - 0x800));
+                    break;
+                default:
+                    codePoint = (char32_t)(0x1'0000 + (hash >> 40U) % (Utf8Codec::kMaxCodePoint + 1 - 0x1'0000));
+                    break;
+            }
+        }
+        if (!Utf8Codec::isEncodable(codePoint)) {
+            continue;
+        }
+        if (size - offset < Utf8Codec::getSize(codePoint)) {
+            break;
+        }
+        offset += Utf8Codec::encode(bytes + offset, codePoint);
+        count++;
+    }
+
+    // The rest is padded with ASCII characters.
+    for (; offset != size; offset++) {
+        bytes[offset] = u8' ';
+        count++;
+    }
+    return count;
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
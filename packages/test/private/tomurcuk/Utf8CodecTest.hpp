@@ -0,0 +1,23 @@
+#pragma once
+
+#include <greatest.h>
+#include <stdint.h>
+
+namespace tomurcuk {
+    class Utf8CodecTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        /**
+         * The most bytes of the test strings.
+         */
+        static constexpr auto kCapacity = INT64_C(100'000);
+
+        static auto testValidating() -> greatest_test_res;
+        static auto testRejectingInvalidSequences() -> greatest_test_res;
+        static auto testCounting() -> greatest_test_res;
+
+        static auto fillMixedText(char8_t *bytes, int64_t size) -> int64_t;
+    };
+}
@@ -0,0 +1,136 @@
+#include <greatest.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/LinearMemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/ProcessorLevel.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/VarintCodec.hpp>
+#include <tomurcuk/VarintCodecTest.hpp>
+
+auto tomurcuk::VarintCodecTest::suite() -> void {
+    auto level = ProcessorFeatures::getLevel();
+    for (auto i = 0; i <= (int)ProcessorFeatures::getSupportedLevel(); i++) {
+        ProcessorFeatures::setLevel((ProcessorLevel)i);
+        GREATEST_RUN_TEST(testRoundTrips);
+        GREATEST_RUN_TEST(testRejectingMalformedBytes);
+    }
+    ProcessorFeatures::setLevel(level);
+}
+
+// NOLINTBEGIN(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
+
+auto tomurcuk::VarintCodecTest::testRoundTrips() -> greatest_test_res {
+    static constexpr auto kCapacity = INT64_C(1'000'000);
+    static constexpr auto kCount = INT64_C(5000);
+
+    auto linearMemoryAllocatorResult = LinearMemoryAllocator::create(kCapacity);
+
+    GREATEST_ASSERT(linearMemoryAllocatorResult.isSuccess());
+
+    auto linearMemoryAllocator = *linearMemoryAllocatorResult.value();
+    auto memoryAllocator = linearMemoryAllocator.memoryAllocator();
+
+    // Long runs of single-byte integers alternate with integers of every
+    // size, so that both paths of the vectorized decoder are taken.
+    static uint32_t values32[kCount];
+    static uint64_t values64[kCount];
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        auto hash = (uint64_t)(i + 1) * UINT64_C(0x9E37'79B9'7F4A'7C15);
+        auto shift = i % 1000 < 500 ? UINT64_C(57) : hash % 64;
+        values32[i] = (uint32_t)(hash >> (shift < 32 ? 32 : shift));
+        values64[i] = hash >> shift;
+    }
+    values32[kCount - 1] = UINT32_MAX;
+    values64[kCount - 1] = UINT64_MAX;
+
+    ArrayListView<uint32_t> view32;
+    view32.initialize(values32, kCount);
+    ArrayListView<uint64_t> view64;
+    view64.initialize(values64, kCount);
+    ArrayList<uint8_t> bytes;
+    bytes.initialize();
+
+    GREATEST_ASSERT(VarintCodec::encode(memoryAllocator, &bytes, view32) == Status::eSuccess);
+
+    auto size32 = bytes.getCount();
+
+    GREATEST_ASSERT(VarintCodec::encode(memoryAllocator, &bytes, view64) == Status::eSuccess);
+
+    // Every prefix is decoded, so that it ends at every offset of a block.
+    static uint32_t decoded32[kCount];
+    static uint64_t decoded64[kCount];
+    for (auto count = INT64_C(0); count <= kCount; count += count < 100 ? 1 : 499) {
+        ArrayListView<uint32_t> decodedView32;
+        decodedView32.initialize(count == 0 ? nullptr : decoded32, count);
+
+        GREATEST_ASSERT(VarintCodec::decode(bytes.getView(), decodedView32) >= 0);
+
+        for (auto i = INT64_C(0); i != count; i++) {
+            GREATEST_ASSERT_EQ_FMT(values32[i], decoded32[i], "%" PRIu32);
+        }
+    }
+
+    ArrayListView<uint32_t> decodedView32;
+    decodedView32.initialize(decoded32, kCount);
+
+    GREATEST_ASSERT_EQ_FMT(size32, VarintCodec::decode(bytes.getView(), decodedView32), "%" PRId64);
+
+    ArrayListView<uint8_t> bytesView64;
+    bytesView64.initialize(bytes.getArray() + size32, bytes.getCount() - size32);
+    ArrayListView<uint64_t> decodedView64;
+    decodedView64.initialize(decoded64, kCount);
+
+    GREATEST_ASSERT_EQ_FMT(bytes.getCount() - size32, VarintCodec::decode(bytesView64, decodedView64), "%" PRId64);
+
+    for (auto i = INT64_C(0); i != kCount; i++) {
+        GREATEST_ASSERT_EQ_FMT(values64[i], decoded64[i], "%" PRIu64);
+    }
+
+    bytes.destroy(memoryAllocator);
+    linearMemoryAllocator.destroy();
+
+    GREATEST_PASS();
+}
+
+auto tomurcuk::VarintCodecTest::testRejectingMalformedBytes() -> greatest_test_res {
+    // The bytes are padded, so that the vectorized decoder reads them too.
+    uint8_t truncated[64] = {0x80, 0x80};
+    uint8_t tooLong32[64] = {0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+    uint8_t tooLong64[64] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+    uint8_t largest32[64] = {0xFF, 0xFF, 0xFF, 0xFF, 0x0F};
+
+    uint32_t value32;
+    ArrayListView<uint32_t> valueView32;
+    valueView32.initialize(&value32, 1);
+    uint64_t value64;
+    ArrayListView<uint64_t> valueView64;
+    valueView64.initialize(&value64, 1);
+    ArrayListView<uint8_t> bytesView;
+
+    bytesView.initialize(truncated, 2);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), VarintCodec::decode(bytesView, valueView32), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), VarintCodec::decode(bytesView, valueView64), "%" PRId64);
+
+    bytesView.initialize(tooLong32, 64);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), VarintCodec::decode(bytesView, valueView32), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(INT64_C(5), VarintCodec::decode(bytesView, valueView64), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(UINT64_C(0x1'FFFF'FFFF), value64, "%" PRIu64);
+
+    bytesView.initialize(tooLong64, 64);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(-1), VarintCodec::decode(bytesView, valueView64), "%" PRId64);
+
+    bytesView.initialize(largest32, 64);
+
+    GREATEST_ASSERT_EQ_FMT(INT64_C(5), VarintCodec::decode(bytesView, valueView32), "%" PRId64);
+    GREATEST_ASSERT_EQ_FMT(UINT32_MAX, value32, "%" PRIu32);
+
+    GREATEST_PASS();
+}
+
+// NOLINTEND(cert-err33-c,hicpp-signed-bitwise,modernize-use-std-print) cSpell: disable-line
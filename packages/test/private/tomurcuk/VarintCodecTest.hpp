@@ -0,0 +1,14 @@
+#pragma once
+
+#include <greatest.h>
+
+namespace tomurcuk {
+    class VarintCodecTest {
+    public:
+        static auto suite() -> void;
+
+    private:
+        static auto testRoundTrips() -> greatest_test_res;
+        static auto testRejectingMalformedBytes() -> greatest_test_res;
+    };
+}
@@ -0,0 +1,57 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/String.hpp>
+#include <tomurcuk/StringView.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+
+auto tomurcuk::String::initialize() -> void {
+    mBytes.initialize();
+}
+
+auto tomurcuk::String::destroy(MemoryAllocator memoryAllocator) -> void {
+    mBytes.destroy(memoryAllocator);
+}
+
+auto tomurcuk::String::getView() -> StringView {
+    StringView view;
+    view.initializeValidated(mBytes.getView());
+    return view;
+}
+
+auto tomurcuk::String::getSize() -> int64_t {
+    return mBytes.getCount();
+}
+
+auto tomurcuk::String::isEmpty() -> bool {
+    return mBytes.isEmpty();
+}
+
+auto tomurcuk::String::append(MemoryAllocator memoryAllocator, StringView string) -> Status {
+    if (string.isEmpty()) {
+        return Status::eSuccess;
+    }
+    return mBytes.addAll(memoryAllocator, string.getBytes()) ? Status::eSuccess : Status::eFailure;
+}
+
+auto tomurcuk::String::appendBytes(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes) -> Status {
+    StringView string;
+    if (string.initialize(bytes) == Status::eFailure) {
+        return Status::eFailure;
+    }
+    return append(memoryAllocator, string);
+}
+
+auto tomurcuk::String::appendCodePoint(MemoryAllocator memoryAllocator, char32_t codePoint) -> Status {
+    if (!mBytes.reserve(memoryAllocator, Utf8Codec::getSize(codePoint))) {
+        return Status::eFailure;
+    }
+    mBytes.acknowledge(Utf8Codec::encode(mBytes.getEnd(), codePoint));
+    return Status::eSuccess;
+}
+
+auto tomurcuk::String::removeAll() -> void {
+    mBytes.removeAll();
+}
@@ -0,0 +1,62 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringView.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+
+auto tomurcuk::StringView::initialize(ArrayListView<char8_t> bytes) -> Status {
+    if (Utf8Codec::findInvalidIndex(bytes) != -1) {
+        return Status::eFailure;
+    }
+    mBytes = bytes;
+    return Status::eSuccess;
+}
+
+auto tomurcuk::StringView::initializeValidated(ArrayListView<char8_t> bytes) -> void {
+    mBytes = bytes;
+}
+
+auto tomurcuk::StringView::initializeEmpty() -> void {
+    mBytes.initializeEmpty();
+}
+
+auto tomurcuk::StringView::getBytes() -> ArrayListView<char8_t> {
+    return mBytes;
+}
+
+auto tomurcuk::StringView::getSize() -> int64_t {
+    return mBytes.getCount();
+}
+
+auto tomurcuk::StringView::isEmpty() -> bool {
+    return mBytes.isEmpty();
+}
+
+auto tomurcuk::StringView::isAscii() -> bool {
+    return Utf8Codec::isAscii(mBytes);
+}
+
+auto tomurcuk::StringView::countCodePoints() -> int64_t {
+    return Utf8Codec::countCodePoints(mBytes);
+}
+
+auto tomurcuk::StringView::getSlice(int64_t beginIndex, int64_t endIndex) -> StringView {
+    assert(beginIndex >= 0);
+    assert(beginIndex <= endIndex);
+    assert(endIndex <= mBytes.getCount());
+    assert(isBoundary(beginIndex));
+    assert(isBoundary(endIndex));
+
+    StringView slice;
+    if (beginIndex == endIndex) {
+        slice.initializeEmpty();
+    } else {
+        slice.mBytes.initialize(mBytes.getArray() + beginIndex, endIndex - beginIndex);
+    }
+    return slice;
+}
+
+auto tomurcuk::StringView::isBoundary(int64_t index) -> bool {
+    return index == mBytes.getCount() || (mBytes.getArray()[index] & 0xC0U) != 0x80;
+}
@@ -0,0 +1,274 @@
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/SubstringFinder.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::SubstringFinder::initialize(ArrayListView<char8_t> needle) -> void {
+    mNeedle = needle;
+
+    auto size = needle.getCount();
+    if (size <= kMaxShortNeedleSize) {
+        return;
+    }
+
+    // The later of the maximal suffixes in the two orderings begins a
+    // critical factorization.
+    int64_t period0;
+    int64_t period1;
+    auto suffixIndex0 = findMaximalSuffix(false, &period0);
+    auto suffixIndex1 = findMaximalSuffix(true, &period1);
+    mCriticalIndex = suffixIndex0 >= suffixIndex1 ? suffixIndex0 : suffixIndex1;
+    mPeriod = suffixIndex0 >= suffixIndex1 ? period0 : period1;
+
+    auto bytes = (uint8_t *)needle.getArray();
+    mIsPeriodic = mCriticalIndex == 0 || Bytes::testBlockExactness(bytes, mCriticalIndex, bytes + mPeriod, mCriticalIndex);
+    if (!mIsPeriodic) {
+        mPeriod = (mCriticalIndex > size - mCriticalIndex ? mCriticalIndex : size - mCriticalIndex) + 1;
+    }
+
+    // A window whose last pair does not occur in the needle can be skipped
+    // up to its last byte.
+    for (auto &shift : mShifts) {
+        shift = (uint8_t)(size - 1 < UINT8_MAX ? size - 1 : UINT8_MAX);
+    }
+    for (auto i = INT64_C(1); i != size; i++) {
+        auto distance = size - 1 - i;
+        mShifts[hashPair(bytes[i - 1], bytes[i])] = (uint8_t)(distance < UINT8_MAX ? distance : UINT8_MAX);
+    }
+}
+
+auto tomurcuk::SubstringFinder::getNeedle() -> ArrayListView<char8_t> {
+    return mNeedle;
+}
+
+auto tomurcuk::SubstringFinder::find(ArrayListView<char8_t> haystack) -> int64_t {
+    auto bytes = (uint8_t *)haystack.getArray();
+    auto size = haystack.getCount();
+    if (mNeedle.isEmpty()) {
+        return 0;
+    }
+    if (mNeedle.getCount() <= kMaxShortNeedleSize) {
+        return findShort(bytes, size, 0);
+    }
+
+    auto position = INT64_C(0);
+    auto memory = INT64_C(0);
+    return findLong(bytes, size, &position, &memory);
+}
+
+auto tomurcuk::SubstringFinder::findAll(MemoryAllocator memoryAllocator, ArrayListView<char8_t> haystack, ArrayList<int64_t> *indices) -> Status {
+    auto bytes = (uint8_t *)haystack.getArray();
+    auto size = haystack.getCount();
+    auto count = indices->getCount();
+
+    if (mNeedle.isEmpty()) {
+        if (!indices->reserve(memoryAllocator, size + 1)) {
+            return Status::eFailure;
+        }
+        auto end = indices->getEnd();
+        for (auto i = INT64_C(0); i <= size; i++) {
+            end[i] = i;
+        }
+        indices->acknowledge(size + 1);
+        return Status::eSuccess;
+    }
+
+    if (mNeedle.getCount() <= kMaxShortNeedleSize) {
+        for (auto index = findShort(bytes, size, 0); index != -1; index = findShort(bytes, size, index + 1)) {
+            if (!indices->add(memoryAllocator, index)) {
+                indices->removePortion(count, indices->getCount());
+                return Status::eFailure;
+            }
+        }
+        return Status::eSuccess;
+    }
+
+    auto position = INT64_C(0);
+    auto memory = INT64_C(0);
+    for (auto index = findLong(bytes, size, &position, &memory); index != -1; index = findLong(bytes, size, &position, &memory)) {
+        if (!indices->add(memoryAllocator, index)) {
+            indices->removePortion(count, indices->getCount());
+            return Status::eFailure;
+        }
+    }
+    return Status::eSuccess;
+}
+
+auto tomurcuk::SubstringFinder::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::SubstringFinder::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.findShort = &findShortPortably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.findShort = &findShortWithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::SubstringFinder::findMaximalSuffix(bool isReversed, int64_t *period) -> int64_t {
+    auto bytes = (uint8_t *)mNeedle.getArray();
+    auto size = mNeedle.getCount();
+
+    // The suffix begins after `beforeIndex`, and the candidate that begins
+    // after `candidateIndex` matched it for `offset` bytes so far.
+    auto beforeIndex = INT64_C(-1);
+    auto candidateIndex = INT64_C(0);
+    auto offset = INT64_C(1);
+    *period = 1;
+    while (candidateIndex + offset < size) {
+        auto candidateByte = bytes[candidateIndex + offset];
+        auto suffixByte = bytes[beforeIndex + offset];
+        if (candidateByte == suffixByte) {
+            if (offset != *period) {
+                offset++;
+            } else {
+                candidateIndex += *period;
+                offset = 1;
+            }
+        } else if ((candidateByte < suffixByte) != isReversed) {
+            candidateIndex += offset;
+            offset = 1;
+            *period = candidateIndex - beforeIndex;
+        } else {
+            beforeIndex = candidateIndex;
+            candidateIndex++;
+            offset = 1;
+            *period = 1;
+        }
+    }
+    return beforeIndex + 1;
+}
+
+auto tomurcuk::SubstringFinder::hashPair(uint8_t firstByte, uint8_t secondByte) -> uint8_t {
+    return (uint8_t)((uint32_t)(firstByte << 3U) ^ secondByte);
+}
+
+auto tomurcuk::SubstringFinder::findShort(uint8_t *haystack, int64_t size, int64_t offset) -> int64_t {
+    auto needle = (uint8_t *)mNeedle.getArray();
+    auto needleSize = mNeedle.getCount();
+    if (size - offset < needleSize) {
+        return -1;
+    }
+
+    int64_t index;
+    if (needleSize == 1) {
+        index = Bytes::findByte(haystack + offset, size - offset, needle[0]);
+    } else {
+        index = getKernels().findShort(haystack + offset, size - offset, needle, needleSize);
+    }
+    if (index == -1) {
+        return -1;
+    }
+    return index + offset;
+}
+
+auto tomurcuk::SubstringFinder::findLong(uint8_t *haystack, int64_t size, int64_t *position, int64_t *memory) -> int64_t {
+    auto needle = (uint8_t *)mNeedle.getArray();
+    auto needleSize = mNeedle.getCount();
+    auto windowIndex = *position;
+    auto matchedSize = *memory;
+    while (size - windowIndex >= needleSize) {
+        // The skip by the last pair need not be a multiple of the period; so,
+        // it forgets the bytes that were known to match.
+        auto shift = mShifts[hashPair(haystack[windowIndex + needleSize - 2], haystack[windowIndex + needleSize - 1])];
+        if (shift != 0) {
+            windowIndex += shift;
+            matchedSize = 0;
+            continue;
+        }
+
+        // The right half is compared forwards, and a mismatch in it moves the
+        // window past the matched bytes. The pairs of the shifts are hashed;
+        // so, even the last byte might differ.
+        auto i = mCriticalIndex > matchedSize ? mCriticalIndex : matchedSize;
+        while (i != needleSize && needle[i] == haystack[windowIndex + i]) {
+            i++;
+        }
+        if (i != needleSize) {
+            windowIndex += i - mCriticalIndex + 1;
+            matchedSize = 0;
+            continue;
+        }
+
+        // The left half is compared backwards, down to the bytes that are
+        // known to match.
+        i = mCriticalIndex;
+        while (i > matchedSize && needle[i - 1] == haystack[windowIndex + i - 1]) {
+            i--;
+        }
+        if (i <= matchedSize) {
+            *position = windowIndex + mPeriod;
+            *memory = mIsPeriodic ? needleSize - mPeriod : 0;
+            return windowIndex;
+        }
+
+        // A periodic needle keeps matching the right half after a shift by
+        // its period.
+        windowIndex += mPeriod;
+        matchedSize = mIsPeriodic ? needleSize - mPeriod : 0;
+    }
+    *position = windowIndex;
+    *memory = matchedSize;
+    return -1;
+}
+
+auto tomurcuk::SubstringFinder::findShortPortably(uint8_t *haystack, int64_t size, uint8_t *needle, int64_t needleSize) -> int64_t {
+    auto i = INT64_C(0);
+    while (size - i >= needleSize) {
+        auto index = Bytes::findByte(haystack + i, size - i - needleSize + 1, needle[0]);
+        if (index == -1) {
+            return -1;
+        }
+        i += index;
+        if (haystack[i + needleSize - 1] == needle[needleSize - 1] && Bytes::testBlockExactness(haystack + i, needleSize, needle, needleSize)) {
+            return i;
+        }
+        i++;
+    }
+    return -1;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("avx2")]]
+auto tomurcuk::SubstringFinder::findShortWithAvx2(uint8_t *haystack, int64_t size, uint8_t *needle, int64_t needleSize) -> int64_t {
+    auto firstByte = _mm256_set1_epi8((char)needle[0]);
+    auto lastByte = _mm256_set1_epi8((char)needle[needleSize - 1]);
+    auto i = INT64_C(0);
+
+    // Every window in the block must fit in the haystack.
+    for (; size - i >= 32 + needleSize - 1; i += 32) {
+        auto firstMatches = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *)(haystack + i)), firstByte);
+        auto lastMatches = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *)(haystack + i + needleSize - 1)), lastByte);
+        auto mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(firstMatches, lastMatches));
+        while (mask != 0) {
+            auto index = i + __builtin_ctz(mask);
+            if (Bytes::testBlockExactness(haystack + index, needleSize, needle, needleSize)) {
+                return index;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    auto index = findShortPortably(haystack + i, size - i, needle, needleSize);
+    if (index == -1) {
+        return -1;
+    }
+    return index + i;
+}
+
+#endif
@@ -0,0 +1,396 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Results.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/SubstringSetFinder.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::SubstringSetFinder::create(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char8_t>> needles) -> Result<SubstringSetFinder> {
+    assert(!needles.isEmpty());
+
+    SubstringSetFinder finder;
+    finder.mNeedles = needles;
+    finder.mMaxNeedleSize = 0;
+    for (auto i = INT64_C(0); i != needles.getCount(); i++) {
+        auto needleSize = needles.get(i)->getCount();
+        assert(needleSize != 0);
+
+        finder.mMaxNeedleSize = needleSize > finder.mMaxNeedleSize ? needleSize : finder.mMaxNeedleSize;
+    }
+    finder.mStates = nullptr;
+    finder.mStateCapacity = 0;
+
+    finder.mUsesTeddy = false;
+#if defined(__x86_64__)
+    finder.mUsesTeddy = needles.getCount() <= kMaxTeddyNeedleCount && ProcessorFeatures::hasAvx2();
+#endif
+    if (finder.mUsesTeddy) {
+        finder.initializeTeddy();
+    } else if (finder.initializeAutomaton(memoryAllocator) == Status::eFailure) {
+        return Result<SubstringSetFinder>::failure();
+    }
+    return Results::success(finder);
+}
+
+auto tomurcuk::SubstringSetFinder::destroy(MemoryAllocator memoryAllocator) -> void {
+    if (mStates != nullptr) {
+        memoryAllocator.deallocate(mStates, mStateCapacity * (mClassCount + kInfoColumnCount) * (int64_t)sizeof(int32_t), alignof(int32_t));
+    }
+}
+
+auto tomurcuk::SubstringSetFinder::find(ArrayListView<char8_t> haystack) -> int64_t {
+    auto bytes = (uint8_t *)haystack.getArray();
+    auto size = haystack.getCount();
+#if defined(__x86_64__)
+    if (mUsesTeddy) {
+        return findWithTeddy(bytes, size, 0);
+    }
+#endif
+    return findWithAutomaton(bytes, size);
+}
+
+auto tomurcuk::SubstringSetFinder::findAll(MemoryAllocator memoryAllocator, ArrayListView<char8_t> haystack, ArrayList<int64_t> *indices) -> Status {
+    auto bytes = (uint8_t *)haystack.getArray();
+    auto size = haystack.getCount();
+#if defined(__x86_64__)
+    if (mUsesTeddy) {
+        auto count = indices->getCount();
+        for (auto index = findWithTeddy(bytes, size, 0); index != -1; index = findWithTeddy(bytes, size, index + 1)) {
+            if (!indices->add(memoryAllocator, index)) {
+                indices->removePortion(count, indices->getCount());
+                return Status::eFailure;
+            }
+        }
+        return Status::eSuccess;
+    }
+#endif
+    return findAllWithAutomaton(memoryAllocator, bytes, size, indices);
+}
+
+auto tomurcuk::SubstringSetFinder::initializeTeddy() -> void {
+    // The mask only covers the bytes that every needle has; the tables of the
+    // rest let every bucket through.
+    auto maskSize = kMaskSize;
+    for (auto i = INT64_C(0); i != mNeedles.getCount(); i++) {
+        auto needleSize = mNeedles.get(i)->getCount();
+        maskSize = needleSize < maskSize ? needleSize : maskSize;
+    }
+    for (auto k = INT64_C(0); k != kMaskSize; k++) {
+        for (auto j = 0; j != 16; j++) {
+            mLowTables[k][j] = k < maskSize ? 0 : UINT8_MAX;
+            mHighTables[k][j] = k < maskSize ? 0 : UINT8_MAX;
+        }
+    }
+
+    // Needles that begin with the same mask share a bucket, and the others
+    // are spread over the buckets in turn.
+    int64_t representatives[kBucketCount];
+    for (auto &representative : representatives) {
+        representative = -1;
+    }
+    uint8_t buckets[kMaxTeddyNeedleCount];
+    int64_t bucketCounts[kBucketCount] = {};
+    auto nextBucket = INT64_C(0);
+    for (auto i = INT64_C(0); i != mNeedles.getCount(); i++) {
+        auto needle = (uint8_t *)mNeedles.get(i)->getArray();
+        auto bucket = INT64_C(-1);
+        for (auto b = INT64_C(0); b != kBucketCount; b++) {
+            if (representatives[b] != -1 && Bytes::testBlockExactness(needle, maskSize, mNeedles.get(representatives[b])->getArray(), maskSize)) {
+                bucket = b;
+                break;
+            }
+        }
+        if (bucket == -1) {
+            bucket = nextBucket % kBucketCount;
+            nextBucket++;
+            if (representatives[bucket] == -1) {
+                representatives[bucket] = i;
+            }
+        }
+        buckets[i] = (uint8_t)bucket;
+        bucketCounts[bucket]++;
+
+        auto bit = (uint8_t)(1U << (uint64_t)bucket);
+        for (auto k = INT64_C(0); k != maskSize; k++) {
+            mLowTables[k][needle[k] & 0x0FU] |= bit;
+            mHighTables[k][needle[k] >> 4U] |= bit;
+        }
+    }
+
+    uint8_t bucketBegins[kBucketCount];
+    auto end = 0;
+    for (auto b = INT64_C(0); b != kBucketCount; b++) {
+        bucketBegins[b] = (uint8_t)end;
+        end += (int)bucketCounts[b];
+        mBucketEnds[b] = (uint8_t)end;
+    }
+    for (auto i = INT64_C(0); i != mNeedles.getCount(); i++) {
+        mBucketNeedleIndices[bucketBegins[buckets[i]]] = (uint8_t)i;
+        bucketBegins[buckets[i]]++;
+    }
+}
+
+auto tomurcuk::SubstringSetFinder::initializeAutomaton(MemoryAllocator memoryAllocator) -> Status {
+    // The bytes that occur in the needles get their own columns in order.
+    for (auto &byteClass : mClasses) {
+        byteClass = 0;
+    }
+    auto totalSize = INT64_C(0);
+    for (auto i = INT64_C(0); i != mNeedles.getCount(); i++) {
+        auto needle = mNeedles.get(i);
+        for (auto j = INT64_C(0); j != needle->getCount(); j++) {
+            mClasses[(uint8_t)*needle->get(j)] = 1;
+        }
+        totalSize += needle->getCount();
+    }
+    auto usedCount = 0;
+    for (auto byteClass : mClasses) {
+        usedCount += byteClass;
+    }
+    mClassCount = usedCount == 256 ? 0 : 1;
+    for (auto &byteClass : mClasses) {
+        if (byteClass != 0) {
+            byteClass = (uint16_t)mClassCount;
+            mClassCount++;
+        }
+    }
+
+    // The offsets of the rows must fit in the transitions.
+    auto rowSize = mClassCount + kInfoColumnCount;
+    mStateCapacity = totalSize + 1;
+    if (mStateCapacity > INT32_MAX / rowSize) {
+        return Status::eFailure;
+    }
+    auto statesResult = memoryAllocator.allocateZeroed(mStateCapacity * rowSize * (int64_t)sizeof(int32_t), alignof(int32_t));
+    if (statesResult.isFailure()) {
+        return Status::eFailure;
+    }
+    mStates = (int32_t *)*statesResult.value();
+
+    // The needles are inserted into a trie, where `0` marks the missing
+    // transitions as no transition goes back to the initial state yet.
+    auto stateCount = INT64_C(1);
+    for (auto i = INT64_C(0); i != mNeedles.getCount(); i++) {
+        auto needle = mNeedles.get(i);
+        auto state = INT64_C(0);
+        for (auto j = INT64_C(0); j != needle->getCount(); j++) {
+            auto transition = &mStates[state + mClasses[(uint8_t)*needle->get(j)]];
+            if (*transition == 0) {
+                *transition = (int32_t)(stateCount * rowSize);
+                stateCount++;
+            }
+            state = *transition;
+        }
+        mStates[state + mClassCount + 1] = (int32_t)needle->getCount();
+    }
+
+    // The states are visited in breadth-first order with their failure
+    // states, which are visited before them. Then, every missing transition
+    // is the transition of the failure state.
+    auto queueResult = memoryAllocator.allocate(stateCount * 2 * (int64_t)sizeof(int32_t), alignof(int32_t));
+    if (queueResult.isFailure()) {
+        memoryAllocator.deallocate(mStates, mStateCapacity * rowSize * (int64_t)sizeof(int32_t), alignof(int32_t));
+        return Status::eFailure;
+    }
+    auto queue = (int32_t *)*queueResult.value();
+    queue[0] = 0;
+    queue[1] = 0;
+    mStates[mClassCount + 2] = -1;
+    auto head = INT64_C(0);
+    auto tail = INT64_C(2);
+    while (head != tail) {
+        auto state = queue[head];
+        auto failureState = queue[head + 1];
+        head += 2;
+        for (auto c = INT64_C(0); c != mClassCount; c++) {
+            auto transition = mStates[state + c];
+            if (transition == 0) {
+                mStates[state + c] = mStates[failureState + c];
+                continue;
+            }
+
+            auto nextFailureState = state == 0 ? 0 : mStates[failureState + c];
+            auto needleSize = mStates[transition + mClassCount + 1];
+            auto failureNeedleSize = mStates[nextFailureState + mClassCount + 1];
+            mStates[transition + mClassCount] = needleSize != 0 ? needleSize : mStates[nextFailureState + mClassCount];
+            mStates[transition + mClassCount + 2] = failureNeedleSize != 0 ? nextFailureState : mStates[nextFailureState + mClassCount + 2];
+            queue[tail] = transition;
+            queue[tail + 1] = nextFailureState;
+            tail += 2;
+        }
+    }
+    memoryAllocator.deallocate(queue, stateCount * 2 * (int64_t)sizeof(int32_t), alignof(int32_t));
+    return Status::eSuccess;
+}
+
+auto tomurcuk::SubstringSetFinder::findBuckets(uint8_t *haystack, int64_t size, int64_t index) -> uint32_t {
+    auto buckets = UINT32_C(0xFF);
+    for (auto k = INT64_C(0); k != kMaskSize && index + k != size; k++) {
+        auto byte = haystack[index + k];
+        buckets &= (uint32_t)(mLowTables[k][byte & 0x0FU] & mHighTables[k][byte >> 4U]);
+    }
+    return buckets;
+}
+
+auto tomurcuk::SubstringSetFinder::matchesAt(uint8_t *haystack, int64_t size, int64_t index, uint32_t buckets) -> bool {
+    for (; buckets != 0; buckets &= buckets - 1) {
+        auto bucket = __builtin_ctz(buckets);
+        auto begin = bucket == 0 ? 0 : mBucketEnds[bucket - 1];
+        for (auto i = begin; i != mBucketEnds[bucket]; i++) {
+            auto needle = mNeedles.get(mBucketNeedleIndices[i]);
+            auto needleSize = needle->getCount();
+            if (needleSize <= size - index && *needle->getFirst() == haystack[index] && Bytes::testBlockExactness(haystack + index, needleSize, needle->getArray(), needleSize)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+auto tomurcuk::SubstringSetFinder::findWithAutomaton(uint8_t *haystack, int64_t size) -> int64_t {
+    auto state = INT64_C(0);
+    auto i = INT64_C(0);
+    auto firstIndex = INT64_C(-1);
+    for (; i != size; i++) {
+        state = mStates[state + mClasses[haystack[i]]];
+        auto longestSize = mStates[state + mClassCount];
+        if (longestSize != 0) {
+            firstIndex = i + 1 - longestSize;
+            i++;
+            break;
+        }
+    }
+    if (firstIndex == -1) {
+        return -1;
+    }
+
+    // A longer needle might still end later but begin earlier.
+    for (; i != size && i + 1 - mMaxNeedleSize < firstIndex; i++) {
+        state = mStates[state + mClasses[haystack[i]]];
+        auto longestSize = mStates[state + mClassCount];
+        if (longestSize != 0 && i + 1 - longestSize < firstIndex) {
+            firstIndex = i + 1 - longestSize;
+        }
+    }
+    return firstIndex;
+}
+
+auto tomurcuk::SubstringSetFinder::findAllWithAutomaton(MemoryAllocator memoryAllocator, uint8_t *haystack, int64_t size, ArrayList<int64_t> *indices) -> Status {
+    // The occurrences are found at their ends; so, their beginnings are
+    // collected in a circular bit set until no needle can begin there
+    // anymore.
+    auto windowSize = INT64_C(64);
+    while (windowSize < mMaxNeedleSize) {
+        windowSize *= 2;
+    }
+    auto windowResult = memoryAllocator.allocateZeroed(windowSize / 8, alignof(uint64_t));
+    if (windowResult.isFailure()) {
+        return Status::eFailure;
+    }
+    auto window = (uint64_t *)*windowResult.value();
+    auto windowMask = (uint64_t)windowSize - 1;
+
+    // The bits are only tested until the beginnings of the last occurrence
+    // that was found are final.
+    auto states = mStates;
+    auto classes = mClasses;
+    auto classCount = mClassCount;
+    auto count = indices->getCount();
+    auto isAdded = true;
+    auto state = INT64_C(0);
+    auto pendingEnd = INT64_C(0);
+    for (auto i = INT64_C(0); i != size && isAdded; i++) {
+        auto finalIndex = i - mMaxNeedleSize;
+        if (i < pendingEnd && finalIndex >= 0) {
+            auto bit = (uint64_t)finalIndex & windowMask;
+            if ((window[bit / 64] >> (bit % 64) & 1U) != 0) {
+                window[bit / 64] &= ~(UINT64_C(1) << (bit % 64));
+                isAdded = indices->add(memoryAllocator, finalIndex);
+            }
+        }
+
+        state = states[state + classes[haystack[i]]];
+        if (states[state + classCount] == 0) {
+            continue;
+        }
+        pendingEnd = i + mMaxNeedleSize + 1;
+        for (auto matchState = states[state + classCount + 1] != 0 ? state : states[state + classCount + 2]; matchState != -1; matchState = states[matchState + classCount + 2]) {
+            auto bit = (uint64_t)(i + 1 - states[matchState + classCount + 1]) & windowMask;
+            window[bit / 64] |= UINT64_C(1) << (bit % 64);
+        }
+    }
+
+    auto begin = size - mMaxNeedleSize > 0 ? size - mMaxNeedleSize : 0;
+    for (auto i = begin; i != size && isAdded; i++) {
+        auto bit = (uint64_t)i & windowMask;
+        if ((window[bit / 64] >> (bit % 64) & 1U) != 0) {
+            isAdded = indices->add(memoryAllocator, i);
+        }
+    }
+
+    memoryAllocator.deallocate(window, windowSize / 8, alignof(uint64_t));
+    if (!isAdded) {
+        indices->removePortion(count, indices->getCount());
+        return Status::eFailure;
+    }
+    return Status::eSuccess;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("avx2")]]
+auto tomurcuk::SubstringSetFinder::findWithTeddy(uint8_t *haystack, int64_t size, int64_t offset) -> int64_t {
+    // Shuffles work inside 128-bit lanes; so, the tables are repeated.
+    auto lowTable0 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)mLowTables[0]));
+    auto lowTable1 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)mLowTables[1]));
+    auto lowTable2 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)mLowTables[2]));
+    auto highTable0 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)mHighTables[0]));
+    auto highTable1 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)mHighTables[1]));
+    auto highTable2 = _mm256_broadcastsi128_si256(_mm_load_si128((__m128i *)mHighTables[2]));
+    auto nibbleMask = _mm256_set1_epi8(0x0F);
+    auto zero = _mm256_setzero_si256();
+
+    // The buckets of the windows that begin at the bytes of a vector are
+    // found from the vectors that begin at the next bytes.
+    auto i = offset;
+    for (; size - i >= 32 + kMaskSize - 1; i += 32) {
+        auto bytes0 = _mm256_loadu_si256((__m256i *)(haystack + i));
+        auto bytes1 = _mm256_loadu_si256((__m256i *)(haystack + i + 1));
+        auto bytes2 = _mm256_loadu_si256((__m256i *)(haystack + i + 2));
+        auto buckets0 = _mm256_and_si256(_mm256_shuffle_epi8(lowTable0, _mm256_and_si256(bytes0, nibbleMask)), _mm256_shuffle_epi8(highTable0, _mm256_and_si256(_mm256_srli_epi16(bytes0, 4), nibbleMask)));
+        auto buckets1 = _mm256_and_si256(_mm256_shuffle_epi8(lowTable1, _mm256_and_si256(bytes1, nibbleMask)), _mm256_shuffle_epi8(highTable1, _mm256_and_si256(_mm256_srli_epi16(bytes1, 4), nibbleMask)));
+        auto buckets2 = _mm256_and_si256(_mm256_shuffle_epi8(lowTable2, _mm256_and_si256(bytes2, nibbleMask)), _mm256_shuffle_epi8(highTable2, _mm256_and_si256(_mm256_srli_epi16(bytes2, 4), nibbleMask)));
+        auto buckets = _mm256_and_si256(buckets0, _mm256_and_si256(buckets1, buckets2));
+        auto mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(buckets, zero));
+        if (mask == 0) {
+            continue;
+        }
+
+        alignas(32) uint8_t bucketBytes[32];
+        _mm256_store_si256((__m256i *)bucketBytes, buckets);
+        for (; mask != 0; mask &= mask - 1) {
+            auto j = __builtin_ctz(mask);
+            if (matchesAt(haystack, size, i + j, bucketBytes[j])) {
+                return i + j;
+            }
+        }
+    }
+
+    for (; i < size; i++) {
+        if (matchesAt(haystack, size, i, findBuckets(haystack, size, i))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif
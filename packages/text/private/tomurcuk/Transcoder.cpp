@@ -0,0 +1,567 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringView.hpp>
+#include <tomurcuk/Transcoder.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::Transcoder::transcode(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes, ArrayList<char16_t> *units, int64_t *invalidIndex) -> Status {
+    *invalidIndex = Utf8Codec::findInvalidIndex(bytes);
+    if (*invalidIndex != -1) {
+        return Status::eFailure;
+    }
+    return decode(memoryAllocator, bytes, units);
+}
+
+auto tomurcuk::Transcoder::transcode(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes, ArrayList<char32_t> *codePoints, int64_t *invalidIndex) -> Status {
+    *invalidIndex = Utf8Codec::findInvalidIndex(bytes);
+    if (*invalidIndex != -1) {
+        return Status::eFailure;
+    }
+    return decode(memoryAllocator, bytes, codePoints);
+}
+
+auto tomurcuk::Transcoder::transcode(MemoryAllocator memoryAllocator, StringView string, ArrayList<char16_t> *units) -> Status {
+    return decode(memoryAllocator, string.getBytes(), units);
+}
+
+auto tomurcuk::Transcoder::transcode(MemoryAllocator memoryAllocator, StringView string, ArrayList<char32_t> *codePoints) -> Status {
+    return decode(memoryAllocator, string.getBytes(), codePoints);
+}
+
+auto tomurcuk::Transcoder::transcode(MemoryAllocator memoryAllocator, ArrayListView<char16_t> units, ArrayList<char8_t> *bytes, int64_t *invalidIndex) -> Status {
+    return encode(memoryAllocator, units, bytes, invalidIndex);
+}
+
+auto tomurcuk::Transcoder::transcode(MemoryAllocator memoryAllocator, ArrayListView<char32_t> codePoints, ArrayList<char8_t> *bytes, int64_t *invalidIndex) -> Status {
+    return encode(memoryAllocator, codePoints, bytes, invalidIndex);
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::decode(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes, ArrayList<Unit> *units) -> Status {
+    auto kernels = getKernels();
+    auto count = sizeof(Unit) == 2 ? kernels.countUtf16Units((uint8_t *)bytes.getArray(), bytes.getCount()) : Utf8Codec::countCodePoints(bytes);
+    if (count == 0) {
+        return Status::eSuccess;
+    }
+    if (!units->reserve(memoryAllocator, count + kSlackCount)) {
+        return Status::eFailure;
+    }
+
+    int64_t decodedCount;
+    if constexpr (sizeof(Unit) == 2) {
+        decodedCount = kernels.decodeToUtf16((uint8_t *)bytes.getArray(), bytes.getCount(), units->getEnd());
+    } else {
+        decodedCount = kernels.decodeToUtf32((uint8_t *)bytes.getArray(), bytes.getCount(), units->getEnd());
+    }
+    assert(decodedCount == count);
+
+    units->acknowledge(decodedCount);
+    return Status::eSuccess;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::encode(MemoryAllocator memoryAllocator, ArrayListView<Unit> units, ArrayList<char8_t> *bytes, int64_t *invalidIndex) -> Status {
+    auto kernels = getKernels();
+    int64_t size;
+    if constexpr (sizeof(Unit) == 2) {
+        size = kernels.measureUtf16(units.getArray(), units.getCount(), invalidIndex);
+    } else {
+        size = kernels.measureUtf32(units.getArray(), units.getCount(), invalidIndex);
+    }
+    if (*invalidIndex != -1) {
+        return Status::eFailure;
+    }
+    if (size == 0) {
+        return Status::eSuccess;
+    }
+    if (!bytes->reserve(memoryAllocator, size + kSlackCount)) {
+        return Status::eFailure;
+    }
+
+    int64_t encodedSize;
+    if constexpr (sizeof(Unit) == 2) {
+        encodedSize = kernels.encodeUtf16(units.getArray(), units.getCount(), (uint8_t *)bytes->getEnd());
+    } else {
+        encodedSize = kernels.encodeUtf32(units.getArray(), units.getCount(), (uint8_t *)bytes->getEnd());
+    }
+    assert(encodedSize == size);
+
+    bytes->acknowledge(encodedSize);
+    return Status::eSuccess;
+}
+
+auto tomurcuk::Transcoder::countUtf16UnitsPortably(uint8_t *bytes, int64_t size) -> int64_t {
+    static constexpr auto kMaxWordCount = INT64_C(127);
+    static constexpr auto kHighBits = UINT64_C(0x8080'8080'8080'8080);
+    static constexpr auto kLowBytes = UINT64_C(0x00FF'00FF'00FF'00FF);
+
+    // Every code point takes a unit, and the ones that take 4 bytes, which
+    // lead with `11110`, take a surrogate pair. The flags are summed in bytes,
+    // which hold up to `127` words before they are widened.
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    while (size - offset >= 8) {
+        auto wordCount = (size - offset) / 8 < kMaxWordCount ? (size - offset) / 8 : kMaxWordCount;
+        auto counts = UINT64_C(0);
+        for (auto i = INT64_C(0); i != wordCount; i++) {
+            uint64_t word;
+            __builtin_memcpy(&word, bytes + offset + i * 8, sizeof(word));
+            counts += ((~word | (word << 1U)) & kHighBits) >> 7U;
+            counts += (word & (word << 1U) & (word << 2U) & (word << 3U) & kHighBits) >> 7U;
+        }
+        auto pairCounts = (counts & kLowBytes) + ((counts >> 8U) & kLowBytes);
+        count += (int64_t)((pairCounts * UINT64_C(0x0001'0001'0001'0001)) >> 48U);
+        offset += wordCount * 8;
+    }
+    for (; offset != size; offset++) {
+        count += ((bytes[offset] & 0xC0U) != 0x80) + (bytes[offset] >= 0xF0);
+    }
+    return count;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::measurePortably(Unit *units, int64_t count, int64_t *invalidIndex) -> int64_t {
+    auto size = INT64_C(0);
+    auto index = INT64_C(0);
+    while (index != count) {
+        if (!measureOne(units, count, &index, &size)) {
+            *invalidIndex = index;
+            return 0;
+        }
+    }
+    *invalidIndex = -1;
+    return size;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::decodePortably(uint8_t *bytes, int64_t size, Unit *units) -> int64_t {
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    while (offset != size) {
+        if (size - offset >= 8) {
+            uint64_t word;
+            __builtin_memcpy(&word, bytes + offset, sizeof(word));
+            if ((word & UINT64_C(0x8080'8080'8080'8080)) == 0) {
+                for (auto i = INT64_C(0); i != 8; i++) {
+                    units[count + i] = (Unit)bytes[offset + i];
+                }
+                count += 8;
+                offset += 8;
+                continue;
+            }
+        }
+        decodeOne(bytes, &offset, units, &count);
+    }
+    return count;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::encodePortably(Unit *units, int64_t count, uint8_t *bytes) -> int64_t {
+    auto size = INT64_C(0);
+    auto index = INT64_C(0);
+    while (index != count) {
+        encodeOne(units, &index, bytes, &size);
+    }
+    return size;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::measureOne(Unit *units, int64_t count, int64_t *index, int64_t *size) -> bool {
+    char32_t codePoint = units[*index];
+    if constexpr (sizeof(Unit) == 2) {
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+            if (codePoint >= 0xDC00 || count - *index < 2 || units[*index + 1] < 0xDC00 || units[*index + 1] > 0xDFFF) {
+                return false;
+            }
+            *index += 2;
+            *size += 4;
+            return true;
+        }
+    } else {
+        if (!Utf8Codec::isEncodable(codePoint)) {
+            return false;
+        }
+    }
+    *index += 1;
+    *size += Utf8Codec::getSize(codePoint);
+    return true;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::decodeOne(uint8_t *bytes, int64_t *offset, Unit *units, int64_t *count) -> void {
+    auto pointer = bytes + *offset;
+    char32_t codePoint;
+    if (pointer[0] < 0x80) {
+        codePoint = pointer[0];
+        *offset += 1;
+    } else if (pointer[0] < 0xE0) {
+        codePoint = ((pointer[0] & 0x1FU) << 6U) | (pointer[1] & 0x3FU);
+        *offset += 2;
+    } else if (pointer[0] < 0xF0) {
+        codePoint = ((pointer[0] & 0x0FU) << 12U) | ((pointer[1] & 0x3FU) << 6U) | (pointer[2] & 0x3FU);
+        *offset += 3;
+    } else {
+        codePoint = ((pointer[0] & 0x07U) << 18U) | ((pointer[1] & 0x3FU) << 12U) | ((pointer[2] & 0x3FU) << 6U) | (pointer[3] & 0x3FU);
+        *offset += 4;
+    }
+
+    if constexpr (sizeof(Unit) == 2) {
+        if (codePoint >= 0x1'0000) {
+            codePoint -= 0x1'0000;
+            units[*count] = (Unit)(0xD800U | (codePoint >> 10U));
+            units[*count + 1] = (Unit)(0xDC00U | (codePoint & 0x3FFU));
+            *count += 2;
+            return;
+        }
+    }
+    units[*count] = (Unit)codePoint;
+    *count += 1;
+}
+
+template<typename Unit>
+auto tomurcuk::Transcoder::encodeOne(Unit *units, int64_t *index, uint8_t *bytes, int64_t *size) -> void {
+    char32_t codePoint = units[*index];
+    *index += 1;
+    if constexpr (sizeof(Unit) == 2) {
+        if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+            codePoint = 0x1'0000 + (((codePoint & 0x3FFU) << 10U) | (units[*index] & 0x3FFU));
+            *index += 1;
+        }
+    }
+    *size += Utf8Codec::encode((char8_t *)bytes + *size, codePoint);
+}
+
+auto tomurcuk::Transcoder::getShuffles() -> Shuffles * {
+    static constexpr auto kShuffles = makeShuffles();
+    return (Shuffles *)&kShuffles;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("sse4.1")]]
+auto tomurcuk::Transcoder::countUtf16UnitsWithSse41(uint8_t *bytes, int64_t size) -> int64_t {
+    static constexpr auto kBlockSize = INT64_C(16);
+    static constexpr auto kMaxBlockCount = INT64_C(127);
+
+    // The bytes that are greater than `0xBF` as signed integers are not
+    // continuations, and the ones that are at least `0xF0` as unsigned
+    // integers lead surrogate pairs. The counts are summed in bytes, which
+    // hold up to `127` blocks before they are widened.
+    auto minContinuation = _mm_set1_epi8((char)0xBF);
+    auto minLeadByte4 = _mm_set1_epi8((char)0xF0);
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    while (size - offset >= kBlockSize) {
+        auto blockCount = (size - offset) / kBlockSize < kMaxBlockCount ? (size - offset) / kBlockSize : kMaxBlockCount;
+        auto counts = _mm_setzero_si128();
+        for (auto i = INT64_C(0); i != blockCount; i++) {
+            auto block = _mm_loadu_si128((__m128i *)(bytes + offset + i * kBlockSize));
+            counts = _mm_sub_epi8(counts, _mm_cmpgt_epi8(block, minContinuation));
+            counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(_mm_max_epu8(block, minLeadByte4), block));
+        }
+        auto sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+        count += _mm_extract_epi64(sums, 0) + _mm_extract_epi64(sums, 1);
+        offset += blockCount * kBlockSize;
+    }
+    return count + countUtf16UnitsPortably(bytes + offset, size - offset);
+}
+
+template<typename Unit>
+[[gnu::target("sse4.1")]]
+auto tomurcuk::Transcoder::measureWithSse41(Unit *units, int64_t count, int64_t *invalidIndex) -> int64_t {
+    static constexpr auto kLaneCount = INT64_C(16) / (int64_t)sizeof(Unit);
+    static constexpr auto kMaxBlockCount = INT64_C(8192);
+
+    // A block without surrogates and, for code points, without ones after
+    // the greatest one is measured by summing the flags of its lanes that are
+    // at least `0x80`, `0x800` and `0x1'0000` in the lanes of a vector, which
+    // hold up to `8192` blocks before they are widened; the rest are measured
+    // one by one.
+    auto size = INT64_C(0);
+    auto index = INT64_C(0);
+    while (count - index >= kLaneCount) {
+        auto sums = _mm_setzero_si128();
+        for (auto i = INT64_C(0); i != kMaxBlockCount && count - index >= kLaneCount; i++) {
+            auto block = _mm_loadu_si128((__m128i *)(units + index));
+            if constexpr (sizeof(Unit) == 2) {
+                // Every unit takes 3 bytes unless it is less than `0x80` or
+                // `0x800`, whose negated flags are summed.
+                auto surrogates = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xF800)), _mm_set1_epi16((short)0xD800));
+                if (_mm_testz_si128(surrogates, surrogates) != 0) {
+                    auto isAscii = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128());
+                    auto isSmall = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xF800)), _mm_setzero_si128());
+                    sums = _mm_add_epi16(sums, _mm_add_epi16(isAscii, isSmall));
+                    size += 3 * kLaneCount;
+                    index += kLaneCount;
+                    continue;
+                }
+            } else {
+                auto surrogates = _mm_cmpeq_epi32(_mm_and_si128(block, _mm_set1_epi32((int)0xFFFF'F800)), _mm_set1_epi32(0xD800));
+                auto isEncodable = _mm_cmpeq_epi32(_mm_min_epu32(block, _mm_set1_epi32((int)Utf8Codec::kMaxCodePoint)), block);
+                if (_mm_testc_si128(_mm_andnot_si128(surrogates, isEncodable), _mm_set1_epi32(-1)) != 0) {
+                    sums = _mm_sub_epi32(sums, _mm_cmpgt_epi32(block, _mm_set1_epi32(0x7F)));
+                    sums = _mm_sub_epi32(sums, _mm_cmpgt_epi32(block, _mm_set1_epi32(0x7FF)));
+                    sums = _mm_sub_epi32(sums, _mm_cmpgt_epi32(block, _mm_set1_epi32(0xFFFF)));
+                    size += kLaneCount;
+                    index += kLaneCount;
+                    continue;
+                }
+            }
+
+            auto blockEnd = index + kLaneCount;
+            auto codePointIndex = index;
+            auto codePointsSize = INT64_C(0);
+            while (codePointIndex < blockEnd) {
+                if (!measureOne(units, count, &codePointIndex, &codePointsSize)) {
+                    *invalidIndex = codePointIndex;
+                    return 0;
+                }
+            }
+            size += codePointsSize;
+            index = codePointIndex;
+        }
+        if constexpr (sizeof(Unit) == 2) {
+            sums = _mm_madd_epi16(sums, _mm_set1_epi16(1));
+        }
+        sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+        size += _mm_cvtsi128_si32(_mm_add_epi32(sums, _mm_srli_si128(sums, 4)));
+    }
+
+    auto restSize = measurePortably(units + index, count - index, invalidIndex);
+    if (*invalidIndex != -1) {
+        *invalidIndex += index;
+        return 0;
+    }
+    return size + restSize;
+}
+
+template<typename Unit>
+[[gnu::target("sse4.1")]]
+auto tomurcuk::Transcoder::decodeWithSse41(uint8_t *bytes, int64_t size, Unit *units) -> int64_t {
+    static constexpr auto kBlockSize = INT64_C(16);
+    static constexpr auto kChunkSize = 4 * kBlockSize;
+
+    auto shuffles = getShuffles();
+    auto minContinuation = _mm_set1_epi8((char)0xBF);
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    while (size - offset >= kChunkSize) {
+        auto block0 = _mm_loadu_si128((__m128i *)(bytes + offset));
+        auto block1 = _mm_loadu_si128((__m128i *)(bytes + offset + kBlockSize));
+        auto block2 = _mm_loadu_si128((__m128i *)(bytes + offset + 2 * kBlockSize));
+        auto block3 = _mm_loadu_si128((__m128i *)(bytes + offset + 3 * kBlockSize));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(block0, block1), _mm_or_si128(block2, block3))) == 0) {
+            for (auto i = INT64_C(0); i != kChunkSize; i += 8) {
+                auto word = _mm_loadl_epi64((__m128i *)(bytes + offset + i));
+                if constexpr (sizeof(Unit) == 2) {
+                    _mm_storeu_si128((__m128i *)(units + count + i), _mm_cvtepu8_epi16(word));
+                } else {
+                    _mm_storeu_si128((__m128i *)(units + count + i), _mm_cvtepu8_epi32(word));
+                    _mm_storeu_si128((__m128i *)(units + count + i + 4), _mm_cvtepu8_epi32(_mm_srli_si128(word, 4)));
+                }
+            }
+            count += kChunkSize;
+            offset += kChunkSize;
+            continue;
+        }
+
+        // A byte ends a code point when the byte after it is not a
+        // continuation, and the ends among the 12 bytes after a position
+        // select how the code points that begin there are decoded. The steps
+        // begin in the first 48 bytes of the chunk, so that they only read
+        // its bytes.
+        auto leadMask0 = (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(block0, minContinuation));
+        auto leadMask1 = (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(block1, minContinuation));
+        auto leadMask2 = (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(block2, minContinuation));
+        auto leadMask3 = (uint64_t)(uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(block3, minContinuation));
+        auto endMask = (leadMask0 | (leadMask1 << 16U) | (leadMask2 << 32U) | (leadMask3 << 48U)) >> 1U;
+        auto asciiMask = ~(uint64_t)(uint32_t)_mm_movemask_epi8(block0);
+        asciiMask &= ~((uint64_t)(uint32_t)_mm_movemask_epi8(block1) << 16U);
+        asciiMask &= ~((uint64_t)(uint32_t)_mm_movemask_epi8(block2) << 32U);
+        asciiMask &= ~((uint64_t)(uint32_t)_mm_movemask_epi8(block3) << 48U);
+        auto position = INT64_C(0);
+        while (position < kChunkSize - kBlockSize) {
+            auto block = _mm_loadu_si128((__m128i *)(bytes + offset + position));
+            if (((asciiMask >> (uint64_t)position) & 0xFFFFU) == 0xFFFFU) {
+                if constexpr (sizeof(Unit) == 2) {
+                    _mm_storeu_si128((__m128i *)(units + count), _mm_cvtepu8_epi16(block));
+                    _mm_storeu_si128((__m128i *)(units + count + 8), _mm_cvtepu8_epi16(_mm_srli_si128(block, 8)));
+                } else {
+                    _mm_storeu_si128((__m128i *)(units + count), _mm_cvtepu8_epi32(block));
+                    _mm_storeu_si128((__m128i *)(units + count + 4), _mm_cvtepu8_epi32(_mm_srli_si128(block, 4)));
+                    _mm_storeu_si128((__m128i *)(units + count + 8), _mm_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+                    _mm_storeu_si128((__m128i *)(units + count + 12), _mm_cvtepu8_epi32(_mm_srli_si128(block, 12)));
+                }
+                count += kBlockSize;
+                position += kBlockSize;
+                continue;
+            }
+
+            auto decoding = shuffles->decodings[(endMask >> (uint64_t)position) & 0xFFFU];
+            auto kind = (unsigned)decoding >> 12U;
+            if (kind == 0) {
+                auto codePointOffset = offset + position;
+                auto codePointCount = count;
+                decodeOne(bytes, &codePointOffset, units, &codePointCount);
+                position = codePointOffset - offset;
+                count = codePointCount;
+                continue;
+            }
+
+            auto lanes = _mm_shuffle_epi8(block, _mm_loadu_si128((__m128i *)shuffles->decodingShuffles[decoding & 0xFFU]));
+            if (kind == kSixCodePoints) {
+                // Every 16-bit lane holds the last byte of a code point and
+                // the byte before it if there is one.
+                auto lowBits = _mm_and_si128(lanes, _mm_set1_epi16(0x7F));
+                auto highBits = _mm_srli_epi16(_mm_and_si128(lanes, _mm_set1_epi16(0x1F00)), 2);
+                auto codePoints = _mm_or_si128(lowBits, highBits);
+                if constexpr (sizeof(Unit) == 2) {
+                    _mm_storeu_si128((__m128i *)(units + count), codePoints);
+                } else {
+                    _mm_storeu_si128((__m128i *)(units + count), _mm_cvtepu16_epi32(codePoints));
+                    _mm_storeu_si128((__m128i *)(units + count + 4), _mm_cvtepu16_epi32(_mm_srli_si128(codePoints, 8)));
+                }
+                count += 6;
+            } else {
+                // Every 32-bit lane holds the bytes of a code point from the
+                // last one to the first one.
+                auto lowBits = _mm_and_si128(lanes, _mm_set1_epi32(0x7F));
+                auto middleBits = _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x3F00)), 2);
+                auto highBits = _mm_srli_epi32(_mm_and_si128(lanes, _mm_set1_epi32(0x0F'0000)), 4);
+                auto codePoints = _mm_or_si128(_mm_or_si128(lowBits, middleBits), highBits);
+                if constexpr (sizeof(Unit) == 2) {
+                    _mm_storel_epi64((__m128i *)(units + count), _mm_packus_epi32(codePoints, codePoints));
+                } else {
+                    _mm_storeu_si128((__m128i *)(units + count), codePoints);
+                }
+                count += 4;
+            }
+            position += (decoding >> 8U) & 0xFU;
+        }
+        offset += position;
+    }
+    return count + decodePortably(bytes + offset, size - offset, units + count);
+}
+
+template<typename Unit>
+[[gnu::target("sse4.1")]]
+auto tomurcuk::Transcoder::encodeWithSse41(Unit *units, int64_t count, uint8_t *bytes) -> int64_t {
+    static constexpr auto kLaneCount = INT64_C(8);
+
+    auto shuffles = getShuffles();
+    auto size = INT64_C(0);
+    auto index = INT64_C(0);
+    while (count - index >= kLaneCount) {
+        // The code points are narrowed to 16-bit lanes unless one of them is
+        // outside the Basic Multilingual Plane, which is encoded one by one
+        // like the surrogates.
+        __m128i block;
+        auto isNarrow = false;
+        if constexpr (sizeof(Unit) == 2) {
+            block = _mm_loadu_si128((__m128i *)(units + index));
+            auto surrogates = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xF800)), _mm_set1_epi16((short)0xD800));
+            isNarrow = _mm_testz_si128(surrogates, surrogates) != 0;
+        } else {
+            auto lowBlock = _mm_loadu_si128((__m128i *)(units + index));
+            auto highBlock = _mm_loadu_si128((__m128i *)(units + index + 4));
+            isNarrow = _mm_testz_si128(_mm_or_si128(lowBlock, highBlock), _mm_set1_epi32((int)0xFFFF'0000)) != 0;
+            block = _mm_packus_epi32(lowBlock, highBlock);
+        }
+        if (!isNarrow) {
+            auto blockEnd = index + kLaneCount;
+            auto codePointIndex = index;
+            auto codePointsSize = size;
+            while (codePointIndex < blockEnd) {
+                encodeOne(units, &codePointIndex, bytes, &codePointsSize);
+            }
+            index = codePointIndex;
+            size = codePointsSize;
+            continue;
+        }
+
+        if (_mm_testz_si128(block, _mm_set1_epi16((short)0xFF80)) != 0) {
+            _mm_storel_epi64((__m128i *)(bytes + size), _mm_packus_epi16(block, block));
+            size += kLaneCount;
+            index += kLaneCount;
+            continue;
+        }
+
+        if (_mm_testz_si128(block, _mm_set1_epi16((short)0xF800)) != 0) {
+            // Every 16-bit lane is either an ASCII character or the 2 bytes
+            // of a code point, whose upper bytes are dropped for the former.
+            auto asciiLanes = _mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128());
+            auto leadBytes = _mm_or_si128(_mm_srli_epi16(block, 6), _mm_set1_epi16(0xC0));
+            auto continuations = _mm_slli_epi16(_mm_or_si128(_mm_and_si128(block, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80)), 8);
+            auto lanes = _mm_blendv_epi8(_mm_or_si128(leadBytes, continuations), block, asciiLanes);
+            auto asciiMask = (unsigned)_mm_movemask_epi8(_mm_packs_epi16(asciiLanes, asciiLanes)) & 0xFFU;
+            auto shuffle = _mm_loadu_si128((__m128i *)shuffles->twoByteShuffles[asciiMask]);
+            _mm_storeu_si128((__m128i *)(bytes + size), _mm_shuffle_epi8(lanes, shuffle));
+            size += shuffles->twoByteSizes[asciiMask];
+            index += kLaneCount;
+            continue;
+        }
+
+        // Every half of the block is widened to 32-bit lanes that hold the
+        // 1 to 3 bytes of the code points, whose unused upper bytes are
+        // dropped.
+        for (auto half = 0; half != 2; half++) {
+            auto codePoints = _mm_cvtepu16_epi32(half == 0 ? block : _mm_srli_si128(block, 8));
+            auto isLong = _mm_cmpgt_epi32(codePoints, _mm_set1_epi32(0x7F));
+            auto isLonger = _mm_cmpgt_epi32(codePoints, _mm_set1_epi32(0x7FF));
+            auto lastBits = _mm_or_si128(_mm_and_si128(codePoints, _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x80));
+            auto middleBits = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(codePoints, 6), _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x80));
+            auto twoBytes = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(codePoints, 6), _mm_set1_epi32(0xC0)), _mm_slli_epi32(lastBits, 8));
+            auto threeBytes = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(codePoints, 12), _mm_set1_epi32(0xE0)), _mm_or_si128(_mm_slli_epi32(middleBits, 8), _mm_slli_epi32(lastBits, 16)));
+            auto lanes = _mm_blendv_epi8(_mm_blendv_epi8(codePoints, twoBytes, isLong), threeBytes, isLonger);
+            auto mask = (unsigned)_mm_movemask_ps(_mm_castsi128_ps(isLong)) | ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(isLonger)) << 4U);
+            auto shuffle = _mm_loadu_si128((__m128i *)shuffles->threeByteShuffles[mask]);
+            _mm_storeu_si128((__m128i *)(bytes + size), _mm_shuffle_epi8(lanes, shuffle));
+            size += shuffles->threeByteSizes[mask];
+        }
+        index += kLaneCount;
+    }
+    return size + encodePortably(units + index, count - index, bytes + size);
+}
+
+#endif
+
+// The kernels are selected after the templates are defined, since GCC keeps
+// the target attributes of the definitions only for the templates that were
+// not referenced before.
+auto tomurcuk::Transcoder::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::Transcoder::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.countUtf16Units = &countUtf16UnitsPortably;
+    kernels.measureUtf16 = &measurePortably<char16_t>;
+    kernels.measureUtf32 = &measurePortably<char32_t>;
+    kernels.decodeToUtf16 = &decodePortably<char16_t>;
+    kernels.decodeToUtf32 = &decodePortably<char32_t>;
+    kernels.encodeUtf16 = &encodePortably<char16_t>;
+    kernels.encodeUtf32 = &encodePortably<char32_t>;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasSse41()) {
+        kernels.countUtf16Units = &countUtf16UnitsWithSse41;
+        kernels.measureUtf16 = &measureWithSse41<char16_t>;
+        kernels.measureUtf32 = &measureWithSse41<char32_t>;
+        kernels.decodeToUtf16 = &decodeWithSse41<char16_t>;
+        kernels.decodeToUtf32 = &decodeWithSse41<char32_t>;
+        kernels.encodeUtf16 = &encodeWithSse41<char16_t>;
+        kernels.encodeUtf32 = &encodeWithSse41<char32_t>;
+    }
+#endif
+
+    return kernels;
+}
@@ -0,0 +1,339 @@
+#include <assert.h>
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Bytes.hpp>
+#include <tomurcuk/ProcessorFeatures.hpp>
+#include <tomurcuk/Utf8Codec.hpp>
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+#endif
+
+auto tomurcuk::Utf8Codec::findInvalidIndex(ArrayListView<char8_t> bytes) -> int64_t {
+    return getKernels().findInvalidIndex((uint8_t *)bytes.getArray(), bytes.getCount());
+}
+
+auto tomurcuk::Utf8Codec::countCodePoints(ArrayListView<char8_t> bytes) -> int64_t {
+    return getKernels().countCodePoints((uint8_t *)bytes.getArray(), bytes.getCount());
+}
+
+auto tomurcuk::Utf8Codec::isAscii(ArrayListView<char8_t> bytes) -> bool {
+    return getKernels().isAscii((uint8_t *)bytes.getArray(), bytes.getCount());
+}
+
+auto tomurcuk::Utf8Codec::isEncodable(char32_t codePoint) -> bool {
+    return codePoint <= kMaxCodePoint && (codePoint < U'\xD800' || codePoint > U'\xDFFF');
+}
+
+auto tomurcuk::Utf8Codec::getSize(char32_t codePoint) -> int64_t {
+    assert(isEncodable(codePoint));
+
+    return 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x1'0000);
+}
+
+auto tomurcuk::Utf8Codec::encode(char8_t *bytes, char32_t codePoint) -> int64_t {
+    assert(isEncodable(codePoint));
+
+    if (codePoint < 0x80) {
+        bytes[0] = (char8_t)codePoint;
+        return 1;
+    }
+    if (codePoint < 0x800) {
+        bytes[0] = (char8_t)(0xC0U | (codePoint >> 6U));
+        bytes[1] = (char8_t)(0x80U | (codePoint & 0x3FU));
+        return 2;
+    }
+    if (codePoint < 0x1'0000) {
+        bytes[0] = (char8_t)(0xE0U | (codePoint >> 12U));
+        bytes[1] = (char8_t)(0x80U | ((codePoint >> 6U) & 0x3FU));
+        bytes[2] = (char8_t)(0x80U | (codePoint & 0x3FU));
+        return 3;
+    }
+    bytes[0] = (char8_t)(0xF0U | (codePoint >> 18U));
+    bytes[1] = (char8_t)(0x80U | ((codePoint >> 12U) & 0x3FU));
+    bytes[2] = (char8_t)(0x80U | ((codePoint >> 6U) & 0x3FU));
+    bytes[3] = (char8_t)(0x80U | (codePoint & 0x3FU));
+    return 4;
+}
+
+auto tomurcuk::Utf8Codec::getKernels() -> Kernels {
+    return ProcessorFeatures::getKernels<Kernels, &selectKernels>();
+}
+
+auto tomurcuk::Utf8Codec::selectKernels() -> Kernels {
+    Kernels kernels;
+    kernels.findInvalidIndex = &findInvalidIndexPortably;
+    kernels.countCodePoints = &countCodePointsPortably;
+    kernels.isAscii = &isAsciiPortably;
+
+#if defined(__x86_64__)
+    if (ProcessorFeatures::hasAvx2()) {
+        kernels.findInvalidIndex = &findInvalidIndexWithAvx2;
+        kernels.countCodePoints = &countCodePointsWithAvx2;
+        kernels.isAscii = &isAsciiWithAvx2;
+    }
+#endif
+
+    return kernels;
+}
+
+auto tomurcuk::Utf8Codec::findInvalidIndexPortably(uint8_t *bytes, int64_t size) -> int64_t {
+    return findInvalidIndexFrom(bytes, size, 0);
+}
+
+auto tomurcuk::Utf8Codec::countCodePointsPortably(uint8_t *bytes, int64_t size) -> int64_t {
+    static constexpr auto kMaxWordCount = INT64_C(255);
+    static constexpr auto kLowBytes = UINT64_C(0x00FF'00FF'00FF'00FF);
+
+    // A byte does not continue a code point unless its highest bits are
+    // `10`; so, the second highest bit of every byte is shifted under the
+    // highest one. The flags are summed in bytes, which hold up to `255`
+    // words before they are widened.
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    while (size - offset >= 8) {
+        auto wordCount = (size - offset) / 8 < kMaxWordCount ? (size - offset) / 8 : kMaxWordCount;
+        auto counts = UINT64_C(0);
+        for (auto i = INT64_C(0); i != wordCount; i++) {
+            uint64_t word;
+            __builtin_memcpy(&word, bytes + offset + i * 8, sizeof(word));
+            counts += ((~word | (word << 1U)) & UINT64_C(0x8080'8080'8080'8080)) >> 7U;
+        }
+        auto pairCounts = (counts & kLowBytes) + ((counts >> 8U) & kLowBytes);
+        count += (int64_t)((pairCounts * UINT64_C(0x0001'0001'0001'0001)) >> 48U);
+        offset += wordCount * 8;
+    }
+    for (; offset != size; offset++) {
+        count += (bytes[offset] & 0xC0U) != 0x80;
+    }
+    return count;
+}
+
+auto tomurcuk::Utf8Codec::isAsciiPortably(uint8_t *bytes, int64_t size) -> bool {
+    auto highBits = UINT64_C(0);
+    auto offset = INT64_C(0);
+    for (; size - offset >= 8; offset += 8) {
+        uint64_t word;
+        __builtin_memcpy(&word, bytes + offset, sizeof(word));
+        highBits |= word;
+    }
+    for (; offset != size; offset++) {
+        highBits |= bytes[offset];
+    }
+    return (highBits & UINT64_C(0x8080'8080'8080'8080)) == 0;
+}
+
+auto tomurcuk::Utf8Codec::findInvalidIndexFrom(uint8_t *bytes, int64_t size, int64_t offset) -> int64_t {
+    while (offset != size) {
+        if (size - offset >= 8) {
+            uint64_t word;
+            __builtin_memcpy(&word, bytes + offset, sizeof(word));
+            if ((word & UINT64_C(0x8080'8080'8080'8080)) == 0) {
+                offset += 8;
+                continue;
+            }
+        }
+
+        auto byte = bytes[offset];
+        if (byte < 0x80) {
+            offset++;
+            continue;
+        }
+
+        // The leading byte limits the second byte, which rules out the
+        // overlong encodings, the surrogates and the code points after the
+        // greatest one.
+        auto length = INT64_C(0);
+        auto minSecondByte = 0x80U;
+        auto maxSecondByte = 0xBFU;
+        if (byte >= 0xC2 && byte <= 0xDF) {
+            length = 2;
+        } else if (byte >= 0xE0 && byte <= 0xEF) {
+            length = 3;
+            minSecondByte = byte == 0xE0 ? 0xA0U : minSecondByte;
+            maxSecondByte = byte == 0xED ? 0x9FU : maxSecondByte;
+        } else if (byte >= 0xF0 && byte <= 0xF4) {
+            length = 4;
+            minSecondByte = byte == 0xF0 ? 0x90U : minSecondByte;
+            maxSecondByte = byte == 0xF4 ? 0x8FU : maxSecondByte;
+        } else {
+            return offset;
+        }
+        if (size - offset < length || bytes[offset + 1] < minSecondByte || bytes[offset + 1] > maxSecondByte) {
+            return offset;
+        }
+        for (auto i = INT64_C(2); i != length; i++) {
+            if ((bytes[offset + i] & 0xC0U) != 0x80) {
+                return offset;
+            }
+        }
+        offset += length;
+    }
+    return -1;
+}
+
+#if defined(__x86_64__)
+
+[[gnu::target("avx2")]]
+auto tomurcuk::Utf8Codec::findInvalidIndexWithAvx2(uint8_t *bytes, int64_t size) -> int64_t {
+    static constexpr auto kBlockSize = INT64_C(32);
+
+    // The errors a pair of bytes can have, each of which is selected by the
+    // halves of the bytes; a pair has an error when all three lookups
+    // select it.
+    static constexpr auto kTooShort = (char)(1U << 0U);
+    static constexpr auto kTooLong = (char)(1U << 1U);
+    static constexpr auto kOverlong3 = (char)(1U << 2U);
+    static constexpr auto kTooLarge = (char)(1U << 3U);
+    static constexpr auto kSurrogate = (char)(1U << 4U);
+    static constexpr auto kOverlong2 = (char)(1U << 5U);
+    static constexpr auto kTooLarge1000 = (char)(1U << 6U);
+    static constexpr auto kOverlong4 = (char)(1U << 6U);
+    static constexpr auto kTwoContinuations = (char)(1U << 7U);
+    static constexpr auto kCarry = (char)(kTooShort | kTooLong | kTwoContinuations);
+    static constexpr auto kFirstHighLeadByte4 = (char)(kTooShort | kTooLarge | kTooLarge1000 | kOverlong4);
+    static constexpr auto kFirstLowLarge = (char)(kCarry | kTooLarge | kTooLarge1000);
+    static constexpr auto kSecondHighContinuation = (char)(kTooLong | kOverlong2 | kTwoContinuations);
+
+    auto firstHighTable = _mm256_setr_epi8(
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoContinuations, kTwoContinuations, kTwoContinuations, kTwoContinuations,
+        (char)(kTooShort | kOverlong2), kTooShort, (char)(kTooShort | kOverlong3 | kSurrogate), kFirstHighLeadByte4,
+        kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+        kTwoContinuations, kTwoContinuations, kTwoContinuations, kTwoContinuations,
+        (char)(kTooShort | kOverlong2), kTooShort, (char)(kTooShort | kOverlong3 | kSurrogate), kFirstHighLeadByte4
+    );
+    auto firstLowTable = _mm256_setr_epi8(
+        (char)(kCarry | kOverlong3 | kOverlong2 | kOverlong4), (char)(kCarry | kOverlong2), kCarry, kCarry,
+        (char)(kCarry | kTooLarge), kFirstLowLarge, kFirstLowLarge, kFirstLowLarge,
+        kFirstLowLarge, kFirstLowLarge, kFirstLowLarge, kFirstLowLarge,
+        kFirstLowLarge, (char)(kFirstLowLarge | kSurrogate), kFirstLowLarge, kFirstLowLarge,
+        (char)(kCarry | kOverlong3 | kOverlong2 | kOverlong4), (char)(kCarry | kOverlong2), kCarry, kCarry,
+        (char)(kCarry | kTooLarge), kFirstLowLarge, kFirstLowLarge, kFirstLowLarge,
+        kFirstLowLarge, kFirstLowLarge, kFirstLowLarge, kFirstLowLarge,
+        kFirstLowLarge, (char)(kFirstLowLarge | kSurrogate), kFirstLowLarge, kFirstLowLarge
+    );
+    auto secondHighTable = _mm256_setr_epi8(
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        (char)(kSecondHighContinuation | kOverlong3 | kTooLarge1000 | kOverlong4), (char)(kSecondHighContinuation | kOverlong3 | kTooLarge),
+        (char)(kSecondHighContinuation | kSurrogate | kTooLarge), (char)(kSecondHighContinuation | kSurrogate | kTooLarge),
+        kTooShort, kTooShort, kTooShort, kTooShort,
+        kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+        (char)(kSecondHighContinuation | kOverlong3 | kTooLarge1000 | kOverlong4), (char)(kSecondHighContinuation | kOverlong3 | kTooLarge),
+        (char)(kSecondHighContinuation | kSurrogate | kTooLarge), (char)(kSecondHighContinuation | kSurrogate | kTooLarge),
+        kTooShort, kTooShort, kTooShort, kTooShort
+    );
+
+    // A block is incomplete if one of its last bytes leads a sequence that
+    // is longer than the rest of the block.
+    auto maxCompleteBytes = _mm256_setr_epi8(
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+        -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)0xEF, (char)0xDF, (char)0xBF
+    );
+    auto lowNibbles = _mm256_set1_epi8(0x0F);
+
+    auto previousBlock = _mm256_setzero_si256();
+    auto previousIncompleteness = _mm256_setzero_si256();
+    uint8_t tail[kBlockSize];
+    for (auto offset = INT64_C(0);; offset += kBlockSize) {
+        // The last bytes are padded with `0`s, which are ASCII characters
+        // that cut any sequence they follow.
+        auto pointer = bytes + offset;
+        auto restSize = size - offset;
+        if (restSize < kBlockSize) {
+            if (restSize == 0 && _mm256_testz_si256(previousIncompleteness, previousIncompleteness) != 0) {
+                return -1;
+            }
+            Bytes::resetArray(tail, kBlockSize);
+            if (restSize != 0) {
+                Bytes::copyArray(tail, pointer, restSize);
+            }
+            pointer = tail;
+        }
+
+        auto block = _mm256_loadu_si256((__m256i *)pointer);
+        auto error = previousIncompleteness;
+        previousIncompleteness = _mm256_setzero_si256();
+        if (_mm256_movemask_epi8(block) != 0) {
+            auto carriedBlock = _mm256_permute2x128_si256(previousBlock, block, 0x21);
+            auto previous1 = _mm256_alignr_epi8(block, carriedBlock, 15);
+            auto previous2 = _mm256_alignr_epi8(block, carriedBlock, 14);
+            auto previous3 = _mm256_alignr_epi8(block, carriedBlock, 13);
+
+            auto firstHigh = _mm256_shuffle_epi8(firstHighTable, _mm256_and_si256(_mm256_srli_epi16(previous1, 4), lowNibbles));
+            auto firstLow = _mm256_shuffle_epi8(firstLowTable, _mm256_and_si256(previous1, lowNibbles));
+            auto secondHigh = _mm256_shuffle_epi8(secondHighTable, _mm256_and_si256(_mm256_srli_epi16(block, 4), lowNibbles));
+            auto specialCases = _mm256_and_si256(_mm256_and_si256(firstHigh, firstLow), secondHigh);
+
+            // The third and the fourth bytes of a sequence must be
+            // continuations, which is the only case of two continuations that
+            // is not an error.
+            auto isThirdByte = _mm256_subs_epu8(previous2, _mm256_set1_epi8((char)(0xE0 - 0x80)));
+            auto isFourthByte = _mm256_subs_epu8(previous3, _mm256_set1_epi8((char)(0xF0 - 0x80)));
+            auto mustContinue = _mm256_and_si256(_mm256_or_si256(isThirdByte, isFourthByte), _mm256_set1_epi8((char)0x80));
+            error = _mm256_xor_si256(mustContinue, specialCases);
+            previousIncompleteness = _mm256_subs_epu8(block, maxCompleteBytes);
+        }
+        if (_mm256_testz_si256(error, error) == 0) {
+            // The error is in a sequence that ends in the block; so, the
+            // portable search starts from the code point that crosses into it.
+            auto restartOffset = offset;
+            while (restartOffset > 0 && offset - restartOffset < kMaxSize) {
+                restartOffset--;
+                if ((bytes[restartOffset] & 0xC0U) != 0x80) {
+                    break;
+                }
+            }
+            return findInvalidIndexFrom(bytes, size, restartOffset);
+        }
+        if (pointer == tail) {
+            return -1;
+        }
+        previousBlock = block;
+    }
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::Utf8Codec::countCodePointsWithAvx2(uint8_t *bytes, int64_t size) -> int64_t {
+    static constexpr auto kBlockSize = INT64_C(32);
+    static constexpr auto kMaxBlockCount = INT64_C(255);
+
+    // The bytes that are greater than `0xBF` as signed integers are not
+    // continuations. Their counts are summed in bytes, which hold up to
+    // `255` blocks before they are widened.
+    auto minContinuation = _mm256_set1_epi8((char)0xBF);
+    auto count = INT64_C(0);
+    auto offset = INT64_C(0);
+    while (size - offset >= kBlockSize) {
+        auto blockCount = (size - offset) / kBlockSize < kMaxBlockCount ? (size - offset) / kBlockSize : kMaxBlockCount;
+        auto counts = _mm256_setzero_si256();
+        for (auto i = INT64_C(0); i != blockCount; i++) {
+            auto block = _mm256_loadu_si256((__m256i *)(bytes + offset + i * kBlockSize));
+            counts = _mm256_sub_epi8(counts, _mm256_cmpgt_epi8(block, minContinuation));
+        }
+        auto sums = _mm256_sad_epu8(counts, _mm256_setzero_si256());
+        count += _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) + _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3);
+        offset += blockCount * kBlockSize;
+    }
+    return count + countCodePointsPortably(bytes + offset, size - offset);
+}
+
+[[gnu::target("avx2")]]
+auto tomurcuk::Utf8Codec::isAsciiWithAvx2(uint8_t *bytes, int64_t size) -> bool {
+    static constexpr auto kBlockSize = INT64_C(32);
+    static constexpr auto kStepSize = 4 * kBlockSize;
+
+    auto offset = INT64_C(0);
+    for (; size - offset >= kStepSize; offset += kStepSize) {
+        auto block0 = _mm256_loadu_si256((__m256i *)(bytes + offset));
+        auto block1 = _mm256_loadu_si256((__m256i *)(bytes + offset + kBlockSize));
+        auto block2 = _mm256_loadu_si256((__m256i *)(bytes + offset + 2 * kBlockSize));
+        auto block3 = _mm256_loadu_si256((__m256i *)(bytes + offset + 3 * kBlockSize));
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(block0, block1), _mm256_or_si256(block2, block3))) != 0) {
+            return false;
+        }
+    }
+    return isAsciiPortably(bytes + offset, size - offset);
+}
+
+#endif
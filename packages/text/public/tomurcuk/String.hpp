@@ -0,0 +1,101 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringView.hpp>
+
+namespace tomurcuk {
+    /**
+     * Growable string that holds valid UTF-8.
+     *
+     * Bytes from outside are validated when they are appended, and code
+     * points are encoded by the string; so, its views never need to validate
+     * them again.
+     */
+    class String {
+    public:
+        /**
+         * Creates a new string that is empty.
+         */
+        auto initialize() -> void;
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Provides a view of the string.
+         *
+         * @warning The string must not be modified while the view is used.
+         *
+         * @return A view that refers to the bytes of this string.
+         */
+        auto getView() -> StringView;
+
+        /**
+         * Provides the amount of bytes.
+         *
+         * @return The amount of bytes that encode the string.
+         */
+        auto getSize() -> int64_t;
+
+        /**
+         * Tests whether there are no code points.
+         *
+         * @return Whether the string is empty.
+         */
+        auto isEmpty() -> bool;
+
+        /**
+         * Appends the code points of another string.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] string The appended string, which must not refer to this
+         * one.
+         * @return Whether the operation succeeded. On failure, the string is
+         * not changed.
+         */
+        auto append(MemoryAllocator memoryAllocator, StringView string) -> Status;
+
+        /**
+         * Validates bytes and appends the code points they encode.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] bytes The appended bytes.
+         * @return Whether the bytes were valid UTF-8 and could be appended. On
+         * failure, the string is not changed.
+         */
+        auto appendBytes(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes) -> Status;
+
+        /**
+         * Appends the encoding of a code point.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory.
+         * @param[in] codePoint The encodable code point.
+         * @return Whether the operation succeeded. On failure, the string is
+         * not changed.
+         */
+        auto appendCodePoint(MemoryAllocator memoryAllocator, char32_t codePoint) -> Status;
+
+        /**
+         * Removes all code points without deallocating the memory.
+         */
+        auto removeAll() -> void;
+
+    private:
+        /**
+         * The bytes that encode the string.
+         */
+        ArrayList<char8_t> mBytes;
+    };
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Reference to bytes that are valid UTF-8.
+     *
+     * The bytes are validated once when the view is initialized; so, the
+     * queries of the view do not check them again. The view only refers to
+     * them, and they must outlive it.
+     */
+    class StringView {
+    public:
+        /**
+         * Validates bytes and refers to them.
+         *
+         * @param[in] bytes The referred bytes.
+         * @return Whether the bytes are valid UTF-8.
+         */
+        auto initialize(ArrayListView<char8_t> bytes) -> Status;
+
+        /**
+         * Refers to bytes that are known to be valid UTF-8, without
+         * validating them, which is how @ref String provides its views.
+         *
+         * @warning The bytes are never validated. Invalid UTF-8 breaks the
+         * queries of the view; so, prefer @ref initialize unless the bytes
+         * come from another view or a @ref String.
+         *
+         * @param[in] bytes The referred bytes.
+         */
+        auto initializeValidated(ArrayListView<char8_t> bytes) -> void;
+
+        /**
+         * Creates a view of the empty string.
+         */
+        auto initializeEmpty() -> void;
+
+        /**
+         * Provides the referred bytes.
+         *
+         * @return The view of the bytes that encode the string.
+         */
+        auto getBytes() -> ArrayListView<char8_t>;
+
+        /**
+         * Provides the amount of bytes.
+         *
+         * @return The amount of bytes that encode the string.
+         */
+        auto getSize() -> int64_t;
+
+        /**
+         * Tests whether there are no code points.
+         *
+         * @return Whether the string is empty.
+         */
+        auto isEmpty() -> bool;
+
+        /**
+         * Tests whether all code points are ASCII characters.
+         *
+         * @return Whether every code point takes a single byte.
+         */
+        auto isAscii() -> bool;
+
+        /**
+         * Counts the code points.
+         *
+         * @return The amount of code points in the string.
+         */
+        auto countCodePoints() -> int64_t;
+
+        /**
+         * Provides a view of a portion of the string.
+         *
+         * @param[in] beginIndex The index of the first byte of the portion,
+         * which begins a code point or is the amount of bytes.
+         * @param[in] endIndex The index of the byte after the portion, which
+         * begins a code point or is the amount of bytes.
+         * @return A view of the code points in the portion.
+         */
+        auto getSlice(int64_t beginIndex, int64_t endIndex) -> StringView;
+
+    private:
+        /**
+         * The referred bytes.
+         */
+        ArrayListView<char8_t> mBytes;
+
+        auto isBoundary(int64_t index) -> bool;
+    };
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Searcher that finds the occurrences of a needle in byte arrays.
+     *
+     * The needle is analyzed once when the finder is initialized, and the
+     * finder only refers to its bytes, which must outlive it.
+     *
+     * A short needle is searched with the filter of Muła: the AVX2 kernel
+     * compares 32 positions at once with the first and the last byte of the
+     * needle, and only compares the whole needle at the positions where both
+     * matched. Without AVX2, the first byte is found with @ref Bytes::findByte
+     * instead. A long needle is searched with the Two-Way algorithm of
+     * Crochemore and Perrin, which skips ahead by the last pair of bytes of
+     * the window in the manner of the algorithm of Horspool, and takes linear
+     * time in the worst case.
+     */
+    class SubstringFinder {
+    public:
+        /**
+         * The longest needle that is searched with the byte filter.
+         */
+        static constexpr auto kMaxShortNeedleSize = INT64_C(32);
+
+        /**
+         * Analyzes a needle and refers to it.
+         *
+         * @param[in] needle The searched bytes, which might be empty.
+         */
+        auto initialize(ArrayListView<char8_t> needle) -> void;
+
+        /**
+         * Provides the needle.
+         *
+         * @return The view of the searched bytes.
+         */
+        auto getNeedle() -> ArrayListView<char8_t>;
+
+        /**
+         * Finds the first occurrence of the needle.
+         *
+         * @param[in] haystack The searched bytes.
+         * @return The index of the first byte of the first occurrence if there
+         * is one. Otherwise, `-1`. An empty needle occurs at `0`.
+         */
+        auto find(ArrayListView<char8_t> haystack) -> int64_t;
+
+        /**
+         * Finds all occurrences of the needle, including the ones that
+         * overlap.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the indices.
+         * @param[in] haystack The searched bytes.
+         * @param[in,out] indices The list that the indices of the first bytes
+         * of the occurrences are added to in ascending order. An empty needle
+         * occurs at every index up to the amount of bytes.
+         * @return Whether the indices could be added. On failure, the list is
+         * unchanged.
+         */
+        auto findAll(MemoryAllocator memoryAllocator, ArrayListView<char8_t> haystack, ArrayList<int64_t> *indices) -> Status;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*findShort)(uint8_t *haystack, int64_t size, uint8_t *needle, int64_t needleSize) -> int64_t;
+        };
+
+        /**
+         * The searched bytes.
+         */
+        ArrayListView<char8_t> mNeedle;
+
+        /**
+         * The index that splits the needle into a left and a right half at a
+         * critical factorization.
+         *
+         * @warning Only used for long needles.
+         */
+        int64_t mCriticalIndex;
+
+        /**
+         * The period of the needle if it is periodic. Otherwise, the least
+         * amount by which an occurrence can be followed by another one.
+         *
+         * @warning Only used for long needles.
+         */
+        int64_t mPeriod;
+
+        /**
+         * Whether the left half of the needle repeats after its period, so
+         * that the bytes that matched the right half can be remembered after
+         * a shift.
+         *
+         * @warning Only used for long needles.
+         */
+        bool mIsPeriodic;
+
+        /**
+         * The distances from the last occurrence of every hashed pair of
+         * bytes in the needle to its last byte, or one less than the size of
+         * the needle for the pairs that do not occur in it, capped at `255`. A
+         * window whose last pair hashes to the entry is skipped by it.
+         *
+         * @warning Only used for long needles.
+         */
+        uint8_t mShifts[256];
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto findShortPortably(uint8_t *haystack, int64_t size, uint8_t *needle, int64_t needleSize) -> int64_t;
+        static auto findShortWithAvx2(uint8_t *haystack, int64_t size, uint8_t *needle, int64_t needleSize) -> int64_t;
+        static auto hashPair(uint8_t firstByte, uint8_t secondByte) -> uint8_t;
+
+        /**
+         * Finds the maximal suffix of the needle in an ordering of the bytes.
+         *
+         * @param[in] isReversed Whether the bytes are ordered descendingly.
+         * @param[out] period The period of the maximal suffix.
+         * @return The index of the first byte of the maximal suffix.
+         */
+        auto findMaximalSuffix(bool isReversed, int64_t *period) -> int64_t;
+
+        /**
+         * Finds the next occurrence of a short needle.
+         *
+         * @return The index of the occurrence if there is one at or after
+         * the offset. Otherwise, `-1`.
+         */
+        auto findShort(uint8_t *haystack, int64_t size, int64_t offset) -> int64_t;
+
+        /**
+         * Finds the next occurrence of a long needle with the Two-Way
+         * algorithm.
+         *
+         * @param[in,out] position The index where the window of the search
+         * begins, which is moved after the occurrence.
+         * @param[in,out] memory The amount of bytes at the beginning of the
+         * window that are known to match, which is updated for the moved
+         * window.
+         * @return The index of the occurrence if there is one. Otherwise,
+         * `-1`.
+         */
+        auto findLong(uint8_t *haystack, int64_t size, int64_t *position, int64_t *memory) -> int64_t;
+    };
+}
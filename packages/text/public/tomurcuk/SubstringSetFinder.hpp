@@ -0,0 +1,201 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Result.hpp>
+#include <tomurcuk/Status.hpp>
+
+namespace tomurcuk {
+    /**
+     * Searcher that finds where any of a set of needles occurs in byte
+     * arrays.
+     *
+     * The finder only refers to the bytes of the needles, which must outlive
+     * it.
+     *
+     * A few needles are searched with the Teddy algorithm of Langdale when
+     * the processor supports AVX2: every needle is put into one of 8 buckets,
+     * and the low and high halves of the first 3 bytes of a window select the
+     * buckets whose needles might begin with them. The whole needles are only
+     * compared at the windows where a bucket remains. Otherwise, the needles
+     * are searched with the automaton of Aho and Corasick, whose transitions
+     * are stored in a table that has a column for each byte that occurs in
+     * the needles, and a shared column for the other bytes.
+     */
+    class SubstringSetFinder {
+    public:
+        /**
+         * The most needles that are searched with the Teddy algorithm.
+         */
+        static constexpr auto kMaxTeddyNeedleCount = INT64_C(64);
+
+        /**
+         * Creates a new finder for a set of needles.
+         *
+         * @param[in,out] memoryAllocator The allocator that will provide the
+         * memory of the automaton.
+         * @param[in] needles The searched needles, which are not empty.
+         * @return The finder if the memory could be allocated.
+         */
+        static auto create(MemoryAllocator memoryAllocator, ArrayListView<ArrayListView<char8_t>> needles) -> Result<SubstringSetFinder>;
+
+        /**
+         * Deallocates the backing memory.
+         *
+         * @param[in,out] memoryAllocator The allocator that did provide the
+         * memory.
+         */
+        auto destroy(MemoryAllocator memoryAllocator) -> void;
+
+        /**
+         * Finds the first index where any needle occurs.
+         *
+         * @param[in] haystack The searched bytes.
+         * @return The index of the first byte of the first occurrence if there
+         * is one. Otherwise, `-1`.
+         */
+        auto find(ArrayListView<char8_t> haystack) -> int64_t;
+
+        /**
+         * Finds all indices where any needle occurs.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the indices.
+         * @param[in] haystack The searched bytes.
+         * @param[in,out] indices The list that the indices of the first bytes
+         * of the occurrences are added to in ascending order, once for every
+         * index where some needles occur.
+         * @return Whether the indices could be added. On failure, the list is
+         * unchanged.
+         */
+        auto findAll(MemoryAllocator memoryAllocator, ArrayListView<char8_t> haystack, ArrayList<int64_t> *indices) -> Status;
+
+    private:
+        /**
+         * The amount of buckets the Teddy algorithm puts the needles into,
+         * which are the bits of a byte.
+         */
+        static constexpr auto kBucketCount = INT64_C(8);
+
+        /**
+         * The amount of bytes at the beginning of a window that the Teddy
+         * algorithm filters with.
+         */
+        static constexpr auto kMaskSize = INT64_C(3);
+
+        /**
+         * The amount of columns after the transitions of a state.
+         *
+         * The first one is the size of the longest needle that ends at the
+         * state, or `0` if none does. The second one is the size of the
+         * needle that is the string of the state, or `0` if none is. The
+         * third one is the next state on the failure path whose string is a
+         * needle, or `-1` if there is none.
+         */
+        static constexpr auto kInfoColumnCount = INT64_C(3);
+
+        /**
+         * The searched needles.
+         */
+        ArrayListView<ArrayListView<char8_t>> mNeedles;
+
+        /**
+         * The size of the longest needle.
+         */
+        int64_t mMaxNeedleSize;
+
+        /**
+         * Whether the needles are searched with the Teddy algorithm.
+         */
+        bool mUsesTeddy;
+
+        /**
+         * For every byte of the mask, the buckets that have a needle whose
+         * byte there has each low half.
+         *
+         * @warning Only used with the Teddy algorithm.
+         */
+        alignas(16) uint8_t mLowTables[kMaskSize][16];
+
+        /**
+         * For every byte of the mask, the buckets that have a needle whose
+         * byte there has each high half.
+         *
+         * @warning Only used with the Teddy algorithm.
+         */
+        alignas(16) uint8_t mHighTables[kMaskSize][16];
+
+        /**
+         * The indices of the needles, grouped by their buckets.
+         *
+         * @warning Only used with the Teddy algorithm.
+         */
+        uint8_t mBucketNeedleIndices[kMaxTeddyNeedleCount];
+
+        /**
+         * The index after the needles of every bucket in @ref
+         * mBucketNeedleIndices.
+         *
+         * @warning Only used with the Teddy algorithm.
+         */
+        uint8_t mBucketEnds[kBucketCount];
+
+        /**
+         * The column of every byte, where `0` is shared by the bytes that do
+         * not occur in the needles.
+         *
+         * @warning Only used with the automaton.
+         */
+        uint16_t mClasses[256];
+
+        /**
+         * The amount of columns that hold transitions.
+         *
+         * @warning Only used with the automaton.
+         */
+        int64_t mClassCount;
+
+        /**
+         * Pointer to the rows of the states, which hold the offsets of the
+         * rows the transitions go to followed by @ref kInfoColumnCount
+         * columns. The row of the initial state is first.
+         *
+         * @warning `nullptr` with the Teddy algorithm.
+         */
+        int32_t *mStates;
+
+        /**
+         * The amount of states @ref mStates has memory for, which is one more
+         * than the total size of the needles.
+         */
+        int64_t mStateCapacity;
+
+        auto initializeTeddy() -> void;
+        auto initializeAutomaton(MemoryAllocator memoryAllocator) -> Status;
+
+        /**
+         * Finds the buckets of the Teddy algorithm whose needles might occur
+         * at an index.
+         */
+        auto findBuckets(uint8_t *haystack, int64_t size, int64_t index) -> uint32_t;
+
+        /**
+         * Tests whether a needle from some buckets occurs at an index.
+         */
+        auto matchesAt(uint8_t *haystack, int64_t size, int64_t index, uint32_t buckets) -> bool;
+
+        /**
+         * Finds the next index where any needle occurs with the Teddy
+         * algorithm.
+         *
+         * @return The index of the occurrence if there is one at or after the
+         * offset. Otherwise, `-1`.
+         */
+        auto findWithTeddy(uint8_t *haystack, int64_t size, int64_t offset) -> int64_t;
+
+        auto findWithAutomaton(uint8_t *haystack, int64_t size) -> int64_t;
+        auto findAllWithAutomaton(MemoryAllocator memoryAllocator, uint8_t *haystack, int64_t size, ArrayList<int64_t> *indices) -> Status;
+    };
+}
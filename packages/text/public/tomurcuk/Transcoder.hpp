@@ -0,0 +1,316 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayList.hpp>
+#include <tomurcuk/ArrayListView.hpp>
+#include <tomurcuk/MemoryAllocator.hpp>
+#include <tomurcuk/Status.hpp>
+#include <tomurcuk/StringView.hpp>
+
+namespace tomurcuk {
+    /**
+     * Conversions between the UTF-8, UTF-16 and UTF-32 encodings of code
+     * points.
+     *
+     * Every conversion validates its input and finds the exact size of its
+     * output in a first pass, reserves that much of the output list once, and
+     * writes the output in a second pass. So, invalid input is reported with
+     * its position before anything is written.
+     *
+     * The passes have portable implementations and SSE4.1 ones, which
+     * convert ASCII characters 16 at a time, decode the UTF-8 code points in
+     * 12 bytes at a time with the shuffles of Lemire and Muła, and encode 8
+     * code points from the Basic Multilingual Plane at a time; the fastest
+     * ones the processor supports are selected on the first use.
+     */
+    class Transcoder {
+    public:
+        /**
+         * Appends the UTF-16 encoding of UTF-8 bytes.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the units.
+         * @param[in] bytes The converted bytes.
+         * @param[in,out] units The list the converted units are appended to.
+         * @param[out] invalidIndex The index of the first byte of the first
+         * invalid sequence if there is one. Otherwise, `-1`.
+         * @return Whether the bytes were valid and could be converted. On
+         * failure, the units are not changed.
+         */
+        static auto transcode(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes, ArrayList<char16_t> *units, int64_t *invalidIndex) -> Status;
+
+        /**
+         * Appends the UTF-32 encoding of UTF-8 bytes.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the code points.
+         * @param[in] bytes The converted bytes.
+         * @param[in,out] codePoints The list the code points are appended to.
+         * @param[out] invalidIndex The index of the first byte of the first
+         * invalid sequence if there is one. Otherwise, `-1`.
+         * @return Whether the bytes were valid and could be converted. On
+         * failure, the code points are not changed.
+         */
+        static auto transcode(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes, ArrayList<char32_t> *codePoints, int64_t *invalidIndex) -> Status;
+
+        /**
+         * Appends the UTF-16 encoding of a string, which is known to be valid.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the units.
+         * @param[in] string The converted string.
+         * @param[in,out] units The list the converted units are appended to.
+         * @return Whether the operation succeeded. On failure, the units are
+         * not changed.
+         */
+        static auto transcode(MemoryAllocator memoryAllocator, StringView string, ArrayList<char16_t> *units) -> Status;
+
+        /**
+         * Appends the UTF-32 encoding of a string, which is known to be valid.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the code points.
+         * @param[in] string The converted string.
+         * @param[in,out] codePoints The list the code points are appended to.
+         * @return Whether the operation succeeded. On failure, the code points
+         * are not changed.
+         */
+        static auto transcode(MemoryAllocator memoryAllocator, StringView string, ArrayList<char32_t> *codePoints) -> Status;
+
+        /**
+         * Appends the UTF-8 encoding of UTF-16 units.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the bytes.
+         * @param[in] units The converted units.
+         * @param[in,out] bytes The list the converted bytes are appended to.
+         * @param[out] invalidIndex The index of the first surrogate that is
+         * not in a pair if there is one. Otherwise, `-1`.
+         * @return Whether the units were valid and could be converted. On
+         * failure, the bytes are not changed.
+         */
+        static auto transcode(MemoryAllocator memoryAllocator, ArrayListView<char16_t> units, ArrayList<char8_t> *bytes, int64_t *invalidIndex) -> Status;
+
+        /**
+         * Appends the UTF-8 encoding of UTF-32 code points.
+         *
+         * @param[in,out] memoryAllocator The allocator that will/did provide
+         * the memory of the bytes.
+         * @param[in] codePoints The converted code points.
+         * @param[in,out] bytes The list the converted bytes are appended to.
+         * @param[out] invalidIndex The index of the first code point that is a
+         * surrogate or greater than @ref Utf8Codec::kMaxCodePoint if there is
+         * one. Otherwise, `-1`.
+         * @return Whether the code points were valid and could be converted.
+         * On failure, the bytes are not changed.
+         */
+        static auto transcode(MemoryAllocator memoryAllocator, ArrayListView<char32_t> codePoints, ArrayList<char8_t> *bytes, int64_t *invalidIndex) -> Status;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*countUtf16Units)(uint8_t *bytes, int64_t size) -> int64_t;
+            auto (*measureUtf16)(char16_t *units, int64_t count, int64_t *invalidIndex) -> int64_t;
+            auto (*measureUtf32)(char32_t *units, int64_t count, int64_t *invalidIndex) -> int64_t;
+            auto (*decodeToUtf16)(uint8_t *bytes, int64_t size, char16_t *units) -> int64_t;
+            auto (*decodeToUtf32)(uint8_t *bytes, int64_t size, char32_t *units) -> int64_t;
+            auto (*encodeUtf16)(char16_t *units, int64_t count, uint8_t *bytes) -> int64_t;
+            auto (*encodeUtf32)(char32_t *units, int64_t count, uint8_t *bytes) -> int64_t;
+        };
+
+        /**
+         * The shuffles of the vectorized kernels.
+         */
+        struct Shuffles {
+            /**
+             * For every mask of the bytes that end a code point among the
+             * first 12 bytes of a block, the kind of the decoding in bits 12
+             * and 13, the amount of decoded bytes in bits 8 to 11, and the
+             * index of the decoding shuffle in the lower bits. The kind is
+             * @ref kSixCodePoints, @ref kFourCodePoints or `0` when the first
+             * code point takes 4 bytes.
+             */
+            uint16_t decodings[4096];
+
+            /**
+             * The shuffles that move the bytes of 6 code points of 1 or 2
+             * bytes to 16-bit lanes, then the ones that move the bytes of 4
+             * code points of 1 to 3 bytes to 32-bit lanes, from the last byte
+             * to the first one.
+             */
+            uint8_t decodingShuffles[145][16];
+
+            /**
+             * For every mask of the 16-bit lanes that hold ASCII characters,
+             * the shuffles that drop their upper bytes.
+             */
+            uint8_t twoByteShuffles[256][16];
+
+            /**
+             * The amount of bytes kept by every shuffle in @ref
+             * twoByteShuffles.
+             */
+            uint8_t twoByteSizes[256];
+
+            /**
+             * For every mask of the 32-bit lanes that take at least 2 bytes,
+             * joined with the mask of the ones that take 3 bytes in the upper
+             * bits, the shuffles that drop the unused upper bytes.
+             */
+            uint8_t threeByteShuffles[256][16];
+
+            /**
+             * The amount of bytes kept by every shuffle in @ref
+             * threeByteShuffles.
+             */
+            uint8_t threeByteSizes[256];
+        };
+
+        static constexpr auto kSixCodePoints = 1U;
+        static constexpr auto kFourCodePoints = 2U;
+
+        /**
+         * The amount of elements past the converted ones that the vectorized
+         * kernels might overwrite, which are reserved with the output.
+         */
+        static constexpr auto kSlackCount = INT64_C(16);
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        /**
+         * Converts valid UTF-8 bytes to enough memory after the end of a
+         * list.
+         */
+        template<typename Unit>
+        static auto decode(MemoryAllocator memoryAllocator, ArrayListView<char8_t> bytes, ArrayList<Unit> *units) -> Status;
+
+        /**
+         * Validates units and converts them to enough memory after the end of
+         * a list.
+         */
+        template<typename Unit>
+        static auto encode(MemoryAllocator memoryAllocator, ArrayListView<Unit> units, ArrayList<char8_t> *bytes, int64_t *invalidIndex) -> Status;
+
+        static auto countUtf16UnitsPortably(uint8_t *bytes, int64_t size) -> int64_t;
+        static auto countUtf16UnitsWithSse41(uint8_t *bytes, int64_t size) -> int64_t;
+
+        template<typename Unit>
+        static auto measurePortably(Unit *units, int64_t count, int64_t *invalidIndex) -> int64_t;
+        template<typename Unit>
+        static auto measureWithSse41(Unit *units, int64_t count, int64_t *invalidIndex) -> int64_t;
+        template<typename Unit>
+        static auto decodePortably(uint8_t *bytes, int64_t size, Unit *units) -> int64_t;
+        template<typename Unit>
+        static auto decodeWithSse41(uint8_t *bytes, int64_t size, Unit *units) -> int64_t;
+        template<typename Unit>
+        static auto encodePortably(Unit *units, int64_t count, uint8_t *bytes) -> int64_t;
+        template<typename Unit>
+        static auto encodeWithSse41(Unit *units, int64_t count, uint8_t *bytes) -> int64_t;
+
+        /**
+         * Adds the size of the UTF-8 encoding of the code point at an index
+         * and moves the index past it.
+         *
+         * @return Whether the code point was valid.
+         */
+        template<typename Unit>
+        static auto measureOne(Unit *units, int64_t count, int64_t *index, int64_t *size) -> bool;
+
+        /**
+         * Converts the valid UTF-8 code point at an offset and moves the
+         * offset and the count past it.
+         */
+        template<typename Unit>
+        static auto decodeOne(uint8_t *bytes, int64_t *offset, Unit *units, int64_t *count) -> void;
+
+        /**
+         * Converts the valid code point at an index and moves the index and
+         * the size past it.
+         */
+        template<typename Unit>
+        static auto encodeOne(Unit *units, int64_t *index, uint8_t *bytes, int64_t *size) -> void;
+
+        static auto getShuffles() -> Shuffles *;
+
+        static constexpr auto makeShuffles() -> Shuffles {
+            Shuffles shuffles = {};
+            for (auto mask = 0; mask != 4096; mask++) {
+                int ends[12] = {};
+                auto count = 0;
+                for (auto i = 0; i != 12; i++) {
+                    if ((mask & (1 << i)) != 0) {
+                        ends[count] = i;
+                        count++;
+                    }
+                }
+                int sizes[12] = {};
+                auto maxSize = 0;
+                auto maxSizeOf4 = 0;
+                for (auto i = 0; i != count; i++) {
+                    sizes[i] = ends[i] - (i == 0 ? -1 : ends[i - 1]);
+                    maxSize = i < 6 && sizes[i] > maxSize ? sizes[i] : maxSize;
+                    maxSizeOf4 = i < 4 && sizes[i] > maxSizeOf4 ? sizes[i] : maxSizeOf4;
+                }
+                if (count >= 6 && maxSize <= 2) {
+                    auto index = 0;
+                    for (auto i = 0; i != 6; i++) {
+                        index |= (sizes[i] - 1) << i;
+                    }
+                    for (auto i = 0; i != 6; i++) {
+                        shuffles.decodingShuffles[index][2 * i] = (uint8_t)ends[i];
+                        shuffles.decodingShuffles[index][2 * i + 1] = sizes[i] == 2 ? (uint8_t)(ends[i] - 1) : 0x80;
+                    }
+                    for (auto i = 12; i != 16; i++) {
+                        shuffles.decodingShuffles[index][i] = 0x80;
+                    }
+                    shuffles.decodings[mask] = (uint16_t)((kSixCodePoints << 12U) | (unsigned)((ends[5] + 1) << 8) | (unsigned)index);
+                } else if (count >= 4 && maxSizeOf4 <= 3) {
+                    auto index = 0;
+                    for (auto i = 3; i != -1; i--) {
+                        index = 3 * index + sizes[i] - 1;
+                    }
+                    index += 64;
+                    for (auto i = 0; i != 4; i++) {
+                        for (auto j = 0; j != 4; j++) {
+                            shuffles.decodingShuffles[index][4 * i + j] = j < sizes[i] ? (uint8_t)(ends[i] - j) : 0x80;
+                        }
+                    }
+                    shuffles.decodings[mask] = (uint16_t)((kFourCodePoints << 12U) | (unsigned)((ends[3] + 1) << 8) | (unsigned)index);
+                }
+            }
+            for (auto mask = 0; mask != 256; mask++) {
+                auto byteIndex = 0;
+                for (auto lane = 0; lane != 8; lane++) {
+                    shuffles.twoByteShuffles[mask][byteIndex] = (uint8_t)(2 * lane);
+                    byteIndex++;
+                    if ((mask & (1 << lane)) == 0) {
+                        shuffles.twoByteShuffles[mask][byteIndex] = (uint8_t)(2 * lane + 1);
+                        byteIndex++;
+                    }
+                }
+                shuffles.twoByteSizes[mask] = (uint8_t)byteIndex;
+                for (; byteIndex != 16; byteIndex++) {
+                    shuffles.twoByteShuffles[mask][byteIndex] = 0x80;
+                }
+            }
+            for (auto mask = 0; mask != 256; mask++) {
+                auto byteIndex = 0;
+                for (auto lane = 0; lane != 4; lane++) {
+                    auto size = 1 + ((mask >> lane) & 1) + ((mask >> (lane + 4)) & 1);
+                    for (auto i = 0; i != size; i++) {
+                        shuffles.threeByteShuffles[mask][byteIndex] = (uint8_t)(4 * lane + i);
+                        byteIndex++;
+                    }
+                }
+                shuffles.threeByteSizes[mask] = (uint8_t)byteIndex;
+                for (; byteIndex != 16; byteIndex++) {
+                    shuffles.threeByteShuffles[mask][byteIndex] = 0x80;
+                }
+            }
+            return shuffles;
+        }
+    };
+}
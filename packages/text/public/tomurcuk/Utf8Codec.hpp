@@ -0,0 +1,116 @@
+#pragma once
+
+#include <stdint.h>
+#include <tomurcuk/ArrayListView.hpp>
+
+namespace tomurcuk {
+    /**
+     * Codec that queries and writes the UTF-8 encodings of code points.
+     *
+     * Validation has a portable implementation and an AVX2 one, which is the
+     * lookup algorithm of Keiser and Lemire: the high and low halves of every
+     * byte and the high half of the byte after it select bit sets of the
+     * errors they might take part in, and a pair of bytes is invalid when the
+     * three sets share a bit. Counting code points and testing for ASCII have
+     * AVX2 implementations too. The fastest ones the processor supports are
+     * selected on the first use.
+     */
+    class Utf8Codec {
+    public:
+        /**
+         * The most bytes a code point takes.
+         */
+        static constexpr auto kMaxSize = INT64_C(4);
+
+        /**
+         * The greatest code point.
+         */
+        static constexpr auto kMaxCodePoint = U'\U0010FFFF';
+
+        /**
+         * Finds the first invalid sequence in some bytes.
+         *
+         * A sequence is invalid if it is not the shortest encoding of a code
+         * point that is not a surrogate, which includes a continuation byte
+         * without a leading byte and a sequence that is cut by the end of the
+         * bytes.
+         *
+         * @param[in] bytes The validated bytes.
+         * @return The index of the first byte of the first invalid sequence if
+         * there is one. Otherwise, `-1`.
+         */
+        static auto findInvalidIndex(ArrayListView<char8_t> bytes) -> int64_t;
+
+        /**
+         * Counts the code points in valid bytes.
+         *
+         * @param[in] bytes The valid bytes.
+         * @return The amount of code points the bytes encode.
+         */
+        static auto countCodePoints(ArrayListView<char8_t> bytes) -> int64_t;
+
+        /**
+         * Tests whether all bytes are ASCII characters.
+         *
+         * @param[in] bytes The tested bytes.
+         * @return Whether the bytes are less than `0x80`.
+         */
+        static auto isAscii(ArrayListView<char8_t> bytes) -> bool;
+
+        /**
+         * Tests whether a code point can be encoded.
+         *
+         * @param[in] codePoint The tested code point.
+         * @return Whether the code point is at most @ref kMaxCodePoint and not
+         * a surrogate.
+         */
+        static auto isEncodable(char32_t codePoint) -> bool;
+
+        /**
+         * Provides the amount of bytes that encode a code point.
+         *
+         * @param[in] codePoint The encodable code point.
+         * @return The amount of bytes, from `1` to @ref kMaxSize.
+         */
+        static auto getSize(char32_t codePoint) -> int64_t;
+
+        /**
+         * Writes the encoding of a code point.
+         *
+         * @param[out] bytes The pointer to at least @ref getSize bytes.
+         * @param[in] codePoint The encodable code point.
+         * @return The amount of written bytes.
+         */
+        static auto encode(char8_t *bytes, char32_t codePoint) -> int64_t;
+
+    private:
+        /**
+         * Implementations of the operations that were selected together.
+         */
+        struct Kernels {
+            auto (*findInvalidIndex)(uint8_t *bytes, int64_t size) -> int64_t;
+            auto (*countCodePoints)(uint8_t *bytes, int64_t size) -> int64_t;
+            auto (*isAscii)(uint8_t *bytes, int64_t size) -> bool;
+        };
+
+        static auto getKernels() -> Kernels;
+        static auto selectKernels() -> Kernels;
+
+        static auto findInvalidIndexPortably(uint8_t *bytes, int64_t size) -> int64_t;
+        static auto countCodePointsPortably(uint8_t *bytes, int64_t size) -> int64_t;
+        static auto isAsciiPortably(uint8_t *bytes, int64_t size) -> bool;
+        static auto findInvalidIndexWithAvx2(uint8_t *bytes, int64_t size) -> int64_t;
+        static auto countCodePointsWithAvx2(uint8_t *bytes, int64_t size) -> int64_t;
+        static auto isAsciiWithAvx2(uint8_t *bytes, int64_t size) -> bool;
+
+        /**
+         * Finds the first invalid sequence after an offset that begins a code
+         * point, which the vectorized kernels use to locate an error they
+         * found.
+         *
+         * @return The index of the first byte of the first invalid sequence if
+         * there is one. Otherwise, `-1`.
+         */
+        static auto findInvalidIndexFrom(uint8_t *bytes, int64_t size, int64_t offset) -> int64_t;
+    };
+}